@@ -20,32 +20,69 @@ using Enumeration::StreamCipherConvert;
 const __m128i ACS::BLEND_MASK = _mm_set_epi32(0x80000000UL, 0x80800000UL, 0x80800000UL, 0x80808000UL);
 const __m128i ACS::SHIFT_MASK = { 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3 };
 
-class ACS::AcsState
+class ACS::AcsKey final : public KeyContext
 {
 public:
 
 	std::vector<__m128i> RoundKeys;
+	SecureVector<byte> MacKey;
+	std::string CipherName;
+	ushort Rounds;
+	KmacModes Authenticator;
+	ShakeModes Mode;
+
+	AcsKey()
+		:
+		RoundKeys(0),
+		MacKey(0),
+		CipherName(""),
+		Rounds(0),
+		Authenticator(KmacModes::None),
+		Mode(ShakeModes::None)
+	{
+	}
+
+	~AcsKey() override
+	{
+		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(__m128i));
+		MemoryTools::Clear(MacKey, 0, MacKey.size());
+		Rounds = 0;
+		Authenticator = KmacModes::None;
+		Mode = ShakeModes::None;
+	}
+
+	const std::string Name() override
+	{
+		return CipherName;
+	}
+};
+
+class ACS::AcsState
+{
+public:
+
+	std::shared_ptr<const AcsKey> Key;
 	SecureVector<byte> Associated;
 	SecureVector<byte> Custom;
-	SecureVector<byte> MacKey;
 	SecureVector<byte> MacTag;
 	SecureVector<byte> Name;
 	std::vector<SymmetricKeySize> LegalKeySizes;
 	std::vector<byte> Nonce;
+	std::vector<byte> Origin;
 	ulong Counter;
-	ushort Rounds;
+	ulong Offset;
 	KmacModes Authenticator;
 	ShakeModes Mode;
 	bool IsAuthenticated;
 	bool IsEncryption;
 	bool Initialized;
+	bool IsShared;
 
 	AcsState(bool Authenticate)
 		:
-		RoundKeys(0),
+		Key(nullptr),
 		Associated(0),
 		Custom(0),
-		MacKey(0),
 		MacTag(0),
 		Name(0),
 		LegalKeySizes{
@@ -53,22 +90,47 @@ public:
 			SymmetricKeySize(IK512_SIZE, BLOCK_SIZE, INFO_SIZE),
 			SymmetricKeySize(IK1024_SIZE, BLOCK_SIZE, INFO_SIZE) },
 		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
 		Counter(0),
-		Rounds(0),
-		Authenticator(Authenticator),
+		Offset(0),
+		Authenticator(KmacModes::None),
 		Mode(ShakeModes::None),
 		IsAuthenticated(Authenticate),
 		IsEncryption(false),
-		Initialized(false)
+		Initialized(false),
+		IsShared(false)
+	{
+	}
+
+	AcsState(const std::shared_ptr<const AcsKey> &Context)
+		:
+		Key(Context),
+		Associated(0),
+		Custom(0),
+		MacTag(0),
+		Name(0),
+		LegalKeySizes{
+			SymmetricKeySize(IK256_SIZE, BLOCK_SIZE, INFO_SIZE),
+			SymmetricKeySize(IK512_SIZE, BLOCK_SIZE, INFO_SIZE),
+			SymmetricKeySize(IK1024_SIZE, BLOCK_SIZE, INFO_SIZE) },
+		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
+		Counter(0),
+		Offset(0),
+		Authenticator(Context->Authenticator),
+		Mode(Context->Mode),
+		IsAuthenticated(Context->Authenticator != KmacModes::None),
+		IsEncryption(false),
+		Initialized(false),
+		IsShared(true)
 	{
 	}
 
 	AcsState(SecureVector<byte> &State)
 		:
-		RoundKeys(0),
+		Key(nullptr),
 		Associated(0),
 		Custom(0),
-		MacKey(0),
 		MacTag(0),
 		Name(0),
 		LegalKeySizes{
@@ -76,29 +138,31 @@ public:
 			SymmetricKeySize(IK512_SIZE, BLOCK_SIZE, INFO_SIZE),
 			SymmetricKeySize(IK1024_SIZE, BLOCK_SIZE, INFO_SIZE) },
 		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
 		Counter(0),
-		Rounds(0),
+		Offset(0),
 		Authenticator(KmacModes::None),
 		Mode(ShakeModes::None),
 		IsAuthenticated(false),
 		IsEncryption(false),
-		Initialized(false)
+		Initialized(false),
+		IsShared(false)
 	{
 		DeSerialize(State);
 	}
 
 	~AcsState()
 	{
-		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(__m128i));
+		Key.reset();
 		MemoryTools::Clear(Custom, 0, Custom.size());
-		MemoryTools::Clear(MacKey, 0, MacKey.size());
 		MemoryTools::Clear(MacTag, 0, MacTag.size());
 		MemoryTools::Clear(Name, 0, Name.size());
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
+		MemoryTools::Clear(Origin, 0, Origin.size());
 		LegalKeySizes.clear();
 
 		Counter = 0;
-		Rounds = 0;
+		Offset = 0;
 		Authenticator = KmacModes::None;
 		Mode = ShakeModes::None;
 		IsAuthenticated = false;
@@ -108,6 +172,7 @@ public:
 
 	void DeSerialize(SecureVector<byte> &SecureState)
 	{
+		std::shared_ptr<AcsKey> tmpk(new AcsKey());
 		size_t soff;
 		ushort vlen;
 
@@ -115,9 +180,9 @@ public:
 		vlen = 0;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
-		RoundKeys.resize(vlen / sizeof(__m128i));
+		tmpk->RoundKeys.resize(vlen / sizeof(__m128i));
 		soff += sizeof(ushort);
-		MemoryTools::Copy(SecureState, soff, RoundKeys, 0, vlen);
+		MemoryTools::Copy(SecureState, soff, tmpk->RoundKeys, 0, vlen);
 		soff += vlen;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
@@ -133,9 +198,9 @@ public:
 		soff += vlen;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
-		MacKey.resize(vlen);
+		tmpk->MacKey.resize(vlen);
 		soff += sizeof(ushort);
-		MemoryTools::Copy(SecureState, soff, MacKey, 0, MacKey.size());
+		MemoryTools::Copy(SecureState, soff, tmpk->MacKey, 0, tmpk->MacKey.size());
 		soff += vlen;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
@@ -158,7 +223,7 @@ public:
 
 		MemoryTools::CopyToObject(SecureState, soff, &Counter, sizeof(ulong));
 		soff += sizeof(ulong);
-		MemoryTools::CopyToObject(SecureState, soff, &Rounds, sizeof(ushort));
+		MemoryTools::CopyToObject(SecureState, soff, &tmpk->Rounds, sizeof(ushort));
 		soff += sizeof(ushort);
 
 		MemoryTools::CopyToObject(SecureState, soff, &Authenticator, sizeof(KmacModes));
@@ -171,37 +236,60 @@ public:
 		MemoryTools::CopyToObject(SecureState, soff, &IsEncryption, sizeof(bool));
 		soff += sizeof(bool);
 		MemoryTools::CopyToObject(SecureState, soff, &Initialized, sizeof(bool));
+		soff += sizeof(bool);
+
+		// the seek origin and offset were appended to the state format, a state serialized without them can not be restored
+		if (SecureState.size() < soff + sizeof(ushort) + BLOCK_SIZE + sizeof(ulong))
+		{
+			throw CryptoSymmetricException(std::string("ACS"), std::string("Constructor"), std::string("The State array was serialized by an earlier version and can not be restored!"), ErrorCodes::InvalidState);
+		}
+
+		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
+		Origin.resize(vlen);
+		soff += sizeof(ushort);
+		MemoryTools::Copy(SecureState, soff, Origin, 0, Origin.size());
+		soff += vlen;
+		MemoryTools::CopyToObject(SecureState, soff, &Offset, sizeof(ulong));
+
+		// the restored key schedule is a new context, owned by this instance until it is shared
+		tmpk->Authenticator = Authenticator;
+		tmpk->Mode = Mode;
+		tmpk->CipherName = StreamCipherConvert::ToName(StreamCipherConvert::FromDescription(StreamCiphers::RCS, 
+			IsAuthenticated ? static_cast<StreamAuthenticators>(Authenticator) : StreamAuthenticators::None));
+		Key = tmpk;
 	}
 
 	void Reset()
 	{
-		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(__m128i));
+		Key.reset();
 		MemoryTools::Clear(Associated, 0, Associated.size());
 		MemoryTools::Clear(Custom, 0, Custom.size());
-		MemoryTools::Clear(MacKey, 0, MacKey.size());
 		MemoryTools::Clear(MacTag, 0, MacTag.size());
 		MemoryTools::Clear(Name, 0, Name.size());
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
+		MemoryTools::Clear(Origin, 0, Origin.size());
 		Counter = 0;
-		Rounds = 0;
+		Offset = 0;
 		IsEncryption = false;
 		Initialized = false;
+		IsShared = false;
 	}
 
 	SecureVector<byte> Serialize()
 	{
-		const size_t STALEN = (RoundKeys.size() * sizeof(__m128i)) + Associated.size() + Custom.size() + MacKey.size() + MacTag.size() +
-			Name.size() + Nonce.size() + sizeof(ulong) + sizeof(ushort) + sizeof(KmacModes) + sizeof(ShakeModes) + (3 * sizeof(bool)) + (7 * sizeof(ushort));
+		const size_t STALEN = (Key->RoundKeys.size() * sizeof(__m128i)) + Associated.size() + Custom.size() + Key->MacKey.size() + MacTag.size() +
+			Name.size() + Nonce.size() + sizeof(ulong) + sizeof(ushort) + sizeof(KmacModes) + sizeof(ShakeModes) + (3 * sizeof(bool)) + (7 * sizeof(ushort)) +
+			Origin.size() + sizeof(Offset) + sizeof(ushort);
 
 		size_t soff;
 		ushort vlen;
 		SecureVector<byte> state(STALEN);
 
 		soff = 0;
-		vlen = static_cast<ushort>(RoundKeys.size() * sizeof(__m128i));
+		vlen = static_cast<ushort>(Key->RoundKeys.size() * sizeof(__m128i));
 		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
 		soff += sizeof(ushort);
-		MemoryTools::Copy(RoundKeys, 0, state, soff, static_cast<size_t>(vlen));
+		MemoryTools::Copy(Key->RoundKeys, 0, state, soff, static_cast<size_t>(vlen));
 		soff += vlen;
 
 		vlen = static_cast<ushort>(Associated.size());
@@ -216,11 +304,11 @@ public:
 		MemoryTools::Copy(Custom, 0, state, soff, Custom.size());
 		soff += Custom.size();
 
-		vlen = static_cast<ushort>(MacKey.size());
+		vlen = static_cast<ushort>(Key->MacKey.size());
 		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
 		soff += sizeof(ushort);
-		MemoryTools::Copy(MacKey, 0, state, soff, MacKey.size());
-		soff += MacKey.size();
+		MemoryTools::Copy(Key->MacKey, 0, state, soff, Key->MacKey.size());
+		soff += Key->MacKey.size();
 
 		vlen = static_cast<ushort>(MacTag.size());
 		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
@@ -242,7 +330,7 @@ public:
 
 		MemoryTools::CopyFromObject(&Counter, state, soff, sizeof(ulong));
 		soff += sizeof(ulong);
-		MemoryTools::CopyFromObject(&Rounds, state, soff, sizeof(ushort));
+		MemoryTools::CopyFromObject(&Key->Rounds, state, soff, sizeof(ushort));
 		soff += sizeof(ushort);
 
 		MemoryTools::CopyFromObject(&Authenticator, state, soff, sizeof(KmacModes));
@@ -255,6 +343,14 @@ public:
 		MemoryTools::CopyFromObject(&IsEncryption, state, soff, sizeof(bool));
 		soff += sizeof(bool);
 		MemoryTools::CopyFromObject(&Initialized, state, soff, sizeof(bool));
+		soff += sizeof(bool);
+
+		vlen = static_cast<ushort>(Origin.size());
+		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
+		soff += sizeof(ushort);
+		MemoryTools::Copy(Origin, 0, state, soff, Origin.size());
+		soff += Origin.size();
+		MemoryTools::CopyFromObject(&Offset, state, soff, sizeof(ulong));
 
 		return state;
 	}
@@ -289,11 +385,25 @@ ACS::ACS(SecureVector<byte> &State)
 	if (m_acsState->Authenticator != KmacModes::None)
 	{
 		// initialize the mac
-		SymmetricKey kpm(m_acsState->MacKey);
+		SymmetricKey kpm(m_acsState->Key->MacKey);
 		m_macAuthenticator->Initialize(kpm);
 	}
 }
 
+ACS::ACS(const std::shared_ptr<KeyContext> &Context)
+	:
+	m_acsState(std::dynamic_pointer_cast<const AcsKey>(Context) != nullptr ? new AcsState(std::dynamic_pointer_cast<const AcsKey>(Context)) :
+		throw CryptoSymmetricException(std::string("ACS"), std::string("Constructor"), std::string("The key context is null or was not created by ACS!"), ErrorCodes::InvalidParam)),
+	m_macAuthenticator(m_acsState->Authenticator == KmacModes::None ?
+		nullptr :
+		new KMAC(m_acsState->Authenticator)),
+	m_parallelProfile(BLOCK_SIZE, true, STATE_PRECACHED, true)
+{
+#if !defined(CEX_AVX_INTRINSICS)
+	throw CryptoSymmetricException(StreamCipherConvert::ToName(StreamCiphers::RCS), std::string("Constructor"), std::string("AVX is not supported on this system!"), ErrorCodes::NotSupported);
+#endif
+}
+
 ACS::~ACS()
 {
 	if (m_macAuthenticator != nullptr)
@@ -304,6 +414,16 @@ ACS::~ACS()
 
 //~~~Accessors~~~//
 
+const std::shared_ptr<KeyContext> ACS::Context()
+{
+	if (m_acsState->Key == nullptr)
+	{
+		throw CryptoSymmetricException(std::string("ACS"), std::string("Context"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	return std::const_pointer_cast<AcsKey>(m_acsState->Key);
+}
+
 const StreamCiphers ACS::Enumeral()
 {
 	StreamAuthenticators auth;
@@ -403,7 +523,18 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
 	size_t i;
 
-	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		if (m_acsState->Key == nullptr)
+		{
+			throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
+		}
+	}
+	else if (m_acsState->IsShared)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("An instance using a shared key context can not be re-keyed!"), ErrorCodes::IllegalOperation);
+	}
+	else if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
 	{
 		throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes in length."), ErrorCodes::InvalidKey);
 	}
@@ -414,6 +545,9 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -424,17 +558,43 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		}
 	}
 
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		// a nonce-only key re-uses the key schedule, only the nonce, counter, and mac state are reset
+		MemoryTools::Clear(m_acsState->Associated, 0, m_acsState->Associated.size());
+		m_acsState->Associated.resize(0);
+		m_acsState->Counter = 1;
+		MemoryTools::Copy(Parameters.IV(), 0, m_acsState->Nonce, 0, BLOCK_SIZE);
+		MemoryTools::Copy(Parameters.IV(), 0, m_acsState->Origin, 0, BLOCK_SIZE);
+		m_acsState->Offset = 0;
+
+		if (IsAuthenticator())
+		{
+			SymmetricKey kpm(m_acsState->Key->MacKey);
+			m_macAuthenticator->Initialize(kpm);
+			m_acsState->MacTag.resize(m_macAuthenticator->TagSize());
+		}
+
+		m_acsState->IsEncryption = Encryption;
+		m_acsState->Initialized = true;
+
+		return;
+	}
+
 	// reset for a new key
-	if (IsInitialized() == true)
+	if (IsInitialized() == true || m_acsState->Key != nullptr)
 	{
 		Reset();
 	}
 
+	// the key schedule is built in a new context, a context shared by other instances is never modified
+	std::shared_ptr<AcsKey> tmpk(new AcsKey());
+
 	// set the initial processed-bytes count to one
 	m_acsState->Counter = 1;
 
 	// set the number of rounds -v1.0d
-	m_acsState->Rounds = (Parameters.KeySizes().KeySize() == IK256_SIZE) ?
+	tmpk->Rounds = (Parameters.KeySizes().KeySize() == IK256_SIZE) ?
 		RK256_COUNT :
 		(Parameters.KeySizes().KeySize() == IK512_SIZE) ?
 			RK512_COUNT :
@@ -449,6 +609,7 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 			KmacModes::KMAC256;
 
 		m_macAuthenticator.reset(new KMAC(m_acsState->Authenticator));
+		tmpk->Authenticator = m_acsState->Authenticator;
 	}
 
 	// store the customization string -v1.0d
@@ -473,6 +634,8 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	// copy the nonce to state
 	MemoryTools::Copy(Parameters.IV(), 0, m_acsState->Nonce, 0, BLOCK_SIZE);
+	// store the initial counter, Seek positions are relative to it
+	MemoryTools::Copy(Parameters.IV(), 0, m_acsState->Origin, 0, BLOCK_SIZE);
 
 	// cipher key size determines key expansion function and Mac generator type; 256 or 512-bit
 	m_acsState->Mode = (Parameters.KeySizes().KeySize() == IK512_SIZE) ?
@@ -482,13 +645,14 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 			ShakeModes::SHAKE1024;
 
 	// initialize the generator
+	tmpk->Mode = m_acsState->Mode;
 	Kdf::SHAKE gen(m_acsState->Mode);
 	// key with cSHAKE(k,c,n)
 	gen.Initialize(Parameters.SecureKey(), m_acsState->Custom, m_acsState->Name);
 
 	// calculate the size of the round-key array
-	const size_t RNKLEN = static_cast<size_t>(BLOCK_SIZE / sizeof(__m128i)) * static_cast<size_t>(m_acsState->Rounds + 1UL);
-	m_acsState->RoundKeys.resize(RNKLEN);
+	const size_t RNKLEN = static_cast<size_t>(BLOCK_SIZE / sizeof(__m128i)) * static_cast<size_t>(tmpk->Rounds + 1UL);
+	tmpk->RoundKeys.resize(RNKLEN);
 	SecureVector<byte> tmpr(RNKLEN * sizeof(__m128i));
 	// generate the cipher round-keys
 	gen.Generate(tmpr);
@@ -496,7 +660,7 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 	// copy p-rand bytes to round keys
 	for (i = 0; i < RNKLEN; ++i)
 	{
-		m_acsState->RoundKeys[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tmpr[i * sizeof(__m128i)]));
+		tmpk->RoundKeys[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tmpr[i * sizeof(__m128i)]));
 	}
 
 	MemoryTools::Clear(tmpr, 0, tmpr.size());
@@ -511,11 +675,13 @@ void ACS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		SymmetricKey kpm(mack);
 		m_macAuthenticator->Initialize(kpm);
 		// store the key
-		m_acsState->MacKey.resize(mack.size());
-		SecureMove(mack, 0, m_acsState->MacKey, 0, mack.size());
+		tmpk->MacKey.resize(mack.size());
+		SecureMove(mack, 0, tmpk->MacKey, 0, mack.size());
 		m_acsState->MacTag.resize(m_macAuthenticator->TagSize());
 	}
 
+	tmpk->CipherName = Name();
+	m_acsState->Key = tmpk;
 	m_acsState->IsEncryption = Encryption;
 	m_acsState->Initialized = true;
 }
@@ -530,6 +696,22 @@ void ACS::ParallelMaxDegree(size_t Degree)
 	m_parallelProfile.SetMaxDegree(Degree);
 }
 
+void ACS::Seek(ulong Position)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Seek"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (IsAuthenticator() == true)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Seek"), std::string("The MAC is computed over the whole message; an authenticated cipher can not seek!"), ErrorCodes::IllegalOperation);
+	}
+
+	// counter = initial counter + block index
+	IntegerTools::LeIncrease8(m_acsState->Origin, m_acsState->Nonce, static_cast<ulong>(Position / BLOCK_SIZE));
+	m_acsState->Offset = Position % BLOCK_SIZE;
+}
+
 void ACS::SetAssociatedData(const std::vector<byte> &Input, size_t Offset, size_t Length)
 {
 	if (IsInitialized() == false)
@@ -551,55 +733,22 @@ void ACS::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the block-size!");
 
-	if (IsEncryption() == true)
+	if (IsEncryption() == true && IsAuthenticator() == true && Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
 	{
-		if (IsAuthenticator() == true)
-		{
-			if (Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
-			{
-				throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
-			}
-
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(m_acsState->Nonce, 0, BLOCK_SIZE);
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Output, OutOffset, Length);
-			// update the processed bytes counter
-			m_acsState->Counter += Length;
-			// finalize the mac and copy the tag to the end of the output stream
-			Finalize(m_acsState, m_macAuthenticator);
-			MemoryTools::Copy(m_acsState->MacTag, 0, Output, OutOffset + Length, m_acsState->MacTag.size());
-		}
-		else
-		{
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-		}
+		throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
 	}
-	else
-	{
-		if (IsAuthenticator())
-		{
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(m_acsState->Nonce, 0, BLOCK_SIZE);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Input, InOffset, Length);
-			// update the processed bytes counter
-			m_acsState->Counter += Length;
-			// finalize the mac and verify
-			Finalize(m_acsState, m_macAuthenticator);
 
-			if (!IntegerTools::Compare(Input, InOffset + Length, m_acsState->MacTag, 0, m_acsState->MacTag.size()))
-			{
-				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-			}
-		}
+	ProcessStream(Input, InOffset, Output, OutOffset, Length);
+}
 
-		// decrypt the stream
-		Process(Input, InOffset, Output, OutOffset, Length);
-	}
+void ACS::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	const size_t INPLEN = (IsEncryption() == false && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+	const size_t OTPLEN = (IsEncryption() == true && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+
+	ProcessStream(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -629,7 +778,7 @@ void ACS::Finalize(std::unique_ptr<AcsState> &State, std::unique_ptr<IMac> &Auth
 	Authenticator->Finalize(State->MacTag, 0);
 }
 
-void ACS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
+void ACS::Generate(const Span<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
 {
 	size_t bctr;
 
@@ -643,97 +792,45 @@ void ACS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 		const size_t PBKALN = Length - (Length % AVX512BLK);
 		std::vector<byte> tmpc(AVX512BLK);
 
-		// stagger counters and process 8 blocks with avx512
+		// stagger counters and process 16 blocks with avx512
 		while (bctr != PBKALN)
 		{
-			MemoryTools::Copy(Counter, 0, tmpc, 0, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 32, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 64, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 96, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 128, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 160, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 192, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 224, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 256, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 288, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 320, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 352, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 384, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 416, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 448, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 480, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
+			StageCounters(Counter, tmpc, 16);
 			Transform4096(tmpc, 0, Output, OutOffset + bctr);
 			bctr += AVX512BLK;
 		}
 	}
 
-#elif defined(CEX_HAS_AVX2)
+#endif
+
+#if defined(CEX_HAS_AVX)
 
+	// the remainder of a wider kernel cascades to the narrower kernels
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
-	if (Length >= AVX2BLK)
+	if (Length - bctr >= AVX2BLK)
 	{
-		const size_t PBKALN = Length - (Length % AVX2BLK);
+		const size_t PBKALN = Length - ((Length - bctr) % AVX2BLK);
 		std::vector<byte> tmpc(AVX2BLK);
 
-		// stagger counters and process 8 blocks with avx2
+		// stagger counters and process 8 blocks
 		while (bctr != PBKALN)
 		{
-			MemoryTools::Copy(Counter, 0, tmpc, 0, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 32, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 64, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 96, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 128, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 160, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 192, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 224, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
+			StageCounters(Counter, tmpc, 8);
 			Transform2048(tmpc, 0, Output, OutOffset + bctr);
 			bctr += AVX2BLK;
 		}
 	}
 
-#elif defined(CEX_HAS_AVX)
-
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
-	if (Length >= AVXBLK)
+	if (Length - bctr >= AVXBLK)
 	{
-		const size_t PBKALN = Length - (Length % AVXBLK);
+		const size_t PBKALN = Length - ((Length - bctr) % AVXBLK);
 		std::vector<byte> tmpc(AVXBLK);
 
-		// 4 blocks with avx
+		// 4 blocks
 		while (bctr != PBKALN)
 		{
-			MemoryTools::Copy(Counter, 0, tmpc, 0, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 32, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 64, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
-			MemoryTools::Copy(Counter, 0, tmpc, 96, BLOCK_SIZE);
-			IntegerTools::LeIncrement(Counter, 16);
+			StageCounters(Counter, tmpc, 4);
 			Transform1024(tmpc, 0, Output, OutOffset + bctr);
 			bctr += AVXBLK;
 		}
@@ -759,10 +856,39 @@ void ACS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 	}
 }
 
-void ACS::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void ACS::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	size_t i;
 
+	if (m_acsState->Offset != 0 && Length != 0)
+	{
+		// finish the partial block left by a Seek, then continue block aligned
+		const size_t BLKOFT = static_cast<size_t>(m_acsState->Offset);
+		const size_t PRTLEN = IntegerTools::Min(BLOCK_SIZE - BLKOFT, Length);
+		std::vector<byte> tmpc(m_acsState->Nonce);
+		std::vector<byte> otp(BLOCK_SIZE);
+
+		Generate(otp, 0, BLOCK_SIZE, tmpc);
+
+		for (i = 0; i < PRTLEN; ++i)
+		{
+			Output[OutOffset + i] = Input[InOffset + i] ^ otp[BLKOFT + i];
+		}
+
+		m_acsState->Offset += PRTLEN;
+
+		if (m_acsState->Offset == BLOCK_SIZE)
+		{
+			// the block is consumed, keep the incremented counter
+			MemoryTools::Copy(tmpc, 0, m_acsState->Nonce, 0, BLOCK_SIZE);
+			m_acsState->Offset = 0;
+		}
+
+		InOffset += PRTLEN;
+		OutOffset += PRTLEN;
+		Length -= PRTLEN;
+	}
+
 	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
 
 	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
@@ -788,7 +914,7 @@ void ACS::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<b
 	}
 }
 
-void ACS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void ACS::ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t OUTLEN = Output.size() - OutOffset < Length ? Output.size() - OutOffset : Length;
 	const size_t CNKLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
@@ -802,10 +928,21 @@ void ACS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 		// offset counter by chunk size / block size  
 		IntegerTools::LeIncrease8(m_acsState->Nonce, thdc, static_cast<uint>(CTRLEN * i));
 		const size_t STMPOS = i * CNKLEN;
-		// generate random at output offset
-		this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
-		// xor with input at offsets
-		MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+
+		if (Input.data() + InOffset != Output.data() + OutOffset)
+		{
+			// generate random at output offset
+			this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
+			// xor with input at offsets
+			MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+		}
+		else
+		{
+			// in-place; the key-stream is generated to a thread buffer
+			std::vector<byte> thdk(CNKLEN);
+			this->Generate(thdk, 0, CNKLEN, thdc);
+			MemoryTools::XOR(thdk, 0, Output, OutOffset + STMPOS, CNKLEN);
+		}
 
 		// store last counter
 		if (i == m_parallelProfile.ParallelMaxDegree() - 1)
@@ -825,36 +962,106 @@ void ACS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 		InOffset += ALNLEN;
 		OutOffset += ALNLEN;
 
-		Generate(Output, OutOffset, FNLLEN, m_acsState->Nonce);
+		std::vector<byte> fnlk(FNLLEN);
+
+		Generate(fnlk, 0, FNLLEN, m_acsState->Nonce);
 
 		for (size_t i = 0; i < FNLLEN; ++i)
 		{
-			Output[OutOffset + i] ^= Input[InOffset + i];
+			Output[OutOffset + i] = Input[InOffset + i] ^ fnlk[i];
 		}
 	}
 }
 
-void ACS::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void ACS::ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	// get block aligned
 	const size_t ALNLEN = Length - (Length % BLOCK_SIZE);
 	size_t i;
 
-	// generate random
-	Generate(Output, OutOffset, Length, m_acsState->Nonce);
+	if (Input.data() + InOffset != Output.data() + OutOffset)
+	{
+		// generate random
+		Generate(Output, OutOffset, Length, m_acsState->Nonce);
+
+		if (ALNLEN != 0)
+		{
+			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		}
 
-	if (ALNLEN != 0)
+		// get the remaining bytes
+		if (ALNLEN != Length)
+		{
+			for (i = ALNLEN; i < Length; ++i)
+			{
+				Output[i + OutOffset] ^= Input[i + InOffset];
+			}
+		}
+	}
+	else
 	{
-		MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		// in-place; the key-stream is generated to a temporary buffer in block-aligned segments
+		const size_t SEGLEN = 64 * BLOCK_SIZE;
+		std::vector<byte> tmpk(Length < SEGLEN ? Length : SEGLEN);
+		size_t plen;
+
+		i = 0;
+
+		while (i != Length)
+		{
+			plen = (Length - i < tmpk.size()) ? Length - i : tmpk.size();
+			Generate(tmpk, 0, plen, m_acsState->Nonce);
+			MemoryTools::XOR(tmpk, 0, Output, OutOffset + i, plen);
+			i += plen;
+		}
 	}
+}
 
-	// get the remaining bytes
-	if (ALNLEN != Length)
+void ACS::ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (IsEncryption() == true)
+	{
+		if (IsAuthenticator() == true)
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(m_acsState->Nonce, 0, BLOCK_SIZE);
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Output.data() + OutOffset, Length);
+			// update the processed bytes counter
+			m_acsState->Counter += Length;
+			// finalize the mac and copy the tag to the end of the output stream
+			Finalize(m_acsState, m_macAuthenticator);
+			MemoryTools::Copy(m_acsState->MacTag, 0, Output, OutOffset + Length, m_acsState->MacTag.size());
+		}
+		else
+		{
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+		}
+	}
+	else
 	{
-		for (i = ALNLEN; i < Length; ++i)
+		if (IsAuthenticator())
 		{
-			Output[i + OutOffset] ^= Input[i + InOffset];
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(m_acsState->Nonce, 0, BLOCK_SIZE);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Input.data() + InOffset, Length);
+			// update the processed bytes counter
+			m_acsState->Counter += Length;
+			// finalize the mac and verify
+			Finalize(m_acsState, m_macAuthenticator);
+
+			if (!IntegerTools::Compare(Input, InOffset + Length, m_acsState->MacTag, 0, m_acsState->MacTag.size()))
+			{
+				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+			}
 		}
+
+		// decrypt the stream
+		Process(Input, InOffset, Output, OutOffset, Length);
 	}
 }
 
@@ -872,15 +1079,43 @@ void ACS::Reset()
 
 SecureVector<byte> ACS::Serialize()
 {
+	if (m_acsState->Key == nullptr)
+	{
+		throw CryptoSymmetricException(std::string("ACS"), std::string("Serialize"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
 	SecureVector<byte> tmps = m_acsState->Serialize();
 
 	return tmps;
 }
 
-void ACS::Transform256(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void ACS::StageCounters(std::vector<byte> &Counter, std::vector<byte> &Output, size_t Count)
+{
+	// the low 16 bytes of the nonce are a little-endian 128-bit counter, the high 16 bytes are constant
+	const __m128i CTRONE = _mm_set_epi64x(0, 1);
+	const __m128i CTRZRO = _mm_setzero_si128();
+	const __m128i NCEHGH = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Counter.data() + 16));
+	__m128i ctr;
+	size_t i;
+
+	ctr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Counter.data()));
+
+	for (i = 0; i < Count; ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + (i * BLOCK_SIZE)), ctr);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + (i * BLOCK_SIZE) + 16), NCEHGH);
+		// add one to the low qword, and carry into the high qword when the low qword wraps to zero
+		ctr = _mm_add_epi64(ctr, CTRONE);
+		ctr = _mm_sub_epi64(ctr, _mm_slli_si128(_mm_cmpeq_epi64(ctr, CTRZRO), 8));
+	}
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Counter.data()), ctr);
+}
+
+void ACS::Transform256(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t HLFBLK = 16;
-	const size_t RNDCNT = m_acsState->RoundKeys.size() - 3;
+	const size_t RNDCNT = m_acsState->Key->RoundKeys.size() - 3;
 	size_t kctr;
 
 	__m128i blk1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
@@ -889,9 +1124,9 @@ void ACS::Transform256(const std::vector<byte> &Input, size_t InOffset, std::vec
 	__m128i tmp2;
 
 	kctr = 0;
-	blk1 = _mm_xor_si128(blk1, m_acsState->RoundKeys[kctr]);
+	blk1 = _mm_xor_si128(blk1, m_acsState->Key->RoundKeys[kctr]);
 	++kctr;
-	blk2 = _mm_xor_si128(blk2, m_acsState->RoundKeys[kctr]);
+	blk2 = _mm_xor_si128(blk2, m_acsState->Key->RoundKeys[kctr]);
 
 	while (kctr != RNDCNT)
 	{
@@ -903,10 +1138,10 @@ void ACS::Transform256(const std::vector<byte> &Input, size_t InOffset, std::vec
 		tmp2 = _mm_shuffle_epi8(tmp2, SHIFT_MASK);
 		++kctr;
 		// encrypt the first half-block
-		blk1 = _mm_aesenc_si128(tmp1, m_acsState->RoundKeys[kctr]);
+		blk1 = _mm_aesenc_si128(tmp1, m_acsState->Key->RoundKeys[kctr]);
 		++kctr;
 		// encrypt the second half-block
-		blk2 = _mm_aesenc_si128(tmp2, m_acsState->RoundKeys[kctr]);
+		blk2 = _mm_aesenc_si128(tmp2, m_acsState->Key->RoundKeys[kctr]);
 	}
 
 	// final block
@@ -915,30 +1150,320 @@ void ACS::Transform256(const std::vector<byte> &Input, size_t InOffset, std::vec
 	tmp1 = _mm_shuffle_epi8(tmp1, SHIFT_MASK);
 	tmp2 = _mm_shuffle_epi8(tmp2, SHIFT_MASK);
 	++kctr;
-	blk1 = _mm_aesenclast_si128(tmp1, m_acsState->RoundKeys[kctr]);
+	blk1 = _mm_aesenclast_si128(tmp1, m_acsState->Key->RoundKeys[kctr]);
 	++kctr;
-	blk2 = _mm_aesenclast_si128(tmp2, m_acsState->RoundKeys[kctr]);
+	blk2 = _mm_aesenclast_si128(tmp2, m_acsState->Key->RoundKeys[kctr]);
 
 	// store in output
 	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), blk1);
 	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + HLFBLK]), blk2);
 }
 
-void ACS::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void ACS::Transform1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
-	Transform256(Input, InOffset, Output, OutOffset);
-	Transform256(Input, InOffset + 32, Output, OutOffset + 32);
-	Transform256(Input, InOffset + 64, Output, OutOffset + 64);
-	Transform256(Input, InOffset + 96, Output, OutOffset + 96);
+	const size_t RNDCNT = m_acsState->Key->RoundKeys.size() - 3;
+	__m128i A0;
+	__m128i B0;
+	__m128i A1;
+	__m128i B1;
+	__m128i A2;
+	__m128i B2;
+	__m128i A3;
+	__m128i B3;
+	__m128i key1;
+	__m128i key2;
+	__m128i T;
+	size_t kctr;
+
+	A0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+	B0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+	A1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+	B1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+	A2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+	B2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+	A3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+	B3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+
+	kctr = 0;
+	key1 = m_acsState->Key->RoundKeys[kctr];
+	++kctr;
+	key2 = m_acsState->Key->RoundKeys[kctr];
+	A0 = _mm_xor_si128(A0, key1);
+	B0 = _mm_xor_si128(B0, key2);
+	A1 = _mm_xor_si128(A1, key1);
+	B1 = _mm_xor_si128(B1, key2);
+	A2 = _mm_xor_si128(A2, key1);
+	B2 = _mm_xor_si128(B2, key2);
+	A3 = _mm_xor_si128(A3, key1);
+	B3 = _mm_xor_si128(B3, key2);
+
+	// each round is applied to every block before the next round, the independent blocks fill the aes pipeline
+	while (kctr != RNDCNT)
+	{
+		// mix and shuffle the half-blocks
+		T = _mm_blendv_epi8(A0, B0, BLEND_MASK);
+		B0 = _mm_blendv_epi8(B0, A0, BLEND_MASK);
+		A0 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B0 = _mm_shuffle_epi8(B0, SHIFT_MASK);
+		T = _mm_blendv_epi8(A1, B1, BLEND_MASK);
+		B1 = _mm_blendv_epi8(B1, A1, BLEND_MASK);
+		A1 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B1 = _mm_shuffle_epi8(B1, SHIFT_MASK);
+		T = _mm_blendv_epi8(A2, B2, BLEND_MASK);
+		B2 = _mm_blendv_epi8(B2, A2, BLEND_MASK);
+		A2 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B2 = _mm_shuffle_epi8(B2, SHIFT_MASK);
+		T = _mm_blendv_epi8(A3, B3, BLEND_MASK);
+		B3 = _mm_blendv_epi8(B3, A3, BLEND_MASK);
+		A3 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B3 = _mm_shuffle_epi8(B3, SHIFT_MASK);
+		++kctr;
+		key1 = m_acsState->Key->RoundKeys[kctr];
+		++kctr;
+		key2 = m_acsState->Key->RoundKeys[kctr];
+		A0 = _mm_aesenc_si128(A0, key1);
+		B0 = _mm_aesenc_si128(B0, key2);
+		A1 = _mm_aesenc_si128(A1, key1);
+		B1 = _mm_aesenc_si128(B1, key2);
+		A2 = _mm_aesenc_si128(A2, key1);
+		B2 = _mm_aesenc_si128(B2, key2);
+		A3 = _mm_aesenc_si128(A3, key1);
+		B3 = _mm_aesenc_si128(B3, key2);
+	}
+
+	// final round
+	T = _mm_blendv_epi8(A0, B0, BLEND_MASK);
+	B0 = _mm_blendv_epi8(B0, A0, BLEND_MASK);
+	A0 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B0 = _mm_shuffle_epi8(B0, SHIFT_MASK);
+	T = _mm_blendv_epi8(A1, B1, BLEND_MASK);
+	B1 = _mm_blendv_epi8(B1, A1, BLEND_MASK);
+	A1 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B1 = _mm_shuffle_epi8(B1, SHIFT_MASK);
+	T = _mm_blendv_epi8(A2, B2, BLEND_MASK);
+	B2 = _mm_blendv_epi8(B2, A2, BLEND_MASK);
+	A2 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B2 = _mm_shuffle_epi8(B2, SHIFT_MASK);
+	T = _mm_blendv_epi8(A3, B3, BLEND_MASK);
+	B3 = _mm_blendv_epi8(B3, A3, BLEND_MASK);
+	A3 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B3 = _mm_shuffle_epi8(B3, SHIFT_MASK);
+	++kctr;
+	key1 = m_acsState->Key->RoundKeys[kctr];
+	++kctr;
+	key2 = m_acsState->Key->RoundKeys[kctr];
+	A0 = _mm_aesenclast_si128(A0, key1);
+	B0 = _mm_aesenclast_si128(B0, key2);
+	A1 = _mm_aesenclast_si128(A1, key1);
+	B1 = _mm_aesenclast_si128(B1, key2);
+	A2 = _mm_aesenclast_si128(A2, key1);
+	B2 = _mm_aesenclast_si128(B2, key2);
+	A3 = _mm_aesenclast_si128(A3, key1);
+	B3 = _mm_aesenclast_si128(B3, key2);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), A0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 16]), B0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 32]), A1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 48]), B1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 64]), A2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 80]), B2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 96]), A3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 112]), B3);
 }
 
-void ACS::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void ACS::Transform2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
-	Transform1024(Input, InOffset, Output, OutOffset);
-	Transform1024(Input, InOffset + 128, Output, OutOffset + 128);
+	const size_t RNDCNT = m_acsState->Key->RoundKeys.size() - 3;
+	__m128i A0;
+	__m128i B0;
+	__m128i A1;
+	__m128i B1;
+	__m128i A2;
+	__m128i B2;
+	__m128i A3;
+	__m128i B3;
+	__m128i A4;
+	__m128i B4;
+	__m128i A5;
+	__m128i B5;
+	__m128i A6;
+	__m128i B6;
+	__m128i A7;
+	__m128i B7;
+	__m128i key1;
+	__m128i key2;
+	__m128i T;
+	size_t kctr;
+
+	A0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+	B0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+	A1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+	B1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+	A2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+	B2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+	A3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+	B3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+	A4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 128]));
+	B4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 144]));
+	A5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 160]));
+	B5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 176]));
+	A6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 192]));
+	B6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 208]));
+	A7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 224]));
+	B7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 240]));
+
+	kctr = 0;
+	key1 = m_acsState->Key->RoundKeys[kctr];
+	++kctr;
+	key2 = m_acsState->Key->RoundKeys[kctr];
+	A0 = _mm_xor_si128(A0, key1);
+	B0 = _mm_xor_si128(B0, key2);
+	A1 = _mm_xor_si128(A1, key1);
+	B1 = _mm_xor_si128(B1, key2);
+	A2 = _mm_xor_si128(A2, key1);
+	B2 = _mm_xor_si128(B2, key2);
+	A3 = _mm_xor_si128(A3, key1);
+	B3 = _mm_xor_si128(B3, key2);
+	A4 = _mm_xor_si128(A4, key1);
+	B4 = _mm_xor_si128(B4, key2);
+	A5 = _mm_xor_si128(A5, key1);
+	B5 = _mm_xor_si128(B5, key2);
+	A6 = _mm_xor_si128(A6, key1);
+	B6 = _mm_xor_si128(B6, key2);
+	A7 = _mm_xor_si128(A7, key1);
+	B7 = _mm_xor_si128(B7, key2);
+
+	// each round is applied to every block before the next round, the independent blocks fill the aes pipeline
+	while (kctr != RNDCNT)
+	{
+		// mix and shuffle the half-blocks
+		T = _mm_blendv_epi8(A0, B0, BLEND_MASK);
+		B0 = _mm_blendv_epi8(B0, A0, BLEND_MASK);
+		A0 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B0 = _mm_shuffle_epi8(B0, SHIFT_MASK);
+		T = _mm_blendv_epi8(A1, B1, BLEND_MASK);
+		B1 = _mm_blendv_epi8(B1, A1, BLEND_MASK);
+		A1 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B1 = _mm_shuffle_epi8(B1, SHIFT_MASK);
+		T = _mm_blendv_epi8(A2, B2, BLEND_MASK);
+		B2 = _mm_blendv_epi8(B2, A2, BLEND_MASK);
+		A2 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B2 = _mm_shuffle_epi8(B2, SHIFT_MASK);
+		T = _mm_blendv_epi8(A3, B3, BLEND_MASK);
+		B3 = _mm_blendv_epi8(B3, A3, BLEND_MASK);
+		A3 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B3 = _mm_shuffle_epi8(B3, SHIFT_MASK);
+		T = _mm_blendv_epi8(A4, B4, BLEND_MASK);
+		B4 = _mm_blendv_epi8(B4, A4, BLEND_MASK);
+		A4 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B4 = _mm_shuffle_epi8(B4, SHIFT_MASK);
+		T = _mm_blendv_epi8(A5, B5, BLEND_MASK);
+		B5 = _mm_blendv_epi8(B5, A5, BLEND_MASK);
+		A5 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B5 = _mm_shuffle_epi8(B5, SHIFT_MASK);
+		T = _mm_blendv_epi8(A6, B6, BLEND_MASK);
+		B6 = _mm_blendv_epi8(B6, A6, BLEND_MASK);
+		A6 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B6 = _mm_shuffle_epi8(B6, SHIFT_MASK);
+		T = _mm_blendv_epi8(A7, B7, BLEND_MASK);
+		B7 = _mm_blendv_epi8(B7, A7, BLEND_MASK);
+		A7 = _mm_shuffle_epi8(T, SHIFT_MASK);
+		B7 = _mm_shuffle_epi8(B7, SHIFT_MASK);
+		++kctr;
+		key1 = m_acsState->Key->RoundKeys[kctr];
+		++kctr;
+		key2 = m_acsState->Key->RoundKeys[kctr];
+		A0 = _mm_aesenc_si128(A0, key1);
+		B0 = _mm_aesenc_si128(B0, key2);
+		A1 = _mm_aesenc_si128(A1, key1);
+		B1 = _mm_aesenc_si128(B1, key2);
+		A2 = _mm_aesenc_si128(A2, key1);
+		B2 = _mm_aesenc_si128(B2, key2);
+		A3 = _mm_aesenc_si128(A3, key1);
+		B3 = _mm_aesenc_si128(B3, key2);
+		A4 = _mm_aesenc_si128(A4, key1);
+		B4 = _mm_aesenc_si128(B4, key2);
+		A5 = _mm_aesenc_si128(A5, key1);
+		B5 = _mm_aesenc_si128(B5, key2);
+		A6 = _mm_aesenc_si128(A6, key1);
+		B6 = _mm_aesenc_si128(B6, key2);
+		A7 = _mm_aesenc_si128(A7, key1);
+		B7 = _mm_aesenc_si128(B7, key2);
+	}
+
+	// final round
+	T = _mm_blendv_epi8(A0, B0, BLEND_MASK);
+	B0 = _mm_blendv_epi8(B0, A0, BLEND_MASK);
+	A0 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B0 = _mm_shuffle_epi8(B0, SHIFT_MASK);
+	T = _mm_blendv_epi8(A1, B1, BLEND_MASK);
+	B1 = _mm_blendv_epi8(B1, A1, BLEND_MASK);
+	A1 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B1 = _mm_shuffle_epi8(B1, SHIFT_MASK);
+	T = _mm_blendv_epi8(A2, B2, BLEND_MASK);
+	B2 = _mm_blendv_epi8(B2, A2, BLEND_MASK);
+	A2 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B2 = _mm_shuffle_epi8(B2, SHIFT_MASK);
+	T = _mm_blendv_epi8(A3, B3, BLEND_MASK);
+	B3 = _mm_blendv_epi8(B3, A3, BLEND_MASK);
+	A3 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B3 = _mm_shuffle_epi8(B3, SHIFT_MASK);
+	T = _mm_blendv_epi8(A4, B4, BLEND_MASK);
+	B4 = _mm_blendv_epi8(B4, A4, BLEND_MASK);
+	A4 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B4 = _mm_shuffle_epi8(B4, SHIFT_MASK);
+	T = _mm_blendv_epi8(A5, B5, BLEND_MASK);
+	B5 = _mm_blendv_epi8(B5, A5, BLEND_MASK);
+	A5 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B5 = _mm_shuffle_epi8(B5, SHIFT_MASK);
+	T = _mm_blendv_epi8(A6, B6, BLEND_MASK);
+	B6 = _mm_blendv_epi8(B6, A6, BLEND_MASK);
+	A6 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B6 = _mm_shuffle_epi8(B6, SHIFT_MASK);
+	T = _mm_blendv_epi8(A7, B7, BLEND_MASK);
+	B7 = _mm_blendv_epi8(B7, A7, BLEND_MASK);
+	A7 = _mm_shuffle_epi8(T, SHIFT_MASK);
+	B7 = _mm_shuffle_epi8(B7, SHIFT_MASK);
+	++kctr;
+	key1 = m_acsState->Key->RoundKeys[kctr];
+	++kctr;
+	key2 = m_acsState->Key->RoundKeys[kctr];
+	A0 = _mm_aesenclast_si128(A0, key1);
+	B0 = _mm_aesenclast_si128(B0, key2);
+	A1 = _mm_aesenclast_si128(A1, key1);
+	B1 = _mm_aesenclast_si128(B1, key2);
+	A2 = _mm_aesenclast_si128(A2, key1);
+	B2 = _mm_aesenclast_si128(B2, key2);
+	A3 = _mm_aesenclast_si128(A3, key1);
+	B3 = _mm_aesenclast_si128(B3, key2);
+	A4 = _mm_aesenclast_si128(A4, key1);
+	B4 = _mm_aesenclast_si128(B4, key2);
+	A5 = _mm_aesenclast_si128(A5, key1);
+	B5 = _mm_aesenclast_si128(B5, key2);
+	A6 = _mm_aesenclast_si128(A6, key1);
+	B6 = _mm_aesenclast_si128(B6, key2);
+	A7 = _mm_aesenclast_si128(A7, key1);
+	B7 = _mm_aesenclast_si128(B7, key2);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), A0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 16]), B0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 32]), A1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 48]), B1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 64]), A2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 80]), B2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 96]), A3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 112]), B3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 128]), A4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 144]), B4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 160]), A5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 176]), B5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 192]), A6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 208]), B6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 224]), A7);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 240]), B7);
 }
 
-void ACS::Transform4096(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void ACS::Transform4096(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	Transform2048(Input, InOffset, Output, OutOffset);
 	Transform2048(Input, InOffset + 256, Output, OutOffset + 256);
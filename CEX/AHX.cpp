@@ -200,6 +200,14 @@ void AHX::DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Decrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void AHX::DecryptBlock(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	Decrypt128(INP, 0, OTP, 0);
+}
+
 void AHX::EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
 {
 	Encrypt128(Input, 0, Output, 0);
@@ -210,6 +218,201 @@ void AHX::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Encrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void AHX::EncryptBlock(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	Encrypt128(INP, 0, OTP, 0);
+}
+
+void AHX::EncryptLanes(const std::vector<AHX*> &Ciphers, const byte* Input, byte* Output, size_t Count)
+{
+	CEXASSERT(Count <= Ciphers.size(), "The lane count exceeds the number of cipher instances!");
+
+	size_t i;
+
+	i = 0;
+
+	while (Count - i >= 8)
+	{
+		EncryptLanes1024(Ciphers, i, Input + (i * BLOCK_SIZE), Output + (i * BLOCK_SIZE));
+		i += 8;
+	}
+
+	while (i != Count)
+	{
+		Ciphers[i]->EncryptBlock(Input + (i * BLOCK_SIZE), Output + (i * BLOCK_SIZE));
+		++i;
+	}
+}
+
+size_t AHX::GcmEncrypt(const std::array<ulong, Numeric::CMUL::CMUL_POWERS_SIZE> &Powers, std::vector<byte> &Counter, std::vector<byte> &Hash, const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized() && IsEncryption(), "The cipher must be initialized for encryption!");
+	CEXASSERT(Counter.size() >= BLOCK_SIZE && Hash.size() >= BLOCK_SIZE, "The counter and hash must be at least one block in length!");
+
+#if defined(CEX_HAS_AVX2)
+
+	const size_t GRPBLK = Numeric::CMUL::CMUL_PARALLEL_BLOCKS;
+	const size_t GRPLEN = GRPBLK * BLOCK_SIZE;
+	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
+	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i SWAP = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+	std::array<__m128i, Numeric::CMUL::CMUL_PARALLEL_BLOCKS> hkey;
+	std::array<byte, Numeric::CMUL::CMUL_PARALLEL_BLOCKS * BLOCK_SIZE> tmpc;
+	const byte* prv;
+	__m128i A;
+	__m128i T0;
+	__m128i T1;
+	__m128i T3;
+	__m128i X0;
+	__m128i X1;
+	__m128i X2;
+	__m128i X3;
+	__m128i X4;
+	__m128i X5;
+	__m128i X6;
+	__m128i X7;
+	__m128i Y;
+	__m128i rkey;
+	size_t bctr;
+	size_t i;
+	size_t kctr;
+
+	bctr = 0;
+
+	if (Length >= GRPLEN)
+	{
+		// block i of a group is multiplied by H^(8-i); the powers are byte-reflected once
+		for (i = 0; i < GRPBLK; ++i)
+		{
+			A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Powers.data() + ((GRPBLK - 1 - i) * Numeric::CMUL::CMUL_STATE_SIZE)));
+			A = _mm_shuffle_epi8(A, SWAP);
+			hkey[i] = _mm_shuffle_epi8(A, MASK);
+		}
+
+		Y = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Hash.data())), MASK);
+		prv = nullptr;
+
+		while (Length - bctr >= GRPLEN)
+		{
+			for (i = 0; i < GRPBLK; ++i)
+			{
+				MemoryTools::COPY128(Counter, 0, tmpc, i * BLOCK_SIZE);
+				IntegerTools::BeIncrement8(Counter);
+			}
+
+			kctr = 0;
+			T0 = _mm_setzero_si128();
+			T1 = _mm_setzero_si128();
+			T3 = _mm_setzero_si128();
+			rkey = m_ahxState->RoundKeys[kctr];
+			X0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data())), rkey);
+			X1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 16)), rkey);
+			X2 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 32)), rkey);
+			X3 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 48)), rkey);
+			X4 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 64)), rkey);
+			X5 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 80)), rkey);
+			X6 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 96)), rkey);
+			X7 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tmpc.data() + 112)), rkey);
+
+			while (kctr != RNDCNT)
+			{
+				++kctr;
+				rkey = m_ahxState->RoundKeys[kctr];
+				X0 = _mm_aesenc_si128(X0, rkey);
+				X1 = _mm_aesenc_si128(X1, rkey);
+				X2 = _mm_aesenc_si128(X2, rkey);
+				X3 = _mm_aesenc_si128(X3, rkey);
+				X4 = _mm_aesenc_si128(X4, rkey);
+				X5 = _mm_aesenc_si128(X5, rkey);
+				X6 = _mm_aesenc_si128(X6, rkey);
+				X7 = _mm_aesenc_si128(X7, rkey);
+
+				// one block of the preceding cipher-text is multiplied in the shadow of each of the first 8 rounds
+				if (prv != nullptr && kctr <= GRPBLK)
+				{
+					A = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(prv + ((kctr - 1) * BLOCK_SIZE))), MASK);
+
+					if (kctr == 1)
+					{
+						A = _mm_xor_si128(A, Y);
+					}
+
+					GhashMultiply(A, hkey[kctr - 1], T0, T1, T3);
+				}
+			}
+
+			++kctr;
+			rkey = m_ahxState->RoundKeys[kctr];
+			X0 = _mm_aesenclast_si128(X0, rkey);
+			X1 = _mm_aesenclast_si128(X1, rkey);
+			X2 = _mm_aesenclast_si128(X2, rkey);
+			X3 = _mm_aesenclast_si128(X3, rkey);
+			X4 = _mm_aesenclast_si128(X4, rkey);
+			X5 = _mm_aesenclast_si128(X5, rkey);
+			X6 = _mm_aesenclast_si128(X6, rkey);
+			X7 = _mm_aesenclast_si128(X7, rkey);
+
+			if (prv != nullptr)
+			{
+				Y = GhashReduce(T0, T1, T3);
+			}
+
+			// each input block is loaded before its output is stored, so the buffers can overlap
+			X0 = _mm_xor_si128(X0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr), X0);
+			X1 = _mm_xor_si128(X1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 16)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 16), X1);
+			X2 = _mm_xor_si128(X2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 32)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 32), X2);
+			X3 = _mm_xor_si128(X3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 48)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 48), X3);
+			X4 = _mm_xor_si128(X4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 64)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 64), X4);
+			X5 = _mm_xor_si128(X5, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 80)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 80), X5);
+			X6 = _mm_xor_si128(X6, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 96)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 96), X6);
+			X7 = _mm_xor_si128(X7, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + bctr + 112)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + bctr + 112), X7);
+
+			prv = Output + bctr;
+			bctr += GRPLEN;
+		}
+
+		// the last group has no rounds to hide behind
+		T0 = _mm_setzero_si128();
+		T1 = _mm_setzero_si128();
+		T3 = _mm_setzero_si128();
+
+		for (i = 0; i < GRPBLK; ++i)
+		{
+			A = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(prv + (i * BLOCK_SIZE))), MASK);
+
+			if (i == 0)
+			{
+				A = _mm_xor_si128(A, Y);
+			}
+
+			GhashMultiply(A, hkey[i], T0, T1, T3);
+		}
+
+		Y = GhashReduce(T0, T1, T3);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Hash.data()), _mm_shuffle_epi8(Y, MASK));
+		MemoryTools::Clear(hkey, 0, hkey.size() * sizeof(__m128i));
+	}
+
+	return bctr;
+
+#else
+
+	return 0;
+
+#endif
+}
+
 void AHX::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
 	if (!SymmetricKeySize::Contains(m_legalKeySizes, Parameters.KeySizes().KeySize()))
@@ -285,6 +488,21 @@ void AHX::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	}
 }
 
+void AHX::Transform(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	if (m_ahxState->Encryption)
+	{
+		Encrypt128(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt128(INP, 0, OTP, 0);
+	}
+}
+
 void AHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_ahxState->Encryption)
@@ -297,6 +515,21 @@ void AHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vec
 	}
 }
 
+void AHX::Transform512(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 4 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 4 * BLOCK_SIZE);
+
+	if (m_ahxState->Encryption)
+	{
+		Encrypt512(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt512(INP, 0, OTP, 0);
+	}
+}
+
 void AHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_ahxState->Encryption)
@@ -309,6 +542,21 @@ void AHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::ve
 	}
 }
 
+void AHX::Transform1024(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 8 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 8 * BLOCK_SIZE);
+
+	if (m_ahxState->Encryption)
+	{
+		Encrypt1024(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt1024(INP, 0, OTP, 0);
+	}
+}
+
 void AHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_ahxState->Encryption)
@@ -321,6 +569,21 @@ void AHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::ve
 	}
 }
 
+void AHX::Transform2048(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 16 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 16 * BLOCK_SIZE);
+
+	if (m_ahxState->Encryption)
+	{
+		Encrypt2048(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt2048(INP, 0, OTP, 0);
+	}
+}
+
 //~~~Key Schedule~~~//
 
 void AHX::SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<AhxState> &State, std::unique_ptr<IKdf> &Generator)
@@ -494,9 +757,59 @@ void AHX::ExpandSubBlock(std::vector<__m128i> &Key, size_t Index, size_t Offset)
 	Key[Index] = _mm_xor_si128(pkb, Key[Index]);
 }
 
+void AHX::GhashMultiply(__m128i X, __m128i H, __m128i &T0, __m128i &T1, __m128i &T3)
+{
+	// accumulate the unreduced product of a byte-reflected block and power of H
+	T0 = _mm_xor_si128(T0, _mm_clmulepi64_si128(X, H, 0x00));
+	T1 = _mm_xor_si128(T1, _mm_clmulepi64_si128(X, H, 0x01));
+	T1 = _mm_xor_si128(T1, _mm_clmulepi64_si128(X, H, 0x10));
+	T3 = _mm_xor_si128(T3, _mm_clmulepi64_si128(X, H, 0x11));
+}
+
+__m128i AHX::GhashReduce(__m128i T0, __m128i T1, __m128i T3)
+{
+	// shift the 256 bit sum left by one and reduce it modulo the ghash polynomial, as in CMUL
+	__m128i T2;
+	__m128i T4;
+	__m128i T5;
+
+	T2 = _mm_slli_si128(T1, 8);
+	T1 = _mm_srli_si128(T1, 8);
+	T0 = _mm_xor_si128(T0, T2);
+	T3 = _mm_xor_si128(T3, T1);
+	T4 = _mm_srli_epi32(T0, 31);
+	T0 = _mm_slli_epi32(T0, 1);
+	T5 = _mm_srli_epi32(T3, 31);
+	T3 = _mm_slli_epi32(T3, 1);
+	T2 = _mm_srli_si128(T4, 12);
+	T5 = _mm_slli_si128(T5, 4);
+	T4 = _mm_slli_si128(T4, 4);
+	T0 = _mm_or_si128(T0, T4);
+	T3 = _mm_or_si128(T3, T5);
+	T3 = _mm_or_si128(T3, T2);
+	T4 = _mm_slli_epi32(T0, 31);
+	T5 = _mm_slli_epi32(T0, 30);
+	T2 = _mm_slli_epi32(T0, 25);
+	T4 = _mm_xor_si128(T4, T5);
+	T4 = _mm_xor_si128(T4, T2);
+	T5 = _mm_srli_si128(T4, 4);
+	T3 = _mm_xor_si128(T3, T5);
+	T4 = _mm_slli_si128(T4, 12);
+	T0 = _mm_xor_si128(T0, T4);
+	T3 = _mm_xor_si128(T3, T0);
+	T4 = _mm_srli_epi32(T0, 1);
+	T1 = _mm_srli_epi32(T0, 2);
+	T2 = _mm_srli_epi32(T0, 7);
+	T3 = _mm_xor_si128(T3, T1);
+	T3 = _mm_xor_si128(T3, T2);
+	T3 = _mm_xor_si128(T3, T4);
+
+	return T3;
+}
+
 //~~~Rounds Processing~~~//
 
-void AHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
 	size_t kctr = 0;
@@ -514,7 +827,7 @@ void AHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), _mm_aesdeclast_si128(X, m_ahxState->RoundKeys[kctr]));
 }
 
-void AHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Decrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
 	size_t kctr = 0;
@@ -550,20 +863,202 @@ void AHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	X3.Store(Output, OutOffset + 48);
 }
 
-void AHX::Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Decrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
-	// no aes-ni 256 api.. yet
-	Decrypt512(Input, InOffset, Output, OutOffset);
-	Decrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
+	__m128i rkey;
+	__m128i X0;
+	__m128i X1;
+	__m128i X2;
+	__m128i X3;
+	__m128i X4;
+	__m128i X5;
+	__m128i X6;
+	__m128i X7;
+	size_t kctr;
+
+	kctr = 0;
+	X0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+	X1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+	X2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+	X3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+	X4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+	X5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+	X6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+	X7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+
+	// the round key is loaded once per round and applied to every block, the independent blocks hide the aes latency
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_xor_si128(X0, rkey);
+	X1 = _mm_xor_si128(X1, rkey);
+	X2 = _mm_xor_si128(X2, rkey);
+	X3 = _mm_xor_si128(X3, rkey);
+	X4 = _mm_xor_si128(X4, rkey);
+	X5 = _mm_xor_si128(X5, rkey);
+	X6 = _mm_xor_si128(X6, rkey);
+	X7 = _mm_xor_si128(X7, rkey);
+
+	while (kctr != RNDCNT)
+	{
+		++kctr;
+		rkey = m_ahxState->RoundKeys[kctr];
+		X0 = _mm_aesdec_si128(X0, rkey);
+		X1 = _mm_aesdec_si128(X1, rkey);
+		X2 = _mm_aesdec_si128(X2, rkey);
+		X3 = _mm_aesdec_si128(X3, rkey);
+		X4 = _mm_aesdec_si128(X4, rkey);
+		X5 = _mm_aesdec_si128(X5, rkey);
+		X6 = _mm_aesdec_si128(X6, rkey);
+		X7 = _mm_aesdec_si128(X7, rkey);
+	}
+
+	++kctr;
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_aesdeclast_si128(X0, rkey);
+	X1 = _mm_aesdeclast_si128(X1, rkey);
+	X2 = _mm_aesdeclast_si128(X2, rkey);
+	X3 = _mm_aesdeclast_si128(X3, rkey);
+	X4 = _mm_aesdeclast_si128(X4, rkey);
+	X5 = _mm_aesdeclast_si128(X5, rkey);
+	X6 = _mm_aesdeclast_si128(X6, rkey);
+	X7 = _mm_aesdeclast_si128(X7, rkey);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), X0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 16]), X1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 32]), X2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 48]), X3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 64]), X4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 80]), X5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 96]), X6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 112]), X7);
 }
 
-void AHX::Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Decrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_AVX512) && defined(CEX_HAS_VAES)
+	// the EVEX encoded aes instructions can address xmm16-31, so 16 blocks and a round key stay in registers
+	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
+	__m128i rkey;
+	__m128i X0;
+	__m128i X1;
+	__m128i X2;
+	__m128i X3;
+	__m128i X4;
+	__m128i X5;
+	__m128i X6;
+	__m128i X7;
+	__m128i X8;
+	__m128i X9;
+	__m128i X10;
+	__m128i X11;
+	__m128i X12;
+	__m128i X13;
+	__m128i X14;
+	__m128i X15;
+	size_t kctr;
+
+	kctr = 0;
+	X0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+	X1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+	X2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+	X3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+	X4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+	X5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+	X6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+	X7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+	X8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 128]));
+	X9 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 144]));
+	X10 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 160]));
+	X11 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 176]));
+	X12 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 192]));
+	X13 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 208]));
+	X14 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 224]));
+	X15 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 240]));
+
+	// the round key is loaded once per round and applied to every block, the independent blocks hide the aes latency
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_xor_si128(X0, rkey);
+	X1 = _mm_xor_si128(X1, rkey);
+	X2 = _mm_xor_si128(X2, rkey);
+	X3 = _mm_xor_si128(X3, rkey);
+	X4 = _mm_xor_si128(X4, rkey);
+	X5 = _mm_xor_si128(X5, rkey);
+	X6 = _mm_xor_si128(X6, rkey);
+	X7 = _mm_xor_si128(X7, rkey);
+	X8 = _mm_xor_si128(X8, rkey);
+	X9 = _mm_xor_si128(X9, rkey);
+	X10 = _mm_xor_si128(X10, rkey);
+	X11 = _mm_xor_si128(X11, rkey);
+	X12 = _mm_xor_si128(X12, rkey);
+	X13 = _mm_xor_si128(X13, rkey);
+	X14 = _mm_xor_si128(X14, rkey);
+	X15 = _mm_xor_si128(X15, rkey);
+
+	while (kctr != RNDCNT)
+	{
+		++kctr;
+		rkey = m_ahxState->RoundKeys[kctr];
+		X0 = _mm_aesdec_si128(X0, rkey);
+		X1 = _mm_aesdec_si128(X1, rkey);
+		X2 = _mm_aesdec_si128(X2, rkey);
+		X3 = _mm_aesdec_si128(X3, rkey);
+		X4 = _mm_aesdec_si128(X4, rkey);
+		X5 = _mm_aesdec_si128(X5, rkey);
+		X6 = _mm_aesdec_si128(X6, rkey);
+		X7 = _mm_aesdec_si128(X7, rkey);
+		X8 = _mm_aesdec_si128(X8, rkey);
+		X9 = _mm_aesdec_si128(X9, rkey);
+		X10 = _mm_aesdec_si128(X10, rkey);
+		X11 = _mm_aesdec_si128(X11, rkey);
+		X12 = _mm_aesdec_si128(X12, rkey);
+		X13 = _mm_aesdec_si128(X13, rkey);
+		X14 = _mm_aesdec_si128(X14, rkey);
+		X15 = _mm_aesdec_si128(X15, rkey);
+	}
+
+	++kctr;
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_aesdeclast_si128(X0, rkey);
+	X1 = _mm_aesdeclast_si128(X1, rkey);
+	X2 = _mm_aesdeclast_si128(X2, rkey);
+	X3 = _mm_aesdeclast_si128(X3, rkey);
+	X4 = _mm_aesdeclast_si128(X4, rkey);
+	X5 = _mm_aesdeclast_si128(X5, rkey);
+	X6 = _mm_aesdeclast_si128(X6, rkey);
+	X7 = _mm_aesdeclast_si128(X7, rkey);
+	X8 = _mm_aesdeclast_si128(X8, rkey);
+	X9 = _mm_aesdeclast_si128(X9, rkey);
+	X10 = _mm_aesdeclast_si128(X10, rkey);
+	X11 = _mm_aesdeclast_si128(X11, rkey);
+	X12 = _mm_aesdeclast_si128(X12, rkey);
+	X13 = _mm_aesdeclast_si128(X13, rkey);
+	X14 = _mm_aesdeclast_si128(X14, rkey);
+	X15 = _mm_aesdeclast_si128(X15, rkey);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), X0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 16]), X1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 32]), X2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 48]), X3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 64]), X4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 80]), X5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 96]), X6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 112]), X7);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 128]), X8);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 144]), X9);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 160]), X10);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 176]), X11);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 192]), X12);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 208]), X13);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 224]), X14);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 240]), X15);
+#else
+	// the vex encoded aes instructions are limited to xmm0-15, a 16 block interleave would spill to the stack
 	Decrypt1024(Input, InOffset, Output, OutOffset);
 	Decrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
+#endif
 }
 
-void AHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
 	size_t kctr = 0;
@@ -581,7 +1076,7 @@ void AHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), _mm_aesenclast_si128(X, m_ahxState->RoundKeys[kctr]));
 }
 
-void AHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Encrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
 	size_t kctr = 0;
@@ -617,16 +1112,276 @@ void AHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	X3.Store(Output, OutOffset + 48);
 }
 
-void AHX::Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Encrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
-	Encrypt512(Input, InOffset, Output, OutOffset);
-	Encrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
+	__m128i rkey;
+	__m128i X0;
+	__m128i X1;
+	__m128i X2;
+	__m128i X3;
+	__m128i X4;
+	__m128i X5;
+	__m128i X6;
+	__m128i X7;
+	size_t kctr;
+
+	kctr = 0;
+	X0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+	X1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+	X2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+	X3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+	X4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+	X5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+	X6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+	X7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+
+	// the round key is loaded once per round and applied to every block, the independent blocks hide the aes latency
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_xor_si128(X0, rkey);
+	X1 = _mm_xor_si128(X1, rkey);
+	X2 = _mm_xor_si128(X2, rkey);
+	X3 = _mm_xor_si128(X3, rkey);
+	X4 = _mm_xor_si128(X4, rkey);
+	X5 = _mm_xor_si128(X5, rkey);
+	X6 = _mm_xor_si128(X6, rkey);
+	X7 = _mm_xor_si128(X7, rkey);
+
+	while (kctr != RNDCNT)
+	{
+		++kctr;
+		rkey = m_ahxState->RoundKeys[kctr];
+		X0 = _mm_aesenc_si128(X0, rkey);
+		X1 = _mm_aesenc_si128(X1, rkey);
+		X2 = _mm_aesenc_si128(X2, rkey);
+		X3 = _mm_aesenc_si128(X3, rkey);
+		X4 = _mm_aesenc_si128(X4, rkey);
+		X5 = _mm_aesenc_si128(X5, rkey);
+		X6 = _mm_aesenc_si128(X6, rkey);
+		X7 = _mm_aesenc_si128(X7, rkey);
+	}
+
+	++kctr;
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_aesenclast_si128(X0, rkey);
+	X1 = _mm_aesenclast_si128(X1, rkey);
+	X2 = _mm_aesenclast_si128(X2, rkey);
+	X3 = _mm_aesenclast_si128(X3, rkey);
+	X4 = _mm_aesenclast_si128(X4, rkey);
+	X5 = _mm_aesenclast_si128(X5, rkey);
+	X6 = _mm_aesenclast_si128(X6, rkey);
+	X7 = _mm_aesenclast_si128(X7, rkey);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), X0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 16]), X1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 32]), X2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 48]), X3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 64]), X4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 80]), X5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 96]), X6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 112]), X7);
 }
 
-void AHX::Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void AHX::Encrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_AVX512) && defined(CEX_HAS_VAES)
+	// the EVEX encoded aes instructions can address xmm16-31, so 16 blocks and a round key stay in registers
+	const size_t RNDCNT = m_ahxState->RoundKeys.size() - 2;
+	__m128i rkey;
+	__m128i X0;
+	__m128i X1;
+	__m128i X2;
+	__m128i X3;
+	__m128i X4;
+	__m128i X5;
+	__m128i X6;
+	__m128i X7;
+	__m128i X8;
+	__m128i X9;
+	__m128i X10;
+	__m128i X11;
+	__m128i X12;
+	__m128i X13;
+	__m128i X14;
+	__m128i X15;
+	size_t kctr;
+
+	kctr = 0;
+	X0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+	X1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+	X2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+	X3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+	X4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+	X5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+	X6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+	X7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+	X8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 128]));
+	X9 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 144]));
+	X10 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 160]));
+	X11 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 176]));
+	X12 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 192]));
+	X13 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 208]));
+	X14 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 224]));
+	X15 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 240]));
+
+	// the round key is loaded once per round and applied to every block, the independent blocks hide the aes latency
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_xor_si128(X0, rkey);
+	X1 = _mm_xor_si128(X1, rkey);
+	X2 = _mm_xor_si128(X2, rkey);
+	X3 = _mm_xor_si128(X3, rkey);
+	X4 = _mm_xor_si128(X4, rkey);
+	X5 = _mm_xor_si128(X5, rkey);
+	X6 = _mm_xor_si128(X6, rkey);
+	X7 = _mm_xor_si128(X7, rkey);
+	X8 = _mm_xor_si128(X8, rkey);
+	X9 = _mm_xor_si128(X9, rkey);
+	X10 = _mm_xor_si128(X10, rkey);
+	X11 = _mm_xor_si128(X11, rkey);
+	X12 = _mm_xor_si128(X12, rkey);
+	X13 = _mm_xor_si128(X13, rkey);
+	X14 = _mm_xor_si128(X14, rkey);
+	X15 = _mm_xor_si128(X15, rkey);
+
+	while (kctr != RNDCNT)
+	{
+		++kctr;
+		rkey = m_ahxState->RoundKeys[kctr];
+		X0 = _mm_aesenc_si128(X0, rkey);
+		X1 = _mm_aesenc_si128(X1, rkey);
+		X2 = _mm_aesenc_si128(X2, rkey);
+		X3 = _mm_aesenc_si128(X3, rkey);
+		X4 = _mm_aesenc_si128(X4, rkey);
+		X5 = _mm_aesenc_si128(X5, rkey);
+		X6 = _mm_aesenc_si128(X6, rkey);
+		X7 = _mm_aesenc_si128(X7, rkey);
+		X8 = _mm_aesenc_si128(X8, rkey);
+		X9 = _mm_aesenc_si128(X9, rkey);
+		X10 = _mm_aesenc_si128(X10, rkey);
+		X11 = _mm_aesenc_si128(X11, rkey);
+		X12 = _mm_aesenc_si128(X12, rkey);
+		X13 = _mm_aesenc_si128(X13, rkey);
+		X14 = _mm_aesenc_si128(X14, rkey);
+		X15 = _mm_aesenc_si128(X15, rkey);
+	}
+
+	++kctr;
+	rkey = m_ahxState->RoundKeys[kctr];
+	X0 = _mm_aesenclast_si128(X0, rkey);
+	X1 = _mm_aesenclast_si128(X1, rkey);
+	X2 = _mm_aesenclast_si128(X2, rkey);
+	X3 = _mm_aesenclast_si128(X3, rkey);
+	X4 = _mm_aesenclast_si128(X4, rkey);
+	X5 = _mm_aesenclast_si128(X5, rkey);
+	X6 = _mm_aesenclast_si128(X6, rkey);
+	X7 = _mm_aesenclast_si128(X7, rkey);
+	X8 = _mm_aesenclast_si128(X8, rkey);
+	X9 = _mm_aesenclast_si128(X9, rkey);
+	X10 = _mm_aesenclast_si128(X10, rkey);
+	X11 = _mm_aesenclast_si128(X11, rkey);
+	X12 = _mm_aesenclast_si128(X12, rkey);
+	X13 = _mm_aesenclast_si128(X13, rkey);
+	X14 = _mm_aesenclast_si128(X14, rkey);
+	X15 = _mm_aesenclast_si128(X15, rkey);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset]), X0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 16]), X1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 32]), X2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 48]), X3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 64]), X4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 80]), X5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 96]), X6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 112]), X7);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 128]), X8);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 144]), X9);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 160]), X10);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 176]), X11);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 192]), X12);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 208]), X13);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 224]), X14);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&Output[OutOffset + 240]), X15);
+#else
+	// the vex encoded aes instructions are limited to xmm0-15, a 16 block interleave would spill to the stack
 	Encrypt1024(Input, InOffset, Output, OutOffset);
 	Encrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
+#endif
+}
+
+void AHX::EncryptLanes1024(const std::vector<AHX*> &Ciphers, size_t Offset, const byte* Input, byte* Output)
+{
+	CEXASSERT(Ciphers.size() - Offset >= 8, "The cipher vector is smaller than the lane count!");
+
+	const size_t RNDCNT = Ciphers[Offset]->m_ahxState->RoundKeys.size() - 2;
+	std::array<const __m128i*, 8> rkeys;
+	__m128i X0;
+	__m128i X1;
+	__m128i X2;
+	__m128i X3;
+	__m128i X4;
+	__m128i X5;
+	__m128i X6;
+	__m128i X7;
+	size_t kctr;
+	size_t i;
+
+	for (i = 0; i < rkeys.size(); ++i)
+	{
+		CEXASSERT(Ciphers[Offset + i]->IsInitialized() && Ciphers[Offset + i]->IsEncryption(), "The cipher instances must be initialized for encryption!");
+		CEXASSERT(Ciphers[Offset + i]->m_ahxState->RoundKeys.size() - 2 == RNDCNT, "The cipher instances must use the same number of rounds!");
+		rkeys[i] = Ciphers[Offset + i]->m_ahxState->RoundKeys.data();
+	}
+
+	kctr = 0;
+	X0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input));
+	X1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 16));
+	X2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 32));
+	X3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 48));
+	X4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 64));
+	X5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 80));
+	X6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 96));
+	X7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input + 112));
+
+	// each lane is keyed independently; the lanes are interleaved through each round so the aes latency is hidden as in Encrypt1024
+	X0 = _mm_xor_si128(X0, rkeys[0][kctr]);
+	X1 = _mm_xor_si128(X1, rkeys[1][kctr]);
+	X2 = _mm_xor_si128(X2, rkeys[2][kctr]);
+	X3 = _mm_xor_si128(X3, rkeys[3][kctr]);
+	X4 = _mm_xor_si128(X4, rkeys[4][kctr]);
+	X5 = _mm_xor_si128(X5, rkeys[5][kctr]);
+	X6 = _mm_xor_si128(X6, rkeys[6][kctr]);
+	X7 = _mm_xor_si128(X7, rkeys[7][kctr]);
+
+	while (kctr != RNDCNT)
+	{
+		++kctr;
+		X0 = _mm_aesenc_si128(X0, rkeys[0][kctr]);
+		X1 = _mm_aesenc_si128(X1, rkeys[1][kctr]);
+		X2 = _mm_aesenc_si128(X2, rkeys[2][kctr]);
+		X3 = _mm_aesenc_si128(X3, rkeys[3][kctr]);
+		X4 = _mm_aesenc_si128(X4, rkeys[4][kctr]);
+		X5 = _mm_aesenc_si128(X5, rkeys[5][kctr]);
+		X6 = _mm_aesenc_si128(X6, rkeys[6][kctr]);
+		X7 = _mm_aesenc_si128(X7, rkeys[7][kctr]);
+	}
+
+	++kctr;
+	X0 = _mm_aesenclast_si128(X0, rkeys[0][kctr]);
+	X1 = _mm_aesenclast_si128(X1, rkeys[1][kctr]);
+	X2 = _mm_aesenclast_si128(X2, rkeys[2][kctr]);
+	X3 = _mm_aesenclast_si128(X3, rkeys[3][kctr]);
+	X4 = _mm_aesenclast_si128(X4, rkeys[4][kctr]);
+	X5 = _mm_aesenclast_si128(X5, rkeys[5][kctr]);
+	X6 = _mm_aesenclast_si128(X6, rkeys[6][kctr]);
+	X7 = _mm_aesenclast_si128(X7, rkeys[7][kctr]);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output), X0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 16), X1);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 32), X2);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 48), X3);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 64), X4);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 80), X5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 96), X6);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output + 112), X7);
 }
 
 //~~~Helpers~~~//
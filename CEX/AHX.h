@@ -36,6 +36,7 @@
 #define CEX_AHX_H
 
 #include "IBlockCipher.h"
+#include "CMUL.h"
 #include "Intrinsics.h"
 
 NAMESPACE_BLOCK
@@ -229,6 +230,16 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	void DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Decrypt a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>false</c> before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">Encrypted bytes</param>
+	/// <param name="Output">Decrypted bytes</param>
+	void DecryptBlock(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Encrypt a block of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>true</c> before this method can be used.
@@ -251,6 +262,46 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	void EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Encrypt a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>true</c> before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void EncryptBlock(const byte* Input, byte* Output) override;
+
+	/// <summary>
+	/// Encrypt one block for each lane of a set of independently keyed cipher instances.
+	/// <para>Block i of the Input is encrypted with the key of Ciphers[i]; groups of 8 lanes are interleaved through each round, in the same way as the Transform1024 kernel.
+	/// Every instance must be initialized for encryption, and use the same number of transformation rounds.
+	/// Input and Output must point to at least Count * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Ciphers">The initialized cipher instances, one per lane</param>
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	/// <param name="Count">The number of lanes to process, beginning with the first instance</param>
+	static void EncryptLanes(const std::vector<AHX*> &Ciphers, const byte* Input, byte* Output, size_t Count);
+
+	/// <summary>
+	/// Encrypt a length of bytes in GCM counter mode, and add the cipher-text to a GHASH state in the same pass.
+	/// <para>The rounds of each 8 block counter group are interleaved with the carry-less multiplies of the preceding group's cipher-text, and the 8 products share one reduction.
+	/// Only whole multiples of 8 blocks are processed, the caller transforms and hashes the remainder; if the build does not support the carry-less multiply, no bytes are processed.
+	/// The cipher must be initialized for encryption; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Powers">The powers of the hash key H^1 to H^8, as generated by CMUL::PreCompute</param>
+	/// <param name="Counter">The big-endian counter block of the first input block; incremented by the number of blocks processed</param>
+	/// <param name="Hash">The running GHASH state; updated with the cipher-text</param>
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	/// <param name="Length">The number of bytes available</param>
+	///
+	/// <returns>The number of bytes processed</returns>
+	size_t GcmEncrypt(const std::array<ulong, Numeric::CMUL::CMUL_POWERS_SIZE> &Powers, std::vector<byte> &Counter, std::vector<byte> &Hash, const byte* Input, byte* Output, size_t Length);
+
 	/// <summary>
 	/// Initialize the cipher with a populated SymmetricKey or SymmetricSecureKey container
 	/// </summary>
@@ -284,6 +335,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Transform 4 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -296,10 +357,21 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform 4 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 4 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform512(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Transform 8 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
-	/// Input and Output array lengths must be at least 8 * <see cref="BlockSize"/> in length.</para>
+	/// Input and Output array lengths must be at least 8 * <see cref="BlockSize"/> in length.
+	/// The 8 blocks are interleaved through each round, which keeps the AES-NI pipeline full.</para>
 	/// </summary>
 	/// 
 	/// <param name="Input">The input array of bytes to transform</param>
@@ -308,10 +380,21 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform 8 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 8 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform1024(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Transform 16 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
-	/// Input and Output array lengths must be at least 16 * <see cref="BlockSize"/> in length.</para>
+	/// Input and Output array lengths must be at least 16 * <see cref="BlockSize"/> in length.
+	/// With AVX512VL and VAES, the 16 blocks are interleaved through each round in the EVEX addressable registers xmm0-31; otherwise two 8 block passes are used.</para>
 	/// </summary>
 	/// 
 	/// <param name="Input">The input array of bytes to transform</param>
@@ -320,23 +403,36 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform 16 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 16 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform2048(const byte* Input, byte* Output) override;
+
 private:
 
 	static std::vector<SymmetricKeySize> CalculateKeySizes(BlockCipherExtensions Extension);
+	static void EncryptLanes1024(const std::vector<AHX*> &Ciphers, size_t Offset, const byte* Input, byte* Output);
 	static void ExpandRotBlock(std::vector<__m128i> &Key, __m128i* K1, __m128i* K2, __m128i KR, size_t Offset);
 	static void ExpandRotBlock(std::vector<__m128i> &Key, size_t Index, size_t Offset);
 	static void ExpandSubBlock(std::vector<__m128i> &Key, size_t Index, size_t Offset);
+	static void GhashMultiply(__m128i X, __m128i H, __m128i &T0, __m128i &T1, __m128i &T3);
+	static __m128i GhashReduce(__m128i T0, __m128i T1, __m128i T3);
 	static void SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<AhxState> &State, std::unique_ptr<IKdf> &Generator);
 	static void StandardExpand(const SecureVector<byte> &Key, std::unique_ptr<AhxState> &State);
 
-	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
+	void Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Decrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Decrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Decrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
 };
 
 NAMESPACE_BLOCKEND
@@ -588,6 +588,19 @@ void BCG::Process(SecureVector<byte> &Output, size_t OutOffset, size_t Length)
 
 void BCG::Transform256(const SecureVector<byte> &Input, size_t InOffset, SecureVector<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_SSSE3)
+
+	// constant-time vector permute rounds, the block is held as two 128-bit halves
+	std::array<__m128i, 2> state;
+
+	state[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset));
+	state[1] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + 16));
+	VpEncrypt256(state, m_bcgState->RoundKeys, static_cast<size_t>(m_bcgState->Rounds));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset), state[0]);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset + 16), state[1]);
+
+#else
+
 	SecureVector<byte> state(BLOCK_SIZE, 0x00);
 	size_t i;
 
@@ -595,9 +608,9 @@ void BCG::Transform256(const SecureVector<byte> &Input, size_t InOffset, SecureV
 	KeyAddition(state, m_bcgState->RoundKeys, 0);
 
 	// pre-load the s-box into L1 cache
-#if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
+#	if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
 	PrefetchSbox();
-#endif
+#	endif
 
 	for (i = 1; i < m_bcgState->Rounds; ++i)
 	{
@@ -612,14 +625,38 @@ void BCG::Transform256(const SecureVector<byte> &Input, size_t InOffset, SecureV
 	KeyAddition(state, m_bcgState->RoundKeys, static_cast<size_t>(m_bcgState->Rounds) << 3UL);
 
 	MemoryTools::Copy(state, 0, Output, OutOffset, BLOCK_SIZE);
+
+#endif
 }
 
 void BCG::Transform1024(const SecureVector<byte> &Input, size_t InOffset, SecureVector<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_SSSE3)
+
+	// 4 blocks, the rounds of all blocks are interleaved
+	std::array<__m128i, 8> state;
+	size_t i;
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		state[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + (i * 16)));
+	}
+
+	VpEncrypt256(state, m_bcgState->RoundKeys, static_cast<size_t>(m_bcgState->Rounds));
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset + (i * 16)), state[i]);
+	}
+
+#else
+
 	Transform256(Input, InOffset, Output, OutOffset);
 	Transform256(Input, InOffset + 32, Output, OutOffset + 32);
 	Transform256(Input, InOffset + 64, Output, OutOffset + 64);
 	Transform256(Input, InOffset + 96, Output, OutOffset + 96);
+
+#endif
 }
 
 void BCG::Transform2048(const SecureVector<byte> &Input, size_t InOffset, SecureVector<byte> &Output, size_t OutOffset)
@@ -1991,7 +1991,7 @@ public:
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4)),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 64),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 128),
-				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 196),
+				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 192),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 256),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 320),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 384),
@@ -2168,7 +2168,7 @@ public:
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4)),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 64),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 128),
-				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 196),
+				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 192),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 256),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 320),
 				IntegerTools::LeBytesTo32(Input, InOffset + (i * 4) + 384),
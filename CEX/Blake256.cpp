@@ -1,5 +1,6 @@
 #include "Blake256.h"
 #include "Blake.h"
+#include "DigestBatch.h"
 #include "CpuDetect.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
@@ -16,6 +17,9 @@ class Blake256::Blake2sState
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = (2 * sizeof(uint)) + (8 * sizeof(uint)) + (2 * sizeof(uint));
+
 	std::array<uint, 2> F = { 0 };
 	std::array<uint, 8> H = { 0 };
 	std::array<uint, 2> T = { 0 };
@@ -29,12 +33,202 @@ public:
 		Reset();
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, F, 0, F.size() * sizeof(uint));
+		Offset += F.size() * sizeof(uint);
+		MemoryTools::Copy(SecureState, Offset, H, 0, H.size() * sizeof(uint));
+		Offset += H.size() * sizeof(uint);
+		MemoryTools::Copy(SecureState, Offset, T, 0, T.size() * sizeof(uint));
+	}
+
 	void Reset()
 	{
 		MemoryTools::Clear(F, 0, F.size() * sizeof(uint));
 		MemoryTools::Clear(H, 0, H.size() * sizeof(uint));
 		MemoryTools::Clear(T, 0, T.size() * sizeof(uint));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(F, 0, SecureState, Offset, F.size() * sizeof(uint));
+		Offset += F.size() * sizeof(uint);
+		MemoryTools::Copy(H, 0, SecureState, Offset, H.size() * sizeof(uint));
+		Offset += H.size() * sizeof(uint);
+		MemoryTools::Copy(T, 0, SecureState, Offset, T.size() * sizeof(uint));
+	}
+};
+
+class Blake256::Blake2sLanes
+{
+private:
+
+#if defined(CEX_HAS_AVX512)
+	static const size_t WIDE_LANES = 16;
+#elif defined(CEX_HAS_AVX2)
+	static const size_t WIDE_LANES = 8;
+#else
+	static const size_t WIDE_LANES = 1;
+#endif
+
+	static void LoadIV(const Blake2sState &Value, std::array<uint, 8> &IV)
+	{
+		MemoryTools::Copy(Blake::IV256, 0, IV, 0, IV.size() * sizeof(uint));
+		IV[4] ^= Value.T[0];
+		IV[5] ^= Value.T[1];
+		IV[6] ^= Value.F[0];
+		IV[7] ^= Value.F[1];
+	}
+
+public:
+
+	typedef Blake2sState State;
+
+	static const size_t BLOCK_SIZE = Blake::BLAKE256_RATE_SIZE;
+	static const size_t DIGEST_SIZE = Blake::BLAKE256_DIGEST_SIZE;
+
+	size_t Lanes()
+	{
+		return WIDE_LANES;
+	}
+
+	size_t Blocks(size_t Length)
+	{
+		// an empty message is processed as a single block of zeroes
+		return (Length == 0) ? 1 : (Length + (BLOCK_SIZE - 1)) / BLOCK_SIZE;
+	}
+
+	void Block(const std::vector<byte> &Message, size_t Index, std::vector<byte> &Output, size_t Lane, State &Value)
+	{
+		const size_t MSGOFT = Index * BLOCK_SIZE;
+		const size_t OUTOFT = Lane * BLOCK_SIZE;
+		const size_t BLKLEN = (Message.size() - MSGOFT < BLOCK_SIZE) ? Message.size() - MSGOFT : BLOCK_SIZE;
+
+		if (BLKLEN != BLOCK_SIZE)
+		{
+			MemoryTools::Clear(Output, OUTOFT + BLKLEN, BLOCK_SIZE - BLKLEN);
+		}
+
+		if (BLKLEN != 0)
+		{
+			MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, BLKLEN);
+		}
+
+		// the counter is the number of message bytes, the f0 flag marks the last block
+		IntegerTools::LeIncreaseW(Value.T, Value.T, BLKLEN);
+
+		if (Index == Blocks(Message.size()) - 1)
+		{
+			Value.F[0] = 0xFFFFFFFFUL;
+		}
+	}
+
+	void Finalize(State &Value, std::vector<byte> &Output)
+	{
+		IntegerTools::LeUL256ToBlock(Value.H, 0, Output, 0);
+	}
+
+	void Permute(const std::vector<byte> &Input, State &Value)
+	{
+		std::array<uint, 8> iv;
+
+		LoadIV(Value, iv);
+
+#if defined(CEX_HAS_AVX2)
+		Blake::PermuteR10P512V(Input, 0, Value.H, iv);
+#else
+#	if defined(CEX_DIGEST_COMPACT)
+		Blake::PermuteR10P512C(Input, 0, Value.H, iv);
+#	else
+		Blake::PermuteR10P512U(Input, 0, Value.H, iv);
+#	endif
+#endif
+	}
+
+	void PermuteW(const std::vector<byte> &Input, std::vector<State> &Values)
+	{
+#if defined(CEX_HAS_AVX512) || defined(CEX_HAS_AVX2)
+
+#	if defined(CEX_HAS_AVX512)
+		std::array<UInt512, 8> wiv;
+		std::array<UInt512, 8> wstate;
+#	else
+		std::array<UInt256, 8> wiv;
+		std::array<UInt256, 8> wstate;
+#	endif
+		std::array<uint, 8 * WIDE_LANES> tmpi;
+		std::array<uint, 8 * WIDE_LANES> tmps;
+		std::array<uint, 8> iv;
+		size_t i;
+		size_t j;
+		size_t k;
+
+#	if defined(CEX_IS_LITTLE_ENDIAN)
+		// the wide permutation reads the message words interleaved by lane; word i of lane j is at word (i * WIDE_LANES) + j
+		std::vector<byte> blks(Input.size());
+
+		for (i = 0; i < 16; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				MemoryTools::Copy(Input, (j * BLOCK_SIZE) + (i * sizeof(uint)), blks, ((i * WIDE_LANES) + j) * sizeof(uint), sizeof(uint));
+			}
+		}
+#	else
+		// the wide permutation loads the block at lane offset j into the vector element (WIDE_LANES - 1 - j)
+		const std::vector<byte> &blks = Input;
+#	endif
+
+		for (j = 0; j < WIDE_LANES; ++j)
+		{
+#	if defined(CEX_IS_LITTLE_ENDIAN)
+			k = j;
+#	else
+			k = WIDE_LANES - 1 - j;
+#	endif
+			LoadIV(Values[j], iv);
+
+			for (i = 0; i < 8; ++i)
+			{
+				tmps[(i * WIDE_LANES) + k] = Values[j].H[i];
+				tmpi[(i * WIDE_LANES) + k] = iv[i];
+			}
+		}
+
+		MemoryTools::Copy(tmps, 0, wstate, 0, tmps.size() * sizeof(uint));
+		MemoryTools::Copy(tmpi, 0, wiv, 0, tmpi.size() * sizeof(uint));
+#	if defined(CEX_HAS_AVX512)
+		Blake::PermuteR10P16x512H(blks, 0, wstate, wiv);
+#	else
+		Blake::PermuteR10P8x512H(blks, 0, wstate, wiv);
+#	endif
+		MemoryTools::Copy(wstate, 0, tmps, 0, tmps.size() * sizeof(uint));
+
+		for (j = 0; j < WIDE_LANES; ++j)
+		{
+#	if defined(CEX_IS_LITTLE_ENDIAN)
+			k = j;
+#	else
+			k = WIDE_LANES - 1 - j;
+#	endif
+
+			for (i = 0; i < 8; ++i)
+			{
+				Values[j].H[i] = tmps[(i * WIDE_LANES) + k];
+			}
+		}
+
+		MemoryTools::Clear(tmps, 0, tmps.size() * sizeof(uint));
+#	if defined(CEX_IS_LITTLE_ENDIAN)
+		MemoryTools::Clear(blks, 0, blks.size());
+#	endif
+
+#else
+
+		Permute(Input, Values[0]);
+
+#endif
+	}
 };
 
 //~~~Constructor~~~//
@@ -58,6 +252,12 @@ Blake256::Blake256(bool Parallel)
 		throw CryptoDigestException(DigestConvert::ToName(Digests::Blake256), std::string("Constructor"), std::string("This cpu does not support parallel processing!"), ErrorCodes::InvalidParam);
 	}
 
+	if (Parallel)
+	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+	}
+
 	Reset();
 }
 
@@ -161,6 +361,58 @@ void Blake256::Compute(const std::vector<byte> &Input, std::vector<byte> &Output
 	Finalize(Output, 0);
 }
 
+void Blake256::Compute(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	BlakeParams params(static_cast<byte>(Blake::BLAKE256_DIGEST_SIZE), 0x01, 0x01, 0x00, 0x00);
+	std::vector<uint> config(CONFIG_SIZE);
+	Blake2sLanes lanes;
+	Blake2sState init;
+
+	LoadState(params, config, init);
+	DigestBatch::Compute(lanes, Input, Output, init);
+}
+
+void Blake256::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * Blake2sState::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += Blake2sState::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void Blake256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < Blake::BLAKE256_DIGEST_SIZE)
@@ -168,6 +420,12 @@ void Blake256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void Blake256::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, Blake::BLAKE256_DIGEST_SIZE);
 	size_t bcnt;
 	size_t blen;
 	size_t i;
@@ -269,7 +527,7 @@ void Blake256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		IntegerTools::LeIncreaseW(m_dgtState[0].T, m_dgtState[0].T, Blake::BLAKE256_RATE_SIZE);
 		Permute(m_msgBuffer, m_msgLength - Blake::BLAKE256_RATE_SIZE, m_dgtState[0]);
 		// output the code
-		IntegerTools::LeUL256ToBlock(m_dgtState[0].H, 0, Output, OutOffset);
+		IntegerTools::LeUL256ToBlock(m_dgtState[0].H, 0, OTP, 0);
 	}
 	else
 	{
@@ -283,7 +541,7 @@ void Blake256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		m_dgtState[0].F[0] = 0xFFFFFFFFUL;
 		IntegerTools::LeIncreaseW(m_dgtState[0].T, m_dgtState[0].T, m_msgLength);
 		Permute(m_msgBuffer, 0, m_dgtState[0]);
-		IntegerTools::LeUL256ToBlock(m_dgtState[0].H, 0, Output, OutOffset);
+		IntegerTools::LeUL256ToBlock(m_dgtState[0].H, 0, OTP, 0);
 	}
 
 	Reset();
@@ -399,6 +657,37 @@ void Blake256::Reset()
 	m_msgLength = 0;
 }
 
+SecureVector<byte> Blake256::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * Blake2sState::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += Blake2sState::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void Blake256::Update(byte Input)
 {
 	std::vector<byte> tmp(1, Input);
@@ -423,6 +712,51 @@ void Blake256::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void Blake256::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void Blake256::LoadState(BlakeParams &Params, std::vector<uint> &Config, Blake2sState &State)
+{
+	MemoryTools::Clear(State.T, 0, State.T.size() * sizeof(uint));
+	MemoryTools::Clear(State.F, 0, State.F.size() * sizeof(uint));
+	MemoryTools::Copy(Blake::IV256, 0, State.H, 0, State.H.size() * sizeof(uint));
+
+	Params.GetConfig<uint>(Config);
+	MemoryTools::XOR256(Config, 0, State.H, 0);
+}
+
+void Blake256::Permute(const Span<const byte> &Input, size_t InOffset, Blake2sState &State)
+{
+	std::array<uint, 8> iv {
+		Blake::IV256[0],
+		Blake::IV256[1],
+		Blake::IV256[2],
+		Blake::IV256[3],
+		Blake::IV256[4] ^ State.T[0],
+		Blake::IV256[5] ^ State.T[1],
+		Blake::IV256[6] ^ State.F[0],
+		Blake::IV256[7] ^ State.F[1] };
+
+#if defined(CEX_HAS_AVX2)
+	Blake::PermuteR10P512V(Input, InOffset, State.H, iv);
+#else
+#	if defined(CEX_DIGEST_COMPACT)
+		Blake::PermuteR10P512C(Input, InOffset, State.H, iv);
+#	else
+		Blake::PermuteR10P512U(Input, InOffset, State.H, iv);
+#	endif
+#endif
+}
+
+void Blake256::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	size_t plen;
 	size_t tlen;
 
@@ -541,42 +875,7 @@ void Blake256::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	}
 }
 
-//~~~Private Functions~~~//
-
-void Blake256::LoadState(BlakeParams &Params, std::vector<uint> &Config, Blake2sState &State)
-{
-	MemoryTools::Clear(State.T, 0, State.T.size() * sizeof(uint));
-	MemoryTools::Clear(State.F, 0, State.F.size() * sizeof(uint));
-	MemoryTools::Copy(Blake::IV256, 0, State.H, 0, State.H.size() * sizeof(uint));
-
-	Params.GetConfig<uint>(Config);
-	MemoryTools::XOR256(Config, 0, State.H, 0);
-}
-
-void Blake256::Permute(const std::vector<byte> &Input, size_t InOffset, Blake2sState &State)
-{
-	std::array<uint, 8> iv {
-		Blake::IV256[0],
-		Blake::IV256[1],
-		Blake::IV256[2],
-		Blake::IV256[3],
-		Blake::IV256[4] ^ State.T[0],
-		Blake::IV256[5] ^ State.T[1],
-		Blake::IV256[6] ^ State.F[0],
-		Blake::IV256[7] ^ State.F[1] };
-
-#if defined(CEX_HAS_AVX2)
-	Blake::PermuteR10P512V(Input, InOffset, State.H, iv);
-#else
-#	if defined(CEX_DIGEST_COMPACT)
-		Blake::PermuteR10P512C(Input, InOffset, State.H, iv);
-#	else
-		Blake::PermuteR10P512U(Input, InOffset, State.H, iv);
-#	endif
-#endif
-}
-
-void Blake256::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, size_t Length, Blake2sState &State)
+void Blake256::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, size_t Length, Blake2sState &State)
 {
 	do
 	{
@@ -0,0 +1,84 @@
+#include "BlockCipherContext.h"
+#include "BlockCipherFromName.h"
+#include "IntegerTools.h"
+#include "MemoryTools.h"
+#include "SymmetricKeySize.h"
+
+NAMESPACE_MODE
+
+using Enumeration::BlockCipherConvert;
+using Cipher::SymmetricKeySize;
+using Tools::IntegerTools;
+using Tools::MemoryTools;
+
+//~~~Constructor~~~//
+
+BlockCipherContext::BlockCipherContext(BlockCiphers CipherType, ISymmetricKey &Parameters)
+	:
+	m_blockCipher(CipherType != BlockCiphers::None ?
+		Helper::BlockCipherFromName::GetInstance(CipherType) :
+		throw CryptoCipherModeException(std::string("BlockCipherContext"), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
+	m_checkCode(0)
+{
+	if (!SymmetricKeySize::Contains(m_blockCipher->LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	{
+		throw CryptoCipherModeException(Name(), std::string("Constructor"), std::string("Invalid key size; key must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidKey);
+	}
+
+	// the round-key schedule is expanded once, and is read-only from this point
+	m_blockCipher->Initialize(true, Parameters);
+
+	// record the encryption of a fixed block, a re-keyed engine produces a different output
+	const std::vector<byte> CHKBLK(m_blockCipher->BlockSize(), 0xFF);
+	m_checkCode.resize(m_blockCipher->BlockSize());
+	m_blockCipher->Transform(CHKBLK, m_checkCode);
+}
+
+BlockCipherContext::~BlockCipherContext()
+{
+	MemoryTools::Clear(m_checkCode, 0, m_checkCode.size());
+
+	if (m_blockCipher != nullptr)
+	{
+		m_blockCipher.reset(nullptr);
+	}
+}
+
+//~~~Accessors~~~//
+
+const BlockCiphers BlockCipherContext::CipherType()
+{
+	return m_blockCipher->Enumeral();
+}
+
+IBlockCipher* BlockCipherContext::Engine()
+{
+	return m_blockCipher.get();
+}
+
+const std::string BlockCipherContext::Name()
+{
+	return BlockCipherConvert::ToName(m_blockCipher->Enumeral());
+}
+
+//~~~Public Functions~~~//
+
+bool BlockCipherContext::Verify()
+{
+	const std::vector<byte> CHKBLK(m_blockCipher->BlockSize(), 0xFF);
+	std::vector<byte> code(m_blockCipher->BlockSize());
+	bool ret;
+
+	if (!m_blockCipher->IsInitialized() || !m_blockCipher->IsEncryption())
+	{
+		return false;
+	}
+
+	m_blockCipher->Transform(CHKBLK, code);
+	ret = IntegerTools::Compare(code, 0, m_checkCode, 0, m_checkCode.size());
+	MemoryTools::Clear(code, 0, code.size());
+
+	return ret;
+}
+
+NAMESPACE_MODEEND
@@ -0,0 +1,110 @@
+#ifndef CEX_BLOCKCIPHERCONTEXT_H
+#define CEX_BLOCKCIPHERCONTEXT_H
+
+#include "CexDomain.h"
+#include "BlockCiphers.h"
+#include "CryptoCipherModeException.h"
+#include "IBlockCipher.h"
+#include "ISymmetricKey.h"
+#include "KeyContext.h"
+
+NAMESPACE_MODE
+
+using Enumeration::BlockCiphers;
+using Exception::CryptoCipherModeException;
+using Enumeration::ErrorCodes;
+using Block::IBlockCipher;
+using Cipher::ISymmetricKey;
+using Cipher::KeyContext;
+
+/// <summary>
+/// An immutable block-cipher key schedule, that can be shared by the CTR, ICM, and GCM cipher modes.
+/// <para>The context owns a block-cipher instance that is keyed for encryption once, when the context is created.
+/// A cipher mode constructed with the context uses the shared round-key schedule, and is initialized with a nonce-only SymmetricKey;
+/// the key is never expanded again, and the cipher mode keeps only its own counter and authentication state.</para>
+/// </summary>
+///
+/// <example>
+/// <description>Sharing one key schedule between two threads:</description>
+/// <code>
+/// std::shared_ptr&lt;BlockCipherContext&gt; ctx = std::make_shared&lt;BlockCipherContext&gt;(BlockCiphers::AES, SymmetricKey(Key));
+/// // on each thread
+/// CTR cipher(ctx);
+/// SymmetricKey kp(std::vector&lt;byte&gt;(0), Nonce);
+/// cipher.Initialize(true, kp);
+/// cipher.Transform(Input, 0, Output, 0, Input.size());
+/// </code>
+/// </example>
+class BlockCipherContext final : public KeyContext
+{
+private:
+
+	std::unique_ptr<IBlockCipher> m_blockCipher;
+	std::vector<byte> m_checkCode;
+
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	BlockCipherContext(const BlockCipherContext&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	BlockCipherContext& operator=(const BlockCipherContext&) = delete;
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	BlockCipherContext() = delete;
+
+	/// <summary>
+	/// Create the key schedule using a block-cipher type name and a key
+	/// </summary>
+	///
+	/// <param name="CipherType">The enumeration type name of the block-cipher</param>
+	/// <param name="Parameters">The SymmetricKey containing the cipher key, and the optional Info parameter used by the extended ciphers</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if an undefined block-cipher type name, or an invalid key is used</exception>
+	BlockCipherContext(BlockCiphers CipherType, ISymmetricKey &Parameters);
+
+	/// <summary>
+	/// Destructor: finalize this class
+	/// </summary>
+	~BlockCipherContext() override;
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The block ciphers enumeration type name
+	/// </summary>
+	const BlockCiphers CipherType();
+
+	/// <summary>
+	/// Read Only: A pointer to the keyed block-cipher instance.
+	/// <para>The instance is shared; only the block transformation functions may be called through this pointer, and it must never be re-initialized.
+	/// A cipher mode bound to the context calls Verify() on every initialization, and rejects an engine that has been re-keyed.</para>
+	/// </summary>
+	IBlockCipher* Engine();
+
+	/// <summary>
+	/// Read Only: The formal name of the block-cipher
+	/// </summary>
+	const std::string Name() override;
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Check that the engine still holds the key schedule the context was created with.
+	/// <para>A fixed block is encrypted and compared in constant time with the output recorded when the context was created.</para>
+	/// </summary>
+	///
+	/// <returns>Returns false if the engine has been re-initialized</returns>
+	bool Verify();
+};
+
+NAMESPACE_MODEEND
+#endif
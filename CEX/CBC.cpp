@@ -1,8 +1,12 @@
 #include "CBC.h"
+#if defined(CEX_HAS_AVX)
+#	include "AHX.h"
+#endif
 #include "BlockCipherFromName.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 #include "ParallelTools.h"
+#include <algorithm>
 
 NAMESPACE_MODE
 
@@ -184,6 +188,53 @@ void CBC::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Encrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void CBC::EncryptBatch(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, std::vector<std::vector<byte>> &Ivs)
+{
+	std::vector<std::vector<byte>*> chains(Ivs.size());
+	std::vector<CBC*> modes(1, this);
+	size_t i;
+
+	if (!IsInitialized() || !IsEncryption())
+	{
+		throw CryptoCipherModeException(Name(), std::string("EncryptBatch"), std::string("The cipher mode must be initialized for encryption!"), ErrorCodes::NotInitialized);
+	}
+
+	VerifyBatch(Input, Output, Ivs.size());
+
+	for (i = 0; i < Ivs.size(); ++i)
+	{
+		if (Ivs[i].size() != BLOCK_SIZE)
+		{
+			throw CryptoCipherModeException(Name(), std::string("EncryptBatch"), std::string("Each initialization vector must be one block in length!"), ErrorCodes::InvalidNonce);
+		}
+
+		chains[i] = &Ivs[i];
+	}
+
+	ProcessBatch(modes, chains, Input, Output);
+}
+
+void CBC::EncryptBatch(const std::vector<CBC*> &Modes, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	std::vector<std::vector<byte>*> chains(Modes.size());
+	size_t i;
+
+	VerifyBatch(Input, Output, Modes.size());
+
+	for (i = 0; i < Modes.size(); ++i)
+	{
+		if (Modes[i] == nullptr || !Modes[i]->IsInitialized() || !Modes[i]->IsEncryption())
+		{
+			throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CBC), std::string("EncryptBatch"), std::string("Each cipher mode must be initialized for encryption!"), ErrorCodes::NotInitialized);
+		}
+
+		chains[i] = &Modes[i]->m_cbcState->IV;
+	}
+
+	// a batch of one lane has a single key, and is processed by the same-key path
+	ProcessBatch(Modes, chains, Input, Output);
+}
+
 void CBC::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
 	if (Parameters.KeySizes().IVSize() != BLOCK_SIZE)
@@ -197,6 +248,9 @@ void CBC::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -230,37 +284,47 @@ void CBC::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	Process(Input, InOffset, Output, OutOffset, Length);
 }
 
+void CBC::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
+}
+
 //~~~Private Functions~~~//
 
-void CBC::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void CBC::Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= BLOCK_SIZE, "The data arrays are smaller than the block-size!");
 
 	std::vector<byte> tmpv(BLOCK_SIZE);
 	MemoryTools::COPY128(Input, InOffset, tmpv, 0);
-	m_blockCipher->DecryptBlock(Input, InOffset, Output, OutOffset);
+	m_blockCipher->DecryptBlock(Input.data() + InOffset, Output.data() + OutOffset);
 	MemoryTools::XOR128(m_cbcState->IV, 0, Output, OutOffset);
 	MemoryTools::COPY128(tmpv, 0, m_cbcState->IV, 0);
 }
 
-void CBC::DecryptParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void CBC::DecryptParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t SEGLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
 	const size_t BLKCNT = (SEGLEN / BLOCK_SIZE);
+	std::vector<byte> segv(m_parallelProfile.ParallelMaxDegree() * BLOCK_SIZE);
 	std::vector<byte> tmpv(BLOCK_SIZE);
+	size_t j;
+
+	// the segment ivs are copied before processing, so the input and output may be the same buffer
+	MemoryTools::COPY128(m_cbcState->IV, 0, segv, 0);
+
+	for (j = 1; j < m_parallelProfile.ParallelMaxDegree(); ++j)
+	{
+		MemoryTools::COPY128(Input, (InOffset + (j * SEGLEN)) - BLOCK_SIZE, segv, j * BLOCK_SIZE);
+	}
 
-	ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, &Output, OutOffset, &tmpv, SEGLEN, BLKCNT](size_t i)
+	ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, &Output, OutOffset, &segv, &tmpv, SEGLEN, BLKCNT](size_t i)
 	{
 		std::vector<byte> thdv(BLOCK_SIZE);
 
-		if (i != 0)
-		{
-			MemoryTools::COPY128(Input, (InOffset + (i * SEGLEN)) - BLOCK_SIZE, thdv, 0);
-		}
-		else
-		{
-			MemoryTools::COPY128(m_cbcState->IV, 0, thdv, 0);
-		}
+		MemoryTools::COPY128(segv, i * BLOCK_SIZE, thdv, 0);
 
 		this->DecryptSegment(Input, InOffset + i * SEGLEN, Output, OutOffset + i * SEGLEN, thdv, BLKCNT);
 
@@ -273,7 +337,7 @@ void CBC::DecryptParallel(const std::vector<byte> &Input, size_t InOffset, std::
 	MemoryTools::COPY128(tmpv, 0, m_cbcState->IV, 0);
 }
 
-void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount)
+void CBC::DecryptSegment(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount)
 {
 	size_t bctr;
 	size_t rctr;
@@ -300,7 +364,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 			// store next iv
 			MemoryTools::Copy(Input, INPOFT, tmpn, 0, (Input.size() - INPOFT >= AVX512BLK) ? AVX512BLK : Input.size() - INPOFT);
 			// transform 8 blocks
-			m_blockCipher->Transform2048(Input, InOffset, Output, OutOffset);
+			m_blockCipher->Transform2048(Input.data() + InOffset, Output.data() + OutOffset);
 			// xor the set
 			MemoryTools::XOR1024(tmpv, 0, Output, OutOffset);
 			MemoryTools::XOR1024(tmpv, 128, Output, OutOffset + 128);
@@ -314,10 +378,13 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 
 		MemoryTools::COPY128(tmpn, 0, Iv, 0);
 	}
-#elif defined(CEX_HAS_AVX2)
+#endif
+
+#if defined(CEX_HAS_AVX)
+	// the remainder of a wider kernel cascades to the narrower kernels
 	if (bctr > 7)
 	{
-		// 256bit avx2
+		// 8 blocks
 		const size_t AVX2BLK = 128;
 		rctr = (bctr / 8);
 		std::vector<byte> tmpv(AVX2BLK);
@@ -334,7 +401,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 			// store next iv
 			MemoryTools::Copy(Input, INPOFT, tmpn, 0, (Input.size() - INPOFT >= AVX2BLK) ? AVX2BLK: Input.size() - INPOFT);
 			// transform 8 blocks
-			m_blockCipher->Transform1024(Input, InOffset, Output, OutOffset);
+			m_blockCipher->Transform1024(Input.data() + InOffset, Output.data() + OutOffset);
 			// xor the set
 			MemoryTools::XOR1024(tmpv, 0, Output, OutOffset);
 			// swap iv
@@ -347,7 +414,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 
 		MemoryTools::COPY128(tmpn, 0, Iv, 0);
 	}
-#elif defined(CEX_HAS_AVX)
+
 	if (bctr > 3)
 	{
 		// 128bit avx
@@ -364,7 +431,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 		{
 			const size_t INPOFT = InOffset + BLKOFT;
 			MemoryTools::Copy(Input, INPOFT, tmpn, 0, (Input.size() - INPOFT >= AVXBLK) ? AVXBLK : Input.size() - INPOFT);
-			m_blockCipher->Transform512(Input, InOffset, Output, OutOffset);
+			m_blockCipher->Transform512(Input.data() + InOffset, Output.data() + OutOffset);
 			MemoryTools::XOR512(tmpv, 0, Output, OutOffset);
 			MemoryTools::Copy(tmpn, 0, tmpv, 0, AVXBLK);
 			InOffset += AVXBLK;
@@ -384,7 +451,7 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 		while (bctr != 0)
 		{
 			MemoryTools::COPY128(Input, InOffset, tmpi, 0);
-			m_blockCipher->DecryptBlock(Input, InOffset, Output, OutOffset);
+			m_blockCipher->DecryptBlock(Input.data() + InOffset, Output.data() + OutOffset);
 			MemoryTools::XOR128(Iv, 0, Output, OutOffset);
 			MemoryTools::COPY128(tmpi, 0, Iv, 0);
 			InOffset += BLOCK_SIZE;
@@ -394,16 +461,51 @@ void CBC::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 	}
 }
 
-void CBC::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void CBC::Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= BLOCK_SIZE, "The data arrays are smaller than the block-size!");
 
 	MemoryTools::XOR128(Input, InOffset, m_cbcState->IV, 0);
-	m_blockCipher->EncryptBlock(m_cbcState->IV, 0, Output, OutOffset);
+	m_blockCipher->EncryptBlock(m_cbcState->IV.data(), Output.data() + OutOffset);
 	MemoryTools::COPY128(Output, OutOffset, m_cbcState->IV, 0);
 }
 
-void CBC::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void CBC::EncryptWide(std::vector<byte> &State, size_t Count)
+{
+	size_t i;
+
+	i = 0;
+
+#if defined(CEX_HAS_AVX512)
+	while (Count - i >= 16)
+	{
+		m_blockCipher->Transform2048(State.data() + (i * BLOCK_SIZE), State.data() + (i * BLOCK_SIZE));
+		i += 16;
+	}
+#endif
+
+#if defined(CEX_HAS_AVX)
+	while (Count - i >= 8)
+	{
+		m_blockCipher->Transform1024(State.data() + (i * BLOCK_SIZE), State.data() + (i * BLOCK_SIZE));
+		i += 8;
+	}
+
+	while (Count - i >= 4)
+	{
+		m_blockCipher->Transform512(State.data() + (i * BLOCK_SIZE), State.data() + (i * BLOCK_SIZE));
+		i += 4;
+	}
+#endif
+
+	while (i != Count)
+	{
+		m_blockCipher->EncryptBlock(State.data() + (i * BLOCK_SIZE), State.data() + (i * BLOCK_SIZE));
+		++i;
+	}
+}
+
+void CBC::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the block-size!");
 	CEXASSERT(Length % m_blockCipher->BlockSize() == 0, "The length must be evenly divisible by the block ciphers block-size!");
@@ -449,4 +551,123 @@ void CBC::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<b
 	}
 }
 
+void CBC::ProcessBatch(const std::vector<CBC*> &Modes, const std::vector<std::vector<byte>*> &Chains, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	const size_t LANCNT = Input.size();
+	std::vector<size_t> order(LANCNT);
+	std::vector<byte> state(LANCNT * BLOCK_SIZE);
+	size_t actcnt;
+	size_t i;
+	size_t j;
+	size_t oft;
+
+	// the lanes are ordered by length, so the lanes that still have blocks to encrypt are always a prefix of the order
+	for (i = 0; i < LANCNT; ++i)
+	{
+		order[i] = i;
+	}
+
+	std::stable_sort(order.begin(), order.end(), [&Input](size_t A, size_t B)
+	{
+		return Input[A].size() > Input[B].size();
+	});
+
+#if defined(CEX_HAS_AVX)
+	// independently keyed lanes are interleaved by the aes-ni kernel when every lane uses an AHX engine with the same rounds
+	std::vector<AHX*> engs(0);
+
+	if (Modes.size() > 1)
+	{
+		engs.resize(LANCNT);
+
+		for (i = 0; i < LANCNT; ++i)
+		{
+			engs[i] = dynamic_cast<AHX*>(Modes[order[i]]->m_blockCipher.get());
+
+			if (engs[i] == nullptr || engs[i]->Rounds() != engs[0]->Rounds())
+			{
+				engs.clear();
+				break;
+			}
+		}
+	}
+#endif
+
+	actcnt = LANCNT;
+	oft = 0;
+
+	while (actcnt != 0 && Input[order[actcnt - 1]].size() == 0)
+	{
+		--actcnt;
+	}
+
+	while (actcnt != 0)
+	{
+		// gather the next block of each active lane, xor'd with the lanes chaining vector
+		for (i = 0; i < actcnt; ++i)
+		{
+			j = order[i];
+			MemoryTools::COPY128(*Chains[j], 0, state, i * BLOCK_SIZE);
+			MemoryTools::XOR128(Input[j], oft, state, i * BLOCK_SIZE);
+		}
+
+		if (Modes.size() == 1)
+		{
+			Modes[0]->EncryptWide(state, actcnt);
+		}
+#if defined(CEX_HAS_AVX)
+		else if (engs.size() != 0)
+		{
+			AHX::EncryptLanes(engs, state.data(), state.data(), actcnt);
+		}
+#endif
+		else
+		{
+			for (i = 0; i < actcnt; ++i)
+			{
+				Modes[order[i]]->m_blockCipher->EncryptBlock(state.data() + (i * BLOCK_SIZE), state.data() + (i * BLOCK_SIZE));
+			}
+		}
+
+		// scatter the cipher-text, which is also the next chaining vector of the lane
+		for (i = 0; i < actcnt; ++i)
+		{
+			j = order[i];
+			MemoryTools::COPY128(state, i * BLOCK_SIZE, Output[j], oft);
+			MemoryTools::COPY128(state, i * BLOCK_SIZE, *Chains[j], 0);
+		}
+
+		oft += BLOCK_SIZE;
+
+		while (actcnt != 0 && Input[order[actcnt - 1]].size() == oft)
+		{
+			--actcnt;
+		}
+	}
+
+	MemoryTools::Clear(state, 0, state.size());
+}
+
+void CBC::VerifyBatch(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, size_t Lanes)
+{
+	size_t i;
+
+	if (Input.size() != Lanes || Output.size() != Lanes)
+	{
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CBC), std::string("EncryptBatch"), std::string("The batch requires one input and output per message!"), ErrorCodes::InvalidSize);
+	}
+
+	for (i = 0; i < Lanes; ++i)
+	{
+		if (Input[i].size() % BLOCK_SIZE != 0)
+		{
+			throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CBC), std::string("EncryptBatch"), std::string("The message length must be evenly divisible by the block size!"), ErrorCodes::InvalidSize);
+		}
+		if (Output[i].size() < Input[i].size())
+		{
+			throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CBC), std::string("EncryptBatch"), std::string("The output is smaller than the message!"), ErrorCodes::InvalidSize);
+		}
+	}
+}
+
 NAMESPACE_MODEEND
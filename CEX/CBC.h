@@ -76,6 +76,7 @@ NAMESPACE_MODE
 /// <item><description>The DecryptBlock, Decrypt512, Decrypt1024  EncryptBlock, Encrypt512, Encrypt1024 functions can be accessed through the class instance.</description></item>
 /// <item><description>The transformation methods can not be called until the Initialize(bool, ISymmetricKey) function has been called.</description></item>
 /// <item><description>In CBC mode, only the decryption function can be processed in parallel.</description></item>
+/// <item><description>Independent messages can be encrypted concurrently with the EncryptBatch functions, which advance one chain per message in lockstep through the multi-block cipher transforms; both same-key and multi-key batches are supported.</description></item>
 /// <item><description>The ParallelThreadsMax() property is used as the thread count in the parallel loop; this must be an even number no greater than the number of processer cores on the system.</description></item>
 /// <item><description>Parallel processing is enabled on decryption by passing an input block of at least ParallelBlockSize() to the transform; this can be disabled by setting IsParallel() to false in the ParallelProfile() accessor.</description></item>
 /// <item><description>ParallelBlockSize() is calculated automatically based on the processor(s) L1 data cache size, this property can be user defined, and must be evenly divisible by ParallelMinimumSize().</description></item>
@@ -251,6 +252,38 @@ public:
 	/// <param name="OutOffset">Starting offset within the output vector</param>
 	void EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Encrypt a batch of independent messages with the key of this instance.
+	/// <para>Each message is chained from its own initialization vector, and the messages are advanced in lockstep, one block per message at each step,
+	/// so that the blocks of up to 8 (16 with AVX512) messages are processed together by the multi-block transforms of the cipher.
+	/// On return, each initialization vector holds the last cipher-text block of its message, so a batch can be continued with another call.
+	/// The messages may differ in length, but each length must be evenly divisible by the block size.
+	/// Initialize(bool, ISymmetricKey) must be called with the Encryption flag set to true before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The plain-text messages</param>
+	/// <param name="Output">The cipher-text messages; each output must be at least the length of its input message</param>
+	/// <param name="Ivs">The initialization vectors, one per message</param>
+	/// 
+	/// <exception cref="CryptoCipherModeException">Thrown if the mode is not initialized for encryption, or the batch vectors are invalid</exception>
+	void EncryptBatch(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, std::vector<std::vector<byte>> &Ivs);
+
+	/// <summary>
+	/// Encrypt a batch of independent messages, each with the key and initialization vector of its own cipher mode instance.
+	/// <para>The messages are advanced in lockstep, one block per message at each step.
+	/// If every instance uses the AES-NI engine (AHX) with the same number of rounds, the independently keyed blocks are interleaved by the AHX lane kernel,
+	/// otherwise each block is encrypted by the cipher of its instance.
+	/// The chaining vector of each instance is updated, as with the Transform function.
+	/// Each instance must be initialized for encryption, and each message length must be evenly divisible by the block size.</para>
+	/// </summary>
+	/// 
+	/// <param name="Modes">The initialized cipher mode instances, one per message</param>
+	/// <param name="Input">The plain-text messages</param>
+	/// <param name="Output">The cipher-text messages; each output must be at least the length of its input message</param>
+	/// 
+	/// <exception cref="CryptoCipherModeException">Thrown if an instance is not initialized for encryption, or the batch vectors are invalid</exception>
+	static void EncryptBatch(const std::vector<CBC*> &Modes, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output);
+
 	/// <summary>
 	/// Initialize the cipher-mode instance
 	/// </summary>
@@ -288,13 +321,30 @@ public:
 	/// <param name="Length">The number of bytes to transform</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The blocks are read from and written to the callers memory directly, without an intermediate vector.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// If IsParallel() is set to true, and the length is at least ParallelBlockSize(), decryption is run in parallel processing mode.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer, receiving Length bytes</param>
+	/// <param name="Length">The number of bytes to transform; must be evenly divisible by the block size</param>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 private:
 
-	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void DecryptParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount);
-	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
+	static void ProcessBatch(const std::vector<CBC*> &Modes, const std::vector<std::vector<byte>*> &Chains, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output);
+	static void VerifyBatch(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, size_t Lanes);
+
+	void Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void DecryptParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void DecryptSegment(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount);
+	void Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void EncryptWide(std::vector<byte> &State, size_t Count);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
 };
 
 NAMESPACE_MODEEND
@@ -231,15 +231,21 @@ void CFB::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	Process(Input, InOffset, Output, OutOffset, Length);
 }
 
+void CFB::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
+}
+
 //~~~Private Functions~~~//
 
-void CFB::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void CFB::Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	std::vector<byte> tmpr(BLOCK_SIZE);
 	size_t i;
 
 	m_blockCipher->Transform(m_cfbState->IV, 0, tmpr, 0);
-	MemoryTools::Copy(tmpr, 0, Output, OutOffset, m_cfbState->RegisterSize);
 
 	// left shift the register
 	if (m_cfbState->IV.size() - m_cfbState->RegisterSize > 0)
@@ -247,34 +253,37 @@ void CFB::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 		MemoryTools::Copy(m_cfbState->IV, m_cfbState->RegisterSize, m_cfbState->IV, 0, m_cfbState->IV.size() - m_cfbState->RegisterSize);
 	}
 
-	// copy ciphertext to register
+	// copy ciphertext to register before the output is written, the input and output may be the same buffer
 	MemoryTools::Copy(Input, InOffset, m_cfbState->IV, m_cfbState->IV.size() - m_cfbState->RegisterSize, m_cfbState->RegisterSize);
 
 	// xor the iv with the ciphertext producing the plaintext
 	for (i = 0; i < m_cfbState->RegisterSize; i++)
 	{
-		Output[OutOffset + i] ^= Input[InOffset + i];
+		Output[OutOffset + i] = tmpr[i] ^ Input[InOffset + i];
 	}
 }
 
-void CFB::DecryptParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void CFB::DecryptParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t SEGLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
 	const size_t BLKCNT = (SEGLEN / BLOCK_SIZE);
+	std::vector<byte> segv(m_parallelProfile.ParallelMaxDegree() * BLOCK_SIZE);
 	std::vector<byte> tmpv(BLOCK_SIZE);
+	size_t j;
+
+	// the segment registers are copied before processing, so the input and output may be the same buffer
+	MemoryTools::Copy(m_cfbState->IV, 0, segv, 0, m_cfbState->RegisterSize);
+
+	for (j = 1; j < m_parallelProfile.ParallelMaxDegree(); ++j)
+	{
+		MemoryTools::Copy(Input, (InOffset + (j * SEGLEN)) - m_cfbState->RegisterSize, segv, j * BLOCK_SIZE, m_cfbState->RegisterSize);
+	}
 
-	ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, &Output, OutOffset, &tmpv, SEGLEN, BLKCNT](size_t i)
+	ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, &Output, OutOffset, &segv, &tmpv, SEGLEN, BLKCNT](size_t i)
 	{
 		std::vector<byte> thdv(BLOCK_SIZE);
 
-		if (i != 0)
-		{
-			MemoryTools::Copy(Input, (InOffset + (i * SEGLEN)) - m_cfbState->RegisterSize, thdv, 0, m_cfbState->RegisterSize);
-		}
-		else
-		{
-			MemoryTools::Copy(m_cfbState->IV, 0, thdv, 0, m_cfbState->RegisterSize);
-		}
+		MemoryTools::Copy(segv, i * BLOCK_SIZE, thdv, 0, m_cfbState->RegisterSize);
 
 		this->DecryptSegment(Input, InOffset + i * SEGLEN, Output, OutOffset + i * SEGLEN, thdv, BLKCNT);
 
@@ -287,14 +296,15 @@ void CFB::DecryptParallel(const std::vector<byte> &Input, size_t InOffset, std::
 	MemoryTools::Copy(tmpv, 0, m_cfbState->IV, 0, m_cfbState->RegisterSize);
 }
 
-void CFB::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount)
+void CFB::DecryptSegment(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount)
 {
+	std::vector<byte> tmpr(BLOCK_SIZE);
 	size_t i;
 	size_t j;
 
 	for (i = 0; i < BlockCount; i++)
 	{ 
-		m_blockCipher->Transform(Iv, 0, Output, OutOffset);
+		m_blockCipher->Transform(Iv, 0, tmpr, 0);
 
 		// left shift the register
 		if (Iv.size() - m_cfbState->RegisterSize > 0)
@@ -308,7 +318,7 @@ void CFB::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 		// xor the iv with the ciphertext producing the plaintext
 		for (j = 0; j < m_cfbState->RegisterSize; j++)
 		{
-			Output[OutOffset + j] ^= Input[InOffset + j];
+			Output[OutOffset + j] = tmpr[j] ^ Input[InOffset + j];
 		}
 
 		InOffset += BLOCK_SIZE;
@@ -316,19 +326,18 @@ void CFB::DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::v
 	}
 }
 
-void CFB::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void CFB::Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	std::vector<byte> tmpr(BLOCK_SIZE);
 	size_t i;
 
 	// encrypt the register
 	m_blockCipher->Transform(m_cfbState->IV, 0, tmpr, 0);
-	MemoryTools::Copy(tmpr, 0, Output, OutOffset, m_cfbState->RegisterSize);
 
 	// xor the ciphertext with the plaintext by block size bytes
 	for (i = 0; i < m_cfbState->RegisterSize; i++)
 	{
-		Output[OutOffset + i] ^= Input[InOffset + i];
+		Output[OutOffset + i] = tmpr[i] ^ Input[InOffset + i];
 	}
 
 	// left shift the register
@@ -341,7 +350,7 @@ void CFB::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	MemoryTools::Copy(Output, OutOffset, m_cfbState->IV, m_cfbState->IV.size() - m_cfbState->RegisterSize, m_cfbState->RegisterSize);
 }
 
-void CFB::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void CFB::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 
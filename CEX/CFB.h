@@ -304,13 +304,26 @@ public:
 	/// <param name="Length">The number of bytes to transform</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The blocks are read from and written to the callers memory directly, without an intermediate vector.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// If IsParallel() is set to true, and the length is at least ParallelBlockSize(), decryption is run in parallel processing mode.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer, receiving Length bytes</param>
+	/// <param name="Length">The number of bytes to transform; must be evenly divisible by the register size</param>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 private:
 
-	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void DecryptParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void DecryptSegment(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount);
-	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
+	void Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void DecryptParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void DecryptSegment(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, std::vector<byte> &Iv, size_t BlockCount);
+	void Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
 };
 
 NAMESPACE_MODEEND
@@ -162,6 +162,18 @@ size_t CMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The Output buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
+	return Finalize(Output.data() + OutOffset);
+}
+
+size_t CMAC::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, TagSize());
+
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
 	Pad(m_cmacState->Buffer, m_cmacState->Position, m_cmacState->Buffer.size());
 
 	if (m_cmacState->Position != BLOCK_SIZE)
@@ -174,7 +186,7 @@ size_t CMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 	}
 
 	m_cbcMode->EncryptBlock(m_cmacState->Buffer, 0, m_cmacState->State, 0);
-	MemoryTools::Copy(m_cmacState->State, 0, Output, OutOffset, TagSize());
+	MemoryTools::Copy(m_cmacState->State, 0, OTP, 0, TagSize());
 
 	return TagSize();
 }
@@ -256,6 +268,47 @@ void CMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 		throw CryptoMacException(Name(), std::string("Update"), std::string("The Input buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
+	Process(Input, InOffset, Length);
+}
+
+void CMAC::Update(const byte* Input, size_t Length)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Update"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void CMAC::DoubleLu(const std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	uint carry;
+
+	carry = ShiftLeft(Input, Output);
+	// fixed on const 128; all implemented block ciphers are 128-bit
+	Output[Input.size() - 1] ^= static_cast<byte>(MIX_C128 >> ((1 - carry) << 3));
+}
+
+void CMAC::Pad(std::vector<byte> &Input, size_t Offset, size_t Length)
+{
+	if (Offset != Length)
+	{
+		Input[Offset] = CMAC_FINAL;
+		++Offset;
+
+		while (Offset < Length)
+		{
+			Input[Offset] = 0x00;
+			++Offset;
+		}
+	}
+}
+
+void CMAC::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_cmacState->Position == BLOCK_SIZE)
@@ -276,7 +329,7 @@ void CMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 
 			while (Length > BLOCK_SIZE)
 			{
-				m_cbcMode->EncryptBlock(Input, InOffset, m_cmacState->State, 0);
+				m_cbcMode->Transform(Input.data() + InOffset, m_cmacState->State.data(), BLOCK_SIZE);
 				Length -= BLOCK_SIZE;
 				InOffset += BLOCK_SIZE;
 			}
@@ -290,32 +343,6 @@ void CMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 	}
 }
 
-//~~~Private Functions~~~//
-
-void CMAC::DoubleLu(const std::vector<byte> &Input, std::vector<byte> &Output)
-{
-	uint carry;
-
-	carry = ShiftLeft(Input, Output);
-	// fixed on const 128; all implemented block ciphers are 128-bit
-	Output[Input.size() - 1] ^= static_cast<byte>(MIX_C128 >> ((1 - carry) << 3));
-}
-
-void CMAC::Pad(std::vector<byte> &Input, size_t Offset, size_t Length)
-{
-	if (Offset != Length)
-	{
-		Input[Offset] = CMAC_FINAL;
-		++Offset;
-
-		while (Offset < Length)
-		{
-			Input[Offset] = 0x00;
-			++Offset;
-		}
-	}
-}
-
 uint CMAC::ShiftLeft(const std::vector<byte> &Input, std::vector<byte> &Output)
 {
 	// TODO: worth vectorizing in IntegerTools?
@@ -4,9 +4,36 @@
 #	include "Intrinsics.h"
 #endif
 
+#include "MemoryTools.h"
+
 NAMESPACE_NUMERIC
 
 using Tools::IntegerTools;
+using Tools::MemoryTools;
+
+void CMUL::PreCompute(const std::array<ulong, CMUL_STATE_SIZE> &State, std::array<ulong, CMUL_POWERS_SIZE> &Powers)
+{
+	std::array<ulong, CMUL_STATE_SIZE> tmpk;
+	std::array<byte, CMUL_BLOCK_SIZE> tmph;
+	size_t i;
+
+	tmpk = State;
+	Powers[0] = State[0];
+	Powers[1] = State[1];
+	IntegerTools::Be64ToBytes(State[0], tmph, 0);
+	IntegerTools::Be64ToBytes(State[1], tmph, sizeof(ulong));
+
+	// H^(i+1) = H^i * H
+	for (i = 1; i < CMUL_PARALLEL_BLOCKS; ++i)
+	{
+		PermuteR128P128U(tmpk, tmph);
+		Powers[i * CMUL_STATE_SIZE] = IntegerTools::BeBytesTo64(tmph, 0);
+		Powers[(i * CMUL_STATE_SIZE) + 1] = IntegerTools::BeBytesTo64(tmph, sizeof(ulong));
+	}
+
+	MemoryTools::Clear(tmph, 0, tmph.size());
+	MemoryTools::Clear(tmpk, 0, tmpk.size() * sizeof(ulong));
+}
 
 void CMUL::PermuteR128P128U(std::array<ulong, CMUL_STATE_SIZE> &State, std::array<byte, CMUL_BLOCK_SIZE> &Output)
 {
@@ -1171,4 +1198,94 @@ void CMUL::PermuteR128P128V(std::array<ulong, CMUL_STATE_SIZE> &State, std::arra
 #endif
 }
 
+void CMUL::PermuteR128P1024V(const std::array<ulong, CMUL_POWERS_SIZE> &Powers, const Span<const byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output)
+{
+#if defined(CEX_HAS_AVX2)
+
+	const __m128i MASK = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i SWAP = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+	__m128i A;
+	__m128i B;
+	__m128i T0;
+	__m128i T1;
+	__m128i T2;
+	__m128i T3;
+	__m128i T4;
+	__m128i T5;
+	size_t i;
+
+	// the running hash is added to the first block
+	A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Output.data()));
+	A = _mm_xor_si128(A, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset)));
+	T0 = _mm_setzero_si128();
+	T1 = _mm_setzero_si128();
+	T3 = _mm_setzero_si128();
+
+	// accumulate the unreduced products of each block and its power of H; block i is multiplied by H^(8-i)
+	for (i = 0; i < CMUL_PARALLEL_BLOCKS; ++i)
+	{
+		if (i != 0)
+		{
+			A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + (i * CMUL_BLOCK_SIZE)));
+		}
+
+		B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Powers.data() + ((CMUL_PARALLEL_BLOCKS - 1 - i) * CMUL_STATE_SIZE)));
+		A = _mm_shuffle_epi8(A, MASK);
+		B = _mm_shuffle_epi8(B, SWAP);
+		B = _mm_shuffle_epi8(B, MASK);
+		T0 = _mm_xor_si128(T0, _mm_clmulepi64_si128(A, B, 0x00));
+		T1 = _mm_xor_si128(T1, _mm_clmulepi64_si128(A, B, 0x01));
+		T1 = _mm_xor_si128(T1, _mm_clmulepi64_si128(A, B, 0x10));
+		T3 = _mm_xor_si128(T3, _mm_clmulepi64_si128(A, B, 0x11));
+	}
+
+	// the reduction is linear, one reduction of the sum is applied
+	T2 = _mm_slli_si128(T1, 8);
+	T1 = _mm_srli_si128(T1, 8);
+	T0 = _mm_xor_si128(T0, T2);
+	T3 = _mm_xor_si128(T3, T1);
+	T4 = _mm_srli_epi32(T0, 31);
+	T0 = _mm_slli_epi32(T0, 1);
+	T5 = _mm_srli_epi32(T3, 31);
+	T3 = _mm_slli_epi32(T3, 1);
+	T2 = _mm_srli_si128(T4, 12);
+	T5 = _mm_slli_si128(T5, 4);
+	T4 = _mm_slli_si128(T4, 4);
+	T0 = _mm_or_si128(T0, T4);
+	T3 = _mm_or_si128(T3, T5);
+	T3 = _mm_or_si128(T3, T2);
+	T4 = _mm_slli_epi32(T0, 31);
+	T5 = _mm_slli_epi32(T0, 30);
+	T2 = _mm_slli_epi32(T0, 25);
+	T4 = _mm_xor_si128(T4, T5);
+	T4 = _mm_xor_si128(T4, T2);
+	T5 = _mm_srli_si128(T4, 4);
+	T3 = _mm_xor_si128(T3, T5);
+	T4 = _mm_slli_si128(T4, 12);
+	T0 = _mm_xor_si128(T0, T4);
+	T3 = _mm_xor_si128(T3, T0);
+	T4 = _mm_srli_epi32(T0, 1);
+	T1 = _mm_srli_epi32(T0, 2);
+	T2 = _mm_srli_epi32(T0, 7);
+	T3 = _mm_xor_si128(T3, T1);
+	T3 = _mm_xor_si128(T3, T2);
+	T3 = _mm_xor_si128(T3, T4);
+	T3 = _mm_shuffle_epi8(T3, MASK);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data()), T3);
+
+#else
+
+	std::array<ulong, CMUL_STATE_SIZE> tmpk = { Powers[0], Powers[1] };
+	size_t i;
+
+	for (i = 0; i < CMUL_PARALLEL_BLOCKS; ++i)
+	{
+		MemoryTools::XOR128(Input, InOffset + (i * CMUL_BLOCK_SIZE), Output, 0);
+		PermuteR128P128C(tmpk, Output);
+	}
+
+#endif
+}
+
 NAMESPACE_NUMERICEND
\ No newline at end of file
@@ -20,6 +20,7 @@
 #define CEX_CMUL_H
 
 #include "CexDomain.h"
+#include "Span.h"
 
 NAMESPACE_NUMERIC
 
@@ -37,6 +38,25 @@ public:
 	/// </summary>
 	static const size_t CMUL_STATE_SIZE = 2;
 
+	/// <summary>
+	/// The number of blocks processed by the aggregated CMUL permutation function
+	/// </summary>
+	static const size_t CMUL_PARALLEL_BLOCKS = 8;
+
+	/// <summary>
+	/// The hash key powers array size in uint64 integers (H^1 to H^8)
+	/// </summary>
+	static const size_t CMUL_POWERS_SIZE = CMUL_PARALLEL_BLOCKS * CMUL_STATE_SIZE;
+
+	/// <summary>
+	/// Compute the powers of the hash key used by the aggregated CMUL permutation function.
+	/// <para>The powers are stored in ascending order, H^1 at index 0, each as a big-endian pair of uint64 integers in the same format as the state array.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The permutations uint64 state array containing the hash key</param>
+	/// <param name="Powers">The array receiving the hash key powers</param>
+	static void PreCompute(const std::array<ulong, CMUL_STATE_SIZE> &State, std::array<ulong, CMUL_POWERS_SIZE> &Powers);
+
 	/// <summary>
 	/// The compact form of the 128 round (standard) CMUL permutation function.
 	/// <para>This function has been optimized for a small memory consumption.
@@ -65,6 +85,20 @@ public:
 	/// <param name="State">The permutations uint64 state array</param>
 	/// <param name="Output">The output buffer receiving the permuted state</param>
 	static void PermuteR128P128V(std::array<ulong, CMUL_STATE_SIZE> &State, std::array<byte, CMUL_BLOCK_SIZE> &Output);
+
+	/// <summary>
+	/// The vertically vectorized and aggregated form of the 128 round (standard) CMUL permutation function.
+	/// <para>Absorbs 8 blocks in one call; each block is multiplied by the matching power of the hash key (H^8 to H^1),
+	/// the products are summed, and a single reduction is applied to the sum.
+	/// The result is identical to 8 sequential calls to the 128 bit permutation.
+	/// This function uses the SIMD instructions.</para>
+	/// </summary>
+	/// 
+	/// <param name="Powers">The hash key powers array created by the PreCompute function</param>
+	/// <param name="Input">The input array containing the 8 message blocks</param>
+	/// <param name="InOffset">The starting offset within the input array</param>
+	/// <param name="Output">The output buffer containing the running hash, receiving the permuted state</param>
+	static void PermuteR128P1024V(const std::array<ulong, CMUL_POWERS_SIZE> &Powers, const Span<const byte> &Input, size_t InOffset, std::array<byte, CMUL_BLOCK_SIZE> &Output);
 };
 
 NAMESPACE_NUMERICEND
@@ -688,27 +688,15 @@ void CSG::Permute(std::unique_ptr<CsgState> &State)
 	{
 		// use the double-round 48 round permutation
 #if defined(CEX_KECCAK_STRONG)
-#	if defined(CEX_DIGEST_COMPACT)
-		Keccak::PermuteR48P1600C(State->State[State->Index]);
-#	else
-		Keccak::PermuteR48P1600U(State->State[State->Index]);
-#	endif
+		Keccak::PermuteR48P1600(State->State[State->Index]);
 #else
 		// use the standard 24 round permutation
-#	if defined(CEX_DIGEST_COMPACT)
-		Keccak::PermuteR24P1600C(State->State[State->Index]);
-#	else
-		Keccak::PermuteR24P1600U(State->State[State->Index]);
-#	endif
+		Keccak::PermuteR24P1600(State->State[State->Index]);
 #endif
 	}
 	else
 	{
-#if defined(CEX_DIGEST_COMPACT)
-		Keccak::PermuteR48P1600C(State->State[State->Index]);
-#else
-		Keccak::PermuteR48P1600U(State->State[State->Index]);
-#endif
+		Keccak::PermuteR48P1600(State->State[State->Index]);
 	}
 }
 
@@ -24,41 +24,99 @@ using Kdf::SHAKE;
 const std::string CSX256::CLASS_NAME("CSX256");
 const std::vector<byte> CSX256::SIGMA_INFO = { 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x33, 0x32, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6B };
 
+class CSX256::CSX256Key final : public KeyContext
+{
+public:
+
+	SecureVector<byte> CipherKey;
+	SecureVector<byte> Custom;
+	SecureVector<byte> MacKey;
+	std::string CipherName;
+	bool IsAuthenticated;
+
+	CSX256Key()
+		:
+		CipherKey(0),
+		Custom(0),
+		MacKey(0),
+		CipherName(""),
+		IsAuthenticated(false)
+	{
+	}
+
+	~CSX256Key() override
+	{
+		MemoryTools::Clear(CipherKey, 0, CipherKey.size());
+		MemoryTools::Clear(Custom, 0, Custom.size());
+		MemoryTools::Clear(MacKey, 0, MacKey.size());
+		IsAuthenticated = false;
+	}
+
+	const std::string Name() override
+	{
+		return CipherName;
+	}
+};
+
 class CSX256::CSX256State
 {
 public:
 
 	std::array<uint, 2> Nonce = { 0UL };
 	std::array<uint, 14> State = { 0UL };
+	std::shared_ptr<const CSX256Key> Key;
 	SecureVector<byte> Custom;
 	SecureVector<byte> MacKey;
 	SecureVector<byte> MacTag;
 	ulong Counter;
+	ulong Offset;
 	bool IsAuthenticated;
 	bool IsEncryption;
 	bool IsInitialized;
+	bool IsShared;
 
 	CSX256State(bool Authenticate)
 		:
+		Key(nullptr),
 		Custom(0),
 		MacKey(0),
 		MacTag(0),
 		Counter(0),
+		Offset(0),
 		IsAuthenticated(Authenticate),
 		IsEncryption(false),
-		IsInitialized(false)
+		IsInitialized(false),
+		IsShared(false)
+	{
+	}
+
+	CSX256State(const std::shared_ptr<const CSX256Key> &Context)
+		:
+		Key(Context),
+		Custom(Context->Custom),
+		MacKey(Context->MacKey),
+		MacTag(0),
+		Counter(0),
+		Offset(0),
+		IsAuthenticated(Context->IsAuthenticated),
+		IsEncryption(false),
+		IsInitialized(false),
+		IsShared(true)
 	{
 	}
 
 	CSX256State(SecureVector<byte> &State)
 		:
+		Key(nullptr),
 		Custom(0),
 		MacKey(0),
 		MacTag(0),
 		Counter(0),
+		Offset(0),
 		IsAuthenticated(false),
 		IsEncryption(false),
-		IsInitialized(false)
+		IsInitialized(false),
+		IsShared(false)
 	{
 		DeSerialize(State);
 	}
@@ -110,23 +168,50 @@ public:
 		MemoryTools::CopyToObject(SecureState, soff, &IsEncryption, sizeof(bool));
 		soff += sizeof(bool);
 		MemoryTools::CopyToObject(SecureState, soff, &IsInitialized, sizeof(bool));
+		soff += sizeof(bool);
+
+		// the seek offset was appended to the state format, a state serialized without it can not be restored
+		if (SecureState.size() < soff + sizeof(ulong))
+		{
+			throw CryptoSymmetricException(std::string("CSX256"), std::string("Constructor"), std::string("The State array was serialized by an earlier version and can not be restored!"), ErrorCodes::InvalidState);
+		}
+
+		MemoryTools::CopyToObject(SecureState, soff, &Offset, sizeof(ulong));
+
+		// rebuild the key context from the restored state
+		std::shared_ptr<CSX256Key> tmpk(new CSX256Key());
+		tmpk->CipherKey.resize(KEY_SIZE);
+
+		for (size_t i = 0; i < KEY_SIZE / sizeof(uint); ++i)
+		{
+			IntegerTools::Le32ToBytes(State[4 + i], tmpk->CipherKey, i * sizeof(uint));
+		}
+
+		tmpk->Custom = Custom;
+		tmpk->MacKey = MacKey;
+		tmpk->IsAuthenticated = IsAuthenticated;
+		tmpk->CipherName = CLASS_NAME + (IsAuthenticated ? std::string("-") + Enumeration::StreamAuthenticatorConvert::ToName(StreamAuthenticators::KMAC256) : std::string(""));
+		Key = tmpk;
 	}
 
 	void Reset()
 	{
+		Key.reset();
 		MemoryTools::Clear(Custom, 0, Custom.size());
 		MemoryTools::Clear(MacKey, 0, MacKey.size());
 		MemoryTools::Clear(Nonce, 0, Nonce.size() * sizeof(uint));
 		MemoryTools::Clear(State, 0, State.size() * sizeof(uint));
 		MemoryTools::Clear(MacTag, 0, MacTag.size());
 		Counter = 0;
+		Offset = 0;
 		IsEncryption = false;
 		IsInitialized = false;
+		IsShared = false;
 	}
 
 	SecureVector<byte> Serialize()
 	{
-		const size_t STALEN = ((State.size() * sizeof(uint)) + Custom.size() + MacKey.size() + MacTag.size() + (Nonce.size() * sizeof(uint)) + sizeof(ulong) + (3 * sizeof(ushort)) + (3 * sizeof(bool)));
+		const size_t STALEN = ((State.size() * sizeof(uint)) + Custom.size() + MacKey.size() + MacTag.size() + (Nonce.size() * sizeof(uint)) + (2 * sizeof(ulong)) + (3 * sizeof(ushort)) + (3 * sizeof(bool)));
 
 		size_t soff;
 		ushort vlen;
@@ -166,6 +251,8 @@ public:
 		MemoryTools::CopyFromObject(&IsEncryption, state, soff, sizeof(bool));
 		soff += sizeof(bool);
 		MemoryTools::CopyFromObject(&IsInitialized, state, soff, sizeof(bool));
+		soff += sizeof(bool);
+		MemoryTools::CopyFromObject(&Offset, state, soff, sizeof(ulong));
 
 		return state;
 	}
@@ -199,6 +286,18 @@ CSX256::CSX256(SecureVector<byte> &State)
 	}
 }
 
+CSX256::CSX256(const std::shared_ptr<KeyContext> &Context)
+	:
+	m_csx256State(std::dynamic_pointer_cast<const CSX256Key>(Context) != nullptr ? new CSX256State(std::dynamic_pointer_cast<const CSX256Key>(Context)) :
+		throw CryptoSymmetricException(std::string("CSX256"), std::string("Constructor"), std::string("The key context is null or was not created by CSX256!"), ErrorCodes::InvalidParam)),
+	m_legalKeySizes{ SymmetricKeySize(KEY_SIZE, NONCE_SIZE * sizeof(uint), INFO_SIZE) },
+	m_macAuthenticator(m_csx256State->IsAuthenticated == false ?
+		nullptr :
+		new KMAC(KmacModes::KMAC256)),
+	m_parallelProfile(BLOCK_SIZE, true, STATE_PRECACHED, true)
+{
+}
+
 CSX256::~CSX256()
 {
 	if (m_csx256State != nullptr)
@@ -216,6 +315,16 @@ CSX256::~CSX256()
 
 //~~~Accessors~~~//
 
+const std::shared_ptr<KeyContext> CSX256::Context()
+{
+	if (m_csx256State->Key == nullptr)
+	{
+		throw CryptoSymmetricException(std::string("CSX256"), std::string("Context"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	return std::const_pointer_cast<CSX256Key>(m_csx256State->Key);
+}
+
 const StreamCiphers CSX256::Enumeral() 
 {
 	StreamAuthenticators auth;
@@ -315,7 +424,18 @@ const size_t CSX256::TagSize()
 
 void CSX256::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
-	if (Parameters.KeySizes().KeySize() != KEY_SIZE)
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		if (m_csx256State->Key == nullptr)
+		{
+			throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
+		}
+	}
+	else if (m_csx256State->IsShared)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("An instance using a shared key context can not be re-keyed!"), ErrorCodes::IllegalOperation);
+	}
+	else if (Parameters.KeySizes().KeySize() != KEY_SIZE)
 	{
 		throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes in length."), ErrorCodes::InvalidKey);
 	}
@@ -329,6 +449,9 @@ void CSX256::Initialize(bool Encryption, ISymmetricKey &Parameters)
 	}
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -339,29 +462,51 @@ void CSX256::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		}
 	}
 
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		// a nonce-only key re-uses the derived key, only the nonce, counter, and mac state are reset
+		MemoryTools::Clear(m_csx256State->Nonce, 0, m_csx256State->Nonce.size() * sizeof(uint));
+		m_csx256State->Counter = 0;
+		m_csx256State->Offset = 0;
+		Load(m_csx256State->Key->CipherKey, Parameters.SecureIV(), m_csx256State->Key->Custom);
+
+		if (IsAuthenticator())
+		{
+			SymmetricKey kpm(m_csx256State->Key->MacKey);
+			m_macAuthenticator->Initialize(kpm);
+			m_csx256State->MacTag.resize(TagSize());
+		}
+
+		m_csx256State->IsEncryption = Encryption;
+		m_csx256State->IsInitialized = true;
+
+		return;
+	}
+
 	// reset the counter and mac
-	if (IsInitialized() == true)
+	if (IsInitialized() == true || m_csx256State->Key != nullptr)
 	{
 		Reset();
 	}
 
-	m_csx256State->Custom.resize(INFO_SIZE);
+	// the derived key is stored in a new context, a context shared by other instances is never modified
+	std::shared_ptr<CSX256Key> tmpk(new CSX256Key());
+	tmpk->Custom.resize(INFO_SIZE);
 
 	if (Parameters.KeySizes().InfoSize() != 0)
 	{
 		// custom code
-		MemoryTools::Copy(Parameters.Info(), 0, m_csx256State->Custom, 0, IntegerTools::Min(Parameters.KeySizes().InfoSize(), m_csx256State->Custom.size()));
+		MemoryTools::Copy(Parameters.Info(), 0, tmpk->Custom, 0, IntegerTools::Min(Parameters.KeySizes().InfoSize(), tmpk->Custom.size()));
 	}
 	else
 	{
 		// standard
-		MemoryTools::Copy(SIGMA_INFO, 0, m_csx256State->Custom, 0, SIGMA_INFO.size());
+		MemoryTools::Copy(SIGMA_INFO, 0, tmpk->Custom, 0, SIGMA_INFO.size());
 	}
 
 	if (IsAuthenticator() == false)
 	{
-		// add key and nonce to state
-		Load(Parameters.SecureKey(), Parameters.SecureIV(), m_csx256State->Custom);
+		tmpk->CipherKey = Parameters.SecureKey();
 	}
 	else
 	{
@@ -379,27 +524,29 @@ void CSX256::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		gen.Initialize(Parameters.SecureKey(), zero, name);
 
 		// generate the new cipher key
-		SecureVector<byte> cprk(KEY_SIZE);
-		gen.Generate(cprk);
-
-		// load the ciphers state
-		Load(cprk, Parameters.SecureIV(), m_csx256State->Custom);
+		tmpk->CipherKey.resize(KEY_SIZE);
+		gen.Generate(tmpk->CipherKey);
 
 		// generate the mac key
 		SymmetricKeySize ks = m_macAuthenticator->LegalKeySizes()[1];
-		SecureVector<byte> mack(ks.KeySize());
-		gen.Generate(mack);
+		tmpk->MacKey.resize(ks.KeySize());
+		gen.Generate(tmpk->MacKey);
 
 		// initialize the mac
-		SymmetricKey kpm(mack);
+		SymmetricKey kpm(tmpk->MacKey);
 		m_macAuthenticator->Initialize(kpm);
 		m_csx256State->MacTag.resize(TagSize());
-
-		// store mac key for serializaztion
-		m_csx256State->MacKey.resize(mack.size());
-		SecureMove(mack, m_csx256State->MacKey, 0);
 	}
 
+	// add key and nonce to state
+	Load(tmpk->CipherKey, Parameters.SecureIV(), tmpk->Custom);
+
+	// store the custom code and mac key for serialization
+	m_csx256State->Custom = tmpk->Custom;
+	m_csx256State->MacKey = tmpk->MacKey;
+	tmpk->IsAuthenticated = IsAuthenticator();
+	tmpk->CipherName = Name();
+	m_csx256State->Key = tmpk;
 	m_csx256State->IsEncryption = Encryption;
 	m_csx256State->IsInitialized = true;
 }
@@ -414,6 +561,24 @@ void CSX256::ParallelMaxDegree(size_t Degree)
 	m_parallelProfile.SetMaxDegree(Degree);
 }
 
+void CSX256::Seek(ulong Position)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Seek"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (IsAuthenticator() == true)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Seek"), std::string("The MAC is computed over the whole message; an authenticated cipher can not seek!"), ErrorCodes::IllegalOperation);
+	}
+
+	// the block counter starts at zero, the position is the block index
+	const ulong BLKIDX = Position / BLOCK_SIZE;
+	m_csx256State->Nonce[0] = static_cast<uint>(BLKIDX);
+	m_csx256State->Nonce[1] = static_cast<uint>(BLKIDX >> 32);
+	m_csx256State->Offset = Position % BLOCK_SIZE;
+}
+
 SecureVector<byte> CSX256::Serialize()
 {
 	SecureVector<byte> tmps = m_csx256State->Serialize();
@@ -438,57 +603,20 @@ void CSX256::SetAssociatedData(const std::vector<byte> &Input, size_t Offset, si
 
 void CSX256::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
 {
-	if (IsEncryption() == true)
+	if (IsEncryption() == true && IsAuthenticator() == true && Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
 	{
-		if (IsAuthenticator() == true)
-		{
-			if (Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
-			{
-				throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
-			}
-
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[0]), 0, sizeof(uint));
-			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[1]), 0, sizeof(uint));
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Output, OutOffset, Length);
-			// update the mac counter
-			m_csx256State->Counter += Length;
-			// finalize the mac and add the tag to the stream
-			Finalize(m_csx256State, m_macAuthenticator);
-			MemoryTools::Copy(m_csx256State->MacTag, 0, Output, OutOffset + Length, m_csx256State->MacTag.size());
-		}
-		else
-		{
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-		}
+		throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
 	}
-	else
-	{
-		if (IsAuthenticator())
-		{
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[0]), 0, sizeof(uint));
-			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[1]), 0, sizeof(uint));
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Input, InOffset, Length);
-			// update the mac counter
-			m_csx256State->Counter += Length;
-			// finalize the mac and verify
-			Finalize(m_csx256State, m_macAuthenticator);
 
-			if (!IntegerTools::Compare(Input, InOffset + Length, m_csx256State->MacTag, 0, m_csx256State->MacTag.size()))
-			{
-				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-			}
-		}
+	ProcessStream(Input, InOffset, Output, OutOffset, Length);
+}
 
-		// decrypt the stream
-		Process(Input, InOffset, Output, OutOffset, Length);
-	}
+void CSX256::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	const size_t INPLEN = (IsEncryption() == false && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+	const size_t OTPLEN = (IsEncryption() == true && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+
+	ProcessStream(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -507,7 +635,7 @@ void CSX256::Finalize(std::unique_ptr<CSX256State> &State, std::unique_ptr<IMac>
 	Authenticator->Finalize(State->MacTag, 0);
 }
 
-void CSX256::Generate(std::unique_ptr<CSX256State> &State, std::array<uint, 2> &Counter, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void CSX256::Generate(std::unique_ptr<CSX256State> &State, std::array<uint, 2> &Counter, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	size_t ctr;
 
@@ -690,28 +818,78 @@ void CSX256::Load(const SecureVector<byte> &Key, const SecureVector<byte> &Nonce
 	m_csx256State->State[13] = IntegerTools::LeBytesTo32(Nonce, 4);
 }
 
-void CSX256::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void CSX256::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
+	if (m_csx256State->Offset != 0 && Length != 0)
+	{
+		// finish the partial block left by a Seek, then continue block aligned
+		const size_t BLKOFT = static_cast<size_t>(m_csx256State->Offset);
+		const size_t PRTLEN = IntegerTools::Min(BLOCK_SIZE - BLKOFT, Length);
+		std::array<uint, NONCE_SIZE> tmpc = m_csx256State->Nonce;
+		std::vector<byte> otp(BLOCK_SIZE);
+
+		Generate(m_csx256State, tmpc, otp, 0, BLOCK_SIZE);
+
+		for (size_t i = 0; i < PRTLEN; ++i)
+		{
+			Output[OutOffset + i] = Input[InOffset + i] ^ otp[BLKOFT + i];
+		}
+
+		m_csx256State->Offset += PRTLEN;
+
+		if (m_csx256State->Offset == BLOCK_SIZE)
+		{
+			// the block is consumed, keep the incremented counter
+			m_csx256State->Nonce = tmpc;
+			m_csx256State->Offset = 0;
+		}
+
+		InOffset += PRTLEN;
+		OutOffset += PRTLEN;
+		Length -= PRTLEN;
+	}
+
 	const size_t PRCLEN = (Length >= Input.size() - InOffset) && Length >= Output.size() - OutOffset ? IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) : Length;
 
 	if (!m_parallelProfile.IsParallel() || PRCLEN < m_parallelProfile.ParallelMinimumSize())
 	{
-		// generate random
-		Generate(m_csx256State, m_csx256State->Nonce, Output, OutOffset, PRCLEN);
-		// output is input xor random
-		const size_t ALNLEN = PRCLEN - (PRCLEN % BLOCK_SIZE);
-
-		if (ALNLEN != 0)
+		if (Input.data() + InOffset != Output.data() + OutOffset)
 		{
-			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
-		}
+			// generate random
+			Generate(m_csx256State, m_csx256State->Nonce, Output, OutOffset, PRCLEN);
+			// output is input xor random
+			const size_t ALNLEN = PRCLEN - (PRCLEN % BLOCK_SIZE);
 
-		// get the remaining bytes
-		if (ALNLEN != PRCLEN)
+			if (ALNLEN != 0)
+			{
+				MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+			}
+
+			// get the remaining bytes
+			if (ALNLEN != PRCLEN)
+			{
+				for (size_t i = ALNLEN; i < PRCLEN; ++i)
+				{
+					Output[i + OutOffset] ^= Input[i + InOffset];
+				}
+			}
+		}
+		else
 		{
-			for (size_t i = ALNLEN; i < PRCLEN; ++i)
+			// in-place; the key-stream is generated to a temporary buffer in block-aligned segments
+			const size_t SEGLEN = 64 * BLOCK_SIZE;
+			std::vector<byte> tmpk(PRCLEN < SEGLEN ? PRCLEN : SEGLEN);
+			size_t plen;
+			size_t pos;
+
+			pos = 0;
+
+			while (pos != PRCLEN)
 			{
-				Output[i + OutOffset] ^= Input[i + InOffset];
+				plen = (PRCLEN - pos < tmpk.size()) ? PRCLEN - pos : tmpk.size();
+				Generate(m_csx256State, m_csx256State->Nonce, tmpk, 0, plen);
+				MemoryTools::XOR(tmpk, 0, Output, OutOffset + pos, plen);
+				pos += plen;
 			}
 		}
 	}
@@ -730,10 +908,21 @@ void CSX256::Process(const std::vector<byte> &Input, size_t InOffset, std::vecto
 			// offset counter by chunk size / block size
 			IntegerTools::LeIncreaseW(m_csx256State->Nonce, thdCtr, CTRLEN * i);
 			const size_t STMPOS = i * CNKLEN;
-			// create random at offset position
-			this->Generate(m_csx256State, thdCtr, Output, OutOffset + STMPOS, CNKLEN);
-			// xor with input at offset
-			MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+
+			if (Input.data() + InOffset != Output.data() + OutOffset)
+			{
+				// create random at offset position
+				this->Generate(m_csx256State, thdCtr, Output, OutOffset + STMPOS, CNKLEN);
+				// xor with input at offset
+				MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+			}
+			else
+			{
+				// in-place; the key-stream is generated to a thread buffer
+				std::vector<byte> thdk(CNKLEN);
+				this->Generate(m_csx256State, thdCtr, thdk, 0, CNKLEN);
+				MemoryTools::XOR(thdk, 0, Output, OutOffset + STMPOS, CNKLEN);
+			}
 			// store last counter
 			if (i == m_parallelProfile.ParallelMaxDegree() - 1)
 			{
@@ -748,16 +937,68 @@ void CSX256::Process(const std::vector<byte> &Input, size_t InOffset, std::vecto
 		if (RNDLEN < PRCLEN)
 		{
 			const size_t FNLLEN = PRCLEN % RNDLEN;
-			Generate(m_csx256State, m_csx256State->Nonce, Output, RNDLEN, FNLLEN);
+			std::vector<byte> fnlk(FNLLEN);
+
+			Generate(m_csx256State, m_csx256State->Nonce, fnlk, 0, FNLLEN);
 
 			for (size_t i = 0; i < FNLLEN; ++i)
 			{
-				Output[i + OutOffset + RNDLEN] ^= static_cast<byte>(Input[i + InOffset + RNDLEN]);
+				Output[OutOffset + RNDLEN + i] = Input[InOffset + RNDLEN + i] ^ fnlk[i];
 			}
 		}
 	}
 }
 
+void CSX256::ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (IsEncryption() == true)
+	{
+		if (IsAuthenticator() == true)
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[0]), 0, sizeof(uint));
+			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[1]), 0, sizeof(uint));
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Output.data() + OutOffset, Length);
+			// update the mac counter
+			m_csx256State->Counter += Length;
+			// finalize the mac and add the tag to the stream
+			Finalize(m_csx256State, m_macAuthenticator);
+			MemoryTools::Copy(m_csx256State->MacTag, 0, Output, OutOffset + Length, m_csx256State->MacTag.size());
+		}
+		else
+		{
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+		}
+	}
+	else
+	{
+		if (IsAuthenticator())
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[0]), 0, sizeof(uint));
+			m_macAuthenticator->Update(IntegerTools::Le32ToBytes<std::vector<byte>>(m_csx256State->Nonce[1]), 0, sizeof(uint));
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Input.data() + InOffset, Length);
+			// update the mac counter
+			m_csx256State->Counter += Length;
+			// finalize the mac and verify
+			Finalize(m_csx256State, m_macAuthenticator);
+
+			if (!IntegerTools::Compare(Input, InOffset + Length, m_csx256State->MacTag, 0, m_csx256State->MacTag.size()))
+			{
+				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+			}
+		}
+
+		// decrypt the stream
+		Process(Input, InOffset, Output, OutOffset, Length);
+	}
+}
+
 void CSX256::Reset()
 {
 	m_csx256State->Reset();
@@ -34,6 +34,7 @@
 #define CEX_CSX256_H
 
 #include "IStreamCipher.h"
+#include "KeyContext.h"
 #include "ShakeModes.h"
 
 NAMESPACE_STREAM
@@ -140,6 +141,7 @@ private:
 	static const size_t STATE_SIZE = 14;
 	static const size_t TAG_SIZE = 32;
 
+	class CSX256Key;
 	class CSX256State;
 	std::unique_ptr<CSX256State> m_csx256State;
 	std::vector<SymmetricKeySize> m_legalKeySizes;
@@ -175,14 +177,27 @@ public:
 	/// Initialize the stream cipher using a secure-vector serialized state.
 	/// <para>The Serialize function stores the internal state of the cipher, so that it can be reinitialized,
 	/// without the need to call the Initialize function and key-schedule. 
-	/// If this constructor is used, the cipher is fully initialized to the values it had when the Serialize function was called.</para>
+	/// If this constructor is used, the cipher is fully initialized to the values it had when the Serialize function was called.
+	/// The state format includes the seek offset used by Seek; a state serialized before it was added is rejected.</para>
 	/// </summary>
 	///
 	/// <param name="State">The serialized state, created by the Serialize() function</param>
 	///
-	/// <exception cref="CryptoSymmetricException">Thrown if an invalid state array is used</exception>
+	/// <exception cref="CryptoSymmetricException">Thrown if an invalid state array, or a state in the earlier format is used</exception>
 	explicit CSX256(SecureVector<byte> &State);
 
+	/// <summary>
+	/// Initialize the stream cipher using a shared key context.
+	/// <para>The context is created by a keyed CSX256 instance, and is returned by its Context() accessor.
+	/// It holds the cSHAKE derived cipher and MAC keys and the custom code, which are never modified; the authentication setting is taken from the context.
+	/// This instance must be initialized with a nonce-only SymmetricKey before use, the key derivation is not repeated; a keyed initialization is rejected until Reset() releases the context.</para>
+	/// </summary>
+	///
+	/// <param name="Context">The shared key context</param>
+	///
+	/// <exception cref="CryptoSymmetricException">Thrown if the context is null, or was not created by a CSX256 instance</exception>
+	explicit CSX256(const std::shared_ptr<KeyContext> &Context);
+
 	/// <summary>
 	/// Destructor: finalize this class
 	/// </summary>
@@ -190,6 +205,14 @@ public:
 
 	//~~~Accessors~~~//
 
+	/// <summary>
+	/// Read Only: The immutable key context created by the last keyed initialization.
+	/// <para>The context can be passed to the CSX256(std::shared_ptr&lt;KeyContext&gt;) constructor of other instances, on the same or other threads.</para>
+	/// </summary>
+	///
+	/// <exception cref="CryptoSymmetricException">Thrown if the cipher has not been initialized</exception>
+	const std::shared_ptr<KeyContext> Context();
+
 	/// <summary>
 	/// Read Only: The stream ciphers enumeration type name
 	/// </summary>
@@ -273,9 +296,10 @@ public:
 	/// </summary>
 	/// 
 	/// <param name="Encryption">Using Encryption or Decryption mode</param>
-	/// <param name="Parameters">Cipher key structure, containing cipher key, nonce, and optional info array</param>
+	/// <param name="Parameters">Cipher key structure, containing cipher key, nonce, and optional info array.
+	/// <para>If the key is empty, the existing derived key is re-used and only the nonce, counter, and MAC state are reset.</para></param>
 	///
-	/// <exception cref="CryptoSymmetricException">Thrown if a null or invalid key is used</exception>
+	/// <exception cref="CryptoSymmetricException">Thrown if a null or invalid key is used, or an empty key is used before the first keyed initialization</exception>
 	void Initialize(bool Encryption, ISymmetricKey &Parameters) override;
 
 	/// <summary>
@@ -289,11 +313,25 @@ public:
 	/// <exception cref="CryptoCipherModeException">Thrown if the degree parameter is invalid</exception>
 	void ParallelMaxDegree(size_t Degree) override;
 
+	/// <summary>
+	/// Set the key-stream position to a byte offset from the start of the stream.
+	/// <para>The block counter is set to the block index of the position; the next call to Transform 
+	/// begins at that byte, and a position that is not block aligned has the remainder of that block applied before continuing.
+	/// Seeking is only available when authentication is disabled.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Position">The byte offset from the start of the key-stream</param>
+	/// 
+	/// <exception cref="CryptoSymmetricException">Thrown if the cipher has not been initialized, or if authentication is enabled</exception>
+	void Seek(ulong Position);
+
 	/// <summary>
 	/// Saves the internal state of the cipher to a secure vector.
 	/// <para>The Serialize function can store the internal state of the cipher at the time it is invoked.
 	/// The cipher instance can be reinitialized through a constructor option, without the need to re-call the Initialize function and associated key-schedule functions.
-	/// This is useful in situations where the cipher is required intermitantly, and the entire state can be stored rather than just the key and nonce.</para>
+	/// This is useful in situations where the cipher is required intermitantly, and the entire state can be stored rather than just the key and nonce.
+	/// The state now ends with the seek offset used by Seek, and can not be restored by an earlier version of the library.</para>
 	/// </summary>
 	///
 	/// <returns>The serialized cipher state</returns>
@@ -327,12 +365,29 @@ public:
 	/// <exception cref="CryptoAuthenticationFailure">Thrown during decryption if the the ciphertext fails authentication</exception>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The bytes are read from and written to the callers memory directly, without an intermediate vector.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// If authentication is enabled, the output buffer receives the MAC code after the cipher-text when encrypting (Length + TagSize() bytes),
+	/// and the input buffer must contain the MAC code after the cipher-text when decrypting.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer</param>
+	/// <param name="Length">The number of bytes to transform</param>
+	///
+	/// <exception cref="CryptoAuthenticationFailure">Thrown during decryption if the the ciphertext fails authentication</exception>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 private:
 
 	static void Finalize(std::unique_ptr<CSX256State> &State, std::unique_ptr<IMac> &Authenticator);
-	static void Generate(std::unique_ptr<CSX256State> &State, std::array<uint, NONCE_SIZE> &Counter, std::vector<byte> &Output, size_t OutOffset, size_t Length);
+	static void Generate(std::unique_ptr<CSX256State> &State, std::array<uint, NONCE_SIZE> &Counter, const Span<byte> &Output, size_t OutOffset, size_t Length);
 	void Load(const SecureVector<byte> &Key, const SecureVector<byte> &Nonce, const SecureVector<byte> &Code);
-	void Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
 	void Reset();
 };
 
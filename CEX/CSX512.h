@@ -330,12 +330,29 @@ public:
 	/// <exception cref="CryptoAuthenticationFailure">Thrown during decryption if the the ciphertext fails authentication</exception>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The bytes are read from and written to the callers memory directly, without an intermediate vector.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// If authentication is enabled, the output buffer receives the MAC code after the cipher-text when encrypting (Length + TagSize() bytes),
+	/// and the input buffer must contain the MAC code after the cipher-text when decrypting.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer</param>
+	/// <param name="Length">The number of bytes to transform</param>
+	///
+	/// <exception cref="CryptoAuthenticationFailure">Thrown during decryption if the the ciphertext fails authentication</exception>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 private:
 
 	static void Finalize(std::unique_ptr<CSX512State> &State, std::unique_ptr<IMac> &Authenticator);
-	static void Generate(std::unique_ptr<CSX512State> &State, std::vector<byte> &Output, size_t OutOffset, std::array<ulong, 2> &Counter, size_t Length);
+	static void Generate(std::unique_ptr<CSX512State> &State, const Span<byte> &Output, size_t OutOffset, std::array<ulong, 2> &Counter, size_t Length);
 	void Load(const SecureVector<byte> &Key, const SecureVector<byte> &Nonce, const SecureVector<byte> &Code);
-	void Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
 	void Reset();
 };
 
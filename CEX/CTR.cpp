@@ -16,6 +16,8 @@ class CTR::CtrState
 public:
 
 	std::vector<byte> Nonce;
+	std::vector<byte> Origin;
+	size_t Offset;
 	bool Destroyed;
 	bool Encryption;
 	bool Initialized;
@@ -23,6 +25,8 @@ public:
 	CtrState(bool IsDestroyed)
 		:
 		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
+		Offset(0),
 		Destroyed(IsDestroyed),
 		Encryption(false),
 		Initialized(false)
@@ -37,6 +41,8 @@ public:
 	void Reset()
 	{
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
+		MemoryTools::Clear(Origin, 0, Origin.size());
+		Offset = 0;
 		Destroyed = false;
 		Encryption = false;
 		Initialized = false;
@@ -65,6 +71,17 @@ CTR::CTR(IBlockCipher* Cipher)
 {
 }
 
+CTR::CTR(const std::shared_ptr<BlockCipherContext> &Context)
+	:
+	m_ctrState(new CtrState(false)),
+	m_blockCipher(Context != nullptr ?
+		Context->Engine() :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::CTR), std::string("Constructor"), std::string("The key context can not be null!"), ErrorCodes::IllegalOperation)),
+	m_keyContext(Context),
+	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
+{
+}
+
 CTR::~CTR()
 {
 	if (m_ctrState->Destroyed)
@@ -181,10 +198,29 @@ void CTR::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 
 void CTR::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
-	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	if (Parameters.KeySizes().KeySize() == 0)
 	{
-		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidKey);
+		if (!m_blockCipher->IsInitialized() || !m_blockCipher->IsEncryption())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
+		}
+		if (m_keyContext != nullptr && !m_keyContext->Verify())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The engine of the shared key context has been re-keyed!"), ErrorCodes::InvalidState);
+		}
 	}
+	else
+	{
+		if (m_keyContext != nullptr)
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("An instance using a shared key context can not be re-keyed!"), ErrorCodes::IllegalOperation);
+		}
+		if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidKey);
+		}
+	}
+
 	if (Parameters.KeySizes().IVSize() != BLOCK_SIZE)
 	{
 		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid nonce size; nonce must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidNonce);
@@ -192,6 +228,9 @@ void CTR::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -202,8 +241,16 @@ void CTR::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		}
 	}
 
-	m_blockCipher->Initialize(true, Parameters);
+	if (Parameters.KeySizes().KeySize() != 0)
+	{
+		// a nonce-only key re-uses the existing round-key schedule
+		m_blockCipher->Initialize(true, Parameters);
+	}
+
 	MemoryTools::Copy(Parameters.IV(), 0, m_ctrState->Nonce, 0, m_ctrState->Nonce.size());
+	// store the initial counter, Seek positions are relative to it
+	MemoryTools::Copy(Parameters.IV(), 0, m_ctrState->Origin, 0, m_ctrState->Origin.size());
+	m_ctrState->Offset = 0;
 	m_ctrState->Encryption = Encryption;
 	m_ctrState->Initialized = true;
 }
@@ -218,36 +265,32 @@ void CTR::ParallelMaxDegree(size_t Degree)
 	m_parallelProfile.SetMaxDegree(Degree);
 }
 
+void CTR::Seek(ulong Position)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Seek"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	// counter = initial counter + block index
+	MemoryTools::Copy(m_ctrState->Origin, 0, m_ctrState->Nonce, 0, m_ctrState->Nonce.size());
+	IntegerTools::BeIncrease8(m_ctrState->Nonce, static_cast<ulong>(Position / BLOCK_SIZE));
+	m_ctrState->Offset = static_cast<size_t>(Position % BLOCK_SIZE);
+}
+
 void CTR::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
 {
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the block-size!");
 
-	size_t i;
-
-	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
-
-	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
-	{
-		const size_t BLKCNT = Length / PRLBLK;
-
-		for (i = 0; i < BLKCNT; ++i)
-		{
-			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK), PRLBLK);
-		}
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
 
-		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+void CTR::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 
-		if (RMDLEN != 0)
-		{
-			const size_t BLKOFT = (PRLBLK * BLKCNT);
-			ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
-		}
-	}
-	else
-	{
-		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
-	}
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -262,7 +305,7 @@ void CTR::Encrypt(const std::vector<byte> &Input, size_t InOffset, std::vector<b
 	MemoryTools::XOR128(Input, InOffset, Output, OutOffset);
 }
 
-void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
+void CTR::Generate(const Span<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
 {
 	size_t bctr = 0;
 
@@ -271,7 +314,7 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 	if (Length >= AVX512BLK)
 	{
 		const size_t PBKALN = Length - (Length % AVX512BLK);
-		std::vector<byte> tmpc(AVX512BLK);
+		std::array<byte, AVX512BLK> tmpc;
 
 		// stagger counters and process 8 blocks with avx512
 		while (bctr != PBKALN)
@@ -308,18 +351,21 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			IntegerTools::BeIncrement8(Counter);
 			MemoryTools::COPY128(Counter, 0, tmpc, 240);
 			IntegerTools::BeIncrement8(Counter);
-			m_blockCipher->Transform2048(tmpc, 0, Output, OutOffset + bctr);
+			m_blockCipher->Transform2048(tmpc.data(), Output.data() + OutOffset + bctr);
 			bctr += AVX512BLK;
 		}
 	}
-#elif defined(CEX_HAS_AVX2)
+#endif
+
+#if defined(CEX_HAS_AVX)
+	// the remainder of a wider kernel cascades to the narrower kernels
 	const size_t AVX2BLK = 8 * BLOCK_SIZE;
-	if (Length >= AVX2BLK)
+	if (Length - bctr >= AVX2BLK)
 	{
-		const size_t PBKALN = Length - (Length % AVX2BLK);
-		std::vector<byte> tmpc(AVX2BLK);
+		const size_t PBKALN = Length - ((Length - bctr) % AVX2BLK);
+		std::array<byte, AVX2BLK> tmpc;
 		
-		// stagger counters and process 8 blocks with avx2
+		// stagger counters and process 8 blocks
 		while (bctr != PBKALN)
 		{
 			MemoryTools::COPY128(Counter, 0, tmpc, 0);
@@ -338,16 +384,16 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			IntegerTools::BeIncrement8(Counter);
 			MemoryTools::COPY128(Counter, 0, tmpc, 112);
 			IntegerTools::BeIncrement8(Counter);
-			m_blockCipher->Transform1024(tmpc, 0, Output, OutOffset + bctr);
+			m_blockCipher->Transform1024(tmpc.data(), Output.data() + OutOffset + bctr);
 			bctr += AVX2BLK;
 		}
 	}
-#elif defined(CEX_HAS_AVX)
+
 	const size_t AVXBLK = 4 * BLOCK_SIZE;
-	if (Length >= AVXBLK)
+	if (Length - bctr >= AVXBLK)
 	{
-		const size_t PBKALN = Length - (Length % AVXBLK);
-		std::vector<byte> tmpc(AVXBLK);
+		const size_t PBKALN = Length - ((Length - bctr) % AVXBLK);
+		std::array<byte, AVXBLK> tmpc;
 
 		// 4 blocks with avx
 		while (bctr != PBKALN)
@@ -360,7 +406,7 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			IntegerTools::BeIncrement8(Counter);
 			MemoryTools::COPY128(Counter, 0, tmpc, 48);
 			IntegerTools::BeIncrement8(Counter);
-			m_blockCipher->Transform512(tmpc, 0, Output, OutOffset + bctr);
+			m_blockCipher->Transform512(tmpc.data(), Output.data() + OutOffset + bctr);
 			bctr += AVXBLK;
 		}
 	}
@@ -369,88 +415,178 @@ void CTR::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 	const size_t BLKALN = Length - (Length % BLOCK_SIZE);
 	while (bctr != BLKALN)
 	{
-		m_blockCipher->EncryptBlock(Counter, 0, Output, OutOffset + bctr);
+		m_blockCipher->EncryptBlock(Counter.data(), Output.data() + OutOffset + bctr);
 		IntegerTools::BeIncrement8(Counter);
 		bctr += BLOCK_SIZE;
 	}
 
 	if (bctr != Length)
 	{
-		std::vector<byte> otp(BLOCK_SIZE);
-		m_blockCipher->EncryptBlock(Counter, otp);
+		std::array<byte, BLOCK_SIZE> otp;
+		m_blockCipher->EncryptBlock(Counter.data(), otp.data());
 		IntegerTools::BeIncrement8(Counter);
 		const size_t RMDLEN = Length % BLOCK_SIZE;
 		MemoryTools::Copy(otp, 0, Output, OutOffset + (Length - RMDLEN), RMDLEN);
 	}
 }
 
-void CTR::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void CTR::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	size_t i;
+
+	if (m_ctrState->Offset != 0 && Length != 0)
+	{
+		// finish the partial block left by a Seek, then continue block aligned
+		std::vector<byte> otp(BLOCK_SIZE);
+		const size_t PRTLEN = IntegerTools::Min(BLOCK_SIZE - m_ctrState->Offset, Length);
+
+		m_blockCipher->EncryptBlock(m_ctrState->Nonce, otp);
+
+		for (i = 0; i < PRTLEN; ++i)
+		{
+			Output[OutOffset + i] = Input[InOffset + i] ^ otp[m_ctrState->Offset + i];
+		}
+
+		m_ctrState->Offset += PRTLEN;
+
+		if (m_ctrState->Offset == BLOCK_SIZE)
+		{
+			IntegerTools::BeIncrement8(m_ctrState->Nonce);
+			m_ctrState->Offset = 0;
+		}
+
+		InOffset += PRTLEN;
+		OutOffset += PRTLEN;
+		Length -= PRTLEN;
+	}
+
+	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
+
+	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
+	{
+		const size_t BLKCNT = Length / PRLBLK;
+
+		for (i = 0; i < BLKCNT; ++i)
+		{
+			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK), PRLBLK);
+		}
+
+		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+
+		if (RMDLEN != 0)
+		{
+			const size_t BLKOFT = (PRLBLK * BLKCNT);
+
+			// split a large remainder across the threads
+			if (RMDLEN >= m_parallelProfile.ParallelMinimumSize())
+			{
+				ProcessParallel(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+			}
+			else
+			{
+				ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+			}
+		}
+	}
+	else
+	{
+		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
+	}
+}
+
+void CTR::ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t OUTLEN = Output.size() - OutOffset < Length ? Output.size() - OutOffset : Length;
-	const size_t CNKLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
-	const size_t ALNLEN = CNKLEN * m_parallelProfile.ParallelMaxDegree();
-	const size_t CTRLEN = (CNKLEN / BLOCK_SIZE);
-	std::vector<byte> tmpc(m_ctrState->Nonce.size());
+	const size_t ALNLEN = OUTLEN - (OUTLEN % BLOCK_SIZE);
+	const size_t PRLCNK = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
+	// a short remainder is divided evenly between the threads, a full parallel block by the cache-sized chunk
+	const size_t RMDCNK = ((ALNLEN / m_parallelProfile.ParallelMaxDegree()) + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
+	const size_t CNKLEN = (RMDCNK < PRLCNK) ? RMDCNK : PRLCNK;
 
-	ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, &Output, OutOffset, &tmpc, CNKLEN, CTRLEN](size_t i)
+	ParallelTools::ParallelFor(0, ALNLEN, CNKLEN, [this, &Input, InOffset, &Output, OutOffset](size_t Start, size_t End)
 	{
 		// thread level counter
 		std::vector<byte> thdc(BLOCK_SIZE);
-		// offset counter by chunk size / block size  
-		IntegerTools::BeIncrease8(m_ctrState->Nonce, thdc, static_cast<uint>(CTRLEN * i));
-		const size_t STMPOS = i * CNKLEN;
-		// generate random at output offset
-		this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
-		// xor with input at offsets
-		MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
-
-		// store last counter
-		if (i == m_parallelProfile.ParallelMaxDegree() - 1)
+		// offset counter by chunk position / block size  
+		IntegerTools::BeIncrease8(m_ctrState->Nonce, thdc, static_cast<uint>(Start / BLOCK_SIZE));
+
+		if (Input.data() + InOffset != Output.data() + OutOffset)
+		{
+			// generate random at output offset
+			this->Generate(Output, OutOffset + Start, End - Start, thdc);
+			// xor with input at offsets
+			MemoryTools::XOR(Input, InOffset + Start, Output, OutOffset + Start, End - Start);
+		}
+		else
 		{
-			MemoryTools::COPY128(thdc, 0, tmpc, 0);
+			// in-place; the key-stream is generated to a thread buffer
+			std::vector<byte> thdk(End - Start);
+			this->Generate(thdk, 0, thdk.size(), thdc);
+			MemoryTools::XOR(thdk, 0, Output, OutOffset + Start, thdk.size());
 		}
 	});
 
-	// copy last counter to class variable
-	MemoryTools::COPY128(tmpc, 0, m_ctrState->Nonce, 0);
+	// advance the class counter past the processed blocks
+	IntegerTools::BeIncrease8(m_ctrState->Nonce, static_cast<uint>(ALNLEN / BLOCK_SIZE));
 
 	// last block processing
-
 	if (ALNLEN < OUTLEN)
 	{
 		const size_t FNLLEN = OUTLEN - ALNLEN;
 		InOffset += ALNLEN;
 		OutOffset += ALNLEN;
 
-		Generate(Output, OutOffset, FNLLEN, m_ctrState->Nonce);
+		std::vector<byte> fnlk(BLOCK_SIZE);
+
+		Generate(fnlk, 0, FNLLEN, m_ctrState->Nonce);
 
 		for (size_t i = 0; i < FNLLEN; ++i)
 		{
-			Output[OutOffset + i] ^= Input[InOffset + i];
+			Output[OutOffset + i] = Input[InOffset + i] ^ fnlk[i];
 		}
 	}
 }
 
-void CTR::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void CTR::ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	// get block aligned
 	const size_t ALNLEN = Length - (Length % BLOCK_SIZE);
 	size_t i;
 
-	// generate random
-	Generate(Output, OutOffset, Length, m_ctrState->Nonce);
-
-	if (ALNLEN != 0)
+	if (Input.data() + InOffset != Output.data() + OutOffset)
 	{
-		MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
-	}
+		// generate random
+		Generate(Output, OutOffset, Length, m_ctrState->Nonce);
+
+		if (ALNLEN != 0)
+		{
+			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		}
 
-	// get the remaining bytes
-	if (ALNLEN != Length)
+		// get the remaining bytes
+		if (ALNLEN != Length)
+		{
+			for (i = ALNLEN; i < Length; ++i)
+			{
+				Output[i + OutOffset] ^= Input[i + InOffset];
+			}
+		}
+	}
+	else
 	{
-		for (i = ALNLEN; i < Length; ++i)
+		// in-place; the key-stream is generated to a stack buffer in block-aligned segments
+		const size_t SEGLEN = 64 * BLOCK_SIZE;
+		std::array<byte, SEGLEN> tmpk;
+		size_t plen;
+
+		i = 0;
+
+		while (i != Length)
 		{
-			Output[i + OutOffset] ^= Input[i + InOffset];
+			plen = (Length - i < SEGLEN) ? Length - i : SEGLEN;
+			Generate(tmpk, 0, plen, m_ctrState->Nonce);
+			MemoryTools::XOR(tmpk, 0, Output, OutOffset + i, plen);
+			i += plen;
 		}
 	}
 }
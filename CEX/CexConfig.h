@@ -207,10 +207,11 @@
 #	define CEX_SECURE_ALLOCATOR
 #endif
 
+// the secure allocator size classes range from MIN to MAX bytes, the locked region is at most MAXKB kilobytes
 #define CEX_SECMEMALLOC_DEFAULT 4096
 #define CEX_SECMEMALLOC_MIN 16
-#define CEX_SECMEMALLOC_MAX 128
-#define CEX_SECMEMALLOC_MAXKB 512
+#define CEX_SECMEMALLOC_MAX 4096
+#define CEX_SECMEMALLOC_MAXKB 2048
 
 // cpu type (only intel/amd/arm are targeted for support)
 #if defined(CEX_COMPILER_MSC)
@@ -490,6 +491,12 @@ typedef unsigned char byte;
 #if defined(__AVX512__)
 #	define CEX_HAS_AVX512
 #endif
+#if defined(__VAES__) && defined(__AVX512VL__)
+#	define CEX_HAS_VAES
+#endif
+#if defined(__BMI2__)
+#	define CEX_HAS_BMI2
+#endif
 
 #if defined(CEX_HAS_AVX2)
 #if (!defined(CEX_HAS_AVX))
@@ -679,6 +686,12 @@ typedef unsigned char byte;
 /// </summary>
 #define CEX_PREFETCH_RIJNDAEL_TABLES
 
+/// <summary>
+/// ParallelTools uses the libraries persistent work-stealing thread pool instead of OpenMP.
+/// <para>Removing this value reverts parallel loops to OpenMP when it is available.</para>
+/// </summary>
+#define CEX_PARALLEL_THREADPOOL
+
 /// <summary>
 /// Enabling this value will add cpu jitter to the ACP entropy collector (slightly stronger, but much slower)
 /// </summary>
@@ -66,8 +66,8 @@ private:
 
 #if defined(CEX_HAS_AVX512)
 
-	template<typename T>
-	static void Store16xUL512(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
+	template<typename T, typename ArrayU8>
+	static void Store16xUL512(std::array<T, 16> &State, ArrayU8 &Output, size_t OutOffset)
 	{
 		std::array<uint, 16> tmp;
 		size_t i;
@@ -94,8 +94,8 @@ private:
 		}
 	}
 
-	template<typename T>
-	static void Store8xULL1024(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
+	template<typename T, typename ArrayU8>
+	static void Store8xULL1024(std::array<T, 16> &State, ArrayU8 &Output, size_t OutOffset)
 	{
 		std::array<ulong, 8> tmp;
 		size_t i;
@@ -116,8 +116,8 @@ private:
 
 #elif defined(CEX_HAS_AVX2)
 
-	template<typename T>
-	static void Store8xUL512(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
+	template<typename T, typename ArrayU8>
+	static void Store8xUL512(std::array<T, 16> &State, ArrayU8 &Output, size_t OutOffset)
 	{
 		std::array<uint, 8> tmp;
 		size_t i;
@@ -136,8 +136,8 @@ private:
 		}
 	}
 
-	template<typename T>
-	static void Store4xULL1024(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
+	template<typename T, typename ArrayU8>
+	static void Store4xULL1024(std::array<T, 16> &State, ArrayU8 &Output, size_t OutOffset)
 	{
 		std::array<ulong, 4> tmp;
 		size_t i;
@@ -154,8 +154,8 @@ private:
 
 #elif defined(CEX_HAS_AVX)
 
-	template<typename T>
-	static void Store4xUL512(std::array<T, 16> &State, std::vector<byte> &Output, size_t OutOffset)
+	template<typename T, typename ArrayU8>
+	static void Store4xUL512(std::array<T, 16> &State, ArrayU8 &Output, size_t OutOffset)
 	{
 		std::array<uint, 4> tmp;
 		size_t i;
@@ -8,6 +8,7 @@
 #include "ECB.h"
 #include "ICM.h"
 #include "OFB.h"
+#include "XTS.h"
 
 NAMESPACE_HELPER
 
@@ -55,6 +56,11 @@ ICipherMode* CipherModeFromName::GetInstance(IBlockCipher* Cipher, CipherModes C
 				mptr = new OFB(Cipher);
 				break;
 			}
+			case CipherModes::XTS:
+			{
+				mptr = new XTS(Cipher);
+				break;
+			}
 			default:
 			{
 				// invalid option
@@ -116,6 +122,11 @@ ICipherMode* CipherModeFromName::GetInstance(BlockCiphers CipherType, CipherMode
 				mptr = new OFB(CipherType);
 				break;
 			}
+			case CipherModes::XTS:
+			{
+				mptr = new XTS(CipherType);
+				break;
+			}
 			default:
 			{
 				// invalid option
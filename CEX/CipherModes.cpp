@@ -50,6 +50,9 @@ std::string CipherModeConvert::ToName(CipherModes Enumeral)
 	case CipherModes::OFB:
 		name = std::string("OFB");
 		break;
+	case CipherModes::XTS:
+		name = std::string("XTS");
+		break;
 	default:
 		name = std::string("None");
 		break;
@@ -118,6 +121,10 @@ CipherModes CipherModeConvert::FromName(std::string &Name)
 	{
 		tname = CipherModes::OFB;
 	}
+	else if (Name == std::string("XTS"))
+	{
+		tname = CipherModes::XTS;
+	}
 	else
 	{
 		tname = CipherModes::None;
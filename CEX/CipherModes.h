@@ -69,7 +69,11 @@ enum class CipherModes : byte
 	/// <summary>
 	/// Output FeedBack Mode
 	/// </summary>
-	OFB = 14
+	OFB = 14,
+	/// <summary>
+	/// XEX-based Tweaked-codebook sector encryption Mode (IEEE 1619)
+	/// </summary>
+	XTS = 15
 };
 
 class CipherModeConvert
@@ -4,6 +4,7 @@
 #include "IntegerTools.h"
 #include "PaddingFromName.h"
 #include "StreamCipherFromName.h"
+#include "StreamPipeline.h"
 
 NAMESPACE_PROCESSING
 
@@ -21,6 +22,7 @@ public:
 	bool CounterMode;
 	bool Encryption;
 	bool Initialized;
+	bool Pipelined;
 
 	CipherState(bool IsCounter, bool Destroyed)
 		:
@@ -28,7 +30,8 @@ public:
 		Buffered(false),
 		CounterMode(IsCounter),
 		Encryption(false),
-		Initialized(false)
+		Initialized(false),
+		Pipelined(true)
 	{
 
 	}
@@ -40,6 +43,7 @@ public:
 		CounterMode = false;
 		Encryption = false;
 		Initialized = false;
+		Pipelined = false;
 	}
 };
 
@@ -91,6 +95,11 @@ bool &CipherStream::IsParallel()
 	return m_cipherEngine->ParallelProfile().IsParallel();
 }
 
+bool &CipherStream::IsPipelined()
+{
+	return m_cipherState->Pipelined;
+}
+
 const std::vector<SymmetricKeySize> CipherStream::LegalKeySizes() 
 { 
 	return m_legalKeySizes; 
@@ -267,10 +276,41 @@ void CipherStream::BlockTransform(IByteStream* InStream, IByteStream* OutStream)
 	std::vector<byte> inp(0);
 	std::vector<byte> otp(0);
 
+	const size_t BLKLEN = m_cipherEngine->BlockSize();
+	const size_t ALNLEN = (m_cipherState->CounterMode || m_cipherState->Encryption) ? (INPLEN / BLKLEN) * BLKLEN : (INPLEN < BLKLEN) ? 0 : ((INPLEN / BLKLEN) * BLKLEN) - BLKLEN;
+
 	plen = 0;
 	pread = 0;
 
-	if (IsParallel())
+	// the output is the input length, plus a block of padding when a padded mode is encrypting
+	if (OutStream->Enumeral() == Enumeration::StreamModes::DirectFileStream && InStream != OutStream)
+	{
+		static_cast<DirectFileStream*>(OutStream)->Reserve(OutStream->Position() + INPLEN + ((m_cipherState->Encryption && !m_cipherState->CounterMode) ? BLKLEN : 0));
+	}
+
+	if (InStream->Enumeral() == Enumeration::StreamModes::MappedFileStream && InStream != OutStream)
+	{
+		plen = MappedTransform(static_cast<MappedFileStream*>(InStream), OutStream, INPLEN, ALNLEN);
+	}
+	else if (m_cipherState->Pipelined && InStream != OutStream)
+	{
+		const size_t BUFLEN = IsParallel() ? m_cipherEngine->ParallelBlockSize() : StreamPipeline::DEF_BUFFER - (StreamPipeline::DEF_BUFFER % BLKLEN);
+
+		// the aligned body is read, transformed, and written concurrently; the final block and padding are processed below
+		if (ALNLEN >= 2 * BUFLEN)
+		{
+			StreamPipeline pipe(BUFLEN);
+
+			pipe.Process(InStream, OutStream, ALNLEN, [this, INPLEN, &plen](const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length)
+			{
+				m_cipherEngine->Transform(Input, 0, Output, 0, Length);
+				plen += Length;
+				CalculateProgress(INPLEN, plen);
+			});
+		}
+	}
+
+	if (plen == 0 && IsParallel())
 	{
 		const size_t PRLBLK = m_cipherEngine->ParallelBlockSize();
 		if (INPLEN > PRLBLK)
@@ -290,8 +330,6 @@ void CipherStream::BlockTransform(IByteStream* InStream, IByteStream* OutStream)
 		}
 	}
 
-	const size_t BLKLEN = m_cipherEngine->BlockSize();
-	const size_t ALNLEN = (m_cipherState->CounterMode || m_cipherState->Encryption) ? (INPLEN / BLKLEN) * BLKLEN : (INPLEN < BLKLEN) ? 0 : ((INPLEN / BLKLEN) * BLKLEN) - BLKLEN;
 	inp.resize(BLKLEN);
 	otp.resize(BLKLEN);
 
@@ -380,6 +418,60 @@ void CipherStream::CalculateProgress(size_t Length, size_t Processed)
 	}
 }
 
+size_t CipherStream::MappedTransform(MappedFileStream* InStream, IByteStream* OutStream, size_t Length, size_t AlignedLength)
+{
+	const size_t BUFLEN = IsParallel() ? m_cipherEngine->ParallelBlockSize() : StreamPipeline::DEF_BUFFER - (StreamPipeline::DEF_BUFFER % m_cipherEngine->BlockSize());
+	const ulong INPPOS = InStream->Position();
+	const bool OUTMAP = (OutStream->Enumeral() == Enumeration::StreamModes::MappedFileStream);
+	Span<const byte> inp = InStream->View(INPPOS, AlignedLength);
+	Span<byte> out;
+	std::vector<byte> otp(0);
+	size_t plen;
+
+	plen = 0;
+
+	if (OUTMAP)
+	{
+		// the output file is grown to the body length once, and the cipher writes to the mapping
+		MappedFileStream* outmap = static_cast<MappedFileStream*>(OutStream);
+		out = outmap->WritableView(outmap->Position(), AlignedLength);
+	}
+	else
+	{
+		otp.resize(BUFLEN);
+	}
+
+	while (plen != AlignedLength)
+	{
+		const size_t PRCLEN = IntegerTools::Min(BUFLEN, AlignedLength - plen);
+
+		// read ahead the segment that follows this one
+		InStream->Prefetch(INPPOS + plen + PRCLEN, BUFLEN);
+
+		if (OUTMAP)
+		{
+			m_cipherEngine->Transform(inp.data() + plen, out.data() + plen, PRCLEN);
+		}
+		else
+		{
+			m_cipherEngine->Transform(inp.data() + plen, otp.data(), PRCLEN);
+			OutStream->Write(otp, 0, PRCLEN);
+		}
+
+		plen += PRCLEN;
+		CalculateProgress(Length, plen);
+	}
+
+	InStream->Seek(INPPOS + AlignedLength, IO::SeekOrigin::Begin);
+
+	if (OUTMAP)
+	{
+		OutStream->Seek(AlignedLength, IO::SeekOrigin::Current);
+	}
+
+	return plen;
+}
+
 ICipherMode* CipherStream::GetCipherMode(BlockCiphers CipherType, CipherModes CipherModeType)
 {
 	return Helper::CipherModeFromName::GetInstance(CipherType, CipherModeType);
@@ -27,11 +27,13 @@
 
 #include "CexDomain.h"
 #include "CryptoProcessingException.h"
+#include "DirectFileStream.h"
 #include "Event.h"
 #include "IBlockCipher.h"
 #include "IByteStream.h"
 #include "ICipherMode.h"
 #include "IPadding.h"
+#include "MappedFileStream.h"
 #include "ParallelOptions.h"
 #include "SymmetricKeySize.h"
 #include "SymmetricCiphers.h"
@@ -43,7 +45,9 @@ using Exception::CryptoProcessingException;
 using Enumeration::CipherModes;
 using Routing::Event;
 using Cipher::Block::IBlockCipher;
+using IO::DirectFileStream;
 using IO::IByteStream;
+using IO::MappedFileStream;
 using Cipher::Block::Mode::ICipherMode;
 using Cipher::Block::Padding::IPadding;
 using Cipher::ISymmetricKey;
@@ -121,6 +125,9 @@ using Cipher::SymmetricKeySize;
 /// <item><description>ParallelBlockSize() is calculated automatically based on the processor(s) L1 data cache size, this property can be user defined, and must be evenly divisible by ParallelMinimumSize().</description></item>
 /// <item><description>The ParallelBlockSize(), IsParallel(), and ParallelThreadsMax() accessors, can be changed through the ParallelProfile() property</description></item>
 /// <item><description>Parallel block calculation ex. <c>ParallelBlockSize = N - (N % .ParallelMinimumSize);</c></description></item>
+/// <item><description>The stream Write function is pipelined; input reads, the cipher transformation, and output writes run concurrently, this can be disabled with the IsPipelined() property.</description></item>
+/// <item><description>A MappedFileStream input is transformed directly out of the file mapping, and a MappedFileStream output is written in place, without intermediate copies.</description></item>
+/// <item><description>The output length is known before the transformation starts; a DirectFileStream output preallocates the file to that length before it is written.</description></item>
 /// </list>
 /// </remarks>
 class CipherStream
@@ -192,6 +199,14 @@ public:
 	/// </summary>
 	bool &IsParallel();
 
+	/// <summary>
+	/// Read/Write: Stream reads and writes are overlapped with the cipher transformation, the default is true.
+	/// <para>When enabled, the Write(IByteStream*, IByteStream*) function reads the input stream on a reader thread into a ring of ParallelBlockSize buffers,
+	/// transforms the buffers in order with the (parallel) cipher on the calling thread, and writes them to the output stream on a writer thread.
+	/// The pipeline is used when the input is at least two buffers in length, and the input and output are different stream instances.</para>
+	/// </summary>
+	bool &IsPipelined();
+
 	/// <summary>
 	/// Read Only: The supported key, nonce, and info sizes for the selected cipher configuration
 	/// </summary>
@@ -269,6 +284,7 @@ private:
 	void BlockTransform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
 	void BlockTransform(IByteStream* InStream, IByteStream* OutStream);
 	void CalculateProgress(size_t Length, size_t Processed);
+	size_t MappedTransform(MappedFileStream* InStream, IByteStream* OutStream, size_t Length, size_t AlignedLength);
 	static ICipherMode* GetCipherMode(BlockCiphers CipherType, CipherModes CipherModeType);
 	static IPadding* GetPaddingMode(PaddingModes PaddingType);
 };
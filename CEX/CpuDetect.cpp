@@ -1,7 +1,15 @@
 #include "CpuDetect.h"
 #include <algorithm>
-
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <sstream>
 #include <thread>
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+#	include <sched.h>
+#elif defined(CEX_OS_WINDOWS)
+#	include <windows.h>
+#endif
 #if defined(CEX_ARCH_X86_X64)
 #	if defined(CEX_COMPILER_MSC)
 #		include <intrin.h>
@@ -379,8 +387,354 @@ bool CpuDetect::Avx2Enabled()
 	return status;
 }
 
+size_t CpuDetect::AvailableCores(bool Refresh)
+{
+	// 0 is not yet detected
+	static std::atomic_size_t cores(0);
+	size_t res;
+	size_t tmpc;
+
+	res = cores;
+
+	if (res == 0 || Refresh == true)
+	{
+		res = static_cast<size_t>(std::thread::hardware_concurrency());
+		tmpc = AffinityCores();
+
+		if (tmpc != 0 && (tmpc < res || res == 0))
+		{
+			res = tmpc;
+		}
+
+		tmpc = CgroupCores();
+
+		if (tmpc != 0 && (tmpc < res || res == 0))
+		{
+			res = tmpc;
+		}
+
+		if (res == 0)
+		{
+			res = 1;
+		}
+
+		cores = res;
+	}
+
+	return res;
+}
+
+std::vector<std::vector<size_t>> CpuDetect::CoreTopology()
+{
+	// (package, core) -> logical processors
+	std::map<std::pair<size_t, size_t>, std::vector<size_t>> cmap;
+	std::vector<std::vector<size_t>> cores;
+	const size_t LGCCNT = static_cast<size_t>(std::thread::hardware_concurrency());
+
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+	const size_t MAXCPU = 4096;
+	size_t found;
+	size_t i;
+
+	found = 0;
+
+	// online cpu indices may be sparse; scan until every online processor is found
+	for (i = 0; i < MAXCPU && found < LGCCNT; ++i)
+	{
+		std::ostringstream path;
+		path << "/sys/devices/system/cpu/cpu" << i << "/topology/";
+		std::ifstream coreid(path.str() + "core_id");
+		std::ifstream pkgid(path.str() + "physical_package_id");
+		size_t core;
+		size_t pkg;
+
+		if (coreid.is_open() && pkgid.is_open() && (coreid >> core) && (pkgid >> pkg))
+		{
+			cmap[std::pair<size_t, size_t>(pkg, core)].push_back(i);
+			++found;
+		}
+	}
+
+#elif defined(CEX_OS_WINDOWS)
+	DWORD buflen;
+
+	buflen = 0;
+	GetLogicalProcessorInformation(nullptr, &buflen);
+
+	if (buflen != 0)
+	{
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(buflen / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+		size_t i;
+		size_t j;
+
+		if (GetLogicalProcessorInformation(info.data(), &buflen) != FALSE)
+		{
+			for (i = 0; i < info.size(); ++i)
+			{
+				if (info[i].Relationship == RelationProcessorCore)
+				{
+					for (j = 0; j < sizeof(ULONG_PTR) * 8; ++j)
+					{
+						if ((info[i].ProcessorMask & (static_cast<ULONG_PTR>(1) << j)) != 0)
+						{
+							// windows reports cores in package order; the entry index is the core key
+							cmap[std::pair<size_t, size_t>(0, i)].push_back(j);
+						}
+					}
+				}
+			}
+		}
+	}
+#endif
+
+	for (auto &ent : cmap)
+	{
+		std::sort(ent.second.begin(), ent.second.end());
+		cores.push_back(ent.second);
+	}
+
+	// topology not available; treat each logical processor as a core
+	if (cores.size() == 0)
+	{
+		size_t i;
+
+		for (i = 0; i < LGCCNT; ++i)
+		{
+			cores.push_back(std::vector<size_t>(1, i));
+		}
+	}
+
+	return cores;
+}
+
+size_t CpuDetect::ParseCpuList(const std::string &List)
+{
+	// a cpu list is a comma separated set of indices and ranges, ex. "0-3,8,10-11"
+	std::istringstream iss(List);
+	std::string item;
+	size_t res;
+
+	res = 0;
+
+	while (std::getline(iss, item, ','))
+	{
+		const size_t DPOS = item.find('-');
+
+		if (item.find_first_of("0123456789") != std::string::npos && item.find_first_not_of("0123456789- \t\r\n") == std::string::npos)
+		{
+			if (DPOS != std::string::npos)
+			{
+				const std::string FSTSTR = item.substr(0, DPOS);
+				const std::string LSTSTR = item.substr(DPOS + 1);
+
+				if (FSTSTR.find_first_of("0123456789") != std::string::npos && LSTSTR.find_first_of("0123456789") != std::string::npos && LSTSTR.find('-') == std::string::npos)
+				{
+					const size_t FIRST = static_cast<size_t>(std::stoul(FSTSTR));
+					const size_t LAST = static_cast<size_t>(std::stoul(LSTSTR));
+
+					res += (LAST >= FIRST) ? (LAST - FIRST + 1) : 0;
+				}
+			}
+			else
+			{
+				++res;
+			}
+		}
+	}
+
+	return res;
+}
+
+size_t CpuDetect::ParseCpuQuota(const std::string &Quota, const std::string &Period)
+{
+	// the largest field length that can not overflow the conversion
+	const size_t MAXDGT = 18;
+	size_t res;
+
+	res = 0;
+
+	// a quota of "max" (v2) or -1 (v1) is unlimited
+	if (Quota.size() != 0 && Quota.size() <= MAXDGT && Quota.find_first_not_of("0123456789") == std::string::npos &&
+		Period.size() != 0 && Period.size() <= MAXDGT && Period.find_first_not_of("0123456789") == std::string::npos)
+	{
+		const unsigned long long QUOTA = std::stoull(Quota);
+		const unsigned long long PERIOD = std::stoull(Period);
+
+		if (QUOTA != 0 && PERIOD != 0)
+		{
+			res = static_cast<size_t>((QUOTA + PERIOD - 1) / PERIOD);
+		}
+	}
+
+	return res;
+}
+
 //~~~Private Functions~~~//
 
+size_t CpuDetect::AffinityCores()
+{
+	size_t res;
+
+	res = 0;
+
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+
+	if (sched_getaffinity(0, sizeof(set), &set) == 0)
+	{
+		res = static_cast<size_t>(CPU_COUNT(&set));
+	}
+#elif defined(CEX_OS_WINDOWS)
+	DWORD_PTR prcmsk;
+	DWORD_PTR sysmsk;
+
+	if (GetProcessAffinityMask(GetCurrentProcess(), &prcmsk, &sysmsk) != FALSE)
+	{
+		while (prcmsk != 0)
+		{
+			res += static_cast<size_t>(prcmsk & 1);
+			prcmsk >>= 1;
+		}
+	}
+#endif
+
+	return res;
+}
+
+size_t CpuDetect::CgroupCores()
+{
+	size_t res;
+
+	res = 0;
+
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+	const std::string CGROOT = "/sys/fs/cgroup";
+	std::ifstream ifs("/proc/self/cgroup");
+	std::string line;
+	std::string cpath;
+	std::string spath;
+	std::string v2path;
+	size_t cores;
+	bool v2;
+
+	v2 = false;
+
+	// v2: "0::/path", v1: "id:controller,controller:/path"
+	while (std::getline(ifs, line))
+	{
+		const size_t FPOS = line.find(':');
+		const size_t SPOS = (FPOS != std::string::npos) ? line.find(':', FPOS + 1) : std::string::npos;
+
+		if (SPOS != std::string::npos)
+		{
+			const std::string CTLS = "," + line.substr(FPOS + 1, SPOS - FPOS - 1) + ",";
+			const std::string PATH = (line.substr(SPOS + 1) == "/") ? std::string("") : line.substr(SPOS + 1);
+
+			if (line.compare(0, FPOS, "0") == 0 && CTLS == ",,")
+			{
+				v2 = true;
+				v2path = PATH;
+			}
+			else if (CTLS.find(",cpu,") != std::string::npos)
+			{
+				cpath = CGROOT + "/" + line.substr(FPOS + 1, SPOS - FPOS - 1) + PATH;
+
+				if (!std::ifstream(cpath + "/cpu.cfs_quota_us").is_open())
+				{
+					// the controller may be mounted under its own name, or the path may be hidden by a namespace
+					cpath = std::ifstream(CGROOT + "/cpu" + PATH + "/cpu.cfs_quota_us").is_open() ? CGROOT + "/cpu" + PATH : CGROOT + "/cpu";
+				}
+			}
+			else if (CTLS.find(",cpuset,") != std::string::npos)
+			{
+				spath = std::ifstream(CGROOT + "/cpuset" + PATH + "/cpuset.cpus").is_open() ? CGROOT + "/cpuset" + PATH : CGROOT + "/cpuset";
+			}
+			else
+			{
+				// misra
+			}
+		}
+	}
+
+	if (v2 == true && cpath.empty())
+	{
+		// a quota on any ancestor applies, walk up to the root of the hierarchy
+		std::string path = v2path;
+
+		while (true)
+		{
+			std::ifstream cmax(CGROOT + path + "/cpu.max");
+			std::string quota;
+			std::string period;
+
+			if (cmax.is_open() && (cmax >> quota >> period))
+			{
+				cores = ParseCpuQuota(quota, period);
+
+				if (cores != 0 && (cores < res || res == 0))
+				{
+					res = cores;
+				}
+			}
+
+			if (path.empty())
+			{
+				break;
+			}
+
+			path = path.substr(0, path.find_last_of('/'));
+		}
+
+		spath = std::ifstream(CGROOT + v2path + "/cpuset.cpus.effective").is_open() ? CGROOT + v2path : CGROOT;
+		std::ifstream cset(spath + "/cpuset.cpus.effective");
+
+		if (std::getline(cset, line))
+		{
+			cores = ParseCpuList(line);
+
+			if (cores != 0 && (cores < res || res == 0))
+			{
+				res = cores;
+			}
+		}
+	}
+	else
+	{
+		if (!cpath.empty())
+		{
+			std::ifstream qfs(cpath + "/cpu.cfs_quota_us");
+			std::ifstream pfs(cpath + "/cpu.cfs_period_us");
+			std::string quota;
+			std::string period;
+
+			if ((qfs >> quota) && (pfs >> period))
+			{
+				res = ParseCpuQuota(quota, period);
+			}
+		}
+
+		if (!spath.empty())
+		{
+			std::ifstream cset(spath + "/cpuset.cpus");
+
+			if (std::getline(cset, line))
+			{
+				cores = ParseCpuList(line);
+
+				if (cores != 0 && (cores < res || res == 0))
+				{
+					res = cores;
+				}
+			}
+		}
+	}
+#endif
+
+	return res;
+}
+
 void CpuDetect::BusInfo()
 {
 	std::array<uint, 4> cpuInfo;
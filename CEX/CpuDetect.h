@@ -457,10 +457,57 @@ public:
 	/// <returns>Returns true if the feature is available</returns>
 	static bool Avx2Enabled();
 
+	/// <summary>
+	/// The number of processors this process can actually use.
+	/// <para>The logical processor count is bounded by the thread affinity mask (and so by cpusets), the cgroup cpuset,
+	/// and the cgroup v1 (cpu.cfs_quota_us) or v2 (cpu.max) CPU bandwidth quota, rounded up to whole processors.
+	/// The value is detected once and cached for the process; set Refresh to re-read the limits after they are changed by a container runtime.</para>
+	/// </summary>
+	///
+	/// <param name="Refresh">Re-detect the limits rather than returning the cached value</param>
+	///
+	/// <returns>Returns the effective number of processors, at least one</returns>
+	static size_t AvailableCores(bool Refresh = false);
+
+	/// <summary>
+	/// Get the logical processors available to this process, grouped by the physical core they share.
+	/// <para>Each entry is a physical core, listing the indices of its logical processors (SMT siblings) in ascending order;
+	/// cores are ordered by package and core id. If the topology can not be read from the operating system,
+	/// each logical processor is reported as a separate core.</para>
+	/// </summary>
+	///
+	/// <returns>The logical processor indices grouped by physical core</returns>
+	static std::vector<std::vector<size_t>> CoreTopology();
+
+	/// <summary>
+	/// Count the processors in a Linux cpu list, as read from a cpuset.cpus file.
+	/// <para>The list is a comma separated set of indices and inclusive ranges, ex. "0-3,8,10-11" is 7 processors.
+	/// A reversed range, or an entry containing characters other than digits, a dash or white space, is not counted.</para>
+	/// </summary>
+	///
+	/// <param name="List">The cpu list string</param>
+	///
+	/// <returns>The number of processors in the list, or zero if the list is empty</returns>
+	static size_t ParseCpuList(const std::string &List);
+
+	/// <summary>
+	/// Convert a cgroup CPU bandwidth quota to a processor count, rounded up to whole processors.
+	/// <para>The Quota and Period are the two fields of a cgroup v2 cpu.max file, or the contents of the cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us files.
+	/// An unlimited quota ("max" or -1), or a field that is not a positive decimal integer, returns zero.</para>
+	/// </summary>
+	///
+	/// <param name="Quota">The run-time quota in microseconds</param>
+	/// <param name="Period">The scheduling period in microseconds</param>
+	///
+	/// <returns>The number of processors the quota allows, or zero if the quota is unlimited or invalid</returns>
+	static size_t ParseCpuQuota(const std::string &Quota, const std::string &Period);
+
 private:
 
 
 	void BusInfo();
+	static size_t AffinityCores();
+	static size_t CgroupCores();
 	static void Cpuid(int Flag, std::array<uint, 4> &Output);
 	static void CpuidSublevel(int Flag, int Level, std::array<uint, 4> &Output);
 	bool HasFeature(CpuidFlags Flag);
@@ -0,0 +1,177 @@
+// The GPL version 3 License (GPLv3)
+//
+// Copyright (c) 2020 vtdev.com
+// This file is part of the CEX Cryptographic library.
+//
+// This program is free software : you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+//
+// Implementation Details:
+// A lane scheduler that hashes a batch of independent messages with the horizontally vectorized (wide) permutation functions.
+// Contact: develop@vtdev.com
+
+#ifndef CEX_DIGESTBATCH_H
+#define CEX_DIGESTBATCH_H
+
+#include "CexDomain.h"
+#include "MemoryTools.h"
+#include <algorithm>
+
+NAMESPACE_DIGEST
+
+using Tools::MemoryTools;
+
+/// <summary>
+/// Schedules a batch of independent messages onto the lanes of a horizontally vectorized digest permutation.
+/// <para>Each lane of the wide permutation hashes a different message; when a message is finished, the next message in the batch is loaded into the free lane.
+/// The messages are scheduled longest first, so the shorter messages fill the lanes that become free near the end of the batch.
+/// When fewer than half of the lanes remain busy, the wide permutation is abandoned, and the remaining messages are finished with the sequential permutation.</para>
+/// </summary>
+///
+/// <remarks>
+/// <para>The lane policy (TLanes) supplies the algorithm specific parts of the computation: \n
+/// <c>State</c>; the state type of a single message. \n
+/// <c>BLOCK_SIZE and DIGEST_SIZE</c>; the permutation input block and output sizes. \n
+/// <c>Lanes()</c>; the number of lanes processed by the wide permutation, 1 if there is no wide permutation. \n
+/// <c>Blocks(Length)</c>; the number of permutation blocks in a message of Length bytes, including the padding blocks. \n
+/// <c>Block(Message, Index, Output, Lane, State)</c>; copy (or pad) a message block to the lane offset of the output, and update the per block state (counters and flags). \n
+/// <c>Permute(Input, State)</c>; the sequential permutation of the first block in the input. \n
+/// <c>PermuteW(Input, States)</c>; the wide permutation of one block per lane. \n
+/// <c>Finalize(State, Output)</c>; store the hash value of a finished message.</para>
+/// </remarks>
+class DigestBatch
+{
+public:
+
+	/// <summary>
+	/// Compute the hash values of a batch of messages
+	/// </summary>
+	///
+	/// <param name="Lanes">The lane policy of the digest</param>
+	/// <param name="Input">The batch of messages</param>
+	/// <param name="Output">The hash values, in the order of the messages; resized to the number of messages and the digest size</param>
+	/// <param name="Initial">The initial state of each message</param>
+	template<class TLanes>
+	static void Compute(TLanes &Lanes, const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output, const typename TLanes::State &Initial)
+	{
+		const size_t LNECNT = Lanes.Lanes();
+		std::vector<typename TLanes::State> states(LNECNT, Initial);
+		std::vector<byte> blocks(LNECNT * TLanes::BLOCK_SIZE);
+		std::vector<size_t> order(Input.size());
+		std::vector<size_t> msgidx(LNECNT, 0);
+		std::vector<size_t> blkidx(LNECNT, 0);
+		std::vector<size_t> blkcnt(LNECNT, 0);
+		size_t active;
+		size_t i;
+		size_t next;
+
+		Output.resize(Input.size());
+
+		for (i = 0; i < Input.size(); ++i)
+		{
+			order[i] = i;
+			Output[i].resize(TLanes::DIGEST_SIZE);
+		}
+
+		// longest first; the short messages fill the lanes freed at the end of the batch
+		std::stable_sort(order.begin(), order.end(), [&Input](size_t X, size_t Y)
+		{
+			return Input[X].size() > Input[Y].size();
+		});
+
+		active = 0;
+		next = 0;
+
+		for (;;)
+		{
+			// load the next messages into the free lanes
+			for (i = 0; i < LNECNT; ++i)
+			{
+				if (blkcnt[i] == 0 && next != order.size())
+				{
+					msgidx[i] = order[next];
+					blkidx[i] = 0;
+					blkcnt[i] = Lanes.Blocks(Input[msgidx[i]].size());
+					states[i] = Initial;
+					++active;
+					++next;
+				}
+			}
+
+			// a mostly empty vector is slower than the sequential permutation
+			if (active == 0 || (LNECNT > 1 && active * 2 < LNECNT))
+			{
+				break;
+			}
+
+			for (i = 0; i < LNECNT; ++i)
+			{
+				if (blkcnt[i] != 0)
+				{
+					Lanes.Block(Input[msgidx[i]], blkidx[i], blocks, i, states[i]);
+				}
+				else
+				{
+					MemoryTools::Clear(blocks, i * TLanes::BLOCK_SIZE, TLanes::BLOCK_SIZE);
+				}
+			}
+
+			if (LNECNT > 1)
+			{
+				Lanes.PermuteW(blocks, states);
+			}
+			else
+			{
+				Lanes.Permute(blocks, states[0]);
+			}
+
+			for (i = 0; i < LNECNT; ++i)
+			{
+				if (blkcnt[i] != 0)
+				{
+					++blkidx[i];
+
+					if (blkidx[i] == blkcnt[i])
+					{
+						Lanes.Finalize(states[i], Output[msgidx[i]]);
+						blkcnt[i] = 0;
+						blkidx[i] = 0;
+						--active;
+					}
+				}
+			}
+		}
+
+		// finish the stragglers sequentially
+		for (i = 0; i < LNECNT; ++i)
+		{
+			while (blkidx[i] != blkcnt[i])
+			{
+				Lanes.Block(Input[msgidx[i]], blkidx[i], blocks, 0, states[i]);
+				Lanes.Permute(blocks, states[i]);
+				++blkidx[i];
+
+				if (blkidx[i] == blkcnt[i])
+				{
+					Lanes.Finalize(states[i], Output[msgidx[i]]);
+				}
+			}
+		}
+
+		MemoryTools::Clear(blocks, 0, blocks.size());
+	}
+};
+
+NAMESPACE_DIGESTEND
+#endif
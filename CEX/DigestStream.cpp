@@ -1,6 +1,7 @@
 #include "DigestStream.h"
 #include "DigestFromName.h"
 #include "ParallelOptions.h"
+#include "StreamPipeline.h"
 
 NAMESPACE_PROCESSING
 
@@ -16,12 +17,14 @@ public:
 	size_t Interval;
 	bool Destroy;
 	bool Parallel;
+	bool Pipelined;
 
 	DigestStreamState(bool Destroyed, bool IsParallel)
 		:
 		Interval(0),
 		Destroy(Destroyed),
-		Parallel(IsParallel)
+		Parallel(IsParallel),
+		Pipelined(true)
 	{
 	}
 
@@ -30,6 +33,7 @@ public:
 		Interval = 0;
 		Destroy = false;
 		Parallel = false;
+		Pipelined = false;
 	}
 };
 
@@ -69,6 +73,11 @@ bool DigestStream::IsParallel()
 	return m_digestEngine->IsParallel();
 }
 
+bool &DigestStream::IsPipelined()
+{
+	return m_streamState->Pipelined;
+}
+
 size_t DigestStream::ParallelBlockSize()
 {
 	return m_digestEngine->ParallelBlockSize();
@@ -179,7 +188,45 @@ std::vector<byte> DigestStream::Process(IByteStream* InStream, size_t Length)
 	plen = 0;
 	pread = 0;
 
-	if (m_streamState->Parallel)
+	if (InStream->Enumeral() == Enumeration::StreamModes::MappedFileStream)
+	{
+		const size_t BUFLEN = m_streamState->Parallel ? m_digestEngine->ParallelBlockSize() : StreamPipeline::DEF_BUFFER - (StreamPipeline::DEF_BUFFER % BLKLEN);
+		MappedFileStream* inpmap = static_cast<MappedFileStream*>(InStream);
+		const ulong INPPOS = inpmap->Position();
+		Span<const byte> inpv = inpmap->View(INPPOS, Length);
+
+		// the digest is updated from the mapping; the segment that follows is read ahead
+		while (plen != Length)
+		{
+			const size_t PRCLEN = (Length - plen) < BUFLEN ? (Length - plen) : BUFLEN;
+
+			inpmap->Prefetch(INPPOS + plen + PRCLEN, BUFLEN);
+			m_digestEngine->Update(inpv.data() + plen, PRCLEN);
+			plen += PRCLEN;
+			CalculateProgress(Length, plen);
+		}
+
+		inpmap->Seek(INPPOS + Length, IO::SeekOrigin::Begin);
+	}
+	else if (m_streamState->Pipelined)
+	{
+		const size_t BUFLEN = m_streamState->Parallel ? m_digestEngine->ParallelBlockSize() : StreamPipeline::DEF_BUFFER - (StreamPipeline::DEF_BUFFER % BLKLEN);
+
+		// the stream is read ahead into the buffer ring, while the digest is updated on this thread
+		if (Length >= 2 * BUFLEN)
+		{
+			StreamPipeline pipe(BUFLEN);
+
+			pipe.Process(InStream, Length, [this, Length, &plen](const std::vector<byte> &Input, size_t Count)
+			{
+				m_digestEngine->Update(Input, 0, Count);
+				plen += Count;
+				CalculateProgress(Length, plen);
+			});
+		}
+	}
+
+	if (plen == 0 && m_streamState->Parallel)
 	{
 		const size_t PRLBLK = m_digestEngine->ParallelBlockSize();
 
@@ -200,7 +247,7 @@ std::vector<byte> DigestStream::Process(IByteStream* InStream, size_t Length)
 
 	inp.resize(BLKLEN);
 
-	while (plen != ALNLEN)
+	while (plen < ALNLEN)
 	{
 		pread = InStream->Read(inp, 0, BLKLEN);
 		m_digestEngine->Update(inp, 0, pread);
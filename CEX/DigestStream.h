@@ -29,6 +29,7 @@
 #include "Event.h"
 #include "IByteStream.h"
 #include "IDigest.h"
+#include "MappedFileStream.h"
 
 NAMESPACE_PROCESSING
 
@@ -36,6 +37,7 @@ using Exception::CryptoProcessingException;
 using Enumeration::Digests;
 using Routing::Event;
 using IO::IByteStream;
+using IO::MappedFileStream;
 using Digest::IDigest;
 
 /// <summary>
@@ -58,6 +60,8 @@ using Digest::IDigest;
 /// <list type="bullet">
 /// <item><description>Uses any of the implemented Digests using either the IDigest interface, or a Digests enumeration type.</description></item>
 /// <item><description>This implementation has a Progress counter that returns total sum of bytes processed per either of the Compute() calls.</description></item>
+/// <item><description>The stream Compute function is pipelined; input reads and the digest updates run concurrently, this can be disabled with the IsPipelined() property.</description></item>
+/// <item><description>A MappedFileStream input is hashed directly out of the file mapping, without intermediate copies.</description></item>
 /// </list>
 /// </remarks>
 class DigestStream
@@ -128,6 +132,13 @@ public:
 	/// </summary>
 	bool IsParallel();
 
+	/// <summary>
+	/// Read/Write: Stream reads are overlapped with the digest computation, the default is true.
+	/// <para>When enabled, the Compute(IByteStream*) function reads the input stream on a reader thread into a ring of buffers, while the digest is updated on the calling thread.
+	/// The pipeline is used when the input is at least two buffers in length.</para>
+	/// </summary>
+	bool &IsPipelined();
+
 	/// <summary>
 	/// Read Only: Parallel block size; the minimum input size that triggers parallel processing.
 	/// </summary>
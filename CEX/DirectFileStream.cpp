@@ -0,0 +1,729 @@
+#include "DirectFileStream.h"
+#include "MemoryTools.h"
+
+// CEX_OS_POSIX is only set when unistd.h precedes the configuration header, the unix family targets are matched directly
+#if !defined(CEX_OS_WINDOWS) && (defined(CEX_OS_POSIX) || defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID) || defined(CEX_OS_APPLE) || defined(CEX_OS_BSD) || defined(CEX_OS_UNIX))
+#	define CEX_DIRECTIO_POSIX
+#endif
+
+#if defined(CEX_OS_WINDOWS)
+#	include <windows.h>
+#elif defined(CEX_DIRECTIO_POSIX)
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <sys/stat.h>
+#	include <sys/types.h>
+#	include <unistd.h>
+#endif
+
+NAMESPACE_IO
+
+using Enumeration::ErrorCodes;
+using Tools::MemoryTools;
+
+const std::string DirectFileStream::CLASS_NAME("DirectFileStream");
+
+class DirectFileStream::DirectState
+{
+public:
+
+	std::string FileName;
+	// the buffer is over-allocated by one alignment unit; Block is the aligned start of the usable region
+	std::vector<byte> Buffer;
+	byte* Block;
+	size_t BufferSize;
+	// the file offset of the first buffered byte
+	ulong BufferBase;
+	// the number of bytes read into the buffer, or the number of written bytes waiting to be flushed; only one is non-zero
+	size_t Cached;
+	size_t Pending;
+	ulong Length;
+	ulong Position;
+	// the length preallocated by Reserve; space beyond the stream length is released when the file is closed
+	ulong Reserved;
+#if defined(CEX_OS_WINDOWS)
+	HANDLE FileHandle;
+#else
+	int FileHandle;
+#endif
+	DirectAccess Access;
+	bool Destroyed;
+	bool Direct;
+	bool Writable;
+
+	DirectState(const std::string &Name, DirectAccess Mode, size_t Size)
+		:
+		FileName(Name),
+		Buffer(Size + ALIGN_SIZE),
+		Block(nullptr),
+		BufferSize(Size),
+		BufferBase(0),
+		Cached(0),
+		Pending(0),
+		Length(0),
+		Position(0),
+		Reserved(0),
+#if defined(CEX_OS_WINDOWS)
+		FileHandle(INVALID_HANDLE_VALUE),
+#else
+		FileHandle(-1),
+#endif
+		Access(Mode),
+		Destroyed(false),
+		Direct(false),
+		Writable(Mode != DirectAccess::Read)
+	{
+		const size_t ALNOFT = reinterpret_cast<size_t>(Buffer.data()) % ALIGN_SIZE;
+
+		Block = Buffer.data() + (ALNOFT != 0 ? ALIGN_SIZE - ALNOFT : 0);
+	}
+
+	~DirectState()
+	{
+		MemoryTools::Clear(Buffer, 0, Buffer.size());
+		Block = nullptr;
+		BufferSize = 0;
+		BufferBase = 0;
+		Cached = 0;
+		Pending = 0;
+		Length = 0;
+		Position = 0;
+		Reserved = 0;
+		Destroyed = false;
+		Direct = false;
+		Writable = false;
+	}
+};
+
+//~~~Constructor~~~//
+
+DirectFileStream::DirectFileStream(const std::string &FileName, DirectAccess Access, bool DirectIO, size_t BufferSize)
+	:
+	m_directState(BufferSize != 0 ? new DirectState(FileName, Access, ((BufferSize + ALIGN_SIZE - 1) / ALIGN_SIZE) * ALIGN_SIZE) :
+		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The buffer size can not be zero!"), ErrorCodes::InvalidParam))
+{
+	bool opened;
+
+#if defined(CEX_OS_WINDOWS)
+
+	const DWORD FACCESS = m_directState->Writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+	const DWORD FCREATE = (Access == DirectAccess::Create) ? CREATE_ALWAYS : OPEN_EXISTING;
+	LARGE_INTEGER flen;
+
+	m_directState->FileHandle = CreateFileA(FileName.c_str(), FACCESS, FILE_SHARE_READ, nullptr, FCREATE, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	opened = (m_directState->FileHandle != INVALID_HANDLE_VALUE);
+
+	if (opened && GetFileSizeEx(m_directState->FileHandle, &flen) != 0)
+	{
+		m_directState->Length = static_cast<ulong>(flen.QuadPart);
+	}
+
+#elif defined(CEX_DIRECTIO_POSIX)
+
+	const int FFLAGS = (Access == DirectAccess::Read) ? O_RDONLY : (Access == DirectAccess::ReadWrite) ? O_RDWR : (O_RDWR | O_CREAT | O_TRUNC);
+	struct stat fst;
+
+	m_directState->FileHandle = -1;
+
+#	if defined(O_DIRECT)
+	if (DirectIO)
+	{
+		m_directState->FileHandle = open(FileName.c_str(), FFLAGS | O_DIRECT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		// a file system that does not support direct I/O (tmpfs) rejects the flag, the file is opened through the page cache
+		m_directState->Direct = (m_directState->FileHandle != -1);
+	}
+#	endif
+
+	if (m_directState->FileHandle == -1)
+	{
+		m_directState->FileHandle = open(FileName.c_str(), FFLAGS, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	}
+
+	opened = (m_directState->FileHandle != -1);
+
+	if (opened && fstat(m_directState->FileHandle, &fst) == 0)
+	{
+		m_directState->Length = static_cast<ulong>(fst.st_size);
+	}
+
+#	if defined(POSIX_FADV_SEQUENTIAL)
+	if (opened)
+	{
+		// doubles the kernel read-ahead window on the file
+		posix_fadvise(m_directState->FileHandle, 0, 0, POSIX_FADV_SEQUENTIAL);
+	}
+#	endif
+
+#else
+
+	opened = false;
+
+#endif
+
+	if (!opened)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The file does not exist, or could not be opened!"), ErrorCodes::InvalidParam);
+	}
+}
+
+DirectFileStream::~DirectFileStream()
+{
+	Destroy();
+}
+
+//~~~Accessors~~~//
+
+const DirectFileStream::DirectAccess DirectFileStream::Access()
+{
+	return m_directState->Access;
+}
+
+const size_t DirectFileStream::BufferSize()
+{
+	return m_directState->BufferSize;
+}
+
+const bool DirectFileStream::CanRead()
+{
+	return true;
+}
+
+const bool DirectFileStream::CanSeek()
+{
+	return true;
+}
+
+const bool DirectFileStream::CanWrite()
+{
+	return m_directState->Writable;
+}
+
+const StreamModes DirectFileStream::Enumeral()
+{
+	return StreamModes::DirectFileStream;
+}
+
+std::string DirectFileStream::FileName()
+{
+	return m_directState->FileName;
+}
+
+const bool DirectFileStream::IsDirect()
+{
+	return m_directState->Direct;
+}
+
+const ulong DirectFileStream::Length()
+{
+	return m_directState->Length;
+}
+
+const std::string DirectFileStream::Name()
+{
+	return CLASS_NAME;
+}
+
+const ulong DirectFileStream::Position()
+{
+	return m_directState->Position;
+}
+
+//~~~Public Functions~~~//
+
+void DirectFileStream::Close()
+{
+#if defined(CEX_OS_WINDOWS)
+	if (m_directState->FileHandle != INVALID_HANDLE_VALUE)
+#else
+	if (m_directState->FileHandle != -1)
+#endif
+	{
+		bool flushed;
+
+		flushed = FlushBuffer(m_directState.get());
+
+#if defined(CEX_OS_WINDOWS)
+
+		if (m_directState->Reserved > m_directState->Length)
+		{
+			FILE_ALLOCATION_INFO falc;
+
+			falc.AllocationSize.QuadPart = static_cast<LONGLONG>(m_directState->Length);
+			SetFileInformationByHandle(m_directState->FileHandle, FileAllocationInfo, &falc, sizeof(falc));
+		}
+
+		CloseHandle(m_directState->FileHandle);
+		m_directState->FileHandle = INVALID_HANDLE_VALUE;
+
+#elif defined(CEX_DIRECTIO_POSIX)
+
+		// truncating to the current length releases the preallocated blocks past the end of the file
+		if (m_directState->Reserved > m_directState->Length)
+		{
+			if (ftruncate(m_directState->FileHandle, static_cast<off_t>(m_directState->Length)) != 0)
+			{
+				flushed = false;
+			}
+		}
+
+		close(m_directState->FileHandle);
+		m_directState->FileHandle = -1;
+
+#endif
+
+		m_directState->BufferBase = 0;
+		m_directState->Cached = 0;
+		m_directState->Pending = 0;
+		m_directState->Length = 0;
+		m_directState->Position = 0;
+		m_directState->Reserved = 0;
+
+		// the finalizer can not report a failed write
+		if (!flushed && !m_directState->Destroyed)
+		{
+			throw CryptoProcessingException(CLASS_NAME, std::string("Close"), std::string("The buffered bytes could not be written to the file!"), ErrorCodes::NoAccess);
+		}
+	}
+}
+
+void DirectFileStream::CopyTo(IByteStream* Destination)
+{
+	Flush();
+
+	const size_t CPYLEN = m_directState->BufferSize;
+	std::vector<byte> tmpb(CPYLEN);
+	ulong pos;
+
+	pos = 0;
+
+	while (pos != m_directState->Length)
+	{
+		const size_t RMDLEN = (m_directState->Length - pos) < CPYLEN ? static_cast<size_t>(m_directState->Length - pos) : CPYLEN;
+		const size_t RDLEN = ReadAt(m_directState.get(), tmpb.data(), RMDLEN, pos);
+
+		if (RDLEN == 0)
+		{
+			throw CryptoProcessingException(CLASS_NAME, std::string("CopyTo"), std::string("The file could not be read!"), ErrorCodes::BadRead);
+		}
+
+		Destination->Write(tmpb, 0, RDLEN);
+		pos += RDLEN;
+	}
+}
+
+void DirectFileStream::Destroy()
+{
+	if (!m_directState->Destroyed)
+	{
+		m_directState->Destroyed = true;
+		Close();
+	}
+}
+
+void DirectFileStream::Flush()
+{
+	if (!FlushBuffer(m_directState.get()))
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Flush"), std::string("The buffered bytes could not be written to the file!"), ErrorCodes::NoAccess);
+	}
+}
+
+size_t DirectFileStream::Read(std::vector<byte> &Output, size_t Offset, size_t Length)
+{
+	CEXASSERT(Offset + Length <= Output.size(), "Output array is too small");
+
+	DirectState* state = m_directState.get();
+	size_t prcLen;
+
+	// pending writes must reach the file before it is read back
+	Flush();
+
+	if (Length > state->Length - state->Position)
+	{
+		Length = static_cast<size_t>(state->Length - state->Position);
+	}
+
+	prcLen = 0;
+
+	while (prcLen != Length)
+	{
+		const size_t RMDLEN = Length - prcLen;
+
+		if (state->Position >= state->BufferBase && state->Position < state->BufferBase + state->Cached)
+		{
+			const size_t BUFOFT = static_cast<size_t>(state->Position - state->BufferBase);
+			const size_t CPYLEN = (state->Cached - BUFOFT) < RMDLEN ? (state->Cached - BUFOFT) : RMDLEN;
+
+			MemoryTools::CopyFromObject(state->Block + BUFOFT, Output, Offset + prcLen, CPYLEN);
+			state->Position += CPYLEN;
+			prcLen += CPYLEN;
+		}
+		else if (!state->Direct && RMDLEN >= state->BufferSize)
+		{
+			// a large read goes straight to the output, the copy through the buffer is skipped
+			const size_t RDLEN = ReadAt(state, Output.data() + Offset + prcLen, RMDLEN - (RMDLEN % state->BufferSize), state->Position);
+
+			if (RDLEN == 0)
+			{
+				break;
+			}
+
+			state->Position += RDLEN;
+			prcLen += RDLEN;
+		}
+		else
+		{
+			// refill from an aligned offset, as direct I/O requires
+			const ulong BLKBSE = state->Position - (state->Position % ALIGN_SIZE);
+
+			state->Cached = ReadAt(state, state->Block, state->BufferSize, BLKBSE);
+			state->BufferBase = BLKBSE;
+
+			if (state->BufferBase + state->Cached <= state->Position)
+			{
+				break;
+			}
+
+			Advise(state, BLKBSE + state->BufferSize, state->BufferSize);
+		}
+	}
+
+	return prcLen;
+}
+
+byte DirectFileStream::ReadByte()
+{
+	CEXASSERT(m_directState->Length - m_directState->Position >= 1, "Reached end of file");
+
+	std::vector<byte> tmpv(1);
+
+	Read(tmpv, 0, 1);
+
+	return tmpv[0];
+}
+
+void DirectFileStream::Reserve(ulong Length)
+{
+	if (m_directState->Writable && Length > m_directState->Length && Length > m_directState->Reserved)
+	{
+#if defined(CEX_OS_WINDOWS)
+
+		FILE_ALLOCATION_INFO falc;
+
+		falc.AllocationSize.QuadPart = static_cast<LONGLONG>(Length);
+
+		if (SetFileInformationByHandle(m_directState->FileHandle, FileAllocationInfo, &falc, sizeof(falc)) != 0)
+		{
+			m_directState->Reserved = Length;
+		}
+
+#elif defined(CEX_DIRECTIO_POSIX) && defined(FALLOC_FL_KEEP_SIZE)
+
+		// allocate the blocks without changing the file size, the stream length is still set by the writes
+		if (fallocate(m_directState->FileHandle, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(Length)) == 0)
+		{
+			m_directState->Reserved = Length;
+		}
+
+#endif
+	}
+}
+
+void DirectFileStream::Reset()
+{
+	Seek(0, SeekOrigin::Begin);
+}
+
+void DirectFileStream::Seek(ulong Offset, SeekOrigin Origin)
+{
+	// buffered writes are contiguous from the buffer base, they are written before the position moves
+	Flush();
+
+	if (Origin == SeekOrigin::Begin)
+	{
+		m_directState->Position = Offset;
+	}
+	else if (Origin == SeekOrigin::End)
+	{
+		m_directState->Position = m_directState->Length - Offset;
+	}
+	else
+	{
+		m_directState->Position += Offset;
+	}
+}
+
+void DirectFileStream::SetLength(ulong Length)
+{
+	bool resized;
+
+	if (!m_directState->Writable)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("SetLength"), std::string("The file is read only!"), ErrorCodes::ReadOnly);
+	}
+
+	Flush();
+
+#if defined(CEX_OS_WINDOWS)
+
+	LARGE_INTEGER flen;
+
+	flen.QuadPart = static_cast<LONGLONG>(Length);
+	resized = (SetFilePointerEx(m_directState->FileHandle, flen, nullptr, FILE_BEGIN) != 0 && SetEndOfFile(m_directState->FileHandle) != 0);
+
+#elif defined(CEX_DIRECTIO_POSIX)
+
+	resized = (ftruncate(m_directState->FileHandle, static_cast<off_t>(Length)) == 0);
+
+#else
+
+	resized = false;
+
+#endif
+
+	if (!resized)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("SetLength"), std::string("The file could not be resized!"), ErrorCodes::NoAccess);
+	}
+
+	m_directState->Cached = 0;
+	m_directState->Length = Length;
+
+	if (m_directState->Position > Length)
+	{
+		m_directState->Position = Length;
+	}
+}
+
+void DirectFileStream::Write(const std::vector<byte> &Input, size_t Offset, size_t Length)
+{
+	CEXASSERT(Offset + Length <= Input.size(), "Input array is too small");
+
+	DirectState* state = m_directState.get();
+	size_t prcLen;
+
+	if (!state->Writable)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Write"), std::string("The file is read only!"), ErrorCodes::ReadOnly);
+	}
+
+	if (Length == 0)
+	{
+		return;
+	}
+
+	// the read buffer may hold the bytes being overwritten
+	state->Cached = 0;
+
+	if (state->Pending == 0)
+	{
+		state->BufferBase = state->Position;
+	}
+
+	prcLen = 0;
+
+	// a large write goes straight to the file, the copy through the buffer is skipped
+	if (state->Pending == 0 && !state->Direct && Length >= state->BufferSize)
+	{
+		prcLen = Length - (Length % state->BufferSize);
+
+		if (!WriteAt(state, Input.data() + Offset, prcLen, state->Position))
+		{
+			throw CryptoProcessingException(CLASS_NAME, std::string("Write"), std::string("The bytes could not be written to the file!"), ErrorCodes::NoAccess);
+		}
+
+		state->BufferBase += prcLen;
+	}
+
+	while (prcLen != Length)
+	{
+		const size_t RMDLEN = Length - prcLen;
+		const size_t CPYLEN = (state->BufferSize - state->Pending) < RMDLEN ? (state->BufferSize - state->Pending) : RMDLEN;
+
+		MemoryTools::CopyToObject(Input, Offset + prcLen, state->Block + state->Pending, CPYLEN);
+		state->Pending += CPYLEN;
+		prcLen += CPYLEN;
+
+		if (state->Pending == state->BufferSize)
+		{
+			Flush();
+		}
+	}
+
+	state->Position += Length;
+
+	if (state->Position > state->Length)
+	{
+		state->Length = state->Position;
+	}
+}
+
+void DirectFileStream::WriteByte(byte Value)
+{
+	std::vector<byte> tmpv(1, Value);
+
+	Write(tmpv, 0, 1);
+}
+
+//~~~Private Functions~~~//
+
+void DirectFileStream::Advise(DirectState* State, ulong Offset, size_t Length)
+{
+#if defined(CEX_DIRECTIO_POSIX) && defined(POSIX_FADV_WILLNEED)
+	// start reading the next buffer while this one is being processed; the page cache is not used by direct I/O
+	if (!State->Direct && Offset < State->Length)
+	{
+		posix_fadvise(State->FileHandle, static_cast<off_t>(Offset), static_cast<off_t>(Length), POSIX_FADV_WILLNEED);
+	}
+#endif
+}
+
+bool DirectFileStream::FlushBuffer(DirectState* State)
+{
+	bool res;
+
+	res = true;
+
+	if (State->Pending != 0)
+	{
+		res = WriteAt(State, State->Block, State->Pending, State->BufferBase);
+		State->BufferBase += State->Pending;
+		State->Pending = 0;
+	}
+
+	return res;
+}
+
+size_t DirectFileStream::ReadAt(DirectState* State, byte* Output, size_t Length, ulong Position)
+{
+	size_t prcLen;
+
+	prcLen = 0;
+
+	while (prcLen != Length)
+	{
+#if defined(CEX_OS_WINDOWS)
+
+		const ulong RDPOS = Position + prcLen;
+		const DWORD RDLEN = (Length - prcLen) < 0x40000000UL ? static_cast<DWORD>(Length - prcLen) : 0x40000000UL;
+		OVERLAPPED ovl = { 0 };
+		DWORD rlen;
+
+		ovl.Offset = static_cast<DWORD>(RDPOS);
+		ovl.OffsetHigh = static_cast<DWORD>(RDPOS >> 32);
+
+		if (ReadFile(State->FileHandle, Output + prcLen, RDLEN, &rlen, &ovl) == 0)
+		{
+			if (GetLastError() == ERROR_HANDLE_EOF)
+			{
+				break;
+			}
+
+			throw CryptoProcessingException(CLASS_NAME, std::string("Read"), std::string("The file could not be read!"), ErrorCodes::BadRead);
+		}
+
+#elif defined(CEX_DIRECTIO_POSIX)
+
+		const ssize_t rlen = pread(State->FileHandle, Output + prcLen, Length - prcLen, static_cast<off_t>(Position + prcLen));
+
+		if (rlen < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			throw CryptoProcessingException(CLASS_NAME, std::string("Read"), std::string("The file could not be read!"), ErrorCodes::BadRead);
+		}
+
+#else
+
+		const size_t rlen = 0;
+
+#endif
+
+		if (rlen == 0)
+		{
+			break;
+		}
+
+		prcLen += static_cast<size_t>(rlen);
+	}
+
+	return prcLen;
+}
+
+bool DirectFileStream::WriteAt(DirectState* State, const byte* Input, size_t Length, ulong Position)
+{
+	size_t prcLen;
+	bool res;
+
+	prcLen = 0;
+	res = true;
+
+#if defined(CEX_DIRECTIO_POSIX) && defined(O_DIRECT)
+	// direct I/O requires an aligned address, offset, and length; an unaligned write (the tail of the file) goes through the page cache
+	const bool UNALN = State->Direct && ((reinterpret_cast<size_t>(Input) | static_cast<size_t>(Position) | Length) % ALIGN_SIZE) != 0;
+	const int FFLAGS = fcntl(State->FileHandle, F_GETFL);
+
+	if (UNALN)
+	{
+		fcntl(State->FileHandle, F_SETFL, FFLAGS & ~O_DIRECT);
+	}
+#endif
+
+	while (prcLen != Length)
+	{
+#if defined(CEX_OS_WINDOWS)
+
+		const ulong WRPOS = Position + prcLen;
+		const DWORD WRLEN = (Length - prcLen) < 0x40000000UL ? static_cast<DWORD>(Length - prcLen) : 0x40000000UL;
+		OVERLAPPED ovl = { 0 };
+		DWORD wlen;
+
+		ovl.Offset = static_cast<DWORD>(WRPOS);
+		ovl.OffsetHigh = static_cast<DWORD>(WRPOS >> 32);
+
+		if (WriteFile(State->FileHandle, Input + prcLen, WRLEN, &wlen, &ovl) == 0 || wlen == 0)
+		{
+			res = false;
+			break;
+		}
+
+#elif defined(CEX_DIRECTIO_POSIX)
+
+		const ssize_t wlen = pwrite(State->FileHandle, Input + prcLen, Length - prcLen, static_cast<off_t>(Position + prcLen));
+
+		if (wlen <= 0)
+		{
+			if (wlen < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			res = false;
+			break;
+		}
+
+#else
+
+		const size_t wlen = 0;
+		res = false;
+		break;
+
+#endif
+
+		prcLen += static_cast<size_t>(wlen);
+	}
+
+#if defined(CEX_DIRECTIO_POSIX) && defined(O_DIRECT)
+	if (UNALN)
+	{
+		fcntl(State->FileHandle, F_SETFL, FFLAGS);
+	}
+#endif
+
+	return res;
+}
+
+NAMESPACE_IOEND
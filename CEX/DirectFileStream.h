@@ -0,0 +1,298 @@
+// The GPL version 3 License (GPLv3)
+//
+// Copyright (c) 2020 vtdev.com
+// This file is part of the CEX Cryptographic library.
+//
+// This program is free software : you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+//
+// Implementation Details:
+// A descriptor based file stream for large sequential files, using positional I/O with large aligned buffers.
+// Contact: develop@vtdev.com
+
+#ifndef CEX_DIRECTFILESTREAM_H
+#define CEX_DIRECTFILESTREAM_H
+
+#include "IByteStream.h"
+
+NAMESPACE_IO
+
+/// <summary>
+/// A descriptor based file streaming container, for high-throughput sequential access to large files.
+/// <para>The file is accessed with positional reads and writes (pread and pwrite) through a large aligned buffer, instead of the small internal buffers of std::fstream.
+/// Reads and writes the size of the buffer or larger bypass the buffer entirely.
+/// The file can optionally be opened for direct I/O (O_DIRECT), which bypasses the operating system page cache.</para>
+/// </summary>
+///
+/// <example>
+/// <description>Encrypting a large file:</description>
+/// <code>
+/// DirectFileStream fin("C://Tests//archive.bin", DirectFileStream::DirectAccess::Read);
+/// DirectFileStream fout("C://Tests//archive.enc", DirectFileStream::DirectAccess::Create);
+/// CipherStream cs(BlockCiphers::AES, CipherModes::CTR);
+/// cs.Initialize(true, kp);
+/// cs.Write(&amp;fin, &amp;fout);
+/// </code>
+/// </example>
+///
+/// <remarks>
+/// <description>Implementation Notes:</description>
+/// <list type="bullet">
+/// <item><description>The file is opened with a sequential access advisory (posix_fadvise), and the range that follows each buffer refill is advised as will-need, so the kernel reads ahead of the stream.</description></item>
+/// <item><description>The Reserve function preallocates the disk blocks for a known output length (fallocate), without changing the file length; the CipherStream class reserves its output length before writing.</description></item>
+/// <item><description>Direct I/O requires aligned offsets and lengths; the stream buffer is aligned to ALIGN_SIZE, and an unaligned segment (the tail of a file) is written through the page cache.</description></item>
+/// <item><description>On Windows the file is opened with the sequential scan flag and accessed with offset reads and writes; the direct I/O and read-ahead options are not applied.</description></item>
+/// <item><description>Buffered writes are flushed when the buffer is full, when the stream position is moved, and when the stream is flushed or closed.</description></item>
+/// </list>
+/// </remarks>
+class DirectFileStream final : public IByteStream
+{
+public:
+
+	//~~~Enums~~~//
+
+	/// <summary>
+	/// File access type flags
+	/// </summary>
+	enum class DirectAccess : byte
+	{
+		/// <summary>
+		/// Open an existing file for read access
+		/// </summary>
+		Read = 1,
+		/// <summary>
+		/// Open an existing file for read and write access
+		/// </summary>
+		ReadWrite = 2,
+		/// <summary>
+		/// Create or truncate a file, and open it for read and write access
+		/// </summary>
+		Create = 3
+	};
+
+private:
+
+	static const std::string CLASS_NAME;
+
+	class DirectState;
+	std::unique_ptr<DirectState> m_directState;
+
+public:
+
+	/// <summary>
+	/// The buffer and direct I/O alignment in bytes
+	/// </summary>
+	static const size_t ALIGN_SIZE = 4096;
+
+	/// <summary>
+	/// The default stream buffer size in bytes
+	/// </summary>
+	static const size_t DEF_BUFFER = 1024 * 1024;
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	DirectFileStream(const DirectFileStream&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	DirectFileStream& operator=(const DirectFileStream&) = delete;
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	DirectFileStream() = delete;
+
+	/// <summary>
+	/// Constructor: open a file
+	/// </summary>
+	///
+	/// <param name="FileName">The full path and name of the file</param>
+	/// <param name="Access">The level of access requested</param>
+	/// <param name="DirectIO">Open the file for direct I/O, bypassing the page cache; ignored if the platform or file system does not support it</param>
+	/// <param name="BufferSize">The size of the stream buffer in bytes; rounded up to a multiple of ALIGN_SIZE</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the file does not exist or could not be opened, or the buffer size is zero</exception>
+	explicit DirectFileStream(const std::string &FileName, DirectAccess Access = DirectAccess::Read, bool DirectIO = false, size_t BufferSize = DEF_BUFFER);
+
+	/// <summary>
+	/// Destructor: finalize this class
+	/// </summary>
+	~DirectFileStream() override;
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The file access flags
+	/// </summary>
+	const DirectAccess Access();
+
+	/// <summary>
+	/// Read Only: The size of the stream buffer in bytes
+	/// </summary>
+	const size_t BufferSize();
+
+	/// <summary>
+	/// Read Only: The stream can be read
+	/// </summary>
+	const bool CanRead() override;
+
+	/// <summary>
+	/// Read Only: The stream is seekable
+	/// </summary>
+	const bool CanSeek() override;
+
+	/// <summary>
+	/// Read Only: The stream can be written to
+	/// </summary>
+	const bool CanWrite() override;
+
+	/// <summary>
+	/// Read Only: The stream container type
+	/// </summary>
+	const StreamModes Enumeral() override;
+
+	/// <summary>
+	/// Read Only: The file name and path
+	/// </summary>
+	std::string FileName();
+
+	/// <summary>
+	/// Read Only: The file was opened for direct I/O
+	/// </summary>
+	const bool IsDirect();
+
+	/// <summary>
+	/// Read Only: The stream length
+	/// </summary>
+	const ulong Length() override;
+
+	/// <summary>
+	/// Read Only: The streams class name
+	/// </summary>
+	const std::string Name() override;
+
+	/// <summary>
+	/// Read Only: The streams current position
+	/// </summary>
+	const ulong Position() override;
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Flush the buffered writes and close the file
+	/// </summary>
+	void Close() override;
+
+	/// <summary>
+	/// Copy this stream to another stream
+	/// </summary>
+	///
+	/// <param name="Destination">The destination stream</param>
+	void CopyTo(IByteStream* Destination) override;
+
+	/// <summary>
+	/// Release all resources associated with the object; optional, called by the finalizer
+	/// </summary>
+	void Destroy() override;
+
+	/// <summary>
+	/// Write the buffered bytes to the file
+	/// </summary>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the write fails</exception>
+	void Flush();
+
+	/// <summary>
+	/// Copies a portion of the stream into an output buffer
+	/// </summary>
+	///
+	/// <param name="Output">The output array receiving the bytes</param>
+	/// <param name="Offset">Offset within the output array at which to begin</param>
+	/// <param name="Length">The number of bytes to read</param>
+	///
+	/// <returns>The number of bytes read</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the read fails</exception>
+	size_t Read(std::vector<byte> &Output, size_t Offset, size_t Length) override;
+
+	/// <summary>
+	/// Read a single byte from the stream
+	/// </summary>
+	///
+	/// <returns>The read byte value</returns>
+	byte ReadByte() override;
+
+	/// <summary>
+	/// Preallocate the disk space for a file of a known length, without changing the stream length.
+	/// <para>Reserving the output length before a large sequential write avoids file system fragmentation and block allocation during the write.
+	/// The call is advisory; it does nothing if the platform or file system does not support preallocation.</para>
+	/// </summary>
+	///
+	/// <param name="Length">The expected length of the file</param>
+	void Reserve(ulong Length);
+
+	/// <summary>
+	/// Reset the position of the stream to zero
+	/// </summary>
+	void Reset() override;
+
+	/// <summary>
+	/// Seek to a position within the stream
+	/// </summary>
+	///
+	/// <param name="Offset">The offset position</param>
+	/// <param name="Origin">The starting point</param>
+	void Seek(ulong Offset, SeekOrigin Origin) override;
+
+	/// <summary>
+	/// Set the length of the file
+	/// </summary>
+	///
+	/// <param name="Length">The desired length</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the stream is read only, or the file could not be resized</exception>
+	void SetLength(ulong Length) override;
+
+	/// <summary>
+	/// Writes an input buffer to the stream
+	/// </summary>
+	///
+	/// <param name="Input">The input array to write to the stream</param>
+	/// <param name="Offset">Offset within the input array at which to begin</param>
+	/// <param name="Length">The number of bytes to write</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the stream is read only, or the write fails</exception>
+	void Write(const std::vector<byte> &Input, size_t Offset, size_t Length) override;
+
+	/// <summary>
+	/// Write a single byte to the stream
+	/// </summary>
+	///
+	/// <param name="Value">The byte value to write</param>
+	void WriteByte(byte Value) override;
+
+private:
+
+	static void Advise(DirectState* State, ulong Offset, size_t Length);
+	static bool FlushBuffer(DirectState* State);
+	static size_t ReadAt(DirectState* State, byte* Output, size_t Length, ulong Position);
+	static bool WriteAt(DirectState* State, const byte* Input, size_t Length, ulong Position);
+};
+
+NAMESPACE_IOEND
+#endif
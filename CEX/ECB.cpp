@@ -180,6 +180,9 @@ void ECB::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -211,30 +214,15 @@ void ECB::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the length");
 	CEXASSERT(Length % BlockSize() == 0, "The length must be evenly divisible by the block size");
 
-	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
-	size_t i;
-
-	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
-	{
-		const size_t BLKCNT = Length / PRLBLK;
-
-		for (i = 0; i < BLKCNT; ++i)
-		{
-			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK));
-		}
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
 
-		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+void ECB::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized");
+	CEXASSERT(Length % BlockSize() == 0, "The length must be evenly divisible by the block size");
 
-		if (RMDLEN != 0)
-		{
-			const size_t BLKOFT = (PRLBLK * BLKCNT);
-			ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
-		}
-	}
-	else
-	{
-		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
-	}
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -255,7 +243,7 @@ void ECB::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	m_blockCipher->EncryptBlock(Input, InOffset, Output, OutOffset);
 }
 
-void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t BlockCount)
+void ECB::Generate(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t BlockCount)
 {
 	size_t bctr;
 	size_t rctr;
@@ -272,31 +260,34 @@ void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<
 		while (rctr != 0)
 		{
 			// transform 16 blocks
-			m_blockCipher->Transform2048(Input, InOffset, Output, OutOffset);
+			m_blockCipher->Transform2048(Input.data() + InOffset, Output.data() + OutOffset);
 			InOffset += AVX512BLK;
 			OutOffset += AVX512BLK;
 			bctr -= 16;
 			--rctr;
 		}
 	}
-#elif defined(CEX_HAS_AVX2)
+#endif
+
+#if defined(CEX_HAS_AVX)
+	// the remainder of a wider kernel cascades to the narrower kernels
 	if (bctr > 7)
 	{
-		// 256bit avx
+		// 8 blocks
 		const size_t AVX2BLK = 128;
 		rctr = (bctr / 8);
 
 		while (rctr != 0)
 		{
 			// 8 blocks
-			m_blockCipher->Transform1024(Input, InOffset, Output, OutOffset);
+			m_blockCipher->Transform1024(Input.data() + InOffset, Output.data() + OutOffset);
 			InOffset += AVX2BLK;
 			OutOffset += AVX2BLK;
 			bctr -= 8;
 			--rctr;
 		}
 	}
-#elif defined(CEX_HAS_AVX)
+
 	if (bctr > 3)
 	{
 		// 128bit sse3
@@ -306,7 +297,7 @@ void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<
 		while (rctr != 0)
 		{
 			// 4 blocks
-			m_blockCipher->Transform512(Input, InOffset, Output, OutOffset);
+			m_blockCipher->Transform512(Input.data() + InOffset, Output.data() + OutOffset);
 			InOffset += AVXBLK;
 			OutOffset += AVXBLK;
 			bctr -= 4;
@@ -317,14 +308,42 @@ void ECB::Generate(const std::vector<byte> &Input, size_t InOffset, std::vector<
 
 	while (bctr != 0)
 	{
-		m_blockCipher->Transform(Input, InOffset, Output, OutOffset);
+		m_blockCipher->Transform(Input.data() + InOffset, Output.data() + OutOffset);
 		InOffset += BLOCK_SIZE;
 		OutOffset += BLOCK_SIZE;
 		--bctr;
 	}
 }
 
-void ECB::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void ECB::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
+	size_t i;
+
+	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
+	{
+		const size_t BLKCNT = Length / PRLBLK;
+
+		for (i = 0; i < BLKCNT; ++i)
+		{
+			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK));
+		}
+
+		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+
+		if (RMDLEN != 0)
+		{
+			const size_t BLKOFT = (PRLBLK * BLKCNT);
+			ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+		}
+	}
+	else
+	{
+		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
+	}
+}
+
+void ECB::ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t SEGLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
 	const size_t BLKCNT = (SEGLEN / BLOCK_SIZE);
@@ -335,14 +354,14 @@ void ECB::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 	});
 }
 
-void ECB::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void ECB::ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t BLKCNT = Length / BLOCK_SIZE;
 	size_t i;
 
 	for (i = 0; i < BLKCNT; ++i)
 	{
-		m_blockCipher->Transform(Input, InOffset + (i * BLOCK_SIZE), Output, OutOffset + (i * BLOCK_SIZE));
+		m_blockCipher->Transform(Input.data() + InOffset + (i * BLOCK_SIZE), Output.data() + OutOffset + (i * BLOCK_SIZE));
 	}
 }
 
@@ -1,4 +1,7 @@
 #include "GCM.h"
+#if defined(CEX_HAS_AVX)
+#	include "AHX.h"
+#endif
 #include "IntegerTools.h"
 #include "MemoryTools.h"
 
@@ -13,9 +16,9 @@ class GCM::GcmState
 {
 public:
 
+	std::array<ulong, Numeric::CMUL::CMUL_POWERS_SIZE> Powers;
 	std::vector<byte> AAD;
 	SecureVector<byte> Buffer;
-	SecureVector<byte> Key;
 	std::vector<byte> Nonce;
 	std::vector<byte> Tag;
 	size_t Counter;
@@ -23,19 +26,21 @@ public:
 	bool Encryption;
 	bool Finalized;
 	bool Initialized;
+	bool Stitched;
 
 	GcmState(bool IsDestroyed)
 		:
+		Powers { 0 },
 		AAD(0),
 		Buffer(0),
-		Key(0),
 		Nonce(BLOCK_SIZE, 0x00),
 		Tag(BLOCK_SIZE, 0x00),
 		Counter(0),
 		Destroyed(IsDestroyed),
 		Encryption(false),
 		Finalized(false),
-		Initialized(false)
+		Initialized(false),
+		Stitched(false)
 	{
 	}
 
@@ -46,9 +51,9 @@ public:
 
 	void Reset()
 	{
+		MemoryTools::Clear(Powers, 0, Powers.size() * sizeof(ulong));
 		MemoryTools::Clear(AAD, 0, AAD.size());
 		MemoryTools::Clear(Buffer, 0, Buffer.size());
-		MemoryTools::Clear(Key, 0, Key.size());
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
 		MemoryTools::Clear(Tag, 0, Tag.size());
 		Counter = 0;
@@ -80,6 +85,7 @@ GCM::GCM(BlockCiphers CipherType)
 	m_parallelProfile(BLOCK_SIZE, m_cipherMode->ParallelProfile().IsParallel(), m_cipherMode->ParallelProfile().ParallelBlockSize(),
 		m_cipherMode->ParallelProfile().ParallelMaxDegree(), true, m_cipherMode->Engine()->StateCacheSize(), true)
 {
+	m_gcmState->Stitched = HasStitch(m_cipherMode->Engine());
 }
 
 GCM::GCM(IBlockCipher* Cipher)
@@ -100,6 +106,28 @@ GCM::GCM(IBlockCipher* Cipher)
 	m_parallelProfile(BLOCK_SIZE, m_cipherMode->ParallelProfile().IsParallel(), m_cipherMode->ParallelProfile().ParallelBlockSize(),
 		m_cipherMode->ParallelProfile().ParallelMaxDegree(), true, m_cipherMode->Engine()->StateCacheSize(), true)
 {
+	m_gcmState->Stitched = HasStitch(m_cipherMode->Engine());
+}
+
+GCM::GCM(const std::shared_ptr<BlockCipherContext> &Context)
+	:
+	m_gcmState(new GcmState(true)),
+	m_cipherMode(Context != nullptr ? new CTR(Context) :
+		throw CryptoCipherModeException(AeadModeConvert::ToName(AeadModes::GCM), std::string("Constructor"), std::string("The key context can not be null!"), ErrorCodes::IllegalOperation)), //-V2571
+	m_macAuthenticator(new Digest::GHASH()),
+	m_legalKeySizes((Context == nullptr || Context->CipherType() == BlockCiphers::AES || Context->CipherType() == BlockCiphers::Serpent) ?
+		std::vector<SymmetricKeySize> { 
+			SymmetricKeySize(16, BLOCK_SIZE, 0), 
+			SymmetricKeySize(24, BLOCK_SIZE, 0), 
+			SymmetricKeySize(32, BLOCK_SIZE, 0) } :
+		std::vector<SymmetricKeySize>{ 
+			SymmetricKeySize(16, BLOCK_SIZE, 0), 
+			SymmetricKeySize(32, BLOCK_SIZE, 0), 
+			SymmetricKeySize(64, BLOCK_SIZE, 0) }),
+	m_parallelProfile(BLOCK_SIZE, m_cipherMode->ParallelProfile().IsParallel(), m_cipherMode->ParallelProfile().ParallelBlockSize(),
+		m_cipherMode->ParallelProfile().ParallelMaxDegree(), true, m_cipherMode->Engine()->StateCacheSize(), true)
+{
+	m_gcmState->Stitched = HasStitch(m_cipherMode->Engine());
 }
 
 GCM::~GCM()
@@ -214,7 +242,7 @@ void GCM::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		{
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The nonce can not be zeroised or repeating!"), ErrorCodes::InvalidNonce);
 		}
-		if (!m_cipherMode->IsInitialized())
+		if (!m_cipherMode->Engine()->IsInitialized())
 		{
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
 		}
@@ -226,23 +254,31 @@ void GCM::Initialize(bool Encryption, ISymmetricKey &Parameters)
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes in length!"), ErrorCodes::InvalidKey);
 		}
 
-		// key the block-cipher and create the hash key
-		m_cipherMode->Engine()->Initialize(true, Parameters);
-		std::vector<byte> tmph(BLOCK_SIZE);
-		const std::vector<byte> ZEROES(BLOCK_SIZE, 0x00);
-		m_cipherMode->Engine()->Transform(ZEROES, 0, tmph, 0);
+		// key the block-cipher through the counter mode; a mode bound to a shared key context rejects the key
+		SymmetricKey kp(Parameters.SecureKey(), SecureVector<byte>(BLOCK_SIZE, 0x00), Parameters.SecureInfo());
+		m_cipherMode->Initialize(true, kp);
+	}
 
-		std::vector<ulong> gkey = 
-		{
-			IntegerTools::BeBytesTo64(tmph, 0),
-			IntegerTools::BeBytesTo64(tmph, 8)
-		};
-
-		// initialize the ghash function
-		m_macAuthenticator->Initialize(gkey);
-		// store the key in a secure-vector
-		m_gcmState->Key.resize(Parameters.KeySizes().KeySize());
-		MemoryTools::Copy(Parameters.SecureKey(), 0, m_gcmState->Key, 0, m_gcmState->Key.size());
+	// create the hash key from the keyed block-cipher
+	std::vector<byte> tmph(BLOCK_SIZE);
+	const std::vector<byte> ZEROES(BLOCK_SIZE, 0x00);
+	m_cipherMode->Engine()->Transform(ZEROES, 0, tmph, 0);
+
+	std::vector<ulong> gkey = 
+	{
+		IntegerTools::BeBytesTo64(tmph, 0),
+		IntegerTools::BeBytesTo64(tmph, 8)
+	};
+
+	// initialize the ghash function
+	m_macAuthenticator->Initialize(gkey);
+
+	if (m_gcmState->Stitched)
+	{
+		// the stitched kernel multiplies 8 blocks by the powers of the hash key
+		std::array<ulong, Numeric::CMUL::CMUL_STATE_SIZE> tmpk = { gkey[0], gkey[1] };
+		Numeric::CMUL::PreCompute(tmpk, m_gcmState->Powers);
+		MemoryTools::Clear(tmpk, 0, tmpk.size() * sizeof(ulong));
 	}
 
 	// load the state
@@ -264,8 +300,8 @@ void GCM::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		MemoryTools::Copy(tmpn, 0, m_gcmState->Nonce, 0, m_gcmState->Nonce.size());
 	}
 
-	// initialize the CTR mode
-	SymmetricKey ckp(m_gcmState->Key, SecureLock(m_gcmState->Nonce));
+	// initialize the CTR mode with the nonce, the key schedule is not expanded again
+	SymmetricKey ckp(SecureVector<byte>(0), SecureLock(m_gcmState->Nonce));
 	m_cipherMode->Initialize(true, ckp);
 	m_cipherMode->ParallelProfile().Calculate(m_parallelProfile.IsParallel(), m_parallelProfile.ParallelBlockSize(), m_parallelProfile.ParallelMaxDegree());
 
@@ -325,35 +361,23 @@ void GCM::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the the block-size!");
 
-	m_gcmState->Counter += Length;
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
 
-	if (IsEncryption() == true)
-	{
-		// encrypt plain-text
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
-		// process the cipher-text
-		m_macAuthenticator->Update(Output, OutOffset, m_gcmState->Tag, Length);
-		// append the tag to the cipher-text
-		Finalize(Output, OutOffset + Length, TagSize());
-	}
-	else
-	{
-		// process the cipher-text
-		m_macAuthenticator->Update(Input, InOffset, m_gcmState->Tag, Length);
+void GCM::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 
-		// compare the MAC code appended to the ciphertext with the one generated, if they do not match, throw exception bybassing decryption
-		if (!Verify(Input, InOffset + Length, TagSize()))
-		{
-			throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-		}
+	// the tag is appended to the cipher-text on encryption, and read from the end of the cipher-text on decryption
+	const size_t INPLEN = IsEncryption() ? Length : Length + TagSize();
+	const size_t OTPLEN = IsEncryption() ? Length + TagSize() : Length;
 
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
-	}
+	Process(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
 
-void GCM::Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void GCM::Finalize(const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	if (Length < MIN_TAGSIZE || Length > BLOCK_SIZE)
 	{
@@ -384,7 +408,94 @@ void GCM::Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length)
 	m_gcmState->Initialized = false;
 }
 
-bool GCM::Verify(const std::vector<byte> &Input, size_t Offset, size_t Length)
+bool GCM::HasStitch(IBlockCipher* Cipher)
+{
+#if defined(CEX_HAS_AVX2)
+	// the stitched kernel is implemented by the AES-NI cipher
+	return Digest::GHASH::HasGmul() && dynamic_cast<Block::AHX*>(Cipher) != nullptr;
+#else
+	return false;
+#endif
+}
+
+void GCM::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	// inputs that are processed by the parallel cipher use the two-pass path, and are hashed in parallel
+	const bool PRLPRC = IsParallel() && Length >= ParallelBlockSize();
+	// the cipher rounds are interleaved with the hash of the preceding 8 blocks, the tag is checked before decryption
+	const bool STCPRC = m_gcmState->Stitched && IsEncryption() && PRLPRC == false && Length >= STITCH_MINIMUM;
+
+	m_gcmState->Counter += Length;
+
+	if (IsEncryption() == true)
+	{
+		if (STCPRC == true)
+		{
+			// encrypt and hash the message in a single pass
+			Stitch(Input, InOffset, Output, OutOffset, Length);
+		}
+		else
+		{
+			// encrypt plain-text
+			m_cipherMode->Transform(Input.data() + InOffset, Output.data() + OutOffset, Length);
+			// process the cipher-text
+			if (PRLPRC == true)
+			{
+				m_macAuthenticator->ParallelUpdate(Output, OutOffset, m_gcmState->Tag, Length, m_parallelProfile.ParallelMaxDegree());
+			}
+			else
+			{
+				m_macAuthenticator->Update(Output, OutOffset, m_gcmState->Tag, Length);
+			}
+		}
+
+		// append the tag to the cipher-text
+		Finalize(Output, OutOffset + Length, TagSize());
+	}
+	else
+	{
+		// process the cipher-text
+		if (PRLPRC == true)
+		{
+			m_macAuthenticator->ParallelUpdate(Input, InOffset, m_gcmState->Tag, Length, m_parallelProfile.ParallelMaxDegree());
+		}
+		else
+		{
+			m_macAuthenticator->Update(Input, InOffset, m_gcmState->Tag, Length);
+		}
+
+		// compare the MAC code appended to the ciphertext with the one generated, if they do not match, throw exception bybassing decryption
+		if (!Verify(Input, InOffset + Length, TagSize()))
+		{
+			throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+		}
+
+		m_cipherMode->Transform(Input.data() + InOffset, Output.data() + OutOffset, Length);
+	}
+}
+
+void GCM::Stitch(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+#if defined(CEX_HAS_AVX)
+	Block::AHX* eng = static_cast<Block::AHX*>(m_cipherMode->Engine());
+	std::vector<byte> ctr(m_cipherMode->Nonce());
+	size_t plen;
+
+	// each group of 8 counter blocks is encrypted while the previous group of cipher-text is hashed
+	plen = eng->GcmEncrypt(m_gcmState->Powers, ctr, m_gcmState->Tag, Input.data() + InOffset, Output.data() + OutOffset, Length);
+	// the first counter block encrypted the tag nonce, the message begins at the second
+	m_cipherMode->Seek(BLOCK_SIZE + plen);
+
+	// the remainder is less than 8 blocks
+	if (plen != Length)
+	{
+		m_cipherMode->Transform(Input.data() + InOffset + plen, Output.data() + OutOffset + plen, Length - plen);
+		m_macAuthenticator->Update(Output, OutOffset + plen, m_gcmState->Tag, Length - plen);
+	}
+#endif
+}
+
+bool GCM::Verify(const Span<const byte> &Input, size_t Offset, size_t Length)
 {
 	std::vector<byte> code(TagSize());
 	bool ret;
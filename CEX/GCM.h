@@ -103,7 +103,11 @@ NAMESPACE_MODE
 /// The GCM parallel mode also leverages SIMD instructions to 'double parallelize' those segments. \n
 /// An input block assigned to a thread uses SIMD instructions to decrypt/encrypt 4, 8, or 16 blocks in parallel per cycle, depending on which framework is runtime available, AVX, AVX2, or AVX512 instructions. \n
 /// Input blocks equal to, or divisble by the ParallelBlockSize() are processed in parallel on supported systems, this can be disabled through the ParallelProfile accessor function. \n
-/// The cipher transform is parallelizable, however the authentication pass, (GMAC), is processed sequentially.</para>
+/// The authentication pass, (GMAC), is also multi-threaded for these inputs; the hash is linear, so each thread hashes an equal segment of the cipher-text,
+/// and the partial hashes are combined by multiplying with the power of the hash key that matches the segment length.</para>
+/// <para>When the cipher is AES-NI and the carry-less multiply instructions are available, an encryption input that is not processed in parallel is encrypted and authenticated in a single pass. \n
+/// The AES rounds of each group of 8 counter blocks are interleaved with the carry-less multiplies of the previous group's cipher-text, so the hash is computed in the latency of the cipher rounds. \n
+/// Decryption always authenticates the cipher-text before it is decrypted; if the tag does not match, nothing is written to the output.</para>
 ///
 /// <description>Implementation Notes:</description>
 /// <list type="bullet">
@@ -132,6 +136,7 @@ private:
 	static const size_t MAX_PRLALLOC = 100000000;
 	static const size_t MIN_NONCESIZE = 8;
 	static const size_t MIN_TAGSIZE = 12;
+	static const size_t STITCH_MINIMUM = 16 * BLOCK_SIZE;
 
 	class GcmState;
 	std::unique_ptr<GcmState> m_gcmState;
@@ -178,6 +183,17 @@ public:
 	/// <exception cref="CryptoCipherModeException">Thrown if a null block cipher is used</exception>
 	explicit GCM(IBlockCipher* Cipher);
 
+	/// <summary>
+	/// Initialize the Cipher Mode using a shared block-cipher key schedule.
+	/// <para>The mode must be initialized with a nonce-only SymmetricKey; the hash key is derived from the shared block-cipher on each initialization,
+	/// and the key schedule is not expanded again.</para>
+	/// </summary>
+	///
+	/// <param name="Context">The shared block-cipher key context; can not be null</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if a null context is used</exception>
+	explicit GCM(const std::shared_ptr<BlockCipherContext> &Context);
+
 	/// <summary>
 	/// Destructor: finalize this class
 	/// </summary>
@@ -278,7 +294,8 @@ public:
 	/// <summary>
 	/// Initialize the Cipher instance.
 	/// <para>The legal symmetric key and nonce sizes are contained in the LegalKeySizes() property.
-	/// The Info parameter of the SymmetricKey can be used as the initial associated data.</para>
+	/// The Info parameter of the SymmetricKey can be used as the initial associated data.
+	/// After the first initialization, or when constructed with a key context, a SymmetricKey with an empty key re-initializes the mode with a new nonce using the existing key schedule.</para>
 	/// </summary>
 	/// 
 	/// <param name="Encryption">Set to true if cipher is used for encryption, false for decryption operation mode</param>
@@ -339,11 +356,30 @@ public:
 	/// <param name="Length">The number of bytes to transform</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The bytes are read from and written to the callers memory directly, without an intermediate vector.
+	/// When encrypting, the Output must be able to receive Length + TagSize() bytes, the authentication tag is appended to the cipher-text.
+	/// When decrypting, the Input must contain Length + TagSize() bytes, the cipher-text followed by the authentication tag.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer</param>
+	/// <param name="Length">The number of message bytes to transform</param>
+	///
+	/// <exception cref="CryptoAuthenticationFailure">Thrown during decryption if the authentication tag does not match</exception>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 private:
 
 	void Compute(const std::vector<byte> &Input, size_t Offset, size_t Length);
-	void Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length);
-	bool Verify(const std::vector<byte> &Input, size_t Offset, size_t Length);
+	void Finalize(const Span<byte> &Output, size_t OutOffset, size_t Length);
+	static bool HasStitch(IBlockCipher* Cipher);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void Stitch(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	bool Verify(const Span<const byte> &Input, size_t Offset, size_t Length);
 };
 
 NAMESPACE_MODEEND
@@ -1,6 +1,7 @@
 #include "GHASH.h"
 #include "CpuDetect.h"
 #include "IntegerTools.h"
+#include "ParallelTools.h"
 #if defined(CEX_HAS_AVX2)
 #	include "Intrinsics.h"
 #	include <wmmintrin.h>
@@ -10,6 +11,7 @@ NAMESPACE_DIGEST
 
 using Tools::IntegerTools;
 using Tools::MemoryTools;
+using Tools::ParallelTools;
 
 const bool GHASH::HAS_CMUL = HasGmul();
 
@@ -17,6 +19,7 @@ class GHASH::GhashState
 {
 public:
 
+	std::array<ulong, CMUL::CMUL_POWERS_SIZE> Powers;
 	std::array<ulong, CMUL::CMUL_STATE_SIZE> State;
 	std::array<byte, CMUL::CMUL_BLOCK_SIZE> Buffer;
 	size_t Position;
@@ -36,6 +39,7 @@ public:
 	{
 		Position = 0;
 		MemoryTools::Clear(Buffer, 0, Buffer.size());
+		MemoryTools::Clear(Powers, 0, Powers.size() * sizeof(ulong));
 		MemoryTools::Clear(State, 0, State.size() * sizeof(ulong));
 	}
 };
@@ -84,25 +88,72 @@ void GHASH::Finalize(std::vector<byte> &Output, size_t ADLength, size_t TxtLengt
 	Permute(m_dgtState->State, Output);
 }
 
+bool GHASH::HasGmul()
+{
+	CpuDetect dtc;
+
+	return dtc.CMUL() && dtc.AVX();
+}
+
 void GHASH::Initialize(const std::vector<ulong> &Key)
 {
 	MemoryTools::Copy(Key, 0, m_dgtState->State, 0, Key.size() * sizeof(ulong));
+
+	if (HAS_CMUL)
+	{
+		// precompute H^1 to H^8 for the aggregated permutation
+		CMUL::PreCompute(m_dgtState->State, m_dgtState->Powers);
+	}
 }
 
 void GHASH::Multiply(const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length)
 {
-	size_t boff;
+	Multiply(Input, 0, Output, Length, m_dgtState);
+}
 
-	boff = 0;
+void GHASH::ParallelUpdate(const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length, size_t Degree)
+{
+	// each thread hashes an equal block-aligned segment, at least one byte is left for the buffered update
+	const size_t CNKLEN = Degree > 1 ? ((Length - 1) / Degree) - (((Length - 1) / Degree) % CMUL::CMUL_BLOCK_SIZE) : 0;
 
-	while (Length != 0)
+	if (m_dgtState->Position == CMUL::CMUL_BLOCK_SIZE)
 	{
-		const size_t RMDLEN = IntegerTools::Min(Length, CMUL::CMUL_BLOCK_SIZE);
-		MemoryTools::XOR(Input, boff, Output, 0, RMDLEN);
+		MemoryTools::XOR128(m_dgtState->Buffer, 0, Output, 0);
 		Permute(m_dgtState->State, Output);
-		boff += RMDLEN;
-		Length -= RMDLEN;
+		m_dgtState->Position = 0;
 	}
+
+	if (Length != 0 && CNKLEN != 0 && m_dgtState->Position == 0)
+	{
+		std::vector<std::vector<byte>> tmpp(Degree, std::vector<byte>(CMUL::CMUL_BLOCK_SIZE, 0x00));
+		std::array<ulong, CMUL::CMUL_STATE_SIZE> tmpk;
+		std::vector<byte> tmph(CMUL::CMUL_BLOCK_SIZE);
+		size_t j;
+
+		// hash each segment from a zeroed accumulator
+		ParallelTools::ParallelFor(0, Degree, [this, &Input, InOffset, &tmpp, CNKLEN](size_t i)
+		{
+			Multiply(Input, InOffset + (i * CNKLEN), tmpp[i], CNKLEN, m_dgtState);
+		});
+
+		// the hash is linear; each segment shifts the accumulator by H^n, where n is the segment length in blocks
+		Power(m_dgtState->State, CNKLEN / CMUL::CMUL_BLOCK_SIZE, tmph);
+		tmpk[0] = IntegerTools::BeBytesTo64(tmph, 0);
+		tmpk[1] = IntegerTools::BeBytesTo64(tmph, sizeof(ulong));
+
+		for (j = 0; j < Degree; ++j)
+		{
+			Permute(tmpk, Output);
+			MemoryTools::XOR128(tmpp[j], 0, Output, 0);
+		}
+
+		MemoryTools::Clear(tmph, 0, tmph.size());
+		MemoryTools::Clear(tmpk, 0, tmpk.size() * sizeof(ulong));
+		InOffset += Degree * CNKLEN;
+		Length -= Degree * CNKLEN;
+	}
+
+	Update(Input, InOffset, Output, Length);
 }
 
 void GHASH::Reset()
@@ -114,7 +165,7 @@ const size_t GHASH::TagSize()
 	return TAG_SIZE;
 }
 
-void GHASH::Update(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length)
+void GHASH::Update(const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length)
 {
 	if (Length != 0)
 	{
@@ -136,6 +187,17 @@ void GHASH::Update(const std::vector<byte> &Input, size_t InOffset, std::vector<
 			Length -= RMDLEN;
 			InOffset += RMDLEN;
 
+			if (HAS_CMUL)
+			{
+				// 8 blocks per permutation with a single reduction; the last block is always buffered
+				while (Length > PARALLEL_SIZE)
+				{
+					Permute(m_dgtState->Powers, Input, InOffset, Output);
+					Length -= PARALLEL_SIZE;
+					InOffset += PARALLEL_SIZE;
+				}
+			}
+
 			while (Length > CMUL::CMUL_BLOCK_SIZE)
 			{
 				MemoryTools::XOR128(Input, InOffset, Output, 0);
@@ -153,6 +215,28 @@ void GHASH::Update(const std::vector<byte> &Input, size_t InOffset, std::vector<
 	}
 }
 
+void GHASH::Multiply(const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length, std::unique_ptr<GhashState> &State)
+{
+	if (HAS_CMUL)
+	{
+		while (Length >= PARALLEL_SIZE)
+		{
+			Permute(State->Powers, Input, InOffset, Output);
+			InOffset += PARALLEL_SIZE;
+			Length -= PARALLEL_SIZE;
+		}
+	}
+
+	while (Length != 0)
+	{
+		const size_t RMDLEN = IntegerTools::Min(Length, CMUL::CMUL_BLOCK_SIZE);
+		MemoryTools::XOR(Input, InOffset, Output, 0, RMDLEN);
+		Permute(State->State, Output);
+		InOffset += RMDLEN;
+		Length -= RMDLEN;
+	}
+}
+
 void GHASH::Permute(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, std::vector<byte> &Output)
 {
 	std::array<byte, 16> tmp;
@@ -175,11 +259,44 @@ void GHASH::Permute(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, std::vector
 	MemoryTools::COPY128(tmp, 0, Output, 0);
 }
 
-bool GHASH::HasGmul()
+void GHASH::Permute(const std::array<ulong, CMUL::CMUL_POWERS_SIZE> &Powers, const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output)
 {
-	CpuDetect dtc;
+	std::array<byte, 16> tmp;
 
-	return dtc.CMUL() && dtc.AVX();
+	MemoryTools::COPY128(Output, 0, tmp, 0);
+	CMUL::PermuteR128P1024V(Powers, Input, InOffset, tmp);
+	MemoryTools::COPY128(tmp, 0, Output, 0);
+}
+
+void GHASH::Power(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, size_t Exponent, std::vector<byte> &Output)
+{
+	std::array<ulong, CMUL::CMUL_STATE_SIZE> tmpk;
+	size_t i;
+
+	// left-to-right square and multiply, starting from H^1
+	IntegerTools::Be64ToBytes(State[0], Output, 0);
+	IntegerTools::Be64ToBytes(State[1], Output, sizeof(ulong));
+	i = 0;
+
+	while ((Exponent >> i) > 1)
+	{
+		++i;
+	}
+
+	while (i != 0)
+	{
+		--i;
+		tmpk[0] = IntegerTools::BeBytesTo64(Output, 0);
+		tmpk[1] = IntegerTools::BeBytesTo64(Output, sizeof(ulong));
+		Permute(tmpk, Output);
+
+		if (((Exponent >> i) & 1) != 0)
+		{
+			Permute(State, Output);
+		}
+	}
+
+	MemoryTools::Clear(tmpk, 0, tmpk.size() * sizeof(ulong));
 }
 
 NAMESPACE_DIGESTEND
@@ -3,6 +3,7 @@
 
 #include "CexDomain.h"
 #include "CMUL.h"
+#include "Span.h"
 
 NAMESPACE_DIGEST
 
@@ -21,6 +22,7 @@ private:
 
 	static const std::string CLASS_NAME;
 	static const bool HAS_CMUL;
+	static const size_t PARALLEL_SIZE = CMUL::CMUL_PARALLEL_BLOCKS * CMUL::CMUL_BLOCK_SIZE;
 	static const size_t TAG_SIZE = 16;
 
 	class GhashState;
@@ -66,6 +68,11 @@ public:
 	/// <param name="TxtLength">The plain text size</param>
 	void Finalize(std::vector<byte> &Output, size_t ADLength, size_t TxtLength);
 
+	/// <summary>
+	/// Read Only: The carry-less multiply and AVX instructions are available, and the vectorized permutation is used
+	/// </summary>
+	static bool HasGmul();
+
 	/// <summary>
 	/// Initialize the hash key
 	/// </summary>
@@ -82,6 +89,20 @@ public:
 	/// <param name="Length">The number of input bytes to process</param>
 	void Multiply(const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length);
 
+	/// <summary>
+	/// Update the hash function using multiple threads.
+	/// <para>The input is divided into equal block-aligned segments that are hashed concurrently,
+	/// and the partial hashes are combined by multiplying the accumulator with the power of the hash key that matches the segment length.
+	/// The result is identical to the sequential Update function.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The source array</param>
+	/// <param name="InOffset">The offset within the source array</param>
+	/// <param name="Output">The output array</param>
+	/// <param name="Length">The number of bytes to process</param>
+	/// <param name="Degree">The number of threads</param>
+	void ParallelUpdate(const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length, size_t Degree);
+
 	/// <summary>
 	/// Reset the hash function
 	/// </summary>
@@ -100,12 +121,14 @@ public:
 	/// <param name="InOffset">The offset within the source array</param>
 	/// <param name="Output">The output array</param>
 	/// <param name="Length">The number of bytes to process</param>
-	void Update(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length);
+	void Update(const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length);
 
 private:
 
+	static void Multiply(const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t Length, std::unique_ptr<GhashState> &State);
 	static void Permute(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, std::vector<byte> &Output);
-	static bool HasGmul();
+	static void Permute(const std::array<ulong, CMUL::CMUL_POWERS_SIZE> &Powers, const Span<const byte> &Input, size_t InOffset, std::vector<byte> &Output);
+	static void Power(std::array<ulong, CMUL::CMUL_STATE_SIZE> &State, size_t Exponent, std::vector<byte> &Output);
 };
 
 NAMESPACE_DIGESTEND
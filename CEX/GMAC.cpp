@@ -20,6 +20,7 @@ public:
 
 	std::array<byte, CMUL::CMUL_BLOCK_SIZE> Buffer = { 0x00 };
 	std::array<ulong, CMUL::CMUL_STATE_SIZE> Hash = { 0ULL };
+	std::array<ulong, CMUL::CMUL_POWERS_SIZE> Powers = { 0ULL };
 	std::array<byte, CMUL::CMUL_BLOCK_SIZE> State = { 0x00 };
 	std::vector<byte> Nonce;
 	size_t Counter;
@@ -48,6 +49,7 @@ public:
 		Position = 0;
 		MemoryTools::Clear(Buffer, 0, Buffer.size());
 		MemoryTools::Clear(Hash, 0, Hash.size() * sizeof(ulong));
+		MemoryTools::Clear(Powers, 0, Powers.size() * sizeof(ulong));
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
 		MemoryTools::Clear(State, 0, State.size());
 		IsDestroyed = false;
@@ -176,9 +178,21 @@ size_t GMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The Output buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
+	return Finalize(Output.data() + OutOffset);
+}
+
+size_t GMAC::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, TagSize());
+
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
 	PreCompute(m_gmacState, m_gmacState->State, m_gmacState->Counter, 0);
 	MemoryTools::XOR(m_gmacState->Nonce, 0, m_gmacState->State, 0, CMUL::CMUL_BLOCK_SIZE);
-	MemoryTools::Copy(m_gmacState->State, 0, Output, OutOffset, CMUL::CMUL_BLOCK_SIZE);
+	MemoryTools::Copy(m_gmacState->State, 0, OTP, 0, CMUL::CMUL_BLOCK_SIZE);
 	Reset();
 
 	return TagSize();
@@ -235,6 +249,12 @@ void GMAC::Initialize(ISymmetricKey &Parameters)
 		};
 
 		MemoryTools::Copy(tmpk, 0, m_gmacState->Hash, 0, tmpk.size() * sizeof(ulong));
+
+		if (HAS_CMUL)
+		{
+			// precompute H^1 to H^8 for the aggregated permutation
+			CMUL::PreCompute(m_gmacState->Hash, m_gmacState->Powers);
+		}
 	}
 
 	// initialize the nonce
@@ -285,16 +305,22 @@ void GMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 		throw CryptoMacException(Name(), std::string("Update"), std::string("The Input buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
-	if (Length != 0)
+	Process(Input, InOffset, Length);
+}
+
+void GMAC::Update(const byte* Input, size_t Length)
+{
+	if (IsInitialized() == false)
 	{
-		Absorb(Input, InOffset, Length, m_gmacState);
-		m_gmacState->Counter += Length;
+		throw CryptoMacException(Name(), std::string("Update"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
 	}
+
+	Process(Span<const byte>(Input, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
 
-void GMAC::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Length, std::unique_ptr<GmacState> &State)
+void GMAC::Absorb(const Span<const byte> &Input, size_t InOffset, size_t Length, std::unique_ptr<GmacState> &State)
 {
 	if (Length != 0)
 	{
@@ -316,6 +342,17 @@ void GMAC::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Length
 			Length -= RMDLEN;
 			InOffset += RMDLEN;
 
+			if (HAS_CMUL)
+			{
+				// 8 blocks per permutation with a single reduction; the last block is always buffered
+				while (Length > PARALLEL_SIZE)
+				{
+					CMUL::PermuteR128P1024V(State->Powers, Input, InOffset, State->State);
+					Length -= PARALLEL_SIZE;
+					InOffset += PARALLEL_SIZE;
+				}
+			}
+
 			while (Length > CMUL::CMUL_BLOCK_SIZE)
 			{
 				MemoryTools::XOR128(Input, InOffset, State->State, 0);
@@ -395,4 +432,13 @@ void GMAC::PreCompute(std::unique_ptr<GmacState> &State, std::array<byte, CMUL::
 	Permute(State->Hash, Output);
 }
 
+void GMAC::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
+	if (Length != 0)
+	{
+		Absorb(Input, InOffset, Length, m_gmacState);
+		m_gmacState->Counter += Length;
+	}
+}
+
 NAMESPACE_MACEND
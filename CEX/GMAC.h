@@ -95,6 +95,7 @@ private:
 	static const bool HAS_CMUL;
 	static const size_t MINKEY_LENGTH = 16;
 	static const size_t MINSALT_LENGTH = 12;
+	static const size_t PARALLEL_SIZE = Numeric::CMUL::CMUL_PARALLEL_BLOCKS * Numeric::CMUL::CMUL_BLOCK_SIZE;
 
 	class GmacState;
 	std::unique_ptr<IBlockCipher> m_blockCipher;
@@ -190,6 +191,17 @@ public:
 	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized or the output array is too small</exception>
 	size_t Finalize(SecureVector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Completes processing and writes the MAC code to a pointer
+	/// </summary>
+	///
+	/// <param name="Output">A pointer to the output buffer receiving the MAC code; must be at least TagSize in length</param>
+	///
+	/// <returns>The size of the MAC code in bytes</returns>
+	///
+	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized</exception>
+	size_t Finalize(byte* Output) override;
+
 	/// <summary>
 	/// Initialize the MAC generator with an ISymmetricKey key container.
 	/// <para>Can accept either the SymmetricKey or SymmetricSecureKey container to load keying material.
@@ -218,13 +230,25 @@ public:
 	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized or the input array is too small</exception>
 	void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) override;
 
+	/// <summary>
+	/// Update the Mac with a length of bytes using a pointer.
+	/// <para>The message is read from the callers memory directly, without an intermediate vector.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input data</param>
+	/// <param name="Length">The length of data to process in bytes</param>
+	///
+	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized</exception>
+	void Update(const byte* Input, size_t Length) override;
+
 	//~~~Private Functions~~~//
 
-	static void Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Length, std::unique_ptr<GmacState> &State);
+	static void Absorb(const Span<const byte> &Input, size_t InOffset, size_t Length, std::unique_ptr<GmacState> &State);
 	static bool HasCMUL();
 	static void Multiply(std::unique_ptr<GmacState> &State, std::array<byte, Numeric::CMUL::CMUL_BLOCK_SIZE> &Output);
 	static void Permute(std::array<ulong, Numeric::CMUL::CMUL_STATE_SIZE> &State, std::array<byte, Numeric::CMUL::CMUL_BLOCK_SIZE> &Output);
 	static void PreCompute(std::unique_ptr<GmacState> &State, std::array<byte, Numeric::CMUL::CMUL_BLOCK_SIZE> &Output, size_t Counter, size_t Length);
+	void Process(const Span<const byte> &Input, size_t InOffset, size_t Length);
 };
 
 NAMESPACE_MACEND
@@ -373,25 +373,12 @@ void HBA::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
 	}
 
-	// add the starting position of the nonce to the mac
-	m_macAuthenticator->Update(m_cipherMode->Nonce(), 0, m_cipherMode->Nonce().size());
-
 	if (IsEncryption() == true)
 	{
 		if (Output.size() - OutOffset < Length + TagSize())
 		{
 			throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The output array is too small!"), ErrorCodes::InvalidSize);
 		}
-
-		// encrypt the plain-text
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
-		// update the MAC with the cipher-text
-		m_macAuthenticator->Update(Output, OutOffset, Length);
-		// update the mac counter
-		m_hbaState->Counter += Length;
-
-		// finalize and write the MAC code to the end of the output array
-		Finalize(Output, OutOffset + Length, m_macAuthenticator->TagSize());
 	}
 	else
 	{
@@ -399,25 +386,28 @@ void HBA::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 		{
 			throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The output array is too small!"), ErrorCodes::InvalidSize);
 		}
+	}
 
-		// update the MAC with the input cipher-text
-		m_macAuthenticator->Update(Input, InOffset, Length);
-		// update the mac counter
-		m_hbaState->Counter += Length;
-
-		// compare the MAC code appended to the ciphertext with the one generated, if they do not match, throw exception bybassing decryption
-		if (!Verify(Input, InOffset + Length, m_macAuthenticator->TagSize()))
-		{
-			throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-		}
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
 
-		m_cipherMode->Transform(Input, InOffset, Output, OutOffset, Length);
+void HBA::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
 	}
+
+	// the tag is appended to the cipher-text on encryption, and read from the end of the cipher-text on decryption
+	const size_t INPLEN = IsEncryption() ? Length : Length + TagSize();
+	const size_t OTPLEN = IsEncryption() ? Length + TagSize() : Length;
+
+	Process(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
 
-void HBA::Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void HBA::Finalize(const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	std::vector<byte> mctr(sizeof(ulong));
 	SecureVector<byte> mack(0);
@@ -496,7 +486,41 @@ void HBA::Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length)
 	SecureMove(mack, 0, m_hbaState->MacKey, 0, mack.size());
 }
 
-bool HBA::Verify(const std::vector<byte> &Input, size_t InOffset, size_t Length)
+void HBA::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	// add the starting position of the nonce to the mac
+	m_macAuthenticator->Update(m_cipherMode->Nonce(), 0, m_cipherMode->Nonce().size());
+
+	if (IsEncryption() == true)
+	{
+		// encrypt the plain-text
+		m_cipherMode->Transform(Input.data() + InOffset, Output.data() + OutOffset, Length);
+		// update the MAC with the cipher-text
+		m_macAuthenticator->Update(Output.data() + OutOffset, Length);
+		// update the mac counter
+		m_hbaState->Counter += Length;
+
+		// finalize and write the MAC code to the end of the output array
+		Finalize(Output, OutOffset + Length, m_macAuthenticator->TagSize());
+	}
+	else
+	{
+		// update the MAC with the input cipher-text
+		m_macAuthenticator->Update(Input.data() + InOffset, Length);
+		// update the mac counter
+		m_hbaState->Counter += Length;
+
+		// compare the MAC code appended to the ciphertext with the one generated, if they do not match, throw exception bybassing decryption
+		if (!Verify(Input, InOffset + Length, m_macAuthenticator->TagSize()))
+		{
+			throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+		}
+
+		m_cipherMode->Transform(Input.data() + InOffset, Output.data() + OutOffset, Length);
+	}
+}
+
+bool HBA::Verify(const Span<const byte> &Input, size_t InOffset, size_t Length)
 {
 	std::vector<byte> code(m_macAuthenticator->TagSize());
 	bool ret;
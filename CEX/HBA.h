@@ -337,12 +337,30 @@ public:
 	/// <param name="Length">The number of bytes to transform</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The bytes are read from and written to the callers memory directly, without an intermediate vector.
+	/// When encrypting, the Output must be able to receive Length + TagSize() bytes, the authentication tag is appended to the cipher-text.
+	/// When decrypting, the Input must contain Length + TagSize() bytes, the cipher-text followed by the authentication tag.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer</param>
+	/// <param name="Length">The number of message bytes to transform</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the cipher has not been initialized</exception>
+	/// <exception cref="CryptoAuthenticationFailure">Thrown during decryption if the authentication tag does not match</exception>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 	//~~~Private Functions~~~//
 
 private:
 
-	void Finalize(std::vector<byte> &Output, size_t OutOffset, size_t Length);
-	bool Verify(const std::vector<byte> &Input, size_t InOffset, size_t Length);
+	void Finalize(const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	bool Verify(const Span<const byte> &Input, size_t InOffset, size_t Length);
 };
 
 NAMESPACE_MODEEND
@@ -16,8 +16,9 @@ class HMAC::HmacState
 {
 public:
 
-	std::vector<byte> InputPad;
-	std::vector<byte> OutputPad;
+	// the digest states after the input and output pads have been processed
+	SecureVector<byte> InnerState;
+	SecureVector<byte> OuterState;
 	size_t BlockSize;
 	size_t HashSize;
 	bool IsDestroyed;
@@ -25,8 +26,8 @@ public:
 
 	HmacState(size_t InputSize, size_t OutputSize, bool Destroyed)
 		:
-		InputPad(InputSize),
-		OutputPad(InputSize),
+		InnerState(0),
+		OuterState(0),
 		BlockSize(InputSize),
 		HashSize(OutputSize),
 		IsDestroyed(Destroyed),
@@ -38,16 +39,16 @@ public:
 	{
 		BlockSize = 0;
 		HashSize = 0;
-		MemoryTools::Clear(InputPad, 0, InputPad.size());
-		MemoryTools::Clear(OutputPad, 0, OutputPad.size());
+		SecureClear(InnerState);
+		SecureClear(OuterState);
 		IsDestroyed = false;
 		IsInitialized = false;
 	}
 
 	void Reset()
 	{
-		MemoryTools::Clear(InputPad, 0, InputPad.size());
-		MemoryTools::Clear(OutputPad, 0, OutputPad.size());
+		SecureClear(InnerState);
+		SecureClear(OuterState);
 		IsInitialized = false;
 	}
 };
@@ -167,8 +168,6 @@ void HMAC::Compute(const std::vector<byte> &Input, std::vector<byte> &Output)
 
 size_t HMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
-	std::vector<byte> tmpv(m_hmacGenerator->DigestSize(), 0x00);
-
 	if (IsInitialized() == false)
 	{
 		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
@@ -178,11 +177,25 @@ size_t HMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The Output buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
+	return Finalize(Output.data() + OutOffset);
+}
+
+size_t HMAC::Finalize(byte* Output)
+{
+	std::vector<byte> tmpv(m_hmacGenerator->DigestSize(), 0x00);
+
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	// restore the precomputed pad states rather than compressing the pads again
 	m_hmacGenerator->Finalize(tmpv, 0);
-	m_hmacGenerator->Update(m_hmacState->OutputPad, 0, m_hmacState->OutputPad.size());
+	m_hmacGenerator->DeSerialize(m_hmacState->OuterState);
 	m_hmacGenerator->Update(tmpv, 0, tmpv.size());
-	m_hmacGenerator->Finalize(Output, OutOffset);
-	m_hmacGenerator->Update(m_hmacState->InputPad, 0, m_hmacState->InputPad.size());
+	m_hmacGenerator->Finalize(Output);
+	m_hmacGenerator->DeSerialize(m_hmacState->InnerState);
+	MemoryTools::Clear(tmpv, 0, tmpv.size());
 
 	return TagSize();
 }
@@ -199,6 +212,8 @@ size_t HMAC::Finalize(SecureVector<byte> &Output, size_t OutOffset)
 
 void HMAC::Initialize(ISymmetricKey &Parameters)
 {
+	std::vector<byte> ipad(m_hmacGenerator->BlockSize());
+	std::vector<byte> opad(m_hmacGenerator->BlockSize());
 	size_t klen;
 
 #if defined(CEX_ENFORCE_LEGALKEY)
@@ -223,23 +238,27 @@ void HMAC::Initialize(ISymmetricKey &Parameters)
 	if (klen > m_hmacGenerator->BlockSize())
 	{
 		m_hmacGenerator->Update(Parameters.Key(), 0, Parameters.KeySizes().KeySize());
-		m_hmacGenerator->Finalize(m_hmacState->InputPad, 0);
+		m_hmacGenerator->Finalize(ipad, 0);
 		klen = m_hmacGenerator->DigestSize();
 	}
 	else
 	{
-		MemoryTools::Copy(Parameters.Key(), 0, m_hmacState->InputPad, 0, klen);
+		MemoryTools::Copy(Parameters.Key(), 0, ipad, 0, klen);
 	}
 
-	if (m_hmacGenerator->BlockSize() > klen)
-	{
-		MemoryTools::Clear(m_hmacState->InputPad, klen, m_hmacGenerator->BlockSize() - klen);
-	}
+	MemoryTools::Copy(ipad, 0, opad, 0, ipad.size());
+	MemoryTools::XorPad(ipad, IPAD);
+	MemoryTools::XorPad(opad, OPAD);
 
-	MemoryTools::Copy(m_hmacState->InputPad, 0, m_hmacState->OutputPad, 0, m_hmacState->InputPad.size());
-	MemoryTools::XorPad(m_hmacState->InputPad, IPAD);
-	MemoryTools::XorPad(m_hmacState->OutputPad, OPAD);
-	m_hmacGenerator->Update(m_hmacState->InputPad, 0, m_hmacState->InputPad.size());
+	// store the digest state after each pad, the pads are not processed again until the mac is re-keyed
+	m_hmacGenerator->Reset();
+	m_hmacGenerator->Update(opad, 0, opad.size());
+	m_hmacState->OuterState = m_hmacGenerator->Serialize();
+	m_hmacGenerator->Reset();
+	m_hmacGenerator->Update(ipad, 0, ipad.size());
+	m_hmacState->InnerState = m_hmacGenerator->Serialize();
+	MemoryTools::Clear(ipad, 0, ipad.size());
+	MemoryTools::Clear(opad, 0, opad.size());
 
 	m_hmacState->IsInitialized = true;
 }
@@ -265,4 +284,14 @@ void HMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 	m_hmacGenerator->Update(Input, InOffset, Length);
 }
 
+void HMAC::Update(const byte* Input, size_t Length)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Update"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	m_hmacGenerator->Update(Input, Length);
+}
+
 NAMESPACE_MACEND
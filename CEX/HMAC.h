@@ -79,6 +79,7 @@ using Enumeration::SHA2Digests;
 /// <item><description>The Compute(Input, Output) method wraps the Update(Input, Offset, Length) and Finalize(Output, Offset) methods and should only be used on small to medium sized data.</description>/></item>
 /// <item><description>The Update(Input, Offset, Length) processes any length of message data, and is used in conjunction with the Finalize(Output, Offset) method, which completes processing and returns the finalized MAC code.</description>/></item>
 /// <item><description>After a finalizer call the MAC should be re-initialized with a new key.</description></item>
+/// <item><description>The digest states after the input and output pads are computed once by the Initialize function, and restored by each finalizer call; a tag costs no pad compressions after the first.</description></item>
 /// </list>
 /// 
 /// <description>Guiding Publications:</description>
@@ -188,6 +189,17 @@ public:
 	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized or the output array is too small</exception>
 	size_t Finalize(SecureVector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Completes processing and writes the MAC code to a pointer
+	/// </summary>
+	///
+	/// <param name="Output">A pointer to the output buffer receiving the MAC code; must be at least TagSize in length</param>
+	///
+	/// <returns>The size of the MAC code in bytes</returns>
+	///
+	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized</exception>
+	size_t Finalize(byte* Output) override;
+
 	/// <summary>
 	/// Initialize the MAC generator with an ISymmetricKey key container.
 	/// <para>Can accept either the SymmetricKey or SymmetricSecureKey container to load keying material.
@@ -215,6 +227,17 @@ public:
 	/// 
 	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized or the input array is too small</exception>
 	void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) override;
+
+	/// <summary>
+	/// Update the Mac with a length of bytes using a pointer.
+	/// <para>The message is read from the callers memory directly, without an intermediate vector.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input data</param>
+	/// <param name="Length">The length of data to process in bytes</param>
+	///
+	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized</exception>
+	void Update(const byte* Input, size_t Length) override;
 };
 
 NAMESPACE_MACEND
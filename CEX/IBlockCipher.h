@@ -26,6 +26,7 @@
 #include "ErrorCodes.h"
 #include "IKdf.h"
 #include "ISymmetricKey.h"
+#include "Span.h"
 #include "SymmetricKey.h"
 #include "SymmetricKeySize.h"
 
@@ -142,6 +143,16 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	virtual void DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Decrypt a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>false</c> before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">Encrypted bytes</param>
+	/// <param name="Output">Decrypted bytes</param>
+	virtual void DecryptBlock(const byte* Input, byte* Output) = 0;
+
 	/// <summary>
 	/// Encrypt a block of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>true</c> before this method can be used.
@@ -164,6 +175,16 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	virtual void EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Encrypt a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>true</c> before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	virtual void EncryptBlock(const byte* Input, byte* Output) = 0;
+
 	/// <summary>
 	/// Initialize the cipher
 	/// </summary>
@@ -197,6 +218,16 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	virtual void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Transform a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	virtual void Transform(const byte* Input, byte* Output) = 0;
+
 	/// <summary>
 	/// Transform 4 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -209,6 +240,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	virtual void Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Transform 4 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 4 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	virtual void Transform512(const byte* Input, byte* Output) = 0;
+
 	/// <summary>
 	/// Transform 8 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -221,6 +262,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	virtual void Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Transform 8 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 8 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	virtual void Transform1024(const byte* Input, byte* Output) = 0;
+
 	/// <summary>
 	/// Transform 16 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -232,6 +283,16 @@ public:
 	/// <param name="Output">The output array of transformed bytes</param>
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	virtual void Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) = 0;
+
+	/// <summary>
+	/// Transform 16 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 16 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	virtual void Transform2048(const byte* Input, byte* Output) = 0;
 };
 
 NAMESPACE_BLOCKEND
@@ -16,6 +16,8 @@ class ICM::IcmState
 public:
 
 	std::vector<ulong> Nonce;
+	std::vector<ulong> Origin;
+	size_t Offset;
 	bool Destroyed;
 	bool Encryption;
 	bool Initialized;
@@ -23,6 +25,8 @@ public:
 	IcmState(bool IsDestroyed)
 		:
 		Nonce(BLOCK_SIZE / sizeof(ulong), 0x0ULL),
+		Origin(BLOCK_SIZE / sizeof(ulong), 0x0ULL),
+		Offset(0),
 		Destroyed(IsDestroyed),
 		Encryption(false),
 		Initialized(false)
@@ -37,6 +41,8 @@ public:
 	void Reset()
 	{
 		MemoryTools::Clear(Nonce, 0, Nonce.size() * sizeof(ulong));
+		MemoryTools::Clear(Origin, 0, Origin.size() * sizeof(ulong));
+		Offset = 0;
 		Destroyed = false;
 		Encryption = false;
 		Initialized = false;
@@ -65,6 +71,17 @@ ICM::ICM(IBlockCipher* Cipher)
 {
 }
 
+ICM::ICM(const std::shared_ptr<BlockCipherContext> &Context)
+	:
+	m_icmState(new IcmState(false)),
+	m_blockCipher(Context != nullptr ?
+		Context->Engine() :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::ICM), std::string("Constructor"), std::string("The key context can not be null!"), ErrorCodes::IllegalOperation)),
+	m_keyContext(Context),
+	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
+{
+}
+
 ICM::~ICM()
 {
 	if (m_icmState->Destroyed)
@@ -176,10 +193,29 @@ void ICM::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 
 void ICM::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
-	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		if (!m_blockCipher->IsInitialized() || !m_blockCipher->IsEncryption())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
+		}
+		if (m_keyContext != nullptr && !m_keyContext->Verify())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The engine of the shared key context has been re-keyed!"), ErrorCodes::InvalidState);
+		}
+	}
+	else
 	{
-		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidKey);
+		if (m_keyContext != nullptr)
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("An instance using a shared key context can not be re-keyed!"), ErrorCodes::IllegalOperation);
+		}
+		if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidKey);
+		}
 	}
+
 	if (Parameters.KeySizes().IVSize() != BLOCK_SIZE)
 	{
 		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid nonce size; nonce must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidNonce);
@@ -187,6 +223,9 @@ void ICM::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -197,8 +236,16 @@ void ICM::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		}
 	}
 
-	m_blockCipher->Initialize(true, Parameters);
+	if (Parameters.KeySizes().KeySize() != 0)
+	{
+		// a nonce-only key re-uses the existing round-key schedule
+		m_blockCipher->Initialize(true, Parameters);
+	}
+
 	MemoryTools::COPY128(Parameters.IV(), 0, m_icmState->Nonce, 0);
+	// store the initial counter, Seek positions are relative to it
+	MemoryTools::COPY128(Parameters.IV(), 0, m_icmState->Origin, 0);
+	m_icmState->Offset = 0;
 	m_icmState->Encryption = Encryption;
 	m_icmState->Initialized = true;
 }
@@ -213,36 +260,31 @@ void ICM::ParallelMaxDegree(size_t Degree)
 	m_parallelProfile.SetMaxDegree(Degree);
 }
 
+void ICM::Seek(ulong Position)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Seek"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	// counter = initial counter + block index
+	IntegerTools::LeIncreaseW(m_icmState->Origin, m_icmState->Nonce, static_cast<size_t>(Position / BLOCK_SIZE));
+	m_icmState->Offset = static_cast<size_t>(Position % BLOCK_SIZE);
+}
+
 void ICM::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
 {
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the length!");
 
-	size_t i;
-
-	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
-
-	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
-	{
-		const size_t BLKCNT = Length / PRLBLK;
-
-		for (i = 0; i < BLKCNT; ++i)
-		{
-			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK), PRLBLK);
-		}
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
 
-		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+void ICM::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 
-		if (RMDLEN != 0)
-		{
-			const size_t BLKOFT = (PRLBLK * BLKCNT);
-			ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
-		}
-	}
-	else
-	{
-		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
-	}
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -259,7 +301,7 @@ void ICM::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	MemoryTools::XOR128(Input, InOffset, Output, OutOffset);
 }
 
-void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<ulong> &Counter)
+void ICM::Generate(const Span<byte> &Output, size_t OutOffset, size_t Length, std::vector<ulong> &Counter)
 {
 	size_t bctr;
 
@@ -308,7 +350,7 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			IntegerTools::LeIncrementW(Counter);
 			MemoryTools::COPY128(Counter, 0, cblk, 240);
 			IntegerTools::LeIncrementW(Counter);
-			m_blockCipher->Transform2048(cblk, 0, Output, OutOffset + bctr);
+			m_blockCipher->Transform2048(cblk.data(), Output.data() + OutOffset + bctr);
 			bctr += AVX512BLK;
 		}
 	}
@@ -338,7 +380,7 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			IntegerTools::LeIncrementW(Counter);
 			MemoryTools::COPY128(Counter, 0, cblk, 112);
 			IntegerTools::LeIncrementW(Counter);
-			m_blockCipher->Transform1024(cblk, 0, Output, OutOffset + bctr);
+			m_blockCipher->Transform1024(cblk.data(), Output.data() + OutOffset + bctr);
 			bctr += AVX2BLK;
 		}
 	}
@@ -360,7 +402,7 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 			IntegerTools::LeIncrementW(Counter);
 			MemoryTools::COPY128(Counter, 0, cblk, 48);
 			IntegerTools::LeIncrementW(Counter);
-			m_blockCipher->Transform512(cblk, 0, Output, OutOffset + bctr);
+			m_blockCipher->Transform512(cblk.data(), Output.data() + OutOffset + bctr);
 			bctr += AVXBLK;
 		}
 	}
@@ -372,7 +414,7 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 	while (bctr != ALNBLK)
 	{
 		MemoryTools::COPY128(Counter, 0, tmpc, 0);
-		m_blockCipher->EncryptBlock(tmpc, 0, Output, OutOffset + bctr);
+		m_blockCipher->EncryptBlock(tmpc.data(), Output.data() + OutOffset + bctr);
 		IntegerTools::LeIncrementW(Counter);
 		bctr += BLOCK_SIZE;
 	}
@@ -388,69 +430,165 @@ void ICM::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, s
 	}
 }
 
-void ICM::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void ICM::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	size_t i;
+
+	if (m_icmState->Offset != 0 && Length != 0)
+	{
+		// finish the partial block left by a Seek, then continue block aligned
+		std::vector<byte> tmpc(BLOCK_SIZE);
+		std::vector<byte> otp(BLOCK_SIZE);
+		const size_t PRTLEN = IntegerTools::Min(BLOCK_SIZE - m_icmState->Offset, Length);
+
+		MemoryTools::COPY128(m_icmState->Nonce, 0, tmpc, 0);
+		m_blockCipher->EncryptBlock(tmpc, otp);
+
+		for (i = 0; i < PRTLEN; ++i)
+		{
+			Output[OutOffset + i] = Input[InOffset + i] ^ otp[m_icmState->Offset + i];
+		}
+
+		m_icmState->Offset += PRTLEN;
+
+		if (m_icmState->Offset == BLOCK_SIZE)
+		{
+			IntegerTools::LeIncrementW(m_icmState->Nonce);
+			m_icmState->Offset = 0;
+		}
+
+		InOffset += PRTLEN;
+		OutOffset += PRTLEN;
+		Length -= PRTLEN;
+	}
+
+	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
+
+	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
+	{
+		const size_t BLKCNT = Length / PRLBLK;
+
+		for (i = 0; i < BLKCNT; ++i)
+		{
+			ProcessParallel(Input, InOffset + (i * PRLBLK), Output, OutOffset + (i * PRLBLK), PRLBLK);
+		}
+
+		const size_t RMDLEN = Length - (PRLBLK * BLKCNT);
+
+		if (RMDLEN != 0)
+		{
+			const size_t BLKOFT = (PRLBLK * BLKCNT);
+
+			// split a large remainder across the threads
+			if (RMDLEN >= m_parallelProfile.ParallelMinimumSize())
+			{
+				ProcessParallel(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+			}
+			else
+			{
+				ProcessSequential(Input, InOffset + BLKOFT, Output, OutOffset + BLKOFT, RMDLEN);
+			}
+		}
+	}
+	else
+	{
+		ProcessSequential(Input, InOffset, Output, OutOffset, Length);
+	}
+}
+
+void ICM::ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t OUTLEN = Output.size() - OutOffset < Length ? Output.size() - OutOffset : Length;
-	const size_t CNKLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
-	const size_t CTRLEN = (CNKLEN / BLOCK_SIZE);
-	std::vector<ulong> tmpc(m_icmState->Nonce.size());
+	const size_t ALNLEN = OUTLEN - (OUTLEN % BLOCK_SIZE);
+	const size_t PRLCNK = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
+	// a short remainder is divided evenly between the threads, a full parallel block by the cache-sized chunk
+	const size_t RMDCNK = ((ALNLEN / m_parallelProfile.ParallelMaxDegree()) + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
+	const size_t CNKLEN = (RMDCNK < PRLCNK) ? RMDCNK : PRLCNK;
 
-	ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, &Output, OutOffset, &tmpc, CNKLEN, CTRLEN](size_t i)
+	ParallelTools::ParallelFor(0, ALNLEN, CNKLEN, [this, &Input, InOffset, &Output, OutOffset](size_t Start, size_t End)
 	{
 		// thread level counter
 		std::vector<ulong> thdc(2, 0);
-		// offset counter by chunk size / block size  
-		IntegerTools::LeIncreaseW(m_icmState->Nonce, thdc, CTRLEN * i);
-		const size_t STMPOS = i * CNKLEN;
-		// generate random at output array offset
-		this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
-		// xor with input at offsets
-		MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
-
-		// store last counter
-		if (i == m_parallelProfile.ParallelMaxDegree() - 1)
+		// offset counter by chunk position / block size  
+		IntegerTools::LeIncreaseW(m_icmState->Nonce, thdc, Start / BLOCK_SIZE);
+
+		if (Input.data() + InOffset != Output.data() + OutOffset)
+		{
+			// generate random at output offset
+			this->Generate(Output, OutOffset + Start, End - Start, thdc);
+			// xor with input at offsets
+			MemoryTools::XOR(Input, InOffset + Start, Output, OutOffset + Start, End - Start);
+		}
+		else
 		{
-			MemoryTools::COPY128(thdc, 0, tmpc, 0);
+			// in-place; the key-stream is generated to a thread buffer
+			std::vector<byte> thdk(End - Start);
+			this->Generate(thdk, 0, thdk.size(), thdc);
+			MemoryTools::XOR(thdk, 0, Output, OutOffset + Start, thdk.size());
 		}
 	});
 
-	// copy last counter to class variable
-	MemoryTools::COPY128(tmpc, 0, m_icmState->Nonce, 0);
+	// advance the class counter past the processed blocks
+	IntegerTools::LeIncreaseW(m_icmState->Nonce, ALNLEN / BLOCK_SIZE);
 
 	// last block processing
-	const size_t ALNLEN = CNKLEN * m_parallelProfile.ParallelMaxDegree();
 	if (ALNLEN < OUTLEN)
 	{
-		const size_t FNLLEN = (Output.size() - OutOffset) % ALNLEN;
-		Generate(Output, ALNLEN, FNLLEN, m_icmState->Nonce);
+		const size_t FNLLEN = OUTLEN - ALNLEN;
+		InOffset += ALNLEN;
+		OutOffset += ALNLEN;
 
-		for (size_t i = ALNLEN; i < OUTLEN; i++)
+		std::vector<byte> fnlk(BLOCK_SIZE);
+
+		Generate(fnlk, 0, FNLLEN, m_icmState->Nonce);
+
+		for (size_t i = 0; i < FNLLEN; ++i)
 		{
-			Output[i] ^= Input[i];
+			Output[OutOffset + i] = Input[InOffset + i] ^ fnlk[i];
 		}
 	}
 }
 
-void ICM::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void ICM::ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	size_t i;
 
-	// generate random
-	Generate(Output, OutOffset, Length, m_icmState->Nonce);
-	// get block aligned
-	size_t ALNLEN = Length - (Length % m_blockCipher->BlockSize());
-
-	if (ALNLEN != 0)
+	if (Input.data() + InOffset != Output.data() + OutOffset)
 	{
-		MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
-	}
+		// generate random
+		Generate(Output, OutOffset, Length, m_icmState->Nonce);
+		// get block aligned
+		size_t ALNLEN = Length - (Length % m_blockCipher->BlockSize());
+
+		if (ALNLEN != 0)
+		{
+			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		}
 
-	// get the remaining bytes
-	if (ALNLEN != Length)
+		// get the remaining bytes
+		if (ALNLEN != Length)
+		{
+			for (i = ALNLEN; i < Length; ++i)
+			{
+				Output[i + OutOffset] ^= Input[i + InOffset];
+			}
+		}
+	}
+	else
 	{
-		for (i = ALNLEN; i < Length; ++i)
+		// in-place; the key-stream is generated to a temporary buffer in block-aligned segments
+		const size_t SEGLEN = 64 * BLOCK_SIZE;
+		std::vector<byte> tmpk(Length < SEGLEN ? Length : SEGLEN);
+		size_t plen;
+
+		i = 0;
+
+		while (i != Length)
 		{
-			Output[i + OutOffset] ^= Input[i + InOffset];
+			plen = (Length - i < tmpk.size()) ? Length - i : tmpk.size();
+			Generate(tmpk, 0, plen, m_icmState->Nonce);
+			MemoryTools::XOR(tmpk, 0, Output, OutOffset + i, plen);
+			i += plen;
 		}
 	}
 }
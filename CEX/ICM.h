@@ -29,6 +29,7 @@
 #ifndef CEX_ICM_H
 #define CEX_ICM_H
 
+#include "BlockCipherContext.h"
 #include "ICipherMode.h"
 
 NAMESPACE_MODE
@@ -111,6 +112,7 @@ private:
 	class IcmState;
 	std::unique_ptr<IcmState> m_icmState;
 	std::unique_ptr<IBlockCipher> m_blockCipher;
+	std::shared_ptr<BlockCipherContext> m_keyContext;
 	ParallelOptions m_parallelProfile;
 
 public:
@@ -150,6 +152,17 @@ public:
 	/// <exception cref="CryptoCipherModeException">Thrown if a null block-cipher is used</exception>
 	explicit ICM(IBlockCipher* Cipher);
 
+	/// <summary>
+	/// Initialize the Cipher Mode using a shared block-cipher key schedule.
+	/// <para>The mode uses the keyed block-cipher held by the context, and must be initialized with a nonce-only SymmetricKey; 
+	/// the key schedule is not expanded again, and any number of instances on any number of threads can share the same context.</para>
+	/// </summary>
+	///
+	/// <param name="Context">The shared block-cipher key context; can not be null</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if a null context is used</exception>
+	explicit ICM(const std::shared_ptr<BlockCipherContext> &Context);
+
 	/// <summary>
 	/// Destructor: finalize this class
 	/// </summary>
@@ -168,7 +181,8 @@ public:
 	const BlockCiphers CipherType() override;
 
 	/// <summary>
-	/// Read Only: A pointer to the underlying block-cipher instance
+	/// Read Only: A pointer to the underlying block-cipher instance.
+	/// <para>When the mode is bound to a BlockCipherContext, the instance is shared by every mode using the context and must not be re-initialized; a re-keyed engine is rejected by the next Initialize(bool, ISymmetricKey) call.</para>
 	/// </summary>
 	IBlockCipher* Engine() override;
 
@@ -266,9 +280,10 @@ public:
 	/// </summary>
 	/// 
 	/// <param name="Encryption">Operation mode, true if cipher is used for encryption, false to decrypt</param>
-	/// <param name="Parameters">SymmetricKey containing the encryption Key and Initialization Vector</param>
+	/// <param name="Parameters">SymmetricKey containing the encryption Key and Initialization Vector.
+	/// <para>If the key is empty, only the nonce is loaded and the existing key schedule is reused.</para></param>
 	/// 
-	/// <exception cref="CryptoCipherModeException">Thrown if an invalid key or nonce is used</exception>
+	/// <exception cref="CryptoCipherModeException">Thrown if an invalid key or nonce is used, or if a key is passed to an instance constructed with a key context</exception>
 	void Initialize(bool Encryption, ISymmetricKey &Parameters) override;
 
 	/// <summary>
@@ -282,6 +297,18 @@ public:
 	/// <exception cref="CryptoCipherModeException">Thrown if the degree parameter is invalid</exception>
 	void ParallelMaxDegree(size_t Degree) override;
 
+	/// <summary>
+	/// Set the key-stream position to a byte offset from the start of the stream.
+	/// <para>The counter is set to the initial nonce plus the block index of the position; the next call to Transform 
+	/// begins at that byte, and a position that is not block aligned has the remainder of that block applied before continuing.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Position">The byte offset from the start of the key-stream</param>
+	/// 
+	/// <exception cref="CryptoCipherModeException">Thrown if the cipher mode has not been initialized</exception>
+	void Seek(ulong Position);
+
 	/// <summary>
 	/// Transform a length of bytes with offset parameters. 
 	/// <para>This method processes a specified length of bytes, utilizing offsets incremented by the caller.
@@ -297,12 +324,26 @@ public:
 	/// <param name="Length">The number of bytes to transform</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
 
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The key-stream is generated directly to the output buffer and combined with the input, without an intermediate vector.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// If IsParallel() is set to true, and the length is at least ParallelBlockSize(), the transform is run in parallel processing mode.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer, receiving Length bytes</param>
+	/// <param name="Length">The number of bytes to transform</param>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
 private:
 
 	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<ulong> &Counter);
-	void ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
-	void ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length);
+	void Generate(const Span<byte> &Output, size_t OutOffset, size_t Length, std::vector<ulong> &Counter);
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
 };
 
 NAMESPACE_MODEEND
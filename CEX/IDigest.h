@@ -5,6 +5,8 @@
 #include "CryptoDigestException.h"
 #include "Digests.h"
 #include "ParallelOptions.h"
+#include "SecureVector.h"
+#include "Span.h"
 
 NAMESPACE_DIGEST
 
@@ -100,6 +102,16 @@ public:
 	/// <param name="Output">The output vector receiving the final hash code; must be at least DigestSize in length</param>
 	virtual void Compute(const std::vector<byte> &Input, std::vector<byte> &Output) = 0;
 
+	/// <summary>
+	/// Restore the internal state of the digest from a state created by the Serialize function.
+	/// <para>The state must be created by an instance of the same digest, with the same parallel configuration.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The serialized digest state</param>
+	///
+	/// <exception cref="CryptoDigestException">Thrown if the state array is malformed, or was created by a different digest or configuration</exception>
+	virtual void DeSerialize(const SecureVector<byte> &State) = 0;
+
 	/// <summary>
 	/// Finalize message processing and return the hash code.
 	/// <para>Used in conjunction with the Update api to process a message, and then return the finalized hash code.</para>
@@ -109,6 +121,14 @@ public:
 	/// <param name="OutOffset">The starting offset within the output vector</param>
 	virtual void Finalize(std::vector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Finalize message processing and write the hash code to a pointer.
+	/// <para>The hash code is written to the callers memory directly, without an intermediate vector.</para>
+	/// </summary>
+	/// 
+	/// <param name="Output">A pointer to the output buffer receiving the hash code; must be at least DigestSize in length</param>
+	virtual void Finalize(byte* Output) = 0;
+
 	/// <summary>
 	/// Set the number of threads allocated when using multi-threaded tree hashing processing.
 	/// <para>Thread count must be an even number, and not exceed the number of processor cores.
@@ -125,6 +145,15 @@ public:
 	/// </summary>
 	virtual void Reset() = 0;
 
+	/// <summary>
+	/// Save the internal state of the digest (the midstate) to a secure vector.
+	/// <para>The state can be restored to this or another instance of the digest with the DeSerialize function, 
+	/// to reuse the state of a common message prefix, or to resume the hashing of a message.</para>
+	/// </summary>
+	///
+	/// <returns>The serialized digest state</returns>
+	virtual SecureVector<byte> Serialize() = 0;
+
 	/// <summary>
 	/// Update the message digest with a single unsigned 8-bit integer
 	/// </summary>
@@ -155,6 +184,15 @@ public:
 	/// <param name="InOffset">The starting offset within the input vector</param>
 	/// <param name="Length">The number of bytes to process</param>
 	virtual void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) = 0;
+
+	/// <summary>
+	/// Update the message digest with a length of bytes using a pointer.
+	/// <para>The message is read from the callers memory directly, without an intermediate vector.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input message bytes</param>
+	/// <param name="Length">The number of bytes to process</param>
+	virtual void Update(const byte* Input, size_t Length) = 0;
 };
 
 NAMESPACE_DIGESTEND
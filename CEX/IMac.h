@@ -7,6 +7,7 @@
 #include "ISymmetricKey.h"
 #include "Macs.h"
 #include "SecureVector.h"
+#include "Span.h"
 #include "SymmetricKey.h"
 #include "SymmetricKeySize.h"
 
@@ -125,6 +126,15 @@ public:
 	/// <returns>The size of the MAC code in bytes</returns>
 	virtual size_t Finalize(SecureVector<byte> &Output, size_t OutOffset) = 0;
 
+	/// <summary>
+	/// Completes processing and writes the MAC code to a pointer
+	/// </summary>
+	///
+	/// <param name="Output">A pointer to the output buffer receiving the MAC code; must be at least TagSize in length</param>
+	///
+	/// <returns>The size of the MAC code in bytes</returns>
+	virtual size_t Finalize(byte* Output) = 0;
+
 	/// <summary>
 	/// Initialize the MAC generator with an ISymmetricKey key container.
 	/// <para>Can accept either the SymmetricKey or SymmetricSecureKey container to load keying material.
@@ -148,6 +158,14 @@ public:
 	/// <param name="InOffset">The starting position with the input array</param>
 	/// <param name="Length">The length of data to process in bytes</param>
 	virtual void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) = 0;
+
+	/// <summary>
+	/// Update the Mac with a length of bytes using a pointer
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input data</param>
+	/// <param name="Length">The length of data to process in bytes</param>
+	virtual void Update(const byte* Input, size_t Length) = 0;
 };
 
 NAMESPACE_MACEND
@@ -27,6 +27,7 @@
 #include "ParallelOptions.h"
 #include "ParallelTools.h"
 #include "SecureVector.h"
+#include "Span.h"
 #include "StreamAuthenticators.h"
 #include "StreamCiphers.h"
 #include "SymmetricKey.h"
@@ -202,6 +203,19 @@ public:
 	/// <param name="OutOffset">The starting offset within the output vector</param>
 	/// <param name="Length">The byte length of data to process</param>
 	virtual void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) = 0;
+
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The bytes are read from and written to the callers memory directly, without an intermediate vector.
+	/// The Input and Output may point to the same buffer for in-place operation, but must not otherwise overlap.
+	/// If IsParallel() is set to true, and the length is at least ParallelBlockSize(), the transform is run in parallel processing mode.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output buffer, receiving Length bytes</param>
+	/// <param name="Length">The number of bytes to transform</param>
+	virtual void Transform(const byte* Input, byte* Output, size_t Length) = 0;
 };
 
 NAMESPACE_STREAMEND
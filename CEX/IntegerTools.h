@@ -898,7 +898,7 @@ public:
 			odst = Output[lctr];
 			osrc = ((MAXPOS - lctr) < cinc.size()) ? cinc[MAXPOS - lctr] : 0x00;
 			ndst = odst + osrc + carry;
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 		}
 	}
@@ -947,7 +947,7 @@ public:
 			odst = Output[lctr];
 			osrc = ((MAXPOS - lctr) < cinc.size()) ? cinc[MAXPOS - lctr] : 0x00;
 			ndst = static_cast<byte>(odst + osrc + carry);
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 		}
 	}
@@ -995,7 +995,7 @@ public:
 			odst = Output[lctr];
 			osrc = ((MAXPOS - lctr) < cinc.size()) ? cinc[MAXPOS - lctr] : 0x00;
 			ndst = static_cast<byte>(odst + osrc + carry);
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 		}
 	}
@@ -1044,7 +1044,7 @@ public:
 			odst = Output[lctr];
 			osrc = ((MAXPOS - lctr) < cinc.size()) ? cinc[MAXPOS - lctr] : 0x00;
 			ndst = static_cast<byte>(odst + osrc + carry);
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 		}
 	}
@@ -1708,7 +1708,7 @@ public:
 			odst = Output[lctr];
 			osrc = (lctr < cinc.size() ? cinc[lctr] : 0x00);
 			ndst = static_cast<byte>(odst + osrc + carry);
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 			++lctr;
 		}
@@ -1756,7 +1756,7 @@ public:
 			odst = Output[lctr];
 			osrc = (lctr < cinc.size() ? cinc[lctr] : 0x00);
 			ndst = static_cast<byte>(odst + osrc + carry);
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 			++lctr;
 		}
@@ -1802,7 +1802,7 @@ public:
 			odst = Output[lctr];
 			osrc = ((lctr - OutOffset < cinc.size()) ? cinc[lctr - OutOffset] : 0x00);
 			ndst = odst + osrc + carry;
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 			++lctr;
 		}
@@ -1849,7 +1849,7 @@ public:
 			odst = Output[lctr];
 			osrc = ((lctr - OutOffset < cinc.size()) ? cinc[lctr - OutOffset] : 0x00);
 			ndst = odst + osrc + carry;
-			carry = ndst < odst ? 1 : 0;
+			carry = (ndst < odst || (carry != 0 && ndst == odst)) ? 1 : 0;
 			Output[lctr] = ndst;
 			++lctr;
 		}
@@ -167,6 +167,17 @@ size_t KMAC::Finalize(std::vector<byte> &Output, size_t OutOffset)
 	return tmph.size();
 }
 
+size_t KMAC::Finalize(byte* Output)
+{
+	SecureVector<byte> tmph(TagSize());
+	const Span<byte> OTP(Output, tmph.size());
+
+	Finalize(tmph, 0);
+	MemoryTools::Copy(tmph, 0, OTP, 0, tmph.size());
+
+	return tmph.size();
+}
+
 size_t KMAC::Finalize(SecureVector<byte> &Output, size_t OutOffset)
 {
 	std::vector<byte> buf(sizeof(size_t) + 1);
@@ -265,40 +276,17 @@ void KMAC::Update(const std::vector<byte> &Input, size_t InOffset, size_t Length
 		throw CryptoMacException(Name(), std::string("Update"), std::string("The Input buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
-	if (Length != 0)
-	{
-		// update partially filled block
-		if (m_kmacState->Position != 0 && (m_kmacState->Position + Length >= m_kmacState->Rate))
-		{
-			const size_t RMDLEN = m_kmacState->Rate - m_kmacState->Position;
-			if (RMDLEN != 0)
-			{
-				MemoryTools::Copy(Input, InOffset, m_kmacState->Buffer, m_kmacState->Position, RMDLEN);
-			}
-
-			Keccak::FastAbsorb(m_kmacState->Buffer, 0, m_kmacState->Rate, m_kmacState->State);
-			Permute(m_kmacState);
-			m_kmacState->Position = 0;
-			InOffset += RMDLEN;
-			Length -= RMDLEN;
-		}
-
-		// sequential loop through remaining blocks
-		while (Length >= m_kmacState->Rate)
-		{
-			Keccak::FastAbsorb(Input, InOffset, m_kmacState->Rate, m_kmacState->State);
-			Permute(m_kmacState);
-			InOffset += m_kmacState->Rate;
-			Length -= m_kmacState->Rate;
-		}
+	Process(Input, InOffset, Length);
+}
 
-		// store unaligned bytes
-		if (Length != 0)
-		{
-			MemoryTools::Copy(Input, InOffset, m_kmacState->Buffer, m_kmacState->Position, Length);
-			m_kmacState->Position += Length;
-		}
+void KMAC::Update(const byte* Input, size_t Length)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Update"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
 	}
+
+	Process(Span<const byte>(Input, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -345,6 +333,44 @@ void KMAC::Permute(std::unique_ptr<KmacState> &State)
 	Keccak::Permute(State->State, State->Rate);
 }
 
+void KMAC::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
+	if (Length != 0)
+	{
+		// update partially filled block
+		if (m_kmacState->Position != 0 && (m_kmacState->Position + Length >= m_kmacState->Rate))
+		{
+			const size_t RMDLEN = m_kmacState->Rate - m_kmacState->Position;
+			if (RMDLEN != 0)
+			{
+				MemoryTools::Copy(Input, InOffset, m_kmacState->Buffer, m_kmacState->Position, RMDLEN);
+			}
+
+			Keccak::FastAbsorb(m_kmacState->Buffer, 0, m_kmacState->Rate, m_kmacState->State);
+			Permute(m_kmacState);
+			m_kmacState->Position = 0;
+			InOffset += RMDLEN;
+			Length -= RMDLEN;
+		}
+
+		// sequential loop through remaining blocks
+		while (Length >= m_kmacState->Rate)
+		{
+			Keccak::FastAbsorb(Input, InOffset, m_kmacState->Rate, m_kmacState->State);
+			Permute(m_kmacState);
+			InOffset += m_kmacState->Rate;
+			Length -= m_kmacState->Rate;
+		}
+
+		// store unaligned bytes
+		if (Length != 0)
+		{
+			MemoryTools::Copy(Input, InOffset, m_kmacState->Buffer, m_kmacState->Position, Length);
+			m_kmacState->Position += Length;
+		}
+	}
+}
+
 void KMAC::Squeeze(SecureVector<byte> &Output, size_t OutOffset, size_t Length, std::unique_ptr<KmacState> &State)
 {
 	size_t i;
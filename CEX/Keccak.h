@@ -59,7 +59,9 @@ using Tools::MemoryTools;
 /// <para>The compact forms of the permutations have the suffix C, and are optimized for low memory consumption 
 /// (enabled in the hash function by adding the CEX_DIGEST_COMPACT to the CexConfig file). \n
 /// The Unrolled forms are optimized for speed and timing neutrality have the U suffix. \n
-/// The H suffix denotes functions that take an SIMD wrapper class as the state values, and process message blocks in SIMD parallel blocks.</para>
+/// The H suffix denotes functions that take an SIMD wrapper class as the state values, and process message blocks in SIMD parallel blocks. \n
+/// The V suffix denotes the vertically vectorized forms, that permute a single state with the planes of the state held in AVX2 or AVX512 registers. \n
+/// The PermuteR24P1600 and PermuteR48P1600 functions select the V form if AVX2 is available, otherwise the C or U form.</para>
 /// <para>This class contains wide forms of the functions; PermuteR24P4x1600H and PermuteR48P4x1600H use AVX2. \n
 /// Experimental functions using AVX512 instructions are also implemented; PermuteR24P8x1600H and PermuteR48P8x1600H. \n
 /// These extended functions are only visible at run-time on some development platforms (VS..), if the __AVX2__ or __AVX512__ compiler flags are declared explicitly.</para>
@@ -218,11 +220,7 @@ public:
 		{
 			FastAbsorb(Input, InOffset, Rate, State);
 
-#if defined(CEX_DIGEST_COMPACT)
-			PermuteR24P1600C(State);
-#else
-			PermuteR24P1600U(State);
-#endif
+			PermuteR24P1600(State);
 
 			InLength -= Rate;
 			InOffset += Rate;
@@ -262,11 +260,7 @@ public:
 		{
 			FastAbsorb(Input, InOffset, Rate, State);
 
-#if defined(CEX_DIGEST_COMPACT)
-			PermuteR48P1600C(State);
-#else
-			PermuteR48P1600U(State);
-#endif
+			PermuteR48P1600(State);
 
 			InLength -= Rate;
 			InOffset += Rate;
@@ -328,11 +322,7 @@ public:
 
 		AbsorbR24(Message, Offset, Length, Rate, KECCAK_SHA3_DOMAIN, state);
 
-#if defined(CEX_DIGEST_COMPACT)
-		PermuteR24P1600C(state);
-#else
-		PermuteR24P1600U(state);
-#endif
+		PermuteR24P1600(state);
 
 		MemoryTools::Copy(state, 0, Output, 0, OTPLEN);
 	}
@@ -356,11 +346,7 @@ public:
 
 		AbsorbR48(Message, Offset, Length, Rate, KECCAK_SHA3_DOMAIN, state);
 
-#if defined(CEX_DIGEST_COMPACT)
-		PermuteR48P1600C(state);
-#else
-		PermuteR48P1600U(state);
-#endif
+		PermuteR48P1600(state);
 
 		MemoryTools::Copy(state, 0, Output, 0, OTPLEN);
 	}
@@ -412,7 +398,7 @@ public:
 				if (offset == Rate)
 				{
 					FastAbsorb(pad, 0, Rate, State);
-					PermuteR24P1600U(State);
+					PermuteR24P1600(State);
 					offset = 0;
 				}
 
@@ -430,7 +416,7 @@ public:
 				if (offset == Rate)
 				{
 					FastAbsorb(pad, 0, Rate, State);
-					PermuteR24P1600U(State);
+					PermuteR24P1600(State);
 					offset = 0;
 				}
 
@@ -443,7 +429,7 @@ public:
 		offset = (offset % sizeof(ulong) == 0) ? offset : offset + (sizeof(ulong) - (offset % sizeof(ulong)));
 		MemoryTools::XOR(pad, 0, State, 0, offset);
 
-		PermuteR24P1600U(State);
+		PermuteR24P1600(State);
 	}
 
 	/// <summary>
@@ -472,7 +458,7 @@ public:
 				if (offset == Rate)
 				{
 					FastAbsorb(pad, 0, Rate, State);
-					PermuteR48P1600U(State);
+					PermuteR48P1600(State);
 					offset = 0;
 				}
 
@@ -490,7 +476,7 @@ public:
 				if (offset == Rate)
 				{
 					FastAbsorb(pad, 0, Rate, State);
-					PermuteR48P1600U(State);
+					PermuteR48P1600(State);
 					offset = 0;
 				}
 
@@ -503,7 +489,7 @@ public:
 		offset = (offset % sizeof(ulong) == 0) ? offset : offset + (sizeof(ulong) - (offset % sizeof(ulong)));
 		MemoryTools::XOR(pad, 0, State, 0, offset);
 
-		PermuteR48P1600U(State);
+		PermuteR48P1600(State);
 	}
 
 	/// <summary>
@@ -529,7 +515,7 @@ public:
 		while (Length != 0)
 		{
 			const size_t DIFF = IntegerTools::Min(Rate, Length);
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 			MemoryTools::Copy(state, 0, Output, Offset, DIFF);
 			Offset += DIFF;
 			Length -= DIFF;
@@ -559,7 +545,7 @@ public:
 		while (Length != 0)
 		{
 			const size_t DIFF = IntegerTools::Min(Rate, Length);
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 			MemoryTools::Copy(state, 0, Output, Offset, DIFF);
 			Offset += DIFF;
 			Length -= DIFF;
@@ -662,7 +648,7 @@ public:
 				if (poft == Rate)
 				{
 					FastAbsorb(pad, 0, Rate, state);
-					PermuteR24P1600U(state);
+					PermuteR24P1600(state);
 					poft = 0;
 				}
 
@@ -679,13 +665,13 @@ public:
 			state[i / sizeof(ulong)] ^= IntegerTools::LeBytesTo64(pad, i);
 		}
 
-		PermuteR24P1600U(state);
+		PermuteR24P1600(state);
 
 		// loop through the message, absorbing it into the state
 		while (Length >= Rate)
 		{
 			FastAbsorb(Message, Offset, Rate, state);
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 			Length -= Rate;
 			Offset += Rate;
 		}
@@ -711,7 +697,7 @@ public:
 		while (Length != 0)
 		{
 			const size_t DIFF = IntegerTools::Min(Rate, Length);
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 			MemoryTools::Copy(state, 0, Output, Offset, DIFF);
 			Offset += DIFF;
 			Length -= DIFF;
@@ -755,7 +741,7 @@ public:
 				if (poft == Rate)
 				{
 					FastAbsorb(pad, 0, Rate, state);
-					PermuteR48P1600U(state);
+					PermuteR48P1600(state);
 					poft = 0;
 				}
 
@@ -772,13 +758,13 @@ public:
 			state[i / sizeof(ulong)] ^= IntegerTools::LeBytesTo64(pad, i);
 		}
 
-		PermuteR48P1600U(state);
+		PermuteR48P1600(state);
 
 		// loop through the message, absorbing it into the state
 		while (Length >= Rate)
 		{
 			FastAbsorb(Message, Offset, Rate, state);
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 			Length -= Rate;
 			Offset += Rate;
 		}
@@ -804,7 +790,7 @@ public:
 		while (Length != 0)
 		{
 			const size_t DIFF = IntegerTools::Min(Rate, Length);
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 			MemoryTools::Copy(state, 0, Output, Offset, DIFF);
 			Offset += DIFF;
 			Length -= DIFF;
@@ -822,22 +808,50 @@ public:
 	{
 		if (Rate != KECCAK1024_RATE_SIZE)
 		{
-#	if defined(CEX_DIGEST_COMPACT)
-			PermuteR24P1600C(State);
-#	else
-			PermuteR24P1600U(State);
-#	endif
+			PermuteR24P1600(State);
 		}
 		else
 		{
-#	if defined(CEX_DIGEST_COMPACT)
-			PermuteR48P1600C(State);
-#	else
-			PermuteR48P1600U(State);
-#	endif
+			PermuteR48P1600(State);
 		}
 	}
 
+	/// <summary>
+	/// The 24 round (standard) SHA3 permutation function.
+	/// <para>Selects the vectorized form of the permutation if AVX2 or AVX512 is available, otherwise the compact or unrolled form.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The permutations uint64 state array</param>
+	template<typename ArrayU64x25>
+	static void PermuteR24P1600(ArrayU64x25 &State)
+	{
+#if defined(CEX_HAS_AVX2)
+		PermuteR24P1600V(State);
+#elif defined(CEX_DIGEST_COMPACT)
+		PermuteR24P1600C(State);
+#else
+		PermuteR24P1600U(State);
+#endif
+	}
+
+	/// <summary>
+	/// The 48 round (extended) SHA3 permutation function.
+	/// <para>Selects the vectorized form of the permutation if AVX2 or AVX512 is available, otherwise the compact or unrolled form.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The permutations uint64 state array</param>
+	template<typename ArrayU64x25>
+	static void PermuteR48P1600(ArrayU64x25 &State)
+	{
+#if defined(CEX_HAS_AVX2)
+		PermuteR48P1600V(State);
+#elif defined(CEX_DIGEST_COMPACT)
+		PermuteR48P1600C(State);
+#else
+		PermuteR48P1600U(State);
+#endif
+	}
+
 	/// <summary>
 	/// The compact form of the 24 round (standard) SHA3 permutation function.
 	/// <para>This function has been optimized for a small memory consumption.
@@ -7750,6 +7764,34 @@ public:
 		State[24] = Asu;
 	}
 
+#if defined(CEX_HAS_AVX2)
+
+	/// <summary>
+	/// The vertically vectorized form of the 24 round (standard) SHA3 permutation function.
+	/// <para>This function permutes a single state using AVX512 instructions if they are available, otherwise AVX2 instructions.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The permutations uint64 state array</param>
+	template<typename ArrayU64x25>
+	static void PermuteR24P1600V(ArrayU64x25 &State)
+	{
+		PermuteP1600V(State, KECCAK_RC24, 24);
+	}
+
+	/// <summary>
+	/// The vertically vectorized form of the 48 round (extended) SHA3 permutation function.
+	/// <para>This function permutes a single state using AVX512 instructions if they are available, otherwise AVX2 instructions.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The permutations uint64 state array</param>
+	template<typename ArrayU64x25>
+	static void PermuteR48P1600V(ArrayU64x25 &State)
+	{
+		PermuteP1600V(State, KECCAK_RC48, 48);
+	}
+
+#endif
+
 #if defined(CEX_HAS_AVX512)
 
 	/// <summary>
@@ -8584,7 +8626,7 @@ public:
 	{
 		while (Blocks > 0)
 		{
-			PermuteR24P1600U(State);
+			PermuteR24P1600(State);
 
 #if defined(CEX_IS_LITTLE_ENDIAN)
 			MemoryTools::Copy(State, 0, Output, OutOffset, Rate);
@@ -8615,7 +8657,7 @@ public:
 	{
 		while (Blocks > 0)
 		{
-			PermuteR48P1600U(State);
+			PermuteR48P1600(State);
 
 #if defined(CEX_IS_LITTLE_ENDIAN)
 			MemoryTools::Copy(State, 0, Output, OutOffset, Rate);
@@ -8660,7 +8702,7 @@ public:
 		while (inplen >= Rate)
 		{
 			FastAbsorb(Input, inpoft, Rate, state);
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 			inplen -= Rate;
 			inpoft += Rate;
 		}
@@ -8686,7 +8728,7 @@ public:
 
 		if (otplen != 0)
 		{
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 
 			const size_t FNLBLK = (otplen % sizeof(ulong) == 0) ? otplen / sizeof(ulong) : otplen / sizeof(ulong) + 1;
 
@@ -8722,7 +8764,7 @@ public:
 		while (InLength >= Rate)
 		{
 			FastAbsorb(Input, InOffset, Rate, state);
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 			InLength -= Rate;
 			InOffset += Rate;
 		}
@@ -8748,7 +8790,7 @@ public:
 
 		if (OutLength != 0)
 		{
-			PermuteR24P1600U(state);
+			PermuteR24P1600(state);
 
 			const size_t FNLBLK = (OutLength % sizeof(ulong) == 0) ? OutLength / sizeof(ulong) : OutLength / sizeof(ulong) + 1;
 
@@ -8789,7 +8831,7 @@ public:
 		while (inplen >= Rate)
 		{
 			FastAbsorb(Input, inpoft, Rate, state);
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 			inplen -= Rate;
 			inpoft += Rate;
 		}
@@ -8815,7 +8857,7 @@ public:
 
 		if (otplen != 0)
 		{
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 
 			const size_t FNLBLK = (otplen % sizeof(ulong) == 0) ? otplen / sizeof(ulong) : otplen / sizeof(ulong) + 1;
 
@@ -8851,7 +8893,7 @@ public:
 		while (InLength >= Rate)
 		{
 			FastAbsorb(Input, InOffset, Rate, state);
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 			InLength -= Rate;
 			InOffset += Rate;
 		}
@@ -8877,7 +8919,7 @@ public:
 
 		if (OutLength != 0)
 		{
-			PermuteR48P1600U(state);
+			PermuteR48P1600(state);
 
 			const size_t FNLBLK = (OutLength % sizeof(ulong) == 0) ? OutLength / sizeof(ulong) : OutLength / sizeof(ulong) + 1;
 
@@ -8924,6 +8966,228 @@ public:
 
 		return n + 1;
 	}
+
+private:
+
+#if defined(CEX_HAS_AVX512)
+
+	template<typename ArrayU64x25, typename ArrayRC>
+	static void PermuteP1600V(ArrayU64x25 &State, const ArrayRC &RC, size_t Rounds)
+	{
+		// each plane (y) is held in a register, with the lanes (x) in elements 0-4
+		const __m512i RHO0 = _mm512_set_epi64(0, 0, 0, 27, 28, 62, 1, 0);
+		const __m512i RHO1 = _mm512_set_epi64(0, 0, 0, 20, 55, 6, 44, 36);
+		const __m512i RHO2 = _mm512_set_epi64(0, 0, 0, 39, 25, 43, 10, 3);
+		const __m512i RHO3 = _mm512_set_epi64(0, 0, 0, 8, 21, 15, 45, 41);
+		const __m512i RHO4 = _mm512_set_epi64(0, 0, 0, 14, 56, 61, 2, 18);
+		const __m512i THP = _mm512_set_epi64(7, 6, 5, 3, 2, 1, 0, 4);
+		const __m512i THN = _mm512_set_epi64(7, 6, 5, 0, 4, 3, 2, 1);
+		const __m512i PI0 = _mm512_set_epi64(7, 6, 5, 2, 4, 1, 3, 0);
+		const __m512i PI1 = _mm512_set_epi64(7, 6, 5, 3, 0, 2, 4, 1);
+		const __m512i PI2 = _mm512_set_epi64(7, 6, 5, 4, 1, 3, 0, 2);
+		const __m512i PI3 = _mm512_set_epi64(7, 6, 5, 0, 2, 4, 1, 3);
+		const __m512i PI4 = _mm512_set_epi64(7, 6, 5, 1, 3, 0, 2, 4);
+		const __m512i TRL = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+		const __m512i TRH = _mm512_set_epi64(7, 6, 5, 4, 7, 6, 12, 4);
+		const __m512i TR0 = _mm512_set_epi64(7, 6, 5, 4, 9, 8, 1, 0);
+		const __m512i TR1 = _mm512_set_epi64(7, 6, 5, 4, 11, 10, 3, 2);
+		const __m512i TR2 = _mm512_set_epi64(7, 6, 5, 4, 13, 12, 5, 4);
+		const __m512i TR3 = _mm512_set_epi64(7, 6, 5, 4, 15, 14, 7, 6);
+		__m512i C;
+		__m512i D;
+		__m512i P0;
+		__m512i P1;
+		__m512i P2;
+		__m512i P3;
+		__m512i P4;
+		__m512i Q0;
+		__m512i Q1;
+		__m512i Q2;
+		__m512i Q3;
+		__m512i Q4;
+		__m512i U0;
+		__m512i U1;
+		__m512i V0;
+		__m512i V1;
+		size_t i;
+
+		P0 = _mm512_maskz_loadu_epi64(0x1F, &State[0]);
+		P1 = _mm512_maskz_loadu_epi64(0x1F, &State[5]);
+		P2 = _mm512_maskz_loadu_epi64(0x1F, &State[10]);
+		P3 = _mm512_maskz_loadu_epi64(0x1F, &State[15]);
+		P4 = _mm512_maskz_loadu_epi64(0x1F, &State[20]);
+
+		for (i = 0; i < Rounds; ++i)
+		{
+			// theta
+			C = _mm512_ternarylogic_epi64(P0, P1, P2, 0x96);
+			C = _mm512_ternarylogic_epi64(C, P3, P4, 0x96);
+			D = _mm512_xor_si512(_mm512_permutexvar_epi64(THP, C), _mm512_rol_epi64(_mm512_permutexvar_epi64(THN, C), 1));
+			// rho
+			P0 = _mm512_rolv_epi64(_mm512_xor_si512(P0, D), RHO0);
+			P1 = _mm512_rolv_epi64(_mm512_xor_si512(P1, D), RHO1);
+			P2 = _mm512_rolv_epi64(_mm512_xor_si512(P2, D), RHO2);
+			P3 = _mm512_rolv_epi64(_mm512_xor_si512(P3, D), RHO3);
+			P4 = _mm512_rolv_epi64(_mm512_xor_si512(P4, D), RHO4);
+			// pi; the next state is gathered as columns, Q[x][y] = P[x][(x + 3y) % 5]
+			Q0 = _mm512_permutexvar_epi64(PI0, P0);
+			Q1 = _mm512_permutexvar_epi64(PI1, P1);
+			Q2 = _mm512_permutexvar_epi64(PI2, P2);
+			Q3 = _mm512_permutexvar_epi64(PI3, P3);
+			Q4 = _mm512_permutexvar_epi64(PI4, P4);
+			// chi; the neighboring lanes are in the neighboring column registers
+			P0 = _mm512_ternarylogic_epi64(Q0, Q1, Q2, 0xD2);
+			P1 = _mm512_ternarylogic_epi64(Q1, Q2, Q3, 0xD2);
+			P2 = _mm512_ternarylogic_epi64(Q2, Q3, Q4, 0xD2);
+			P3 = _mm512_ternarylogic_epi64(Q3, Q4, Q0, 0xD2);
+			P4 = _mm512_ternarylogic_epi64(Q4, Q0, Q1, 0xD2);
+			// iota
+			P0 = _mm512_xor_si512(P0, _mm512_maskz_set1_epi64(0x01, static_cast<long long>(RC[i])));
+			// transpose the columns to planes
+			U0 = _mm512_permutex2var_epi64(P0, TRL, P1);
+			U1 = _mm512_permutex2var_epi64(P0, TRH, P1);
+			V0 = _mm512_permutex2var_epi64(P2, TRL, P3);
+			V1 = _mm512_permutex2var_epi64(P2, TRH, P3);
+			Q0 = _mm512_mask_permutexvar_epi64(_mm512_permutex2var_epi64(U0, TR0, V0), 0x10, _mm512_set1_epi64(0), P4);
+			Q1 = _mm512_mask_permutexvar_epi64(_mm512_permutex2var_epi64(U0, TR1, V0), 0x10, _mm512_set1_epi64(1), P4);
+			Q2 = _mm512_mask_permutexvar_epi64(_mm512_permutex2var_epi64(U0, TR2, V0), 0x10, _mm512_set1_epi64(2), P4);
+			Q3 = _mm512_mask_permutexvar_epi64(_mm512_permutex2var_epi64(U0, TR3, V0), 0x10, _mm512_set1_epi64(3), P4);
+			P4 = _mm512_mask_permutexvar_epi64(_mm512_permutex2var_epi64(U1, TR0, V1), 0x10, _mm512_set1_epi64(4), P4);
+			P0 = Q0;
+			P1 = Q1;
+			P2 = Q2;
+			P3 = Q3;
+		}
+
+		_mm512_mask_storeu_epi64(&State[0], 0x1F, P0);
+		_mm512_mask_storeu_epi64(&State[5], 0x1F, P1);
+		_mm512_mask_storeu_epi64(&State[10], 0x1F, P2);
+		_mm512_mask_storeu_epi64(&State[15], 0x1F, P3);
+		_mm512_mask_storeu_epi64(&State[20], 0x1F, P4);
+	}
+
+#elif defined(CEX_HAS_AVX2)
+
+	inline static __m256i RotL64V(const __m256i &X, const __m256i &L, const __m256i &R)
+	{
+		return _mm256_or_si256(_mm256_sllv_epi64(X, L), _mm256_srlv_epi64(X, R));
+	}
+
+	template<typename ArrayU64x25, typename ArrayRC>
+	static void PermuteP1600V(ArrayU64x25 &State, const ArrayRC &RC, size_t Rounds)
+	{
+		// each plane (y) holds lanes 0-3 in a register, lane 4 of planes 0-3 is held in X4, and lane 24 in every element of S
+		const __m256i RHL0 = _mm256_set_epi64x(28, 62, 1, 0);
+		const __m256i RHR0 = _mm256_set_epi64x(36, 2, 63, 64);
+		const __m256i RHL1 = _mm256_set_epi64x(55, 6, 44, 36);
+		const __m256i RHR1 = _mm256_set_epi64x(9, 58, 20, 28);
+		const __m256i RHL2 = _mm256_set_epi64x(25, 43, 10, 3);
+		const __m256i RHR2 = _mm256_set_epi64x(39, 21, 54, 61);
+		const __m256i RHL3 = _mm256_set_epi64x(21, 15, 45, 41);
+		const __m256i RHR3 = _mm256_set_epi64x(43, 49, 19, 23);
+		const __m256i RHL4 = _mm256_set_epi64x(56, 61, 2, 18);
+		const __m256i RHR4 = _mm256_set_epi64x(8, 3, 62, 46);
+		const __m256i RHLX = _mm256_set_epi64x(8, 39, 20, 27);
+		const __m256i RHRX = _mm256_set_epi64x(56, 25, 44, 37);
+		const __m256i RHLS = _mm256_set1_epi64x(14);
+		const __m256i RHRS = _mm256_set1_epi64x(50);
+		const __m256i ROL1 = _mm256_set1_epi64x(1);
+		const __m256i ROR1 = _mm256_set1_epi64x(63);
+		__m256i C;
+		__m256i C4;
+		__m256i D;
+		__m256i D4;
+		__m256i P0;
+		__m256i P1;
+		__m256i P2;
+		__m256i P3;
+		__m256i P4;
+		__m256i Q0;
+		__m256i Q1;
+		__m256i Q2;
+		__m256i Q3;
+		__m256i Q4;
+		__m256i R;
+		__m256i S;
+		__m256i T;
+		__m256i T0;
+		__m256i T1;
+		__m256i T2;
+		__m256i T3;
+		__m256i X4;
+		size_t i;
+
+		P0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&State[0]));
+		P1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&State[5]));
+		P2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&State[10]));
+		P3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&State[15]));
+		P4 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&State[20]));
+		X4 = _mm256_set_epi64x(State[19], State[14], State[9], State[4]);
+		S = _mm256_set1_epi64x(State[24]);
+
+		for (i = 0; i < Rounds; ++i)
+		{
+			// theta
+			C = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(P0, P1), _mm256_xor_si256(P2, P3)), P4);
+			C4 = _mm256_xor_si256(X4, _mm256_permute4x64_epi64(X4, _MM_SHUFFLE(2, 3, 0, 1)));
+			C4 = _mm256_xor_si256(_mm256_xor_si256(C4, _mm256_permute4x64_epi64(C4, _MM_SHUFFLE(1, 0, 3, 2))), S);
+			D = _mm256_xor_si256(_mm256_blend_epi32(_mm256_permute4x64_epi64(C, _MM_SHUFFLE(2, 1, 0, 0)), C4, 0x03),
+				RotL64V(_mm256_blend_epi32(_mm256_permute4x64_epi64(C, _MM_SHUFFLE(3, 3, 2, 1)), C4, 0xC0), ROL1, ROR1));
+			D4 = _mm256_xor_si256(_mm256_permute4x64_epi64(C, 0xFF), RotL64V(_mm256_permute4x64_epi64(C, 0x00), ROL1, ROR1));
+			// rho
+			P0 = RotL64V(_mm256_xor_si256(P0, D), RHL0, RHR0);
+			P1 = RotL64V(_mm256_xor_si256(P1, D), RHL1, RHR1);
+			P2 = RotL64V(_mm256_xor_si256(P2, D), RHL2, RHR2);
+			P3 = RotL64V(_mm256_xor_si256(P3, D), RHL3, RHR3);
+			P4 = RotL64V(_mm256_xor_si256(P4, D), RHL4, RHR4);
+			X4 = RotL64V(_mm256_xor_si256(X4, D4), RHLX, RHRX);
+			S = RotL64V(_mm256_xor_si256(S, D4), RHLS, RHRS);
+			// pi; rows 0-3 of the next state are gathered as columns, Q[x][y] = P[x][(x + 3y) % 5], and row 4 into R and T
+			Q0 = _mm256_blend_epi32(_mm256_permute4x64_epi64(P0, _MM_SHUFFLE(0, 1, 3, 0)), _mm256_permute4x64_epi64(X4, 0x00), 0xC0);
+			Q1 = _mm256_blend_epi32(_mm256_permute4x64_epi64(P1, _MM_SHUFFLE(0, 2, 0, 1)), _mm256_permute4x64_epi64(X4, 0x55), 0x0C);
+			Q2 = _mm256_permute4x64_epi64(P2, _MM_SHUFFLE(1, 3, 0, 2));
+			Q3 = _mm256_blend_epi32(_mm256_permute4x64_epi64(P3, _MM_SHUFFLE(2, 0, 1, 3)), _mm256_permute4x64_epi64(X4, 0xFF), 0x30);
+			Q4 = _mm256_blend_epi32(_mm256_permute4x64_epi64(P4, _MM_SHUFFLE(3, 0, 2, 0)), S, 0x03);
+			T0 = _mm256_blend_epi32(_mm256_permute4x64_epi64(P0, 0xAA), _mm256_permute4x64_epi64(P1, 0xFF), 0x0C);
+			T1 = _mm256_blend_epi32(_mm256_permute4x64_epi64(X4, 0xAA), _mm256_permute4x64_epi64(P3, 0x00), 0xC0);
+			R = _mm256_blend_epi32(T0, T1, 0xF0);
+			T = _mm256_permute4x64_epi64(P4, 0x55);
+			// chi
+			P0 = _mm256_xor_si256(Q0, _mm256_andnot_si256(Q1, Q2));
+			P1 = _mm256_xor_si256(Q1, _mm256_andnot_si256(Q2, Q3));
+			P2 = _mm256_xor_si256(Q2, _mm256_andnot_si256(Q3, Q4));
+			P3 = _mm256_xor_si256(Q3, _mm256_andnot_si256(Q4, Q0));
+			X4 = _mm256_xor_si256(Q4, _mm256_andnot_si256(Q0, Q1));
+			T0 = _mm256_blend_epi32(_mm256_permute4x64_epi64(R, _MM_SHUFFLE(3, 3, 2, 1)), T, 0xC0);
+			T1 = _mm256_blend_epi32(_mm256_permute4x64_epi64(R, _MM_SHUFFLE(0, 0, 3, 2)), T, 0x30);
+			S = _mm256_xor_si256(T, _mm256_andnot_si256(_mm256_permute4x64_epi64(R, 0x00), _mm256_permute4x64_epi64(R, 0x55)));
+			P4 = _mm256_xor_si256(R, _mm256_andnot_si256(T0, T1));
+			// iota
+			P0 = _mm256_xor_si256(P0, _mm256_set_epi64x(0, 0, 0, static_cast<long long>(RC[i])));
+			// transpose the columns of rows 0-3 to planes
+			T0 = _mm256_unpacklo_epi64(P0, P1);
+			T1 = _mm256_unpackhi_epi64(P0, P1);
+			T2 = _mm256_unpacklo_epi64(P2, P3);
+			T3 = _mm256_unpackhi_epi64(P2, P3);
+			P0 = _mm256_permute2x128_si256(T0, T2, 0x20);
+			P1 = _mm256_permute2x128_si256(T1, T3, 0x20);
+			P2 = _mm256_permute2x128_si256(T0, T2, 0x31);
+			P3 = _mm256_permute2x128_si256(T1, T3, 0x31);
+		}
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[0]), P0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[5]), P1);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[10]), P2);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[15]), P3);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&State[20]), P4);
+		State[4] = static_cast<ulong>(_mm256_extract_epi64(X4, 0));
+		State[9] = static_cast<ulong>(_mm256_extract_epi64(X4, 1));
+		State[14] = static_cast<ulong>(_mm256_extract_epi64(X4, 2));
+		State[19] = static_cast<ulong>(_mm256_extract_epi64(X4, 3));
+		State[24] = static_cast<ulong>(_mm256_extract_epi64(S, 0));
+	}
+
+#endif
 };
 
 NAMESPACE_DIGESTEND
@@ -0,0 +1,54 @@
+#ifndef CEX_KEYCONTEXT_H
+#define CEX_KEYCONTEXT_H
+
+#include "CexDomain.h"
+
+NAMESPACE_CIPHER
+
+/// <summary>
+/// The key context virtual interface class.
+/// <para>A key context holds the expanded key schedule of a cipher; it is created once from a key, is immutable after construction,
+/// and can be shared through a std::shared_ptr by any number of cipher instances, on any number of threads.
+/// Each cipher instance bound to a context keeps only its own per-operation state (nonce, counter, and MAC state),
+/// and re-initializing a bound instance with a new nonce does not repeat the key expansion.</para>
+/// </summary>
+class KeyContext
+{
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	KeyContext(const KeyContext&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	KeyContext& operator=(const KeyContext&) = delete;
+
+	/// <summary>
+	/// Initialize the KeyContext virtual interface class
+	/// </summary>
+	KeyContext()
+	{
+	}
+
+	/// <summary>
+	/// Destructor: finalize this class
+	/// </summary>
+	virtual ~KeyContext() noexcept
+	{
+	}
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The formal name of the cipher that created the key schedule
+	/// </summary>
+	virtual const std::string Name() = 0;
+};
+
+NAMESPACE_CIPHEREND
+#endif
@@ -1,46 +1,259 @@
 #include "LockingAllocator.h"
 #include "SecureMemory.h"
+#include <array>
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <mutex>
 
 NAMESPACE_TOOLS
 
 using Exception::CryptoException;
 using Enumeration::ErrorCodes;
-using Tools::MemoryPool;
+
+class LockingAllocator::AllocatorState
+{
+public:
+
+	// the size classes are powers of two from CEX_SECMEMALLOC_MIN to CEX_SECMEMALLOC_MAX
+	static const size_t MAX_CLASSES = 16;
+	// the deepest per-thread cache of a size class
+	static const size_t MAX_CACHE = 32;
+	// the locked bytes a thread may hold in each class cache
+	static const size_t CACHE_BYTES = 4096;
+	// the thread hit counter is added to the global counter at this interval
+	static const size_t PUBLISH_HITS = 256;
+
+	// the free blocks held by one thread
+	class ThreadCache
+	{
+	public:
+
+		std::array<std::array<void*, MAX_CACHE>, MAX_CLASSES> Blocks;
+		std::array<size_t, MAX_CLASSES> Counts;
+		size_t Hits;
+		AllocatorState* Owner;
+
+		ThreadCache()
+			:
+			Counts(),
+			Hits(0),
+			Owner(nullptr)
+		{
+		}
+
+		~ThreadCache()
+		{
+			// return the cached blocks to the global lists, unless the allocator has been released
+			if (Owner != nullptr && Alive())
+			{
+				Owner->FlushAll(*this);
+			}
+		}
+	};
+
+	std::atomic_size_t Fallbacks;
+	std::array<void*, MAX_CLASSES> FreeLists;
+	std::atomic_size_t Hits;
+	std::mutex Lock;
+	size_t ClassCount;
+	size_t PageSize;
+	byte* Region;
+	size_t RegionSize;
+	std::atomic_size_t Watermark;
+
+	AllocatorState(byte* Pages, size_t Length)
+		:
+		Fallbacks(0),
+		FreeLists(),
+		Hits(0),
+		Lock(),
+		ClassCount(0),
+		PageSize(SecureMemory::PageSize()),
+		Region(Pages),
+		RegionSize(Length),
+		Watermark(0)
+	{
+		size_t len;
+
+		for (len = CEX_SECMEMALLOC_MIN; len <= CEX_SECMEMALLOC_MAX && ClassCount < MAX_CLASSES; len <<= 1)
+		{
+			++ClassCount;
+		}
+	}
+
+	~AllocatorState()
+	{
+		FreeLists.fill(nullptr);
+		ClassCount = 0;
+		PageSize = 0;
+		Region = nullptr;
+		RegionSize = 0;
+	}
+
+	// set while the process-wide instance owns its locked region
+	static std::atomic_bool &Alive()
+	{
+		static std::atomic_bool alive(false);
+
+		return alive;
+	}
+
+	static size_t ClassIndex(size_t Length)
+	{
+		size_t cls;
+		size_t len;
+
+		cls = 0;
+		len = CEX_SECMEMALLOC_MIN;
+
+		while (len < Length)
+		{
+			len <<= 1;
+			++cls;
+		}
+
+		return cls;
+	}
+
+	static size_t ClassSize(size_t Class)
+	{
+		return static_cast<size_t>(CEX_SECMEMALLOC_MIN) << Class;
+	}
+
+	static size_t CacheDepth(size_t Class)
+	{
+		const size_t DPTLEN = CACHE_BYTES / ClassSize(Class);
+
+		return (DPTLEN > MAX_CACHE) ? MAX_CACHE : (DPTLEN < 2) ? 2 : DPTLEN;
+	}
+
+	ThreadCache &LocalCache()
+	{
+		static thread_local ThreadCache cache;
+
+		cache.Owner = this;
+
+		return cache;
+	}
+
+	bool InRegion(const void* Pointer)
+	{
+		const uintptr_t PTRADR = reinterpret_cast<uintptr_t>(Pointer);
+		const uintptr_t RGNADR = reinterpret_cast<uintptr_t>(Region);
+
+		return (PTRADR >= RGNADR && PTRADR < RGNADR + RegionSize);
+	}
+
+	// move up to half a cache of blocks from the global list; carve a new slab from the region when the list is empty
+	void Refill(ThreadCache &Cache, size_t Class)
+	{
+		const size_t CLSLEN = ClassSize(Class);
+		const size_t SLBLEN = (CLSLEN > PageSize) ? CLSLEN : PageSize;
+		const size_t RFLCNT = CacheDepth(Class) / 2;
+		std::lock_guard<std::mutex> lock(Lock);
+		size_t i;
+
+		Hits += Cache.Hits;
+		Cache.Hits = 0;
+
+		while (Cache.Counts[Class] < RFLCNT)
+		{
+			if (FreeLists[Class] == nullptr)
+			{
+				if (Watermark + SLBLEN > RegionSize)
+				{
+					break;
+				}
+
+				for (i = SLBLEN; i >= CLSLEN; i -= CLSLEN)
+				{
+					byte* blk = Region + Watermark + i - CLSLEN;
+
+					*reinterpret_cast<void**>(blk) = FreeLists[Class];
+					FreeLists[Class] = blk;
+				}
+
+				Watermark += SLBLEN;
+			}
+
+			void* blk = FreeLists[Class];
+
+			FreeLists[Class] = *reinterpret_cast<void**>(blk);
+			*reinterpret_cast<void**>(blk) = nullptr;
+			Cache.Blocks[Class][Cache.Counts[Class]] = blk;
+			++Cache.Counts[Class];
+		}
+	}
+
+	// return the oldest blocks of a class cache to the global list
+	void Flush(ThreadCache &Cache, size_t Class, size_t Count)
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		size_t i;
+
+		Hits += Cache.Hits;
+		Cache.Hits = 0;
+
+		for (i = 0; i < Count; ++i)
+		{
+			*reinterpret_cast<void**>(Cache.Blocks[Class][i]) = FreeLists[Class];
+			FreeLists[Class] = Cache.Blocks[Class][i];
+		}
+
+		for (i = Count; i < Cache.Counts[Class]; ++i)
+		{
+			Cache.Blocks[Class][i - Count] = Cache.Blocks[Class][i];
+		}
+
+		Cache.Counts[Class] -= Count;
+	}
+
+	void FlushAll(ThreadCache &Cache)
+	{
+		size_t i;
+
+		for (i = 0; i < ClassCount; ++i)
+		{
+			Flush(Cache, i, Cache.Counts[i]);
+		}
+	}
+};
 
 //~~~LockingAllocator~~~//
 
 LockingAllocator::LockingAllocator()
 	:
-	m_lockedPages(nullptr),
-	m_lockedPagesSize(0)
+	m_allocatorState(nullptr)
 {
+	// the region is bounded by RLIMIT_MEMLOCK (or the working set size) and CEX_SECMEMALLOC_MAXKB
 	const size_t LCKLMT = SecureMemory::Limit();
 
-	if (LCKLMT)
+	if (LCKLMT >= SecureMemory::PageSize())
 	{
-		m_lockedPages = static_cast<byte*>(SecureMemory::Allocate(LCKLMT));
+		byte* pages = static_cast<byte*>(SecureMemory::Allocate(LCKLMT));
 
-		if (m_lockedPages)
+		if (pages != nullptr)
 		{
-			m_lockedPagesSize = LCKLMT;
-			m_memoryPool.reset(new MemoryPool(m_lockedPages, m_lockedPagesSize, SecureMemory::PageSize(), CEX_SECMEMALLOC_MIN, CEX_SECMEMALLOC_MAX, 4));
+			m_allocatorState.reset(new AllocatorState(pages, LCKLMT));
+			AllocatorState::Alive() = true;
 		}
 	}
 }
 
 LockingAllocator::~LockingAllocator()
 {
-	if (m_memoryPool != nullptr)
+	if (m_allocatorState != nullptr)
 	{
-		m_memoryPool.reset();
-		SecureMemory::Free(m_lockedPages, m_lockedPagesSize);
-	}
+		byte* pages = m_allocatorState->Region;
+		const size_t PGSLEN = m_allocatorState->RegionSize;
 
-	m_lockedPages = nullptr;
-	m_lockedPagesSize = 0;
-	m_memoryPool = nullptr;
+		AllocatorState::Alive() = false;
+		m_allocatorState.reset();
+		SecureMemory::Erase(pages, PGSLEN);
+		SecureMemory::Free(pages, PGSLEN);
+	}
 }
 
 LockingAllocator& LockingAllocator::Instance()
@@ -50,6 +263,25 @@ LockingAllocator& LockingAllocator::Instance()
 	return mlock;
 }
 
+LockingAllocator::AllocatorStatistics LockingAllocator::Statistics()
+{
+	AllocatorStatistics stats = { 0, 0, 0, 0 };
+
+#if defined(CEX_SECURE_ALLOCATOR)
+	LockingAllocator &alc = LockingAllocator::Instance();
+
+	if (alc.m_allocatorState != nullptr)
+	{
+		stats.Fallbacks = alc.m_allocatorState->Fallbacks;
+		stats.Hits = alc.m_allocatorState->Hits + alc.m_allocatorState->LocalCache().Hits;
+		stats.LockedBytes = alc.m_allocatorState->RegionSize;
+		stats.SlabBytes = alc.m_allocatorState->Watermark;
+	}
+#endif
+
+	return stats;
+}
+
 void* LockingAllocator::allocate(size_t Elements, size_t ElementSize)
 {
 	const size_t ELMLEN = Elements * ElementSize;
@@ -57,9 +289,36 @@ void* LockingAllocator::allocate(size_t Elements, size_t ElementSize)
 
 	ptr = nullptr;
 
-	if (m_memoryPool != nullptr && (ELMLEN / ElementSize != Elements))
+	// reject an overflowed length, and lengths larger than the largest size class
+	if (m_allocatorState != nullptr && ElementSize != 0 && ELMLEN / ElementSize == Elements && ELMLEN != 0 && ELMLEN <= CEX_SECMEMALLOC_MAX)
+	{
+		const size_t CLSIDX = AllocatorState::ClassIndex(ELMLEN);
+		AllocatorState::ThreadCache &cache = m_allocatorState->LocalCache();
+
+		if (cache.Counts[CLSIDX] == 0)
+		{
+			m_allocatorState->Refill(cache, CLSIDX);
+		}
+
+		if (cache.Counts[CLSIDX] != 0)
+		{
+			--cache.Counts[CLSIDX];
+			ptr = cache.Blocks[CLSIDX][cache.Counts[CLSIDX]];
+			++cache.Hits;
+			std::memset(ptr, 0x00, ELMLEN);
+
+			// publish the thread counter periodically
+			if (cache.Hits >= AllocatorState::PUBLISH_HITS)
+			{
+				m_allocatorState->Hits += cache.Hits;
+				cache.Hits = 0;
+			}
+		}
+	}
+
+	if (ptr == nullptr && m_allocatorState != nullptr)
 	{
-		ptr = m_memoryPool->Allocate(ELMLEN);
+		++m_allocatorState->Fallbacks;
 	}
 
 	return ptr;
@@ -72,9 +331,19 @@ bool LockingAllocator::deallocate(void* Pointer, size_t Elements, size_t Element
 
 	ret = false;
 
-	if (m_memoryPool != nullptr && (ELMLEN / ElementSize != Elements))
+	if (m_allocatorState != nullptr && m_allocatorState->InRegion(Pointer))
 	{
-		ret = m_memoryPool->Deallocate(Pointer, ELMLEN);
+		const size_t CLSIDX = AllocatorState::ClassIndex(ELMLEN);
+		AllocatorState::ThreadCache &cache = m_allocatorState->LocalCache();
+
+		if (cache.Counts[CLSIDX] == AllocatorState::CacheDepth(CLSIDX))
+		{
+			m_allocatorState->Flush(cache, CLSIDX, cache.Counts[CLSIDX] / 2);
+		}
+
+		cache.Blocks[CLSIDX][cache.Counts[CLSIDX]] = Pointer;
+		++cache.Counts[CLSIDX];
+		ret = true;
 	}
 
 	return ret;
@@ -126,4 +395,4 @@ void LockingAllocator::Deallocate(void* Pointer, size_t Elements, size_t Element
 	}
 }
 
-NAMESPACE_TOOLSEND
\ No newline at end of file
+NAMESPACE_TOOLSEND
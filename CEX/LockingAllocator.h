@@ -10,15 +10,48 @@ NAMESPACE_TOOLS
 /// cond private
 
 /// <summary>
-/// Internal class locking allocator for secure vector implementation
+/// Internal class locking allocator for secure vector implementation.
+/// <para>A slab allocator over a region of locked memory pages, sized from the process locked-memory limit (RLIMIT_MEMLOCK, or the working set on Windows).
+/// Requests of up to CEX_SECMEMALLOC_MAX bytes are rounded to a power of two size class; each thread keeps a small cache of free blocks per class,
+/// and refills or drains it in batches from the global free lists, which are carved from the locked region on demand.
+/// Requests that are too large, or made when the locked region is exhausted, fall back to the heap.</para>
 /// </summary>
 class LockingAllocator final
 {
+public:
+
+	/// <summary>
+	/// Allocator usage counters.
+	/// <para>The counters of other threads are published in batches, so the values are approximate while allocations are in progress.</para>
+	/// </summary>
+	struct AllocatorStatistics
+	{
+		/// <summary>
+		/// The number of allocations served by the heap
+		/// </summary>
+		size_t Fallbacks;
+
+		/// <summary>
+		/// The number of allocations served from locked memory
+		/// </summary>
+		size_t Hits;
+
+		/// <summary>
+		/// The size in bytes of the locked memory region
+		/// </summary>
+		size_t LockedBytes;
+
+		/// <summary>
+		/// The number of bytes of the locked region carved into size class blocks
+		/// </summary>
+		size_t SlabBytes;
+	};
+
 private:
 
-	byte* m_lockedPages;
-	size_t m_lockedPagesSize;
-	std::unique_ptr<MemoryPool> m_memoryPool;
+	class AllocatorState;
+
+	std::unique_ptr<AllocatorState> m_allocatorState;
 
 	LockingAllocator(const LockingAllocator&) = delete;
 
@@ -36,6 +69,8 @@ public:
 
 	static LockingAllocator& Instance();
 
+	static AllocatorStatistics Statistics();
+
 	void* allocate(size_t Elements, size_t ElementSize);
 
 	bool deallocate(void* Pointer, size_t Elements, size_t ElementSize);
@@ -956,11 +956,7 @@ void MLWEQ3329N256::Compute(const std::vector<byte> &Input, size_t InOffset, siz
 
 	Keccak::AbsorbR24(Input, InOffset, InLength, Rate, Keccak::KECCAK_SHA3_DOMAIN, state);
 
-#if defined(CEX_DIGEST_COMPACT)
-	Keccak::PermuteR24P1600C(state);
-#else
-	Keccak::PermuteR24P1600U(state);
-#endif
+	Keccak::PermuteR24P1600(state);
 
 	MemoryTools::Copy(state, 0, Output, OutOffset, OutLength);
 }
@@ -1,5 +1,6 @@
 #include "MacStream.h"
 #include "MacFromName.h"
+#include "StreamPipeline.h"
 
 NAMESPACE_PROCESSING
 
@@ -19,12 +20,14 @@ public:
 	size_t Interval;
 	bool Destroy;
 	bool Initialized;
+	bool Pipelined;
 
 	MacStreamState(bool Destroyed)
 		:
 		Interval(0),
 		Destroy(Destroyed),
-		Initialized(false)
+		Initialized(false),
+		Pipelined(true)
 	{
 	}
 
@@ -33,6 +36,7 @@ public:
 		Interval = 0;
 		Destroy = false;
 		Initialized = false;
+		Pipelined = false;
 	}
 };
 
@@ -70,6 +74,11 @@ const std::vector<SymmetricKeySize> MacStream::LegalKeySizes()
 	return m_macEngine->LegalKeySizes();
 }
 
+bool &MacStream::IsPipelined()
+{
+	return m_streamState->Pipelined;
+}
+
 //~~~Public Functions~~~//
 
 std::vector<byte> MacStream::Compute(IByteStream* InStream)
@@ -187,7 +196,25 @@ std::vector<byte> MacStream::Process(IByteStream* InStream, size_t Length)
 	plen = 0;
 	pread = 0;
 
-	while (plen != ALNLEN)
+	if (m_streamState->Pipelined)
+	{
+		const size_t BUFLEN = StreamPipeline::DEF_BUFFER - (StreamPipeline::DEF_BUFFER % BLKLEN);
+
+		// the stream is read ahead into the buffer ring, while the mac is updated on this thread
+		if (Length >= 2 * BUFLEN)
+		{
+			StreamPipeline pipe(BUFLEN);
+
+			pipe.Process(InStream, Length, [this, Length, &plen](const std::vector<byte> &Input, size_t Count)
+			{
+				m_macEngine->Update(Input, 0, Count);
+				plen += Count;
+				CalculateProgress(Length, plen);
+			});
+		}
+	}
+
+	while (plen < ALNLEN)
 	{
 		pread = InStream->Read(inpBuffer, 0, BLKLEN);
 		m_macEngine->Update(inpBuffer, 0, pread);
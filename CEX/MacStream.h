@@ -66,6 +66,7 @@ using Cipher::SymmetricKeySize;
 /// <list type="bullet">
 /// <item><description>Uses any of the implemented Macs using the IMac interface, or a MAC enumeration type.</description></item>
 /// <item><description>Implementation has a Progress counter that returns total sum of bytes processed per either Compute() calls.</description></item>
+/// <item><description>The stream Compute function is pipelined; input reads and the MAC updates run concurrently, this can be disabled with the IsPipelined() property.</description></item>
 /// </list>
 /// </remarks>
 class MacStream
@@ -132,6 +133,13 @@ public:
 	/// </summary>
 	const std::vector<SymmetricKeySize> LegalKeySizes();
 
+	/// <summary>
+	/// Read/Write: Stream reads are overlapped with the MAC computation, the default is true.
+	/// <para>When enabled, the Compute(IByteStream*) function reads the input stream on a reader thread into a ring of buffers, while the MAC is updated on the calling thread.
+	/// The pipeline is used when the input is at least two buffers in length.</para>
+	/// </summary>
+	bool &IsPipelined();
+
 	//~~~Public Functions~~~//
 
 	/// <summary>
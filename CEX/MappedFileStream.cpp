@@ -0,0 +1,534 @@
+#include "MappedFileStream.h"
+#include "SecureMemory.h"
+
+// CEX_OS_POSIX is only set when unistd.h precedes the configuration header, the unix family targets are matched directly
+#if !defined(CEX_OS_WINDOWS) && (defined(CEX_OS_POSIX) || defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID) || defined(CEX_OS_APPLE) || defined(CEX_OS_BSD) || defined(CEX_OS_UNIX))
+#	define CEX_FILEMAP_POSIX
+#endif
+
+#if defined(CEX_OS_WINDOWS)
+#	include <windows.h>
+#elif defined(CEX_FILEMAP_POSIX)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <sys/types.h>
+#	include <unistd.h>
+#endif
+
+NAMESPACE_IO
+
+using Enumeration::ErrorCodes;
+
+const std::string MappedFileStream::CLASS_NAME("MappedFileStream");
+
+class MappedFileStream::MappedState
+{
+public:
+
+	std::string FileName;
+	byte* Map;
+	// the mapped size of the file; may exceed the stream length while a written file is growing
+	ulong Capacity;
+	ulong Length;
+	ulong Position;
+#if defined(CEX_OS_WINDOWS)
+	HANDLE FileHandle;
+	HANDLE MapHandle;
+#else
+	int FileHandle;
+#endif
+	MappedAccess Access;
+	bool Destroyed;
+	bool Writable;
+
+	MappedState(const std::string &Name, MappedAccess Mode)
+		:
+		FileName(Name),
+		Map(nullptr),
+		Capacity(0),
+		Length(0),
+		Position(0),
+#if defined(CEX_OS_WINDOWS)
+		FileHandle(INVALID_HANDLE_VALUE),
+		MapHandle(nullptr),
+#else
+		FileHandle(-1),
+#endif
+		Access(Mode),
+		Destroyed(false),
+		Writable(Mode != MappedAccess::Read)
+	{
+	}
+
+	~MappedState()
+	{
+		Map = nullptr;
+		Capacity = 0;
+		Length = 0;
+		Position = 0;
+		Destroyed = false;
+		Writable = false;
+	}
+};
+
+//~~~Constructor~~~//
+
+MappedFileStream::MappedFileStream(const std::string &FileName, MappedAccess Access, ulong Length)
+	:
+	m_mapState(new MappedState(FileName, Access))
+{
+	bool opened;
+
+#if defined(CEX_OS_WINDOWS)
+
+	const DWORD FACCESS = m_mapState->Writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+	const DWORD FCREATE = (Access == MappedAccess::Create) ? CREATE_ALWAYS : OPEN_EXISTING;
+	LARGE_INTEGER flen;
+
+	m_mapState->FileHandle = CreateFileA(FileName.c_str(), FACCESS, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, FCREATE, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	opened = (m_mapState->FileHandle != INVALID_HANDLE_VALUE);
+
+	if (opened && GetFileSizeEx(m_mapState->FileHandle, &flen) != 0)
+	{
+		m_mapState->Length = static_cast<ulong>(flen.QuadPart);
+	}
+
+#elif defined(CEX_FILEMAP_POSIX)
+
+	const int FFLAGS = (Access == MappedAccess::Read) ? O_RDONLY : (Access == MappedAccess::ReadWrite) ? O_RDWR : (O_RDWR | O_CREAT | O_TRUNC);
+	struct stat fst;
+
+	m_mapState->FileHandle = open(FileName.c_str(), FFLAGS, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	opened = (m_mapState->FileHandle != -1);
+
+	if (opened && fstat(m_mapState->FileHandle, &fst) == 0)
+	{
+		m_mapState->Length = static_cast<ulong>(fst.st_size);
+	}
+
+#else
+
+	opened = false;
+
+#endif
+
+	if (!opened)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The file does not exist, or could not be opened!"), ErrorCodes::InvalidParam);
+	}
+
+	if (Access == MappedAccess::Create && Length != 0)
+	{
+		Resize(m_mapState.get(), Length);
+		m_mapState->Length = Length;
+	}
+	else
+	{
+		m_mapState->Capacity = m_mapState->Length;
+		Map(m_mapState.get());
+	}
+}
+
+MappedFileStream::~MappedFileStream()
+{
+	Destroy();
+}
+
+//~~~Accessors~~~//
+
+const MappedFileStream::MappedAccess MappedFileStream::Access()
+{
+	return m_mapState->Access;
+}
+
+const bool MappedFileStream::CanRead()
+{
+	return true;
+}
+
+const bool MappedFileStream::CanSeek()
+{
+	return true;
+}
+
+const bool MappedFileStream::CanWrite()
+{
+	return m_mapState->Writable;
+}
+
+const StreamModes MappedFileStream::Enumeral()
+{
+	return StreamModes::MappedFileStream;
+}
+
+std::string MappedFileStream::FileName()
+{
+	return m_mapState->FileName;
+}
+
+const ulong MappedFileStream::Length()
+{
+	return m_mapState->Length;
+}
+
+const std::string MappedFileStream::Name()
+{
+	return CLASS_NAME;
+}
+
+const ulong MappedFileStream::Position()
+{
+	return m_mapState->Position;
+}
+
+//~~~Public Functions~~~//
+
+void MappedFileStream::Close()
+{
+#if defined(CEX_OS_WINDOWS)
+	if (m_mapState->FileHandle != INVALID_HANDLE_VALUE)
+#else
+	if (m_mapState->FileHandle != -1)
+#endif
+	{
+		Unmap(m_mapState.get());
+
+		// release the reserved capacity of a file that was grown by writing
+		if (m_mapState->Writable && m_mapState->Capacity != m_mapState->Length)
+		{
+			Truncate(m_mapState.get(), m_mapState->Length);
+		}
+
+#if defined(CEX_OS_WINDOWS)
+		CloseHandle(m_mapState->FileHandle);
+		m_mapState->FileHandle = INVALID_HANDLE_VALUE;
+#elif defined(CEX_FILEMAP_POSIX)
+		close(m_mapState->FileHandle);
+		m_mapState->FileHandle = -1;
+#endif
+
+		m_mapState->Capacity = 0;
+		m_mapState->Length = 0;
+		m_mapState->Position = 0;
+	}
+}
+
+void MappedFileStream::CopyTo(IByteStream* Destination)
+{
+	const size_t CPYLEN = 64 * 1024;
+	std::vector<byte> tmpb(CPYLEN);
+	ulong pos;
+
+	pos = 0;
+
+	while (pos != m_mapState->Length)
+	{
+		const size_t RMDLEN = (m_mapState->Length - pos) < CPYLEN ? static_cast<size_t>(m_mapState->Length - pos) : CPYLEN;
+
+		std::memcpy(tmpb.data(), m_mapState->Map + pos, RMDLEN);
+		Destination->Write(tmpb, 0, RMDLEN);
+		pos += RMDLEN;
+	}
+}
+
+void MappedFileStream::Destroy()
+{
+	if (!m_mapState->Destroyed)
+	{
+		m_mapState->Destroyed = true;
+		Close();
+	}
+}
+
+void MappedFileStream::Flush()
+{
+	CEXASSERT(m_mapState->Writable, "File is read only");
+
+	if (m_mapState->Map != nullptr)
+	{
+#if defined(CEX_OS_WINDOWS)
+		FlushViewOfFile(m_mapState->Map, 0);
+		FlushFileBuffers(m_mapState->FileHandle);
+#elif defined(CEX_FILEMAP_POSIX)
+		msync(m_mapState->Map, static_cast<size_t>(m_mapState->Capacity), MS_SYNC);
+#endif
+	}
+}
+
+void MappedFileStream::Prefetch(ulong Offset, size_t Length)
+{
+	if (m_mapState->Map != nullptr && Offset < m_mapState->Capacity)
+	{
+#if defined(CEX_FILEMAP_POSIX)
+		// the advised range must start on a page boundary
+		const ulong PGEOFT = Offset - (Offset % SecureMemory::PageSize());
+		const ulong ENDOFT = (Offset + Length) < m_mapState->Capacity ? (Offset + Length) : m_mapState->Capacity;
+
+		madvise(m_mapState->Map + PGEOFT, static_cast<size_t>(ENDOFT - PGEOFT), MADV_WILLNEED);
+#endif
+	}
+}
+
+size_t MappedFileStream::Read(std::vector<byte> &Output, size_t Offset, size_t Length)
+{
+	CEXASSERT(Offset + Length <= Output.size(), "Output array is too small");
+
+	// a position at or past the end of the stream reads nothing
+	if (m_mapState->Position >= m_mapState->Length)
+	{
+		return 0;
+	}
+
+	if (Length > m_mapState->Length - m_mapState->Position)
+	{
+		Length = static_cast<size_t>(m_mapState->Length - m_mapState->Position);
+	}
+
+	if (Length > 0)
+	{
+		std::memcpy(Output.data() + Offset, m_mapState->Map + m_mapState->Position, Length);
+		m_mapState->Position += Length;
+	}
+
+	return Length;
+}
+
+byte MappedFileStream::ReadByte()
+{
+	byte data;
+
+	if (m_mapState->Position >= m_mapState->Length)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("ReadByte"), std::string("Reached the end of the stream!"), ErrorCodes::BadRead);
+	}
+
+	data = m_mapState->Map[m_mapState->Position];
+	++m_mapState->Position;
+
+	return data;
+}
+
+void MappedFileStream::Reset()
+{
+	m_mapState->Position = 0;
+}
+
+void MappedFileStream::Seek(ulong Offset, SeekOrigin Origin)
+{
+	if (Origin == SeekOrigin::Begin)
+	{
+		m_mapState->Position = Offset;
+	}
+	else if (Origin == SeekOrigin::End)
+	{
+		m_mapState->Position = m_mapState->Length - Offset;
+	}
+	else
+	{
+		m_mapState->Position += Offset;
+	}
+}
+
+void MappedFileStream::SetLength(ulong Length)
+{
+	if (!m_mapState->Writable)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("SetLength"), std::string("The file is read only!"), ErrorCodes::ReadOnly);
+	}
+
+	Resize(m_mapState.get(), Length);
+	m_mapState->Length = Length;
+
+	if (m_mapState->Position > Length)
+	{
+		m_mapState->Position = Length;
+	}
+}
+
+Span<const byte> MappedFileStream::View(ulong Offset, size_t Length)
+{
+	if (Offset > m_mapState->Length || Length > m_mapState->Length - Offset)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("View"), std::string("The view exceeds the stream length!"), ErrorCodes::InvalidSize);
+	}
+
+	return Span<const byte>(m_mapState->Map + Offset, Length);
+}
+
+Span<byte> MappedFileStream::WritableView(ulong Offset, size_t Length)
+{
+	if (!m_mapState->Writable)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("WritableView"), std::string("The file is read only!"), ErrorCodes::ReadOnly);
+	}
+
+	if (Offset + Length > m_mapState->Length)
+	{
+		// remapping invalidates the views already taken, so the mapping is only grown past its capacity
+		if (Offset + Length > m_mapState->Capacity)
+		{
+			Reserve(m_mapState.get(), Offset + Length);
+		}
+
+		m_mapState->Length = Offset + Length;
+	}
+
+	return Span<byte>(m_mapState->Map + Offset, Length);
+}
+
+void MappedFileStream::Write(const std::vector<byte> &Input, size_t Offset, size_t Length)
+{
+	CEXASSERT(Offset + Length <= Input.size(), "Input array is too small");
+
+	if (!m_mapState->Writable)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Write"), std::string("The file is read only!"), ErrorCodes::ReadOnly);
+	}
+
+	if (Length > 0)
+	{
+		if (m_mapState->Position + Length > m_mapState->Capacity)
+		{
+			Reserve(m_mapState.get(), m_mapState->Position + Length);
+		}
+
+		std::memcpy(m_mapState->Map + m_mapState->Position, Input.data() + Offset, Length);
+		m_mapState->Position += Length;
+
+		if (m_mapState->Position > m_mapState->Length)
+		{
+			m_mapState->Length = m_mapState->Position;
+		}
+	}
+}
+
+void MappedFileStream::WriteByte(byte Value)
+{
+	std::vector<byte> tmpv(1, Value);
+
+	Write(tmpv, 0, 1);
+}
+
+//~~~Private Functions~~~//
+
+void MappedFileStream::Map(MappedState* State)
+{
+	bool mapped;
+
+	// an empty file can not be mapped, the first write maps it
+	if (State->Capacity == 0)
+	{
+		return;
+	}
+
+#if defined(CEX_OS_WINDOWS)
+
+	const DWORD PGPROT = State->Writable ? PAGE_READWRITE : PAGE_READONLY;
+	const DWORD MAPACC = State->Writable ? FILE_MAP_WRITE : FILE_MAP_READ;
+
+	State->MapHandle = CreateFileMappingA(State->FileHandle, nullptr, PGPROT, static_cast<DWORD>(State->Capacity >> 32), static_cast<DWORD>(State->Capacity), nullptr);
+	mapped = (State->MapHandle != nullptr);
+
+	if (mapped)
+	{
+		State->Map = static_cast<byte*>(MapViewOfFile(State->MapHandle, MAPACC, 0, 0, static_cast<SIZE_T>(State->Capacity)));
+		mapped = (State->Map != nullptr);
+	}
+
+#elif defined(CEX_FILEMAP_POSIX)
+
+	const int PGPROT = State->Writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+	void* ptr;
+
+	ptr = mmap(nullptr, static_cast<size_t>(State->Capacity), PGPROT, MAP_SHARED, State->FileHandle, 0);
+	mapped = (ptr != MAP_FAILED);
+
+	if (mapped)
+	{
+		State->Map = static_cast<byte*>(ptr);
+		// the streams are read front to back; the kernel can read ahead aggressively and drop pages behind the reader
+		madvise(ptr, static_cast<size_t>(State->Capacity), MADV_SEQUENTIAL);
+	}
+
+#else
+
+	mapped = false;
+
+#endif
+
+	if (!mapped)
+	{
+		State->Map = nullptr;
+		throw CryptoProcessingException(CLASS_NAME, std::string("Map"), std::string("The file could not be mapped!"), ErrorCodes::NoAccess);
+	}
+}
+
+void MappedFileStream::Reserve(MappedState* State, ulong Length)
+{
+	ulong cap;
+
+	// grow in doubling increments, so a file written in small pieces is not remapped on every write
+	cap = State->Capacity != 0 ? State->Capacity : SecureMemory::PageSize();
+
+	while (cap < Length)
+	{
+		cap <<= 1;
+	}
+
+	Resize(State, cap);
+}
+
+void MappedFileStream::Resize(MappedState* State, ulong Length)
+{
+	Unmap(State);
+
+	if (!Truncate(State, Length))
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Resize"), std::string("The file could not be resized!"), ErrorCodes::NoAccess);
+	}
+
+	State->Capacity = Length;
+	Map(State);
+}
+
+bool MappedFileStream::Truncate(MappedState* State, ulong Length)
+{
+	bool res;
+
+#if defined(CEX_OS_WINDOWS)
+
+	LARGE_INTEGER flen;
+
+	flen.QuadPart = static_cast<LONGLONG>(Length);
+	res = (SetFilePointerEx(State->FileHandle, flen, nullptr, FILE_BEGIN) != 0 && SetEndOfFile(State->FileHandle) != 0);
+
+#elif defined(CEX_FILEMAP_POSIX)
+
+	res = (ftruncate(State->FileHandle, static_cast<off_t>(Length)) == 0);
+
+#else
+
+	res = false;
+
+#endif
+
+	return res;
+}
+
+void MappedFileStream::Unmap(MappedState* State)
+{
+	if (State->Map != nullptr)
+	{
+#if defined(CEX_OS_WINDOWS)
+		UnmapViewOfFile(State->Map);
+		CloseHandle(State->MapHandle);
+		State->MapHandle = nullptr;
+#elif defined(CEX_FILEMAP_POSIX)
+		munmap(State->Map, static_cast<size_t>(State->Capacity));
+#endif
+		State->Map = nullptr;
+	}
+}
+
+NAMESPACE_IOEND
@@ -0,0 +1,302 @@
+// The GPL version 3 License (GPLv3)
+//
+// Copyright (c) 2020 vtdev.com
+// This file is part of the CEX Cryptographic library.
+//
+// This program is free software : you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+//
+// Implementation Details:
+// A memory-mapped file stream, with zero-copy views of the mapped file.
+// Contact: develop@vtdev.com
+
+#ifndef CEX_MAPPEDFILESTREAM_H
+#define CEX_MAPPEDFILESTREAM_H
+
+#include "IByteStream.h"
+#include "Span.h"
+
+NAMESPACE_IO
+
+/// <summary>
+/// A memory-mapped file streaming container.
+/// <para>The file is mapped into the address space of the process, and the stream reads and writes copy directly to and from the mapping.
+/// The View and WritableView functions return zero-copy views of the mapped file, that can be passed to the pointer overloads of the cipher, digest, and MAC interfaces.
+/// The CipherStream and DigestStream classes detect a mapped input stream, and transform the file directly out of the mapping.</para>
+/// </summary>
+///
+/// <example>
+/// <description>Hashing a file through a view:</description>
+/// <code>
+/// MappedFileStream fin("C://Tests//archive.bin", MappedFileStream::MappedAccess::Read);
+/// Span&lt;const byte&gt; view = fin.View(0, fin.Length());
+/// SHA256 dgt;
+/// dgt.Update(view.data(), view.size());
+/// dgt.Finalize(hash.data());
+/// </code>
+/// </example>
+///
+/// <remarks>
+/// <description>Implementation Notes:</description>
+/// <list type="bullet">
+/// <item><description>The mapping is created with a sequential access hint; the Prefetch function issues a will-need hint for a range of the file.</description></item>
+/// <item><description>A write past the end of a writable stream grows the file and remaps it; views taken before the file is resized are invalidated.</description></item>
+/// <item><description>The capacity of a growing file is reserved in doubling increments, and the file is truncated to the stream length when the stream is closed.</description></item>
+/// <item><description>The Flush function synchronizes the mapped pages with the file on disk.</description></item>
+/// <item><description>The access hints are not issued on Windows; the file is opened with the sequential scan flag.</description></item>
+/// </list>
+/// </remarks>
+class MappedFileStream final : public IByteStream
+{
+public:
+
+	//~~~Enums~~~//
+
+	/// <summary>
+	/// Mapped file access type flags
+	/// </summary>
+	enum class MappedAccess : byte
+	{
+		/// <summary>
+		/// Map an existing file for read access
+		/// </summary>
+		Read = 1,
+		/// <summary>
+		/// Map an existing file for read and write access
+		/// </summary>
+		ReadWrite = 2,
+		/// <summary>
+		/// Create or truncate a file, set its length, and map it for read and write access
+		/// </summary>
+		Create = 3
+	};
+
+private:
+
+	static const std::string CLASS_NAME;
+
+	class MappedState;
+	std::unique_ptr<MappedState> m_mapState;
+
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	MappedFileStream(const MappedFileStream&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	MappedFileStream& operator=(const MappedFileStream&) = delete;
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	MappedFileStream() = delete;
+
+	/// <summary>
+	/// Constructor: open and map a file
+	/// </summary>
+	///
+	/// <param name="FileName">The full path and name of the file</param>
+	/// <param name="Access">The level of access requested</param>
+	/// <param name="Length">The initial length of the file when the access is Create; ignored by the other access modes</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the file does not exist, or could not be opened or mapped</exception>
+	explicit MappedFileStream(const std::string &FileName, MappedAccess Access = MappedAccess::Read, ulong Length = 0);
+
+	/// <summary>
+	/// Destructor: finalize this class
+	/// </summary>
+	~MappedFileStream() override;
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The file access flags
+	/// </summary>
+	const MappedAccess Access();
+
+	/// <summary>
+	/// Read Only: The stream can be read
+	/// </summary>
+	const bool CanRead() override;
+
+	/// <summary>
+	/// Read Only: The stream is seekable
+	/// </summary>
+	const bool CanSeek() override;
+
+	/// <summary>
+	/// Read Only: The stream can be written to
+	/// </summary>
+	const bool CanWrite() override;
+
+	/// <summary>
+	/// Read Only: The stream container type
+	/// </summary>
+	const StreamModes Enumeral() override;
+
+	/// <summary>
+	/// Read Only: The file name and path
+	/// </summary>
+	std::string FileName();
+
+	/// <summary>
+	/// Read Only: The stream length
+	/// </summary>
+	const ulong Length() override;
+
+	/// <summary>
+	/// Read Only: The streams class name
+	/// </summary>
+	const std::string Name() override;
+
+	/// <summary>
+	/// Read Only: The streams current position
+	/// </summary>
+	const ulong Position() override;
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Unmap and close the file; a file that was grown is truncated to the stream length
+	/// </summary>
+	void Close() override;
+
+	/// <summary>
+	/// Copy this stream to another stream
+	/// </summary>
+	///
+	/// <param name="Destination">The destination stream</param>
+	void CopyTo(IByteStream* Destination) override;
+
+	/// <summary>
+	/// Release all resources associated with the object; optional, called by the finalizer
+	/// </summary>
+	void Destroy() override;
+
+	/// <summary>
+	/// Write the mapped pages to disk
+	/// </summary>
+	void Flush();
+
+	/// <summary>
+	/// Advise the operating system that a range of the file will be accessed soon, so the pages can be read ahead
+	/// </summary>
+	///
+	/// <param name="Offset">The starting offset within the file</param>
+	/// <param name="Length">The number of bytes in the range</param>
+	void Prefetch(ulong Offset, size_t Length);
+
+	/// <summary>
+	/// Copies a portion of the stream into an output buffer
+	/// </summary>
+	///
+	/// <param name="Output">The output array receiving the bytes</param>
+	/// <param name="Offset">Offset within the output array at which to begin</param>
+	/// <param name="Length">The number of bytes to read</param>
+	///
+	/// <returns>The number of bytes read</returns>
+	size_t Read(std::vector<byte> &Output, size_t Offset, size_t Length) override;
+
+	/// <summary>
+	/// Read a single byte from the stream
+	/// </summary>
+	///
+	/// <returns>The read byte value</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the position is at or past the end of the stream</exception>
+	byte ReadByte() override;
+
+	/// <summary>
+	/// Reset and initialize the underlying stream to zero
+	/// </summary>
+	void Reset() override;
+
+	/// <summary>
+	/// Seek to a position within the stream
+	/// </summary>
+	///
+	/// <param name="Offset">The offset position</param>
+	/// <param name="Origin">The starting point</param>
+	void Seek(ulong Offset, SeekOrigin Origin) override;
+
+	/// <summary>
+	/// Set the length of the file, and remap it
+	/// </summary>
+	///
+	/// <param name="Length">The desired length</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the stream is read only, or the file could not be resized</exception>
+	void SetLength(ulong Length) override;
+
+	/// <summary>
+	/// Get a read-only view of a range of the mapped file.
+	/// <para>The view is valid until the file is resized or the stream is closed.</para>
+	/// </summary>
+	///
+	/// <param name="Offset">The starting offset within the file</param>
+	/// <param name="Length">The number of bytes in the view</param>
+	///
+	/// <returns>A span pointing into the mapping</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the range exceeds the stream length</exception>
+	Span<const byte> View(ulong Offset, size_t Length);
+
+	/// <summary>
+	/// Get a writable view of a range of the mapped file; the file is grown if the range exceeds the stream length.
+	/// <para>The view is valid until the file is resized or the stream is closed; the mapping is only remapped when the range exceeds the reserved capacity.</para>
+	/// </summary>
+	///
+	/// <param name="Offset">The starting offset within the file</param>
+	/// <param name="Length">The number of bytes in the view</param>
+	///
+	/// <returns>A span pointing into the mapping</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the stream is read only, or the file could not be resized</exception>
+	Span<byte> WritableView(ulong Offset, size_t Length);
+
+	/// <summary>
+	/// Writes an input buffer to the stream
+	/// </summary>
+	///
+	/// <param name="Input">The input array to write to the stream</param>
+	/// <param name="Offset">Offset within the input array at which to begin</param>
+	/// <param name="Length">The number of bytes to write</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the stream is read only, or the file could not be resized</exception>
+	void Write(const std::vector<byte> &Input, size_t Offset, size_t Length) override;
+
+	/// <summary>
+	/// Write a single byte to the stream
+	/// </summary>
+	///
+	/// <param name="Value">The byte value to write</param>
+	void WriteByte(byte Value) override;
+
+private:
+
+	static void Map(MappedState* State);
+	static void Reserve(MappedState* State, ulong Length);
+	static void Resize(MappedState* State, ulong Length);
+	static bool Truncate(MappedState* State, ulong Length);
+	static void Unmap(MappedState* State);
+};
+
+NAMESPACE_IOEND
+#endif
@@ -16,6 +16,7 @@ public:
 	size_t MaxAlloc;
 	byte* MemPool;
 	size_t MinAlloc;
+	std::mutex PoolLock;
 	size_t PageSize;
 	size_t PoolSize;
 
@@ -32,6 +33,7 @@ public:
 		MinAlloc((MinAlloc <= MaxAlloc) ? 
 			MinAlloc :
 			throw CryptoException(std::string("MemoryPool"), std::string("Constructor"), std::string("MemoryPool min alloc is more than max alloc!"), ErrorCodes::InvalidSize)),
+		PoolLock(),
 		PageSize(PageSize),
 		PoolSize(PoolSize)
 	{
@@ -68,10 +70,10 @@ void* MemoryPool::Allocate(size_t Length)
 {
 	std::vector<std::pair<size_t, size_t>>::iterator best;
 	std::vector<std::pair<size_t, size_t>>::iterator itrl;
-	std::mutex m;
 	void* poolr;
 
-	std::lock_guard<std::mutex> lock(m);
+	// the lock is a member of the pool state; a local mutex would not serialize concurrent callers
+	std::lock_guard<std::mutex> lock(m_poolState->PoolLock);
 	poolr = nullptr;
 
 	if (Length <= m_poolState->PoolSize && Length >= m_poolState->MinAlloc && Length <= m_poolState->MaxAlloc)
@@ -95,6 +97,8 @@ void* MemoryPool::Allocate(size_t Length)
 				}
 
 				poolr = m_poolState->MemPool + FSTOFT;
+				// the iterator is invalidated by the erase
+				break;
 			}
 
 			if (((best == m_poolState->FreeList.end()) || (best->second > itrl->second)) && (itrl->second >= (Length + PadSize(itrl->first, ALNBIT))))
@@ -103,7 +107,7 @@ void* MemoryPool::Allocate(size_t Length)
 			}
 		}
 
-		if (best != m_poolState->FreeList.end())
+		if (poolr == nullptr && best != m_poolState->FreeList.end())
 		{
 			const size_t FSTOFT = best->first;
 			const size_t ALNPAD = PadSize(FSTOFT, ALNBIT);
@@ -141,6 +145,9 @@ void* MemoryPool::Allocate(size_t Length)
 
 void MemoryPool::Reset()
 {
+	std::lock_guard<std::mutex> lock(m_poolState->PoolLock);
+
+	m_poolState->FreeList.clear();
 	Clear(m_poolState->MemPool, 0, m_poolState->PoolSize);
 	m_poolState->FreeList.push_back(std::make_pair(0, m_poolState->PoolSize));
 }
@@ -150,8 +157,7 @@ bool MemoryPool::Deallocate(void* Pointer, size_t Length)
 	bool status;
 	std::vector<std::pair<size_t, size_t>>::iterator itrl;
 	std::vector<std::pair<size_t, size_t>>::iterator prev;
-	std::mutex m;
-	std::lock_guard<std::mutex> lock(m);
+	std::lock_guard<std::mutex> lock(m_poolState->PoolLock);
 
 	status = false;
 
@@ -202,23 +202,18 @@ void OFB::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= m_blockCipher->BlockSize(), "The data arrays are smaller than the block-size!");
 	CEXASSERT(Length % m_blockCipher->BlockSize() == 0, "The length must be evenly divisible by the block ciphers block-size!");
 
-	const size_t BLKLEN = m_blockCipher->BlockSize();
-	size_t i;
-
-	if (Length % BLKLEN != 0)
-	{
-		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("Invalid length, must be evenly divisible by the ciphers block size!"), ErrorCodes::InvalidSize);
-	}
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
 
-	const size_t BLKCNT = Length / BLKLEN;
+void OFB::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(Length % m_blockCipher->BlockSize() == 0, "The length must be evenly divisible by the block ciphers block-size!");
 
-	for (i = 0; i < BLKCNT; ++i)
-	{
-		EncryptBlock(Input, (i * BLKLEN) + InOffset, Output, (i * BLKLEN) + OutOffset);
-	}
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
 }
 
-void OFB::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void OFB::Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	CEXASSERT(m_ofbState->Initialized, "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= m_blockCipher->BlockSize(), "The data arrays are smaller than the block-size!");
@@ -237,4 +232,22 @@ void OFB::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	MemoryTools::Copy(m_ofbState->Buffer, 0, m_ofbState->IV, 0, BLOCK_SIZE);
 }
 
+void OFB::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t BLKLEN = m_blockCipher->BlockSize();
+	size_t i;
+
+	if (Length % BLKLEN != 0)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("Invalid length, must be evenly divisible by the ciphers block size!"), ErrorCodes::InvalidSize);
+	}
+
+	const size_t BLKCNT = Length / BLKLEN;
+
+	for (i = 0; i < BLKCNT; ++i)
+	{
+		Encrypt128(Input, (i * BLKLEN) + InOffset, Output, (i * BLKLEN) + OutOffset);
+	}
+}
+
 NAMESPACE_MODEEND
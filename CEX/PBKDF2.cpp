@@ -2,14 +2,24 @@
 #include "DigestFromName.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
+#include "SHA2.h"
 
 NAMESPACE_KDF
 
 using Enumeration::Digests;
+using Digest::SHA2;
 using Tools::IntegerTools;
 using Enumeration::KdfConvert;
 using Tools::MemoryTools;
 
+#if defined(CEX_HAS_AVX512)
+	using Numeric::UInt512;
+	using Numeric::ULong512;
+#elif defined(CEX_HAS_AVX2)
+	using Numeric::UInt256;
+	using Numeric::ULong256;
+#endif
+
 class PBKDF2::Pbkdf2State
 {
 public:
@@ -19,15 +29,17 @@ public:
 	std::vector<byte> State;
 	uint Iterations;
 	bool IsDestroyed;
+	bool IsDirect;
 	bool IsInitialized;
 
-	Pbkdf2State(size_t StateSize, size_t SaltSize, uint Cycles, bool Destroyed)
+	Pbkdf2State(size_t StateSize, size_t SaltSize, uint Cycles, bool Destroyed, bool Direct)
 		:
 		Counter{ 0x00, 0x00, 0x00, 0x01 },
 		Salt(SaltSize),
 		State(StateSize),
 		Iterations(Cycles),
 		IsDestroyed(Destroyed),
+		IsDirect(Direct),
 		IsInitialized(false)
 	{
 	}
@@ -39,6 +51,7 @@ public:
 		MemoryTools::Clear(Salt, 0, Salt.size());
 		MemoryTools::Clear(State, 0, State.size());
 		IsDestroyed = false;
+		IsDirect = false;
 		IsInitialized = false;
 	}
 
@@ -52,6 +65,193 @@ public:
 	}
 };
 
+class PBKDF2::Pbkdf2Lanes256
+{
+private:
+
+#if defined(CEX_HAS_AVX512)
+	static const size_t WIDE_LANES = 16;
+#elif defined(CEX_HAS_AVX2)
+	static const size_t WIDE_LANES = 8;
+#else
+	static const size_t WIDE_LANES = 1;
+#endif
+
+public:
+
+	typedef std::array<uint, 8> State;
+
+	static const size_t BLOCK_SIZE = SHA2::SHA2256_RATE_SIZE;
+	static const size_t DIGEST_SIZE = SHA2::SHA2256_DIGEST_SIZE;
+	static const size_t LENGTH_SIZE = sizeof(ulong);
+
+	static size_t Lanes()
+	{
+#if defined(CEX_HAS_AVX2)
+		// two interleaved sha-ni permutations are faster than the lanes of the wide permutation
+		return SHA2::HasSHANI() ? 2 : WIDE_LANES;
+#else
+		return WIDE_LANES;
+#endif
+	}
+
+	static void Load(State &Value)
+	{
+		MemoryTools::Copy(SHA2::SHA2256State, 0, Value, 0, Value.size() * sizeof(uint));
+	}
+
+	static void Permute(const std::vector<byte> &Input, size_t InOffset, State &Value)
+	{
+		SHA2::PermuteR64P512(Input, InOffset, Value);
+	}
+
+	static void PermuteW(const std::vector<byte> &Input, std::vector<State> &Values)
+	{
+#if defined(CEX_HAS_AVX512) || defined(CEX_HAS_AVX2)
+
+		if (SHA2::HasSHANI())
+		{
+			SHA2::PermuteR64P2x512V(Input, 0, Values[0], Values[1]);
+			return;
+		}
+
+#	if defined(CEX_HAS_AVX512)
+		std::array<UInt512, 8> wstate;
+#	else
+		std::array<UInt256, 8> wstate;
+#	endif
+		std::array<uint, 8 * WIDE_LANES> tmps;
+		size_t i;
+		size_t j;
+
+		// the wide permutation loads the block at lane offset j into the vector element (WIDE_LANES - 1 - j)
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)] = Values[j][i];
+			}
+		}
+
+		MemoryTools::Copy(tmps, 0, wstate, 0, tmps.size() * sizeof(uint));
+#	if defined(CEX_HAS_AVX512)
+		SHA2::PermuteR64P16x512H(Input, 0, wstate);
+#	else
+		SHA2::PermuteR64P8x512H(Input, 0, wstate);
+#	endif
+		MemoryTools::Copy(wstate, 0, tmps, 0, tmps.size() * sizeof(uint));
+
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				Values[j][i] = tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)];
+			}
+		}
+
+		MemoryTools::Clear(tmps, 0, tmps.size() * sizeof(uint));
+
+#else
+
+		Permute(Input, 0, Values[0]);
+
+#endif
+	}
+
+	static void Store(State &Value, std::vector<byte> &Output, size_t OutOffset)
+	{
+		IntegerTools::BeUL256ToBlock(Value, 0, Output, OutOffset);
+	}
+};
+
+class PBKDF2::Pbkdf2Lanes512
+{
+private:
+
+#if defined(CEX_HAS_AVX512)
+	static const size_t WIDE_LANES = 8;
+#elif defined(CEX_HAS_AVX2)
+	static const size_t WIDE_LANES = 4;
+#else
+	static const size_t WIDE_LANES = 1;
+#endif
+
+public:
+
+	typedef std::array<ulong, 8> State;
+
+	static const size_t BLOCK_SIZE = SHA2::SHA2512_RATE_SIZE;
+	static const size_t DIGEST_SIZE = SHA2::SHA2512_DIGEST_SIZE;
+	static const size_t LENGTH_SIZE = 2 * sizeof(ulong);
+
+	static size_t Lanes()
+	{
+		return WIDE_LANES;
+	}
+
+	static void Load(State &Value)
+	{
+		MemoryTools::Copy(SHA2::SHA2512State, 0, Value, 0, Value.size() * sizeof(ulong));
+	}
+
+	static void Permute(const std::vector<byte> &Input, size_t InOffset, State &Value)
+	{
+		SHA2::PermuteR80P1024(Input, InOffset, Value);
+	}
+
+	static void PermuteW(const std::vector<byte> &Input, std::vector<State> &Values)
+	{
+#if defined(CEX_HAS_AVX512) || defined(CEX_HAS_AVX2)
+
+#	if defined(CEX_HAS_AVX512)
+		std::array<ULong512, 8> wstate;
+#	else
+		std::array<ULong256, 8> wstate;
+#	endif
+		std::array<ulong, 8 * WIDE_LANES> tmps;
+		size_t i;
+		size_t j;
+
+		// the wide permutation loads the block at lane offset j into the vector element (WIDE_LANES - 1 - j)
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)] = Values[j][i];
+			}
+		}
+
+		MemoryTools::Copy(tmps, 0, wstate, 0, tmps.size() * sizeof(ulong));
+#	if defined(CEX_HAS_AVX512)
+		SHA2::PermuteR80P8x1024H(Input, 0, wstate);
+#	else
+		SHA2::PermuteR80P4x1024H(Input, 0, wstate);
+#	endif
+		MemoryTools::Copy(wstate, 0, tmps, 0, tmps.size() * sizeof(ulong));
+
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				Values[j][i] = tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)];
+			}
+		}
+
+		MemoryTools::Clear(tmps, 0, tmps.size() * sizeof(ulong));
+
+#else
+
+		Permute(Input, 0, Values[0]);
+
+#endif
+	}
+
+	static void Store(State &Value, std::vector<byte> &Output, size_t OutOffset)
+	{
+		IntegerTools::BeULL512ToBlock(Value, 0, Output, OutOffset);
+	}
+};
+
 //~~~Constructor~~~//
 
 PBKDF2::PBKDF2(SHA2Digests DigestType, uint Iterations)
@@ -73,7 +273,7 @@ PBKDF2::PBKDF2(SHA2Digests DigestType, uint Iterations)
 			std::vector<SymmetricKeySize>(0))),
 	m_pbkdf2Generator(DigestType != SHA2Digests::None ? new HMAC(DigestType) :
 		throw CryptoKdfException(std::string("PBKDF2"), std::string("Constructor"), std::string("The digest type is not supported!"), ErrorCodes::InvalidParam)),
-	m_pbkdf2State(new Pbkdf2State(0, 0, Iterations, true))
+	m_pbkdf2State(new Pbkdf2State(0, 0, Iterations, true, true))
 {
 }
 
@@ -97,7 +297,7 @@ PBKDF2::PBKDF2(IDigest* Digest, uint Iterations)
 			std::vector<SymmetricKeySize>(0))),
 	m_pbkdf2Generator((Digest != nullptr && (Digest->Enumeral() == Digests::SHA2256 || Digest->Enumeral() == Digests::SHA2512)) ? new HMAC(Digest) :
 		throw CryptoKdfException(std::string("PBKDF2"), std::string("Constructor"), std::string("The digest instance is not supported!"), ErrorCodes::IllegalOperation)),
-	m_pbkdf2State(new Pbkdf2State(0, 0, Iterations, false))
+	m_pbkdf2State(new Pbkdf2State(0, 0, Iterations, false, (Digest != nullptr && Digest->IsParallel() == false)))
 {
 }
 
@@ -199,52 +399,70 @@ void PBKDF2::Generate(SecureVector<byte> &Output, size_t OutOffset, size_t Lengt
 	return Expand(Output, OutOffset, Length, m_pbkdf2State, m_pbkdf2Generator);
 }
 
-void PBKDF2::Initialize(ISymmetricKey &Parameters)
+void PBKDF2::Generate(const std::vector<ISymmetricKey*> &Parameters, std::vector<SecureVector<byte>> &Output, size_t Length)
 {
-#if defined(CEX_ENFORCE_LEGALKEY)
-	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
-	{
-		throw CryptoKdfException(Name(), std::string("Initialize"), std::string("Invalid key size, the key length must be one of the LegalKeySizes in length!"), ErrorCodes::InvalidKey);
-	}
-#else
-	if (Parameters.KeySizes().KeySize() < MinimumKeySize())
+	std::vector<std::unique_ptr<Pbkdf2State>> states(0);
+	std::vector<Pbkdf2State*> jobs(0);
+	std::vector<std::vector<byte>> tmps(0);
+	size_t i;
+
+	if (Length == 0 || Length / m_pbkdf2Generator->TagSize() >= MAXGEN_REQUESTS)
 	{
-		throw CryptoKdfException(Name(), std::string("Initialize"), std::string("Invalid key size, the key length must be at least MinimumKeySize in length!"), ErrorCodes::InvalidKey);
+		throw CryptoKdfException(Name(), std::string("Generate"), std::string("The output length is invalid or exceeds the maximum allowed output!"), ErrorCodes::MaxExceeded);
 	}
-#endif
 
-	if (IsInitialized() == true)
+	// each password is expanded from a new state; the key and counter of this instance are not used
+	for (i = 0; i < Parameters.size(); ++i)
 	{
-		Reset();
+		if (Parameters[i] == nullptr)
+		{
+			throw CryptoKdfException(Name(), std::string("Generate"), std::string("The key container can not be null!"), ErrorCodes::InvalidKey);
+		}
+
+		states.push_back(std::unique_ptr<Pbkdf2State>(new Pbkdf2State(0, 0, m_pbkdf2State->Iterations, false, m_pbkdf2State->IsDirect)));
+		Load(*Parameters[i], states[i]);
+		jobs.push_back(states[i].get());
 	}
 
-	// add the key to the state
-	m_pbkdf2State->State.resize(Parameters.KeySizes().KeySize());
-	MemoryTools::Copy(Parameters.Key(), 0, m_pbkdf2State->State, 0, m_pbkdf2State->State.size());
+	Output.resize(Parameters.size());
 
-	if (Parameters.KeySizes().IVSize() + Parameters.KeySizes().InfoSize() != 0)
+	if (m_pbkdf2State->IsDirect)
 	{
-		if (Parameters.KeySizes().IVSize() + Parameters.KeySizes().InfoSize() < MinimumSaltSize())
+		if (m_pbkdf2Generator->TagSize() == SHA2::SHA2256_DIGEST_SIZE)
 		{
-			throw CryptoKdfException(Name(), std::string("Initialize"), std::string("Salt value is too small, must be at least 4 bytes in length!"), ErrorCodes::InvalidSalt);
+			ExpandW<Pbkdf2Lanes256>(jobs, tmps, Length);
 		}
-
-		// resize the salt
-		m_pbkdf2State->Salt.resize(Parameters.KeySizes().IVSize() + Parameters.KeySizes().InfoSize());
-
-		// add the nonce param
-		if (Parameters.KeySizes().IVSize() != 0)
+		else
 		{
-			MemoryTools::Copy(Parameters.IV(), 0, m_pbkdf2State->Salt, 0, m_pbkdf2State->Salt.size());
+			ExpandW<Pbkdf2Lanes512>(jobs, tmps, Length);
 		}
 
-		// add info as extension of salt
-		if (Parameters.KeySizes().InfoSize() > 0)
+		for (i = 0; i < tmps.size(); ++i)
 		{
-			MemoryTools::Copy(Parameters.Info(), 0, m_pbkdf2State->Salt, Parameters.KeySizes().IVSize(), Parameters.KeySizes().InfoSize());
+			Output[i].resize(Length);
+			SecureMove(tmps[i], 0, Output[i], 0, Length);
 		}
 	}
+	else
+	{
+		for (i = 0; i < states.size(); ++i)
+		{
+			Output[i].resize(Length);
+			Expand(Output[i], 0, Length, states[i], m_pbkdf2Generator);
+		}
+
+		m_pbkdf2Generator->Reset();
+	}
+}
 
+void PBKDF2::Initialize(ISymmetricKey &Parameters)
+{
+	if (IsInitialized() == true)
+	{
+		Reset();
+	}
+
+	Load(Parameters, m_pbkdf2State);
 	m_pbkdf2State->IsInitialized = true;
 }
 
@@ -259,44 +477,332 @@ void PBKDF2::Reset()
 
 void PBKDF2::Expand(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::unique_ptr<Pbkdf2State> &State, std::unique_ptr<HMAC> &Generator)
 {
-	std::vector<byte> tmps(Generator->TagSize());
-	size_t i;
+	if (State->IsDirect)
+	{
+		std::vector<Pbkdf2State*> jobs{ State.get() };
+		std::vector<std::vector<byte>> tmps(0);
 
-	do
+		if (Generator->TagSize() == SHA2::SHA2256_DIGEST_SIZE)
+		{
+			ExpandW<Pbkdf2Lanes256>(jobs, tmps, Length);
+		}
+		else
+		{
+			ExpandW<Pbkdf2Lanes512>(jobs, tmps, Length);
+		}
+
+		MemoryTools::Copy(tmps[0], 0, Output, OutOffset, Length);
+		MemoryTools::Clear(tmps[0], 0, tmps[0].size());
+	}
+	else
 	{
-		const size_t PRCRMD = IntegerTools::Min(Generator->TagSize(), Length);
+		std::vector<byte> tmps(Generator->TagSize());
 		SymmetricKey kp(State->State);
+		size_t i;
+
+		// the mac caches the keyed pad states, and returns to the keyed state after each finalize
 		Generator->Initialize(kp);
-		// update the mac with the salt
-		Generator->Update(State->Salt, 0, State->Salt.size());
-		// update the counter
-		Generator->Update(State->Counter, 0, sizeof(uint));
-		// store in temp state
-		Generator->Finalize(tmps, 0);
-		MemoryTools::Copy(tmps, 0, Output, OutOffset, PRCRMD);
-
-		for (i = 1; i != State->Iterations; ++i)
+
+		do
 		{
-			// mac previous state
-			Generator->Initialize(kp);
-			Generator->Update(tmps, 0, tmps.size());
+			const size_t PRCRMD = IntegerTools::Min(Generator->TagSize(), Length);
+			// update the mac with the salt
+			Generator->Update(State->Salt, 0, State->Salt.size());
+			// update the counter
+			Generator->Update(State->Counter, 0, sizeof(uint));
+			// store in temp state
 			Generator->Finalize(tmps, 0);
-			// xor tmp with output
-			MemoryTools::XOR(tmps, 0, Output, OutOffset, PRCRMD);
-		}
-
-		Length -= PRCRMD;
-		OutOffset += PRCRMD;
-		IntegerTools::BeIncrement8(State->Counter, 0, sizeof(uint));
-	} 
-	while (Length != 0);
+			MemoryTools::Copy(tmps, 0, Output, OutOffset, PRCRMD);
+
+			for (i = 1; i < State->Iterations; ++i)
+			{
+				// mac previous state
+				Generator->Update(tmps, 0, tmps.size());
+				Generator->Finalize(tmps, 0);
+				// xor tmp with output
+				MemoryTools::XOR(tmps, 0, Output, OutOffset, PRCRMD);
+			}
+
+			Length -= PRCRMD;
+			OutOffset += PRCRMD;
+			IntegerTools::BeIncrement8(State->Counter, 0, sizeof(uint));
+		} 
+		while (Length != 0);
+
+		MemoryTools::Clear(tmps, 0, tmps.size());
+	}
 }
 
 void PBKDF2::Expand(SecureVector<byte> &Output, size_t OutOffset, size_t Length, std::unique_ptr<Pbkdf2State> &State, std::unique_ptr<HMAC> &Generator)
 {
 	std::vector<byte> tmps(Length);
-	Expand(tmps, OutOffset, Length, State, Generator);
+	Expand(tmps, 0, Length, State, Generator);
 	SecureMove(tmps, 0, Output, OutOffset, tmps.size());
 }
 
+template<class TLanes>
+void PBKDF2::ExpandW(std::vector<Pbkdf2State*> &States, std::vector<std::vector<byte>> &Output, size_t Length)
+{
+	typedef typename TLanes::State StateT;
+
+	const size_t BLKCNT = (Length + TLanes::DIGEST_SIZE - 1) / TLanes::DIGEST_SIZE;
+	const size_t JOBCNT = States.size() * BLKCNT;
+	const size_t LNECNT = TLanes::Lanes();
+	const uint ITRCNT = States.size() != 0 ? States[0]->Iterations : 0;
+	std::vector<StateT> inner(JOBCNT);
+	std::vector<StateT> outer(JOBCNT);
+	std::vector<StateT> lanes(LNECNT);
+	std::vector<byte> codes(JOBCNT * TLanes::DIGEST_SIZE);
+	std::vector<byte> sums(JOBCNT * TLanes::DIGEST_SIZE);
+	std::vector<byte> blocks(LNECNT * TLanes::BLOCK_SIZE);
+	std::vector<byte> msg(0);
+	StateT istate;
+	StateT ostate;
+	size_t i;
+	size_t j;
+	uint k;
+
+	// the keyed pad states of each password, and the first code of each block: U1 = PRF(Password, Salt || INT(i))
+	for (i = 0; i < States.size(); ++i)
+	{
+		Pbkdf2State* pstate = States[i];
+
+		Keyed<TLanes>(pstate->State, istate, ostate);
+		msg.resize(pstate->Salt.size() + sizeof(uint));
+		MemoryTools::Copy(pstate->Salt, 0, msg, 0, pstate->Salt.size());
+
+		for (j = 0; j < BLKCNT; ++j)
+		{
+			const size_t JOBIDX = (i * BLKCNT) + j;
+
+			inner[JOBIDX] = istate;
+			outer[JOBIDX] = ostate;
+			MemoryTools::Copy(pstate->Counter, 0, msg, pstate->Salt.size(), sizeof(uint));
+			Mac<TLanes>(istate, ostate, msg, codes, JOBIDX * TLanes::DIGEST_SIZE);
+			IntegerTools::BeIncrement8(pstate->Counter, 0, sizeof(uint));
+		}
+	}
+
+	MemoryTools::Copy(codes, 0, sums, 0, codes.size());
+
+	// the remaining iterations; each lane of the wide permutation chains the codes of one output block
+	for (i = 0; i < JOBCNT; i += LNECNT)
+	{
+		const size_t ACTCNT = IntegerTools::Min(LNECNT, JOBCNT - i);
+
+		// the message block of an iteration is a single code; the padding and bit length never change
+		MemoryTools::Clear(blocks, 0, blocks.size());
+
+		for (j = 0; j < LNECNT; ++j)
+		{
+			Pad<TLanes>(blocks, j * TLanes::BLOCK_SIZE);
+		}
+
+		// a mostly empty vector is slower than the sequential permutation
+		if (LNECNT > 1 && ACTCNT > 1 && ACTCNT * 2 >= LNECNT)
+		{
+			for (j = 0; j < LNECNT; ++j)
+			{
+				const size_t JOBIDX = i + IntegerTools::Min(j, ACTCNT - 1);
+
+				MemoryTools::Copy(codes, JOBIDX * TLanes::DIGEST_SIZE, blocks, j * TLanes::BLOCK_SIZE, TLanes::DIGEST_SIZE);
+			}
+
+			for (k = 1; k < ITRCNT; ++k)
+			{
+				for (j = 0; j < LNECNT; ++j)
+				{
+					lanes[j] = inner[i + IntegerTools::Min(j, ACTCNT - 1)];
+				}
+
+				TLanes::PermuteW(blocks, lanes);
+
+				for (j = 0; j < LNECNT; ++j)
+				{
+					TLanes::Store(lanes[j], blocks, j * TLanes::BLOCK_SIZE);
+					lanes[j] = outer[i + IntegerTools::Min(j, ACTCNT - 1)];
+				}
+
+				TLanes::PermuteW(blocks, lanes);
+
+				for (j = 0; j < LNECNT; ++j)
+				{
+					TLanes::Store(lanes[j], blocks, j * TLanes::BLOCK_SIZE);
+				}
+
+				for (j = 0; j < ACTCNT; ++j)
+				{
+					MemoryTools::XOR(blocks, j * TLanes::BLOCK_SIZE, sums, (i + j) * TLanes::DIGEST_SIZE, TLanes::DIGEST_SIZE);
+				}
+			}
+		}
+		else
+		{
+			for (j = 0; j < ACTCNT; ++j)
+			{
+				const size_t JOBIDX = i + j;
+
+				MemoryTools::Copy(codes, JOBIDX * TLanes::DIGEST_SIZE, blocks, 0, TLanes::DIGEST_SIZE);
+
+				for (k = 1; k < ITRCNT; ++k)
+				{
+					lanes[0] = inner[JOBIDX];
+					TLanes::Permute(blocks, 0, lanes[0]);
+					TLanes::Store(lanes[0], blocks, 0);
+					lanes[0] = outer[JOBIDX];
+					TLanes::Permute(blocks, 0, lanes[0]);
+					TLanes::Store(lanes[0], blocks, 0);
+					MemoryTools::XOR(blocks, 0, sums, JOBIDX * TLanes::DIGEST_SIZE, TLanes::DIGEST_SIZE);
+				}
+			}
+		}
+	}
+
+	// the blocks of a password are contiguous in the sums
+	Output.resize(States.size());
+
+	for (i = 0; i < States.size(); ++i)
+	{
+		Output[i].resize(Length);
+		MemoryTools::Copy(sums, i * BLKCNT * TLanes::DIGEST_SIZE, Output[i], 0, Length);
+	}
+
+	MemoryTools::Clear(istate, 0, istate.size() * sizeof(istate[0]));
+	MemoryTools::Clear(ostate, 0, ostate.size() * sizeof(ostate[0]));
+
+	for (i = 0; i < JOBCNT; ++i)
+	{
+		MemoryTools::Clear(inner[i], 0, inner[i].size() * sizeof(inner[i][0]));
+		MemoryTools::Clear(outer[i], 0, outer[i].size() * sizeof(outer[i][0]));
+	}
+
+	for (i = 0; i < LNECNT; ++i)
+	{
+		MemoryTools::Clear(lanes[i], 0, lanes[i].size() * sizeof(lanes[i][0]));
+	}
+
+	MemoryTools::Clear(codes, 0, codes.size());
+	MemoryTools::Clear(sums, 0, sums.size());
+	MemoryTools::Clear(blocks, 0, blocks.size());
+}
+
+template<class TLanes>
+void PBKDF2::Hash(typename TLanes::State &Value, const std::vector<byte> &Input, size_t Prefix)
+{
+	const size_t BLKCNT = Input.size() / TLanes::BLOCK_SIZE;
+	const size_t RMDLEN = Input.size() - (BLKCNT * TLanes::BLOCK_SIZE);
+	std::vector<byte> blk(2 * TLanes::BLOCK_SIZE, 0x00);
+	size_t fnlcnt;
+	size_t i;
+
+	for (i = 0; i < BLKCNT; ++i)
+	{
+		TLanes::Permute(Input, i * TLanes::BLOCK_SIZE, Value);
+	}
+
+	// the remainder, the 0x80 pad byte, and the bit length of the prefix and message
+	MemoryTools::Copy(Input, BLKCNT * TLanes::BLOCK_SIZE, blk, 0, RMDLEN);
+	blk[RMDLEN] = 0x80;
+	fnlcnt = (RMDLEN + 1 + TLanes::LENGTH_SIZE > TLanes::BLOCK_SIZE) ? 2 : 1;
+	IntegerTools::Be64ToBytes(static_cast<ulong>(Prefix + Input.size()) << 3, blk, (fnlcnt * TLanes::BLOCK_SIZE) - sizeof(ulong));
+
+	for (i = 0; i < fnlcnt; ++i)
+	{
+		TLanes::Permute(blk, i * TLanes::BLOCK_SIZE, Value);
+	}
+
+	MemoryTools::Clear(blk, 0, blk.size());
+}
+
+template<class TLanes>
+void PBKDF2::Keyed(const std::vector<byte> &Key, typename TLanes::State &Inner, typename TLanes::State &Outer)
+{
+	std::vector<byte> pad(TLanes::BLOCK_SIZE, 0x00);
+
+	// keys longer than the block size are replaced by their hash
+	if (Key.size() > TLanes::BLOCK_SIZE)
+	{
+		TLanes::Load(Inner);
+		Hash<TLanes>(Inner, Key, 0);
+		TLanes::Store(Inner, pad, 0);
+	}
+	else
+	{
+		MemoryTools::Copy(Key, 0, pad, 0, Key.size());
+	}
+
+	MemoryTools::XorPad(pad, IPAD);
+	TLanes::Load(Inner);
+	TLanes::Permute(pad, 0, Inner);
+	MemoryTools::XorPad(pad, IPAD ^ OPAD);
+	TLanes::Load(Outer);
+	TLanes::Permute(pad, 0, Outer);
+	MemoryTools::Clear(pad, 0, pad.size());
+}
+
+template<class TLanes>
+void PBKDF2::Mac(const typename TLanes::State &Inner, const typename TLanes::State &Outer, const std::vector<byte> &Input, std::vector<byte> &Output, size_t OutOffset)
+{
+	typename TLanes::State tmph = Inner;
+	std::vector<byte> code(TLanes::DIGEST_SIZE);
+
+	Hash<TLanes>(tmph, Input, TLanes::BLOCK_SIZE);
+	TLanes::Store(tmph, code, 0);
+	tmph = Outer;
+	Hash<TLanes>(tmph, code, TLanes::BLOCK_SIZE);
+	TLanes::Store(tmph, Output, OutOffset);
+	MemoryTools::Clear(tmph, 0, tmph.size() * sizeof(tmph[0]));
+	MemoryTools::Clear(code, 0, code.size());
+}
+
+template<class TLanes>
+void PBKDF2::Pad(std::vector<byte> &Output, size_t OutOffset)
+{
+	// an iteration hashes the pad block and one code
+	Output[OutOffset + TLanes::DIGEST_SIZE] = 0x80;
+	IntegerTools::Be64ToBytes(static_cast<ulong>(TLanes::BLOCK_SIZE + TLanes::DIGEST_SIZE) << 3, Output, OutOffset + TLanes::BLOCK_SIZE - sizeof(ulong));
+}
+
+void PBKDF2::Load(ISymmetricKey &Parameters, std::unique_ptr<Pbkdf2State> &State)
+{
+#if defined(CEX_ENFORCE_LEGALKEY)
+	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	{
+		throw CryptoKdfException(Name(), std::string("Initialize"), std::string("Invalid key size, the key length must be one of the LegalKeySizes in length!"), ErrorCodes::InvalidKey);
+	}
+#else
+	if (Parameters.KeySizes().KeySize() < MinimumKeySize())
+	{
+		throw CryptoKdfException(Name(), std::string("Initialize"), std::string("Invalid key size, the key length must be at least MinimumKeySize in length!"), ErrorCodes::InvalidKey);
+	}
+#endif
+
+	// add the key to the state
+	State->State.resize(Parameters.KeySizes().KeySize());
+	MemoryTools::Copy(Parameters.Key(), 0, State->State, 0, State->State.size());
+
+	if (Parameters.KeySizes().IVSize() + Parameters.KeySizes().InfoSize() != 0)
+	{
+		if (Parameters.KeySizes().IVSize() + Parameters.KeySizes().InfoSize() < MinimumSaltSize())
+		{
+			throw CryptoKdfException(Name(), std::string("Initialize"), std::string("Salt value is too small, must be at least 4 bytes in length!"), ErrorCodes::InvalidSalt);
+		}
+
+		// resize the salt
+		State->Salt.resize(Parameters.KeySizes().IVSize() + Parameters.KeySizes().InfoSize());
+
+		// add the nonce param
+		if (Parameters.KeySizes().IVSize() != 0)
+		{
+			MemoryTools::Copy(Parameters.IV(), 0, State->Salt, 0, Parameters.KeySizes().IVSize());
+		}
+
+		// add info as extension of salt
+		if (Parameters.KeySizes().InfoSize() > 0)
+		{
+			MemoryTools::Copy(Parameters.Info(), 0, State->Salt, Parameters.KeySizes().IVSize(), Parameters.KeySizes().InfoSize());
+		}
+	}
+}
+
 NAMESPACE_KDFEND
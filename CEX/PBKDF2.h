@@ -84,6 +84,7 @@ using Enumeration::SHA2Digests;
 /// <item><description>The use of a salt value can strongly mitigate some attack vectors targeting the passphrase, and is highly recommended with PBKDF2.</description></item>
 /// <item><description>The minimum salt size is 4 bytes, however larger pseudo-random salt values are more secure.</description></item>
 /// <item><description>The default iterations count is 10000, larger values are recommended for secure server-side password hashing e.g. +20000.</description></item>
+/// <item><description>With a sequential SHA2 digest, the HMAC pad states are computed once per password, and each iteration is two SHA2 permutations of a single block; the output blocks of a request, or the passwords of a batch Generate call, are processed in the lanes of the AVX2/AVX512 wide permutation, or in pairs of interleaved SHA-NI permutations when the processor supports them (SHA2-256).</description></item>
 /// </list>
 /// 
 /// <description><B>Guiding Publications:</B></description>
@@ -106,7 +107,11 @@ private:
 #endif
 	static const size_t MINKEY_LENGTH = 4;
 	static const size_t MINSALT_LENGTH = 4;
+	static const byte IPAD = 0x36;
+	static const byte OPAD = 0x5C;
 
+	class Pbkdf2Lanes256;
+	class Pbkdf2Lanes512;
 	class Pbkdf2State;
 	std::unique_ptr<HMAC> m_pbkdf2Generator;
 	std::unique_ptr<Pbkdf2State> m_pbkdf2State;
@@ -209,6 +214,20 @@ public:
 	/// <exception cref="CryptoKdfException">Thrown if the maximum request size is exceeded</exception>
 	void Generate(SecureVector<byte> &Output, size_t Offset, size_t Length) override;
 
+	/// <summary>
+	/// Derive a key from each password in a batch of passwords.
+	/// <para>Each key container holds a password and its salt (the nonce and info), loaded as they are by the Initialize function; the iterations count of this generator is applied to every password.
+	/// The output of each password is the same as that of a generator initialized with its key container; the key and counter of this generator are not used or changed.
+	/// The iterations of every output block are computed in the lanes of the wide SHA2 permutation.</para>
+	/// </summary>
+	/// 
+	/// <param name="Parameters">The symmetric key containers, one for each password</param>
+	/// <param name="Output">The derived keys, in the order of the key containers; resized to the number of passwords and the output length</param>
+	/// <param name="Length">The number of bytes to derive for each password</param>
+	/// 
+	/// <exception cref="CryptoKdfException">Thrown if a key value is not a legal size, or the maximum request size is exceeded</exception>
+	void Generate(const std::vector<ISymmetricKey*> &Parameters, std::vector<SecureVector<byte>> &Output, size_t Length);
+
 	/// <summary>
 	/// Initialize the generator with a SymmetricKey or SecureSymmetricKey; containing the key, and optional salt, and info string
 	/// </summary>
@@ -227,6 +246,17 @@ private:
 
 	static void Expand(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::unique_ptr<Pbkdf2State> &State, std::unique_ptr<HMAC> &Generator);
 	static void Expand(SecureVector<byte> &Output, size_t OutOffset, size_t Length, std::unique_ptr<Pbkdf2State> &State, std::unique_ptr<HMAC> &Generator);
+	template<class TLanes>
+	static void ExpandW(std::vector<Pbkdf2State*> &States, std::vector<std::vector<byte>> &Output, size_t Length);
+	template<class TLanes>
+	static void Hash(typename TLanes::State &Value, const std::vector<byte> &Input, size_t Prefix);
+	template<class TLanes>
+	static void Keyed(const std::vector<byte> &Key, typename TLanes::State &Inner, typename TLanes::State &Outer);
+	void Load(ISymmetricKey &Parameters, std::unique_ptr<Pbkdf2State> &State);
+	template<class TLanes>
+	static void Mac(const typename TLanes::State &Inner, const typename TLanes::State &Outer, const std::vector<byte> &Input, std::vector<byte> &Output, size_t OutOffset);
+	template<class TLanes>
+	static void Pad(std::vector<byte> &Output, size_t OutOffset);
 };
 
 NAMESPACE_KDFEND
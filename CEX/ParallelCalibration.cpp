@@ -0,0 +1,395 @@
+#include "ParallelCalibration.h"
+#include "ACS.h"
+#include "Blake256.h"
+#include "Blake512.h"
+#include "CBC.h"
+#include "CpuDetect.h"
+#include "CSX256.h"
+#include "CTR.h"
+#include "ECB.h"
+#include "ICM.h"
+#include "ParallelTools.h"
+#include "RCS.h"
+#include "SHA2256.h"
+#include "SHA2512.h"
+#include "SHA3256.h"
+#include "SHA3512.h"
+#include "SymmetricKey.h"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+NAMESPACE_ROOT
+
+using Enumeration::BlockCiphers;
+using Cipher::Block::Mode::CBC;
+using Cipher::Block::Mode::CTR;
+using Cipher::Block::Mode::ECB;
+using Cipher::Block::Mode::ICM;
+using Cipher::Stream::ACS;
+using Cipher::Stream::CSX256;
+using Cipher::Stream::RCS;
+using Digest::Blake256;
+using Digest::Blake512;
+using Enumeration::ErrorCodes;
+using Tools::ParallelTools;
+using Digest::SHA2256;
+using Digest::SHA2512;
+using Digest::SHA3256;
+using Digest::SHA3512;
+using Cipher::SymmetricKey;
+using Cipher::SymmetricKeySize;
+
+const std::string ParallelCalibration::CLASS_NAME("ParallelCalibration");
+const std::string ParallelCalibration::PROFILE_HEADER("CEX-PARALLEL-PROFILE");
+
+//~~~Public Functions~~~//
+
+void ParallelCalibration::Calibrate()
+{
+	CTR ctr(BlockCiphers::AES);
+	Calibrate(&ctr, true);
+	ICM icm(BlockCiphers::AES);
+	Calibrate(&icm, true);
+	ECB ecb(BlockCiphers::AES);
+	Calibrate(&ecb, true);
+	// only cbc decryption is parallelized
+	CBC cbc(BlockCiphers::AES);
+	Calibrate(&cbc, false);
+
+	RCS rcs(false);
+	Calibrate(&rcs);
+	ACS acs(false);
+	Calibrate(&acs);
+	CSX256 csx(false);
+	Calibrate(&csx);
+
+	// the digests throw if constructed in parallel mode on a single core host
+	if (ParallelTools::ProcessorCount() > 1)
+	{
+		SHA2256 sha2256(true);
+		Calibrate(&sha2256);
+		SHA2512 sha2512(true);
+		Calibrate(&sha2512);
+		SHA3256 sha3256(true);
+		Calibrate(&sha3256);
+		SHA3512 sha3512(true);
+		Calibrate(&sha3512);
+		Blake256 blk256(true);
+		Calibrate(&blk256);
+		Blake512 blk512(true);
+		Calibrate(&blk512);
+	}
+}
+
+size_t ParallelCalibration::Calibrate(ICipherMode* Cipher, bool Encryption)
+{
+	size_t blklen;
+
+	if (Cipher == nullptr)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), std::string("The cipher can not be null!"), ErrorCodes::IllegalOperation);
+	}
+
+	blklen = 0;
+
+	if (Cipher->ParallelProfile().IsParallel())
+	{
+		SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		SymmetricKey kp(std::vector<byte>(ks.KeySize(), 0x00), std::vector<byte>(ks.IVSize(), 0x00), std::vector<byte>(ks.InfoSize(), 0x00));
+
+		blklen = Tune(Cipher->ParallelProfile(), [Cipher, Encryption, &kp]()
+		{
+			Cipher->Initialize(Encryption, kp);
+		},
+		[Cipher](const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length)
+		{
+			Cipher->Transform(Input, 0, Output, 0, Length);
+		}, true);
+
+		Set(Cipher->Name(), Cipher->ParallelProfile().ParallelMaxDegree(), blklen);
+	}
+
+	return blklen;
+}
+
+size_t ParallelCalibration::Calibrate(IStreamCipher* Cipher)
+{
+	size_t blklen;
+
+	if (Cipher == nullptr)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), std::string("The cipher can not be null!"), ErrorCodes::IllegalOperation);
+	}
+
+	blklen = 0;
+
+	if (Cipher->ParallelProfile().IsParallel())
+	{
+		SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		SymmetricKey kp(std::vector<byte>(ks.KeySize(), 0x00), std::vector<byte>(ks.IVSize(), 0x00), std::vector<byte>(ks.InfoSize(), 0x00));
+
+		blklen = Tune(Cipher->ParallelProfile(), [Cipher, &kp]()
+		{
+			Cipher->Initialize(true, kp);
+		},
+		[Cipher](const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length)
+		{
+			Cipher->Transform(Input, 0, Output, 0, Length);
+		}, true);
+
+		Set(Cipher->Name(), Cipher->ParallelProfile().ParallelMaxDegree(), blklen);
+	}
+
+	return blklen;
+}
+
+size_t ParallelCalibration::Calibrate(IDigest* Digest)
+{
+	size_t blklen;
+
+	if (Digest == nullptr)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Calibrate"), std::string("The digest can not be null!"), ErrorCodes::IllegalOperation);
+	}
+
+	blklen = 0;
+
+	if (Digest->IsParallel())
+	{
+		blklen = Tune(Digest->ParallelProfile(), [Digest]()
+		{
+			Digest->Reset();
+		},
+		[Digest](const std::vector<byte> &Input, std::vector<byte> &Output, size_t Length)
+		{
+			Digest->Update(Input, 0, Length);
+		}, false);
+
+		Digest->Reset();
+		Set(Digest->Name(), Digest->ParallelProfile().ParallelMaxDegree(), blklen);
+	}
+
+	return blklen;
+}
+
+void ParallelCalibration::Clear()
+{
+	std::lock_guard<std::mutex> lock(ProfileLock());
+
+	ProfileTable().clear();
+}
+
+bool ParallelCalibration::Load(const std::string &Path)
+{
+	std::ifstream ifs(Path.c_str());
+	std::map<std::string, std::pair<size_t, size_t>> tmpt;
+	std::string host;
+	std::string line;
+	std::string name;
+	size_t blklen;
+	size_t degree;
+	bool res;
+
+	res = false;
+
+	if (ifs.is_open() && std::getline(ifs, line) && line == PROFILE_HEADER && std::getline(ifs, host) && host == HostProfile())
+	{
+		res = true;
+
+		while (std::getline(ifs, line))
+		{
+			std::istringstream iss(line);
+
+			if (iss >> name >> degree >> blklen)
+			{
+				tmpt[name] = std::pair<size_t, size_t>(degree, blklen);
+			}
+			else if (!line.empty())
+			{
+				// a damaged profile is discarded
+				res = false;
+				break;
+			}
+			else
+			{
+				// misra
+			}
+		}
+
+		if (res == true)
+		{
+			std::lock_guard<std::mutex> lock(ProfileLock());
+
+			for (auto &ent : tmpt)
+			{
+				ProfileTable()[ent.first] = ent.second;
+			}
+		}
+	}
+
+	return res;
+}
+
+void ParallelCalibration::Save(const std::string &Path)
+{
+	std::ofstream ofs(Path.c_str(), std::ofstream::out | std::ofstream::trunc);
+
+	if (!ofs.is_open())
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Save"), std::string("The profile file could not be created!"), ErrorCodes::InvalidParam);
+	}
+
+	ofs << PROFILE_HEADER << std::endl;
+	ofs << HostProfile() << std::endl;
+
+	{
+		std::lock_guard<std::mutex> lock(ProfileLock());
+
+		for (auto &ent : ProfileTable())
+		{
+			ofs << ent.first << " " << ent.second.first << " " << ent.second.second << std::endl;
+		}
+	}
+
+	if (!ofs.good())
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Save"), std::string("The profile file could not be written!"), ErrorCodes::InvalidParam);
+	}
+}
+
+void ParallelCalibration::Set(const std::string &Name, size_t MaxDegree, size_t ParallelBlockSize)
+{
+	std::lock_guard<std::mutex> lock(ProfileLock());
+
+	ProfileTable()[Name] = std::pair<size_t, size_t>(MaxDegree, ParallelBlockSize);
+}
+
+bool ParallelCalibration::TryGet(const std::string &Name, size_t MaxDegree, size_t &ParallelBlockSize)
+{
+	std::lock_guard<std::mutex> lock(ProfileLock());
+	bool res;
+
+	res = false;
+
+	if (!ProfileTable().empty())
+	{
+		auto ent = ProfileTable().find(Name);
+
+		if (ent != ProfileTable().end() && ent->second.first == MaxDegree)
+		{
+			ParallelBlockSize = ent->second.second;
+			res = true;
+		}
+	}
+
+	return res;
+}
+
+//~~~Private Functions~~~//
+
+std::string ParallelCalibration::HostProfile()
+{
+	CpuDetect dtc;
+	std::ostringstream oss;
+
+	oss << "host " << dtc.PhysicalCores() << " " << CpuDetect::AvailableCores() << " " << dtc.L1DataCacheTotal() << " " << (dtc.AVX512F() ? 512 : dtc.AVX2() ? 256 : dtc.AVX() ? 128 : 0);
+
+	return oss.str();
+}
+
+std::mutex &ParallelCalibration::ProfileLock()
+{
+	static std::mutex lock;
+
+	return lock;
+}
+
+std::map<std::string, std::pair<size_t, size_t>> &ParallelCalibration::ProfileTable()
+{
+	// the process-wide profile: name -> (max degree, parallel block size)
+	static std::map<std::string, std::pair<size_t, size_t>> table;
+
+	return table;
+}
+
+double ParallelCalibration::Throughput(const std::function<void()> &Operation, size_t Length)
+{
+	const std::chrono::high_resolution_clock::time_point START = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> elapsed;
+	size_t bctr;
+
+	bctr = 0;
+
+	do
+	{
+		Operation();
+		bctr += Length;
+		elapsed = std::chrono::high_resolution_clock::now() - START;
+	}
+	while (elapsed.count() * 1000.0 < static_cast<double>(MIN_SAMPLEMS));
+
+	return static_cast<double>(bctr) / elapsed.count();
+}
+
+size_t ParallelCalibration::Tune(ParallelOptions &Profile, const std::function<void()> &Initialize, const std::function<void(const std::vector<byte>&, std::vector<byte>&, size_t)> &Process, bool Crossover)
+{
+	const size_t MAXLEN = (Profile.ParallelMaximumSize() < MAX_CALSIZE) ? Profile.ParallelMaximumSize() : MAX_CALSIZE;
+	const size_t MINLEN = Profile.ParallelMinimumSize();
+	std::vector<byte> inp(MAXLEN > MINLEN ? MAXLEN : MINLEN, 0x00);
+	std::vector<byte> otp(inp.size());
+	double bstrte;
+	double prlrte;
+	double seqrte;
+	size_t blklen;
+	size_t bstlen;
+	size_t crslen;
+	size_t lnglen;
+
+	bstlen = 0;
+	bstrte = 0.0;
+	crslen = 0;
+	blklen = MINLEN;
+
+	while (blklen <= inp.size())
+	{
+		Profile.SetBlockSize(blklen);
+		Initialize();
+
+		// parallel throughput on a long input with this block size
+		lnglen = inp.size() - (inp.size() % blklen);
+		prlrte = Throughput([&Process, &inp, &otp, lnglen]() { Process(inp, otp, lnglen); }, lnglen);
+
+		if (prlrte > bstrte)
+		{
+			bstrte = prlrte;
+			bstlen = blklen;
+		}
+
+		// the first block size at which a single parallel block outperforms sequential processing
+		if (Crossover && crslen == 0)
+		{
+			prlrte = Throughput([&Process, &inp, &otp, blklen]() { Process(inp, otp, blklen); }, blklen);
+			Profile.IsParallel() = false;
+			seqrte = Throughput([&Process, &inp, &otp, blklen]() { Process(inp, otp, blklen); }, blklen);
+			Profile.IsParallel() = true;
+
+			if (prlrte > seqrte)
+			{
+				crslen = blklen;
+			}
+		}
+
+		blklen *= 2;
+	}
+
+	// parallel processing never paid off; defer it to the longest size tested
+	if (Crossover && crslen == 0)
+	{
+		crslen = blklen / 2;
+	}
+
+	return (crslen > bstlen) ? crslen : bstlen;
+}
+
+NAMESPACE_ROOTEND
@@ -0,0 +1,146 @@
+#ifndef CEX_PARALLELCALIBRATION_H
+#define CEX_PARALLELCALIBRATION_H
+
+#include "CexDomain.h"
+#include "ICipherMode.h"
+#include "IDigest.h"
+#include "IStreamCipher.h"
+#include <functional>
+#include <map>
+#include <mutex>
+
+NAMESPACE_ROOT
+
+using Cipher::Block::Mode::ICipherMode;
+using Digest::IDigest;
+using Cipher::Stream::IStreamCipher;
+
+/// <summary>
+/// The ParallelCalibration class.
+/// <para>An opt-in runtime tuner for the ParallelOptions parallel block size.
+/// Each engine is micro-benchmarked on the host, with parallel and sequential processing, over a range of candidate parallel block sizes.
+/// The smallest block size at which parallel processing outperforms sequential processing (the crossover), and the block size with the highest parallel throughput are measured,
+/// and the larger of the two is stored in a process-wide profile, keyed by the engines formal name and its parallel max-degree.
+/// A ParallelOptions instance owned by a supported engine loads the calibrated size when the engine is initialized, provided the user has not changed the parallel settings.</para>
+/// <para>The profile can be saved to a file, and loaded at startup by later processes.
+/// A saved profile records the processor count and L1 data-cache size of the host, and is rejected if loaded on a host with a different profile.</para>
+/// </summary>
+///
+/// <example>
+/// <description>Calibrating once and persisting the profile:</description>
+/// <code>
+/// if (!ParallelCalibration::Load(path))
+/// {
+///     ParallelCalibration::Calibrate();
+///     ParallelCalibration::Save(path);
+/// }
+/// </code>
+/// </example>
+class ParallelCalibration
+{
+private:
+
+	static const std::string CLASS_NAME;
+	static const std::string PROFILE_HEADER;
+	// the longest candidate parallel block size
+	static const size_t MAX_CALSIZE = 2048 * 1024;
+	// the minimum sampling time per measurement in milliseconds
+	static const size_t MIN_SAMPLEMS = 10;
+
+public:
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Calibrate the default set of parallel engines and store the results in the process-wide profile.
+	/// <para>Benchmarks the CTR, ICM, ECB and CBC-decryption modes (AES), the RCS, ACS and CSX256 stream ciphers,
+	/// and the SHA2, SHA3 and Blake parallel tree-hashing digests. Runs for several seconds.</para>
+	/// </summary>
+	static void Calibrate();
+
+	/// <summary>
+	/// Calibrate a cipher mode instance and store the result in the process-wide profile.
+	/// <para>The instance is re-initialized with an all-zeroes key, and its parallel block size is changed;
+	/// the mode is initialized for encryption, or decryption if the Encryption flag is false.</para>
+	/// </summary>
+	///
+	/// <param name="Cipher">The cipher mode instance</param>
+	/// <param name="Encryption">Calibrate the encryption or decryption function</param>
+	///
+	/// <returns>The calibrated parallel block size, or zero if the engine does not support parallel processing on this host</returns>
+	static size_t Calibrate(ICipherMode* Cipher, bool Encryption);
+
+	/// <summary>
+	/// Calibrate a stream cipher instance and store the result in the process-wide profile.
+	/// <para>The instance is re-initialized with an all-zeroes key, and its parallel block size is changed.</para>
+	/// </summary>
+	///
+	/// <param name="Cipher">The stream cipher instance</param>
+	///
+	/// <returns>The calibrated parallel block size, or zero if the engine does not support parallel processing on this host</returns>
+	static size_t Calibrate(IStreamCipher* Cipher);
+
+	/// <summary>
+	/// Calibrate a parallel digest instance and store the result in the process-wide profile.
+	/// <para>The parallel tree-hashing mode produces a different hash than sequential mode, so only the best parallel block size is measured.</para>
+	/// </summary>
+	///
+	/// <param name="Digest">The digest instance, constructed in parallel mode</param>
+	///
+	/// <returns>The calibrated parallel block size, or zero if the digest is not in parallel mode</returns>
+	static size_t Calibrate(IDigest* Digest);
+
+	/// <summary>
+	/// Remove all entries from the process-wide profile
+	/// </summary>
+	static void Clear();
+
+	/// <summary>
+	/// Load a saved profile into the process-wide profile
+	/// </summary>
+	///
+	/// <param name="Path">The full path to the profile file</param>
+	///
+	/// <returns>Returns false if the file could not be read, or was created on a host with a different processor profile</returns>
+	static bool Load(const std::string &Path);
+
+	/// <summary>
+	/// Save the process-wide profile to a file
+	/// </summary>
+	///
+	/// <param name="Path">The full path to the profile file</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the file can not be written</exception>
+	static void Save(const std::string &Path);
+
+	/// <summary>
+	/// Add or replace an entry in the process-wide profile
+	/// </summary>
+	///
+	/// <param name="Name">The engines formal name</param>
+	/// <param name="MaxDegree">The parallel max-degree the size was calibrated with</param>
+	/// <param name="ParallelBlockSize">The calibrated parallel block size</param>
+	static void Set(const std::string &Name, size_t MaxDegree, size_t ParallelBlockSize);
+
+	/// <summary>
+	/// Get the calibrated parallel block size for an engine
+	/// </summary>
+	///
+	/// <param name="Name">The engines formal name</param>
+	/// <param name="MaxDegree">The engines current parallel max-degree</param>
+	/// <param name="ParallelBlockSize">Receives the calibrated parallel block size</param>
+	///
+	/// <returns>Returns true if the profile contains an entry for the engine and degree</returns>
+	static bool TryGet(const std::string &Name, size_t MaxDegree, size_t &ParallelBlockSize);
+
+private:
+
+	static std::string HostProfile();
+	static std::mutex &ProfileLock();
+	static std::map<std::string, std::pair<size_t, size_t>> &ProfileTable();
+	static double Throughput(const std::function<void()> &Operation, size_t Length);
+	static size_t Tune(ParallelOptions &Profile, const std::function<void()> &Initialize, const std::function<void(const std::vector<byte>&, std::vector<byte>&, size_t)> &Process, bool Crossover);
+};
+
+NAMESPACE_ROOTEND
+#endif
@@ -1,9 +1,12 @@
 #include "ParallelOptions.h"
 #include "CpuDetect.h"
+#include "ParallelCalibration.h"
+#include "ThreadPool.h"
 
 NAMESPACE_ROOT
 
 using Enumeration::ErrorCodes;
+using Tools::ThreadPool;
 
 const std::string ParallelOptions::CLASS_NAME("ParallelOptions");
 
@@ -12,6 +15,7 @@ const std::string ParallelOptions::CLASS_NAME("ParallelOptions");
 ParallelOptions::ParallelOptions(size_t BlockSize, bool SimdMultiply, size_t ReservedCache, bool SplitChannel, size_t ParallelMaxDegree)
 	:
 	m_autoInit(true),
+	m_availableCores(0),
 	m_blockSize(BlockSize != 0 && BlockSize % 2 == 0 ? BlockSize :
 		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The BlockSize must be a positive even number!"), ErrorCodes::InvalidParam)),
 	m_hasPrefetch(false),
@@ -27,6 +31,7 @@ ParallelOptions::ParallelOptions(size_t BlockSize, bool SimdMultiply, size_t Res
 	m_parallelMaxDegree(ParallelMaxDegree),
 	m_parallelMinimumSize(0),
 	m_physicalCores(0),
+	m_placement(ThreadPlacements::None),
 	m_processorCount(0),
 	m_simdDetected(SimdProfiles::None),
 	m_simdMultiply(SimdMultiply),
@@ -42,6 +47,7 @@ ParallelOptions::ParallelOptions(size_t BlockSize, bool SimdMultiply, size_t Res
 ParallelOptions::ParallelOptions(size_t BlockSize, bool Parallel, bool SimdMultiply, size_t ReservedCache, bool SplitChannel, size_t ParallelMaxDegree)
 	:
 	m_autoInit(true),
+	m_availableCores(0),
 	m_blockSize(BlockSize != 0 && BlockSize % 2 == 0 ? BlockSize :
 		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The BlockSize must be a positive even number!"), ErrorCodes::InvalidParam)),
 	m_hasPrefetch(false),
@@ -57,6 +63,7 @@ ParallelOptions::ParallelOptions(size_t BlockSize, bool Parallel, bool SimdMulti
 	m_parallelMaxDegree(ParallelMaxDegree),
 	m_parallelMinimumSize(0),
 	m_physicalCores(0),
+	m_placement(ThreadPlacements::None),
 	m_processorCount(0),
 	m_simdDetected(SimdProfiles::None),
 	m_simdMultiply(SimdMultiply),
@@ -74,6 +81,7 @@ ParallelOptions::ParallelOptions(size_t BlockSize, bool Parallel, bool SimdMulti
 ParallelOptions::ParallelOptions(size_t BlockSize, bool Parallel, size_t ParallelBlockSize, size_t ParallelMaxDegree, bool SimdMultiply, size_t ReservedCache, bool SplitChannel)
 	:
 	m_autoInit(false),
+	m_availableCores(0),
 	m_blockSize(BlockSize != 0 && BlockSize % 2 == 0 ? BlockSize :
 		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The BlockSize must be a positive even number!"), ErrorCodes::InvalidParam)),
 	m_defaultParams(),
@@ -90,6 +98,7 @@ ParallelOptions::ParallelOptions(size_t BlockSize, bool Parallel, size_t Paralle
 	m_parallelMaxDegree(ParallelMaxDegree),
 	m_parallelMinimumSize(0),
 	m_physicalCores(0),
+	m_placement(ThreadPlacements::None),
 	m_processorCount(0),
 	m_simdDetected(SimdProfiles::None),
 	m_simdMultiply(SimdMultiply),
@@ -116,6 +125,11 @@ const bool ParallelOptions::IsDefault()
 		m_defaultParams.ParallelBlockSize == m_parallelBlockSize);
 }
 
+const size_t ParallelOptions::AvailableCores()
+{
+	return m_availableCores;
+}
+
 const size_t ParallelOptions::BlockSize() 
 {
 	return m_blockSize;
@@ -186,9 +200,16 @@ const size_t ParallelOptions::PhysicalCores()
 	return m_physicalCores; 
 }
 
+const ThreadPlacements ParallelOptions::Placement()
+{
+	return m_placement;
+}
+
 const size_t ParallelOptions::ProcessorCount()
 {
-	return m_virtualCores != 0 ? m_virtualCores : m_physicalCores;
+	const size_t PRCCNT = m_virtualCores != 0 ? m_virtualCores : m_physicalCores;
+
+	return (m_availableCores != 0 && m_availableCores < PRCCNT) ? m_availableCores : PRCCNT;
 }
 
 const SimdProfiles ParallelOptions::SimdProfile() 
@@ -286,9 +307,68 @@ void ParallelOptions::Calculate(bool Parallel, size_t ParallelBlockSize, size_t
 	Calculate();
 }
 
+bool ParallelOptions::LoadProfile(const std::string &Name)
+{
+	size_t blklen;
+	bool res;
+
+	res = false;
+
+	if (m_isParallel && IsDefault() && ParallelCalibration::TryGet(Name, m_parallelMaxDegree, blklen))
+	{
+		if (blklen >= m_parallelMinimumSize && blklen <= MAX_PRLALLOC && blklen % m_parallelMinimumSize == 0)
+		{
+			m_parallelBlockSize = blklen;
+			// the calibrated size becomes the default
+			StoreDefaults();
+			res = true;
+		}
+	}
+
+	return res;
+}
+
+void ParallelOptions::Redetect()
+{
+	const bool DEFSET = IsDefault();
+	const bool PRLSET = m_isParallel;
+
+	CpuDetect::AvailableCores(true);
+	Detect();
+
+	// a pinned pool only runs on its placement set
+	if (m_placement != ThreadPlacements::None && ThreadPool::Instance().Concurrency() < m_processorCount)
+	{
+		m_processorCount = ThreadPool::Instance().Concurrency();
+
+		if (m_processorCount > 1 && m_processorCount % 2 != 0)
+		{
+			m_processorCount--;
+		}
+	}
+
+	if (DEFSET)
+	{
+		m_parallelMaxDegree = 0;
+		m_isParallel = (m_processorCount > 1);
+	}
+	else
+	{
+		m_isParallel = (PRLSET && m_processorCount > 1);
+	}
+
+	Calculate();
+
+	if (DEFSET)
+	{
+		StoreDefaults();
+	}
+}
+
 void ParallelOptions::Reset()
 {
 	m_autoInit = false;
+	m_availableCores = 0;
 	m_blockSize = 0;
 	m_defaultParams.IsParallel = false;
 	m_defaultParams.MaxDegree = 0;
@@ -306,6 +386,7 @@ void ParallelOptions::Reset()
 	m_parallelMaxDegree = 0;
 	m_parallelMinimumSize = 0;
 	m_physicalCores = 0;
+	m_placement = ThreadPlacements::None;
 	m_processorCount = 0;
 	m_simdDetected = SimdProfiles::None;
 	m_simdMultiply = false;
@@ -337,8 +418,85 @@ void ParallelOptions::SetMaxDegree(size_t MaxDegree)
 	Calculate();
 }
 
+bool ParallelOptions::SetPlacement(ThreadPlacements Placement)
+{
+	if (Placement == ThreadPlacements::Explicit)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("SetPlacement"), std::string("An explicit placement requires a processor set!"), ErrorCodes::InvalidParam);
+	}
+
+	std::vector<size_t> cpus = PlacementList(Placement);
+
+	return ApplyPlacement(Placement, cpus);
+}
+
+bool ParallelOptions::SetPlacement(const std::vector<size_t> &Cpus)
+{
+	if (Cpus.size() == 0)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("SetPlacement"), std::string("The processor set can not be empty!"), ErrorCodes::InvalidParam);
+	}
+
+	std::vector<size_t> cpus = Cpus;
+
+	return ApplyPlacement(ThreadPlacements::Explicit, cpus);
+}
+
 //~~~Private Functions~~~//
 
+bool ParallelOptions::ApplyPlacement(ThreadPlacements Placement, std::vector<size_t> &Cpus)
+{
+	size_t cpucnt;
+	bool res;
+
+	if (Placement == ThreadPlacements::None)
+	{
+		res = ThreadPool::Instance().SetAffinity(std::vector<size_t>(0));
+		cpucnt = (m_virtualCores > m_physicalCores) ? m_virtualCores : m_physicalCores;
+		cpucnt = (m_availableCores < cpucnt) ? m_availableCores : cpucnt;
+	}
+	else
+	{
+		// one worker per listed processor, bounded by the pool size and a user defined degree
+		cpucnt = (Cpus.size() < ThreadPool::Instance().ThreadCount()) ? Cpus.size() : ThreadPool::Instance().ThreadCount();
+
+		if (m_overrideMaxDegree && m_parallelMaxDegree < cpucnt)
+		{
+			cpucnt = m_parallelMaxDegree;
+		}
+
+		if (cpucnt > 1 && cpucnt % 2 != 0)
+		{
+			cpucnt--;
+		}
+
+		Cpus.resize(cpucnt);
+		res = (cpucnt != 0 && ThreadPool::Instance().SetAffinity(Cpus));
+	}
+
+	if (res == true)
+	{
+		m_placement = Placement;
+		m_processorCount = cpucnt;
+
+		if (m_processorCount > 1 && m_processorCount % 2 != 0)
+		{
+			m_processorCount--;
+		}
+
+		// the degree follows the processor count unless the user has set it
+		if (!m_overrideMaxDegree)
+		{
+			m_parallelMaxDegree = 0;
+		}
+
+		m_isParallel = (m_isParallel && m_processorCount > 1);
+		Calculate();
+	}
+
+	return res;
+}
+
 void ParallelOptions::Detect()
 {
 	CpuDetect dtc;
@@ -357,6 +515,13 @@ void ParallelOptions::Detect()
 
 	m_virtualCores = dtc.VirtualCores();
 	m_processorCount = (m_virtualCores > m_physicalCores) ? m_virtualCores : m_physicalCores;
+	// the affinity mask and container limits may allow fewer processors than the host has
+	m_availableCores = CpuDetect::AvailableCores();
+
+	if (m_availableCores < m_processorCount)
+	{
+		m_processorCount = m_availableCores;
+	}
 
 	if (m_processorCount > 1 && m_processorCount % 2 != 0)
 	{
@@ -372,6 +537,60 @@ void ParallelOptions::Detect()
 	m_l1DataCacheTotal = dtc.L1DataCacheTotal();
 }
 
+std::vector<size_t> ParallelOptions::PlacementList(ThreadPlacements Placement)
+{
+	std::vector<std::vector<size_t>> cores = CpuDetect::CoreTopology();
+	std::vector<size_t> cpus(0);
+	size_t i;
+	size_t lvl;
+	bool more;
+
+	if (Placement == ThreadPlacements::Physical)
+	{
+		// the first sibling of each core
+		for (i = 0; i < cores.size(); ++i)
+		{
+			cpus.push_back(cores[i][0]);
+		}
+	}
+	else if (Placement == ThreadPlacements::Pack)
+	{
+		// every sibling of a core before the next core
+		for (i = 0; i < cores.size(); ++i)
+		{
+			cpus.insert(cpus.end(), cores[i].begin(), cores[i].end());
+		}
+	}
+	else if (Placement == ThreadPlacements::Spread)
+	{
+		// one sibling of every core per pass
+		lvl = 0;
+		more = true;
+
+		while (more)
+		{
+			more = false;
+
+			for (i = 0; i < cores.size(); ++i)
+			{
+				if (lvl < cores[i].size())
+				{
+					cpus.push_back(cores[i][lvl]);
+					more = true;
+				}
+			}
+
+			++lvl;
+		}
+	}
+	else
+	{
+		// misra
+	}
+
+	return cpus;
+}
+
 void ParallelOptions::StoreDefaults()
 {
 	m_defaultParams.IsParallel = m_isParallel;
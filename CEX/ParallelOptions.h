@@ -5,12 +5,14 @@
 #include "CpuCores.h"
 #include "CryptoProcessingException.h"
 #include "SimdProfiles.h"
+#include "ThreadPlacements.h"
 
 NAMESPACE_ROOT
 
 using Enumeration::CpuCores;
 using Exception::CryptoProcessingException;
 using Enumeration::SimdProfiles;
+using Enumeration::ThreadPlacements;
 
 /// <summary>
 /// The ParallelOptions class.
@@ -54,6 +56,7 @@ private:
 	const size_t MAX_PRLALLOC = DEF_DATACACHE * 2000;
 
 	bool m_autoInit;
+	size_t m_availableCores;
 	size_t m_blockSize;
 	AutoParallelParams m_defaultParams;
 	bool m_hasPrefetch;
@@ -69,6 +72,7 @@ private:
 	size_t m_parallelMaxDegree;
 	size_t m_parallelMinimumSize;
 	size_t m_physicalCores;
+	ThreadPlacements m_placement;
 	size_t m_processorCount;
 	SimdProfiles m_simdDetected;
 	bool m_simdMultiply;
@@ -153,6 +157,11 @@ public:
 	/// </summary>
 	const bool IsDefault();
 
+	/// <summary>
+	/// Read Only: The number of processors this process can use; bounded by the affinity mask, cpusets and container CPU quotas
+	/// </summary>
+	const size_t AvailableCores();
+
 	/// <summary>
 	/// Read Only: Block size of the algorithm in bytes
 	/// </summary>
@@ -228,7 +237,12 @@ public:
 	const size_t PhysicalCores();
 
 	/// <summary>
-	/// Read Only: The maximum number of processor cores available on the system including virtul cores
+	/// Read Only: The worker thread placement policy applied with SetPlacement()
+	/// </summary>
+	const ThreadPlacements Placement();
+
+	/// <summary>
+	/// Read Only: The maximum number of processor cores available to this process including virtual cores
 	/// </summary>
 	const size_t ProcessorCount();
 
@@ -269,6 +283,25 @@ public:
 	/// <para>This must be an even positive number no greater than the number of processor cores.</para></param>
 	void Calculate(bool Parallel, size_t ParallelBlockSize, size_t MaxDegree);
 
+	/// <summary>
+	/// Apply a calibrated parallel block size from the ParallelCalibration profile.
+	/// <para>The size is applied only if the profile contains an entry for the named engine at the current max-degree,
+	/// and the parallel settings are still the auto-generated defaults.</para>
+	/// </summary>
+	/// 
+	/// <param name="Name">The formal name of the engine that owns this instance</param>
+	/// 
+	/// <returns>Returns true if a calibrated size was applied</returns>
+	bool LoadProfile(const std::string &Name);
+
+	/// <summary>
+	/// Re-detect the number of processors available to the process, and re-calculate the parallel sizes.
+	/// <para>Call after the affinity mask or the container CPU limits have changed.
+	/// If the parallel settings are still the auto-generated defaults, the max-degree and parallel capability follow the new processor count;
+	/// otherwise a user defined max-degree is retained, and parallel processing is disabled if only one processor remains.</para>
+	/// </summary>
+	void Redetect();
+
 	/// <summary>
 	/// Reset all internal data to defaults
 	/// </summary>
@@ -293,9 +326,40 @@ public:
 	/// a value of 0, or greater than the processors virtual-core count, defaults to the processors virtual-core count</param>
 	void SetMaxDegree(size_t MaxDegree);
 
+	/// <summary>
+	/// Pin the parallel worker threads according to a placement policy.
+	/// <para>Physical places one worker on each physical core and leaves the SMT siblings idle, so SIMD and AES units are not shared;
+	/// Pack fills the logical processors of a core before the next, and Spread occupies every core before using a sibling.
+	/// The processor count and max-degree are re-calculated to the number of pinned processors; a user-defined max-degree truncates the placement list.
+	/// The placement is applied to the process-wide thread pool, so it affects every parallel engine; requires the CEX_PARALLEL_THREADPOOL build option.</para>
+	/// </summary>
+	/// 
+	/// <param name="Placement">The placement policy; None restores the operating system scheduling.
+	/// <para>Use the SetPlacement(std::vector&lt;size_t&gt;) overload to apply an explicit processor set.</para></param>
+	/// 
+	/// <returns>Returns false if the threads could not be pinned; the placement is left unchanged</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the Explicit policy is passed to this function</exception>
+	bool SetPlacement(ThreadPlacements Placement);
+
+	/// <summary>
+	/// Pin the parallel worker threads to an explicit set of logical processors.
+	/// <para>One worker is pinned to each listed processor, in order; the processor count and max-degree are re-calculated to the size of the set.
+	/// The placement is applied to the process-wide thread pool, so it affects every parallel engine.</para>
+	/// </summary>
+	/// 
+	/// <param name="Cpus">The ordered list of logical processor indices</param>
+	/// 
+	/// <returns>Returns false if the threads could not be pinned; the placement is left unchanged</returns>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the processor set is empty</exception>
+	bool SetPlacement(const std::vector<size_t> &Cpus);
+
 	//~~~Private Functions~~~//
 
+	bool ApplyPlacement(ThreadPlacements Placement, std::vector<size_t> &Cpus);
 	void Detect();
+	static std::vector<size_t> PlacementList(ThreadPlacements Placement);
 	void StoreDefaults();
 };
 
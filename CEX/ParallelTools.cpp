@@ -1,54 +1,77 @@
 #include "ParallelTools.h"
+#include "CpuDetect.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <thread>
 
 #if defined(CEX_HAS_OPENMP)
 #	include <omp.h>
-#else
-#	include <future>
 #endif
 
 NAMESPACE_TOOLS
 
 size_t ParallelTools::ProcessorCount()
 {
-#if defined(CEX_HAS_OPENMP)
-	return static_cast<size_t>(omp_get_num_procs());
-#else
-	return static_cast<size_t>(std::thread::hardware_concurrency());
-#endif
+	return CpuDetect::AvailableCores();
 }
 
 void ParallelTools::ParallelFor(size_t From, size_t To, const std::function<void(size_t)> &F)
 {
-#if defined(CEX_HAS_OPENMP)
+#if defined(CEX_HAS_OPENMP) && !defined(CEX_PARALLEL_THREADPOOL)
 #	pragma omp parallel num_threads(static_cast<int>(To))
 	{
 		size_t i = From + static_cast<size_t>(omp_get_thread_num());
 		F(i);
 	}
 #else
-	std::vector<std::future<void>> futures;
-
-	for (size_t i = From; i < To; ++i)
+	if (To > From)
 	{
-		auto fut = std::async([i, F]()
+		ThreadPool::Instance().Execute(To - From, [From, &F](size_t i)
 		{
-			F(i);
+			F(From + i);
 		});
-		futures.push_back(std::move(fut));
 	}
+#endif
+}
 
-	for (size_t i = 0; i < futures.size(); ++i)
+void ParallelTools::ParallelFor(size_t From, size_t To, size_t Grain, const std::function<void(size_t, size_t)> &F)
+{
+	if (To > From)
 	{
-		futures[i].wait();
-	}
+		const size_t GRNLEN = (Grain != 0) ? Grain : 1;
+		const size_t CNKCNT = ((To - From) + (GRNLEN - 1)) / GRNLEN;
+		std::atomic_size_t next(From);
 
-	futures.clear();
+		auto claim = [To, GRNLEN, &F, &next](size_t)
+		{
+			size_t pos;
+
+			// claim chunks until the range is exhausted
+			while ((pos = next.fetch_add(GRNLEN)) < To)
+			{
+				F(pos, (To - pos > GRNLEN) ? pos + GRNLEN : To);
+			}
+		};
+
+#if defined(CEX_HAS_OPENMP) && !defined(CEX_PARALLEL_THREADPOOL)
+		const size_t THDCNT = (CNKCNT < ProcessorCount()) ? CNKCNT : ProcessorCount();
+
+#	pragma omp parallel num_threads(static_cast<int>(THDCNT))
+		{
+			claim(static_cast<size_t>(omp_get_thread_num()));
+		}
+#else
+		// the pool is sized to the host, a container quota may allow fewer threads
+		const size_t THDCNT = (ThreadPool::Instance().Concurrency() < ProcessorCount()) ? ThreadPool::Instance().Concurrency() : ProcessorCount();
+
+		ThreadPool::Instance().Execute((CNKCNT < THDCNT) ? CNKCNT : THDCNT, claim);
 #endif
+	}
 }
 
 void ParallelTools::ParallelTask(const std::function<void()> &F)
 {
-#if defined(CEX_HAS_OPENMP)
+#if defined(CEX_HAS_OPENMP) && !defined(CEX_PARALLEL_THREADPOOL)
 #	pragma omp parallel
 	{
 #		pragma omp single nowait
@@ -57,12 +80,10 @@ void ParallelTools::ParallelTask(const std::function<void()> &F)
 		}
 	}
 #else
-	std::future<void> fut = std::async(std::launch::async, [F]()
+	ThreadPool::Instance().Execute(1, [&F](size_t)
 	{
 		F();
 	});
-
-	fut.get();
 #endif
 }
 
@@ -41,14 +41,27 @@ public:
 	static void ParallelFor(size_t From, size_t To, const std::function<void(size_t)> &F);
 
 	/// <summary>
-	/// Execute a function on a new thread
+	/// A multi-threaded parallel For loop with dynamic chunking.
+	/// <para>The range is divided into chunks of Grain elements, the last chunk may be shorter. 
+	/// Each thread claims the next unprocessed chunk until the range is exhausted, so uneven ranges are balanced across the threads.</para>
+	/// </summary>
+	/// 
+	/// <param name="From">The inclusive starting position</param> 
+	/// <param name="To">The exclusive ending position</param>
+	/// <param name="Grain">The number of elements in each chunk</param>
+	/// <param name="F">The function delegate; receives the inclusive start and exclusive end of a chunk</param>
+	static void ParallelFor(size_t From, size_t To, size_t Grain, const std::function<void(size_t, size_t)> &F);
+
+	/// <summary>
+	/// Execute a function as a pooled task, and wait for it to complete
 	/// </summary>
 	/// 
 	/// <param name="F">The function delegate</param>
 	static void ParallelTask(const std::function<void()> &F);
 
 	/// <summary>
-	/// Read Only: The number of processors available on the system
+	/// Read Only: The number of processors available to this process.
+	/// <para>Honors the thread affinity mask, cpusets and container CPU quotas; see CpuDetect::AvailableCores().</para>
 	/// </summary>
 	static size_t ProcessorCount();
 
@@ -93,6 +93,21 @@ void Poly1305::Compute(const std::vector<byte> &Input, std::vector<byte> &Output
 
 size_t Poly1305::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if ((Output.size() - OutOffset) < TagSize())
+	{
+		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The Output buffer is too short!"), ErrorCodes::InvalidSize);
+	}
+
+	return Finalize(Output.data() + OutOffset);
+}
+
+size_t Poly1305::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, TagSize());
 	ulong c;
 	ulong g0;
 	ulong g1;
@@ -105,10 +120,6 @@ size_t Poly1305::Finalize(std::vector<byte> &Output, size_t OutOffset)
 	{
 		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
 	}
-	if ((Output.size() - OutOffset) < TagSize())
-	{
-		throw CryptoMacException(Name(), std::string("Finalize"), std::string("The Output buffer is too short!"), ErrorCodes::InvalidSize);
-	}
 
 	if (m_poly1305State->Position != 0)
 	{
@@ -178,8 +189,8 @@ size_t Poly1305::Finalize(std::vector<byte> &Output, size_t OutOffset)
 	h0 = ((h0) | (h1 << 44));
 	h1 = ((h1 >> 20) | (h2 << 24));
 
-	IntegerTools::Le64ToBytes(h0, Output, OutOffset);
-	IntegerTools::Le64ToBytes(h1, Output, OutOffset + sizeof(ulong));
+	IntegerTools::Le64ToBytes(h0, OTP, 0);
+	IntegerTools::Le64ToBytes(h1, OTP, sizeof(ulong));
 
 	return TagSize();
 }
@@ -240,38 +251,22 @@ void Poly1305::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 		throw CryptoMacException(Name(), std::string("Update"), std::string("The Input buffer is too short!"), ErrorCodes::InvalidSize);
 	}
 
-	if (Length != 0)
-	{
-		if (m_poly1305State->Position != 0 && (m_poly1305State->Position + Length >= BLOCK_SIZE))
-		{
-			const size_t RMDLEN = BLOCK_SIZE - m_poly1305State->Position;
-			if (RMDLEN != 0)
-			{
-				MemoryTools::Copy(Input, InOffset, m_poly1305State->Buffer, m_poly1305State->Position, RMDLEN);
-			}
-
-			Absorb(m_poly1305State->Buffer, 0, BLOCK_SIZE, false, m_poly1305State);
-			m_poly1305State->Position = 0;
-			InOffset += RMDLEN;
-			Length -= RMDLEN;
-		}
-
-		const size_t ALNLEN = (Length / BLOCK_SIZE) * BLOCK_SIZE;
-		Absorb(Input, InOffset, ALNLEN, false, m_poly1305State);
-		Length -= ALNLEN;
-		InOffset += ALNLEN;
+	Process(Input, InOffset, Length);
+}
 
-		if (Length > 0)
-		{
-			MemoryTools::Copy(Input, InOffset, m_poly1305State->Buffer, m_poly1305State->Position, Length);
-			m_poly1305State->Position += Length;
-		}
+void Poly1305::Update(const byte* Input, size_t Length)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoMacException(Name(), std::string("Update"), std::string("The MAC has not been initialized!"), ErrorCodes::NotInitialized);
 	}
+
+	Process(Span<const byte>(Input, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
 
-void Poly1305::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Length, bool IsFinal, std::unique_ptr<Poly1305State> &State)
+void Poly1305::Absorb(const Span<const byte> &Input, size_t InOffset, size_t Length, bool IsFinal, std::unique_ptr<Poly1305State> &State)
 {
 #if !defined(CEX_NATIVE_UINT128)
 	typedef Numeric::Donna128 uint128_t;
@@ -332,4 +327,35 @@ void Poly1305::Absorb(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	State->State[5] = h2;
 }
 
+void Poly1305::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
+	if (Length != 0)
+	{
+		if (m_poly1305State->Position != 0 && (m_poly1305State->Position + Length >= BLOCK_SIZE))
+		{
+			const size_t RMDLEN = BLOCK_SIZE - m_poly1305State->Position;
+			if (RMDLEN != 0)
+			{
+				MemoryTools::Copy(Input, InOffset, m_poly1305State->Buffer, m_poly1305State->Position, RMDLEN);
+			}
+
+			Absorb(m_poly1305State->Buffer, 0, BLOCK_SIZE, false, m_poly1305State);
+			m_poly1305State->Position = 0;
+			InOffset += RMDLEN;
+			Length -= RMDLEN;
+		}
+
+		const size_t ALNLEN = (Length / BLOCK_SIZE) * BLOCK_SIZE;
+		Absorb(Input, InOffset, ALNLEN, false, m_poly1305State);
+		Length -= ALNLEN;
+		InOffset += ALNLEN;
+
+		if (Length > 0)
+		{
+			MemoryTools::Copy(Input, InOffset, m_poly1305State->Buffer, m_poly1305State->Position, Length);
+			m_poly1305State->Position += Length;
+		}
+	}
+}
+
 NAMESPACE_MACEND
@@ -146,6 +146,17 @@ public:
 	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized or the output array is too small</exception>
 	size_t Finalize(SecureVector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Completes processing and writes the MAC code to a pointer
+	/// </summary>
+	///
+	/// <param name="Output">A pointer to the output buffer receiving the MAC code; must be at least TagSize in length</param>
+	///
+	/// <returns>The size of the MAC code in bytes</returns>
+	///
+	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized</exception>
+	size_t Finalize(byte* Output) override;
+
 	/// <summary>
 	/// Initialize the MAC generator with an ISymmetricKey key container.
 	/// <para>Can accept either the SymmetricKey or SymmetricSecureKey container to load keying material.
@@ -174,9 +185,21 @@ public:
 	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized or the input array is too small</exception>
 	void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) override;
 
+	/// <summary>
+	/// Update the Mac with a length of bytes using a pointer.
+	/// <para>The message is read from the callers memory directly, without an intermediate vector.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input data</param>
+	/// <param name="Length">The length of data to process in bytes</param>
+	///
+	/// <exception cref="CryptoMacException">Thrown if the mac is not initialized</exception>
+	void Update(const byte* Input, size_t Length) override;
+
 private:
 
-	static void Absorb(const std::vector<byte> &Output, size_t OutOffset, size_t Length, bool IsFinal, std::unique_ptr<Poly1305State> &State);
+	static void Absorb(const Span<const byte> &Output, size_t OutOffset, size_t Length, bool IsFinal, std::unique_ptr<Poly1305State> &State);
+	void Process(const Span<const byte> &Input, size_t InOffset, size_t Length);
 };
 
 NAMESPACE_MACEND
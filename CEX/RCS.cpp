@@ -19,32 +19,69 @@ using Enumeration::ShakeModes;
 using Enumeration::StreamAuthenticators;
 using Enumeration::StreamCipherConvert;
 
-class RCS::RcsState
+class RCS::RcsKey final : public KeyContext
 {
 public:
 
 	SecureVector<uint> RoundKeys;
+	SecureVector<byte> MacKey;
+	std::string CipherName;
+	uint Rounds;
+	KmacModes Authenticator;
+	ShakeModes Mode;
+
+	RcsKey()
+		:
+		RoundKeys(0),
+		MacKey(0),
+		CipherName(""),
+		Rounds(0),
+		Authenticator(KmacModes::None),
+		Mode(ShakeModes::None)
+	{
+	}
+
+	~RcsKey() override
+	{
+		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(uint));
+		MemoryTools::Clear(MacKey, 0, MacKey.size());
+		Rounds = 0;
+		Authenticator = KmacModes::None;
+		Mode = ShakeModes::None;
+	}
+
+	const std::string Name() override
+	{
+		return CipherName;
+	}
+};
+
+class RCS::RcsState
+{
+public:
+
+	std::shared_ptr<const RcsKey> Key;
 	SecureVector<byte> Associated;
 	SecureVector<byte> Custom;
-	SecureVector<byte> MacKey;
 	SecureVector<byte> MacTag;
 	SecureVector<byte> Name;
 	std::vector<SymmetricKeySize> LegalKeySizes;
 	std::vector<byte> Nonce;
+	std::vector<byte> Origin;
 	ulong Counter;
-	uint Rounds;
+	ulong Offset;
 	KmacModes Authenticator;
 	ShakeModes Mode;
 	bool IsAuthenticated;
 	bool IsEncryption;
 	bool IsInitialized;
+	bool IsShared;
 
 	RcsState(bool Authenticate)
 		:
-		RoundKeys(0),
+		Key(nullptr),
 		Associated(0),
 		Custom(0),
-		MacKey(0),
 		MacTag(0),
 		Name(0),
 		LegalKeySizes{
@@ -52,22 +89,47 @@ public:
 			SymmetricKeySize(IK512_SIZE, BLOCK_SIZE, INFO_SIZE),
 			SymmetricKeySize(IK1024_SIZE, BLOCK_SIZE, INFO_SIZE) },
 		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
 		Counter(0),
-		Rounds(0),
+		Offset(0),
 		Authenticator(KmacModes::None),
 		Mode(ShakeModes::None),
 		IsAuthenticated(Authenticate),
 		IsEncryption(false),
-		IsInitialized(false)
+		IsInitialized(false),
+		IsShared(false)
+	{
+	}
+
+	RcsState(const std::shared_ptr<const RcsKey> &Context)
+		:
+		Key(Context),
+		Associated(0),
+		Custom(0),
+		MacTag(0),
+		Name(0),
+		LegalKeySizes{
+			SymmetricKeySize(IK256_SIZE, BLOCK_SIZE, INFO_SIZE),
+			SymmetricKeySize(IK512_SIZE, BLOCK_SIZE, INFO_SIZE),
+			SymmetricKeySize(IK1024_SIZE, BLOCK_SIZE, INFO_SIZE) },
+		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
+		Counter(0),
+		Offset(0),
+		Authenticator(Context->Authenticator),
+		Mode(Context->Mode),
+		IsAuthenticated(Context->Authenticator != KmacModes::None),
+		IsEncryption(false),
+		IsInitialized(false),
+		IsShared(true)
 	{
 	}
 
 	RcsState(SecureVector<byte> &State)
 		:
-		RoundKeys(0),
+		Key(nullptr),
 		Associated(0),
 		Custom(0),
-		MacKey(0),
 		MacTag(0),
 		Name(0),
 		LegalKeySizes{
@@ -75,29 +137,31 @@ public:
 			SymmetricKeySize(IK512_SIZE, BLOCK_SIZE, INFO_SIZE),
 			SymmetricKeySize(IK1024_SIZE, BLOCK_SIZE, INFO_SIZE) },
 		Nonce(BLOCK_SIZE, 0x00),
+		Origin(BLOCK_SIZE, 0x00),
 		Counter(0),
-		Rounds(0),
+		Offset(0),
 		Authenticator(KmacModes::None),
 		Mode(ShakeModes::None),
 		IsAuthenticated(false),
 		IsEncryption(false),
-		IsInitialized(false)
+		IsInitialized(false),
+		IsShared(false)
 	{
 		DeSerialize(State);
 	}
 
 	~RcsState()
 	{
-		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(uint));
+		Key.reset();
 		MemoryTools::Clear(Associated, 0, Associated.size());
 		MemoryTools::Clear(Custom, 0, Custom.size());
-		MemoryTools::Clear(MacKey, 0, MacKey.size());
 		MemoryTools::Clear(MacTag, 0, MacTag.size());
 		MemoryTools::Clear(Name, 0, Name.size());
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
+		MemoryTools::Clear(Origin, 0, Origin.size());
 		LegalKeySizes.clear();
 		Counter = 0;
-		Rounds = 0;
+		Offset = 0;
 		Authenticator = KmacModes::None;
 		Mode = ShakeModes::None;
 		IsAuthenticated = false;
@@ -107,6 +171,7 @@ public:
 
 	void DeSerialize(SecureVector<byte> &SecureState)
 	{
+		std::shared_ptr<RcsKey> tmpk(new RcsKey());
 		size_t soff;
 		ushort vlen; 
 
@@ -114,9 +179,9 @@ public:
 		vlen = 0;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
-		RoundKeys.resize(vlen / sizeof(uint));
+		tmpk->RoundKeys.resize(vlen / sizeof(uint));
 		soff += sizeof(ushort);
-		MemoryTools::Copy(SecureState, soff, RoundKeys, 0, vlen);
+		MemoryTools::Copy(SecureState, soff, tmpk->RoundKeys, 0, vlen);
 		soff += vlen;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
@@ -132,9 +197,9 @@ public:
 		soff += vlen;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
-		MacKey.resize(vlen);
+		tmpk->MacKey.resize(vlen);
 		soff += sizeof(ushort);
-		MemoryTools::Copy(SecureState, soff, MacKey, 0, MacKey.size());
+		MemoryTools::Copy(SecureState, soff, tmpk->MacKey, 0, tmpk->MacKey.size());
 		soff += vlen;
 
 		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
@@ -157,7 +222,7 @@ public:
 
 		MemoryTools::CopyToObject(SecureState, soff, &Counter, sizeof(ulong));
 		soff += sizeof(ulong);
-		MemoryTools::CopyToObject(SecureState, soff, &Rounds, sizeof(uint));
+		MemoryTools::CopyToObject(SecureState, soff, &tmpk->Rounds, sizeof(uint));
 		soff += sizeof(uint);
 
 		MemoryTools::CopyToObject(SecureState, soff, &Authenticator, sizeof(KmacModes));
@@ -170,37 +235,60 @@ public:
 		MemoryTools::CopyToObject(SecureState, soff, &IsEncryption, sizeof(bool));
 		soff += sizeof(bool);
 		MemoryTools::CopyToObject(SecureState, soff, &IsInitialized, sizeof(bool));
+		soff += sizeof(bool);
+
+		// the seek origin and offset were appended to the state format, a state serialized without them can not be restored
+		if (SecureState.size() < soff + sizeof(ushort) + BLOCK_SIZE + sizeof(ulong))
+		{
+			throw CryptoSymmetricException(std::string("RCS"), std::string("Constructor"), std::string("The State array was serialized by an earlier version and can not be restored!"), ErrorCodes::InvalidState);
+		}
+
+		MemoryTools::CopyToObject(SecureState, soff, &vlen, sizeof(ushort));
+		Origin.resize(vlen);
+		soff += sizeof(ushort);
+		MemoryTools::Copy(SecureState, soff, Origin, 0, Origin.size());
+		soff += vlen;
+		MemoryTools::CopyToObject(SecureState, soff, &Offset, sizeof(ulong));
+
+		// the restored key schedule is a new context, owned by this instance until it is shared
+		tmpk->Authenticator = Authenticator;
+		tmpk->Mode = Mode;
+		tmpk->CipherName = StreamCipherConvert::ToName(StreamCipherConvert::FromDescription(StreamCiphers::RCS, 
+			IsAuthenticated ? static_cast<StreamAuthenticators>(Authenticator) : StreamAuthenticators::None));
+		Key = tmpk;
 	}
 
 	void Reset()
 	{
-		MemoryTools::Clear(RoundKeys, 0, RoundKeys.size() * sizeof(uint));
+		Key.reset();
 		MemoryTools::Clear(Associated, 0, Associated.size());
 		MemoryTools::Clear(Custom, 0, Custom.size());
-		MemoryTools::Clear(MacKey, 0, MacKey.size());
 		MemoryTools::Clear(MacTag, 0, MacTag.size());
 		MemoryTools::Clear(Name, 0, Name.size());
 		MemoryTools::Clear(Nonce, 0, Nonce.size());
+		MemoryTools::Clear(Origin, 0, Origin.size());
 		Counter = 0;
-		Rounds = 0;
+		Offset = 0;
 		IsEncryption = false;
 		IsInitialized = false;
+		IsShared = false;
 	}
 
 	SecureVector<byte> Serialize()
 	{
-		const size_t STALEN = (RoundKeys.size() * sizeof(uint)) + Associated.size() + Custom.size() + MacKey.size() + MacTag.size() + Name.size() + 
-			Nonce.size() + sizeof(Counter) + sizeof(Rounds) + sizeof(Authenticator) + sizeof(Mode) + (3 * sizeof(bool)) + (7 * sizeof(ushort));
+		const size_t STALEN = (Key->RoundKeys.size() * sizeof(uint)) + Associated.size() + Custom.size() + Key->MacKey.size() + MacTag.size() + Name.size() + 
+			Nonce.size() + sizeof(Counter) + sizeof(Key->Rounds) + sizeof(Authenticator) + sizeof(Mode) + (3 * sizeof(bool)) + (7 * sizeof(ushort)) +
+			Origin.size() + sizeof(Offset) + sizeof(ushort);
 
 		size_t soff;
 		ushort vlen;
 		SecureVector<byte> state(STALEN);
 
 		soff = 0;
-		vlen = static_cast<ushort>(RoundKeys.size() * sizeof(uint));
+		vlen = static_cast<ushort>(Key->RoundKeys.size() * sizeof(uint));
 		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
 		soff += sizeof(ushort);
-		MemoryTools::Copy(RoundKeys, 0, state, soff, static_cast<size_t>(vlen));
+		MemoryTools::Copy(Key->RoundKeys, 0, state, soff, static_cast<size_t>(vlen));
 		soff += vlen;
 
 		vlen = static_cast<ushort>(Associated.size());
@@ -215,11 +303,11 @@ public:
 		MemoryTools::Copy(Custom, 0, state, soff, Custom.size());
 		soff += Custom.size();
 
-		vlen = static_cast<ushort>(MacKey.size());
+		vlen = static_cast<ushort>(Key->MacKey.size());
 		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
 		soff += sizeof(ushort);
-		MemoryTools::Copy(MacKey, 0, state, soff, MacKey.size());
-		soff += MacKey.size();
+		MemoryTools::Copy(Key->MacKey, 0, state, soff, Key->MacKey.size());
+		soff += Key->MacKey.size();
 
 		vlen = static_cast<ushort>(MacTag.size());
 		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
@@ -241,7 +329,7 @@ public:
 
 		MemoryTools::CopyFromObject(&Counter, state, soff, sizeof(ulong));
 		soff += sizeof(ulong);
-		MemoryTools::CopyFromObject(&Rounds, state, soff, sizeof(uint));
+		MemoryTools::CopyFromObject(&Key->Rounds, state, soff, sizeof(uint));
 		soff += sizeof(uint);
 
 		MemoryTools::CopyFromObject(&Authenticator, state, soff, sizeof(KmacModes));
@@ -254,6 +342,14 @@ public:
 		MemoryTools::CopyFromObject(&IsEncryption, state, soff, sizeof(bool));
 		soff += sizeof(bool);
 		MemoryTools::CopyFromObject(&IsInitialized, state, soff, sizeof(bool));
+		soff += sizeof(bool);
+
+		vlen = static_cast<ushort>(Origin.size());
+		MemoryTools::CopyFromObject(&vlen, state, soff, sizeof(ushort));
+		soff += sizeof(ushort);
+		MemoryTools::Copy(Origin, 0, state, soff, Origin.size());
+		soff += Origin.size();
+		MemoryTools::CopyFromObject(&Offset, state, soff, sizeof(ulong));
 
 		return state;
 	}
@@ -281,11 +377,22 @@ RCS::RCS(SecureVector<byte> &State)
 	if (m_rcsState->Authenticator != KmacModes::None)
 	{
 		// initialize the mac
-		SymmetricKey kpm(m_rcsState->MacKey);
+		SymmetricKey kpm(m_rcsState->Key->MacKey);
 		m_macAuthenticator->Initialize(kpm);
 	}
 }
 
+RCS::RCS(const std::shared_ptr<KeyContext> &Context)
+	:
+	m_rcsState(std::dynamic_pointer_cast<const RcsKey>(Context) != nullptr ? new RcsState(std::dynamic_pointer_cast<const RcsKey>(Context)) :
+		throw CryptoSymmetricException(std::string("RCS"), std::string("Constructor"), std::string("The key context is null or was not created by RCS!"), ErrorCodes::InvalidParam)),
+	m_macAuthenticator(m_rcsState->Authenticator == KmacModes::None ?
+		nullptr :
+		new KMAC(m_rcsState->Authenticator)),
+	m_parallelProfile(BLOCK_SIZE, true, STATE_PRECACHED, true)
+{
+}
+
 RCS::~RCS()
 {
 	if (m_macAuthenticator != nullptr)
@@ -296,6 +403,16 @@ RCS::~RCS()
 
 //~~~Accessors~~~//
 
+const std::shared_ptr<KeyContext> RCS::Context()
+{
+	if (m_rcsState->Key == nullptr)
+	{
+		throw CryptoSymmetricException(std::string("RCS"), std::string("Context"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	return std::const_pointer_cast<RcsKey>(m_rcsState->Key);
+}
+
 const StreamCiphers RCS::Enumeral()
 {
 	StreamAuthenticators auth;
@@ -395,7 +512,18 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
 	size_t i;
 
-	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		if (m_rcsState->Key == nullptr)
+		{
+			throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("First initialization requires a key and nonce!"), ErrorCodes::IllegalOperation);
+		}
+	}
+	else if (m_rcsState->IsShared)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("An instance using a shared key context can not be re-keyed!"), ErrorCodes::IllegalOperation);
+	}
+	else if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
 	{
 		throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes in length."), ErrorCodes::InvalidKey);
 	}
@@ -406,6 +534,9 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	if (m_parallelProfile.IsParallel())
 	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
 		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
 		{
 			throw CryptoSymmetricException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
@@ -416,17 +547,43 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		}
 	}
 
+	if (Parameters.KeySizes().KeySize() == 0)
+	{
+		// a nonce-only key re-uses the key schedule, only the nonce, counter, and mac state are reset
+		MemoryTools::Clear(m_rcsState->Associated, 0, m_rcsState->Associated.size());
+		m_rcsState->Associated.resize(0);
+		m_rcsState->Counter = 1;
+		MemoryTools::Copy(Parameters.IV(), 0, m_rcsState->Nonce, 0, BLOCK_SIZE);
+		MemoryTools::Copy(Parameters.IV(), 0, m_rcsState->Origin, 0, BLOCK_SIZE);
+		m_rcsState->Offset = 0;
+
+		if (IsAuthenticator())
+		{
+			SymmetricKey kpm(m_rcsState->Key->MacKey);
+			m_macAuthenticator->Initialize(kpm);
+			m_rcsState->MacTag.resize(m_macAuthenticator->TagSize());
+		}
+
+		m_rcsState->IsEncryption = Encryption;
+		m_rcsState->IsInitialized = true;
+
+		return;
+	}
+
 	// reset for a new key
-	if (IsInitialized() == true)
+	if (IsInitialized() == true || m_rcsState->Key != nullptr)
 	{
 		Reset();
 	}
 
+	// the key schedule is built in a new context, a context shared by other instances is never modified
+	std::shared_ptr<RcsKey> tmpk(new RcsKey());
+
 	// set the initial processed-bytes count to one
 	m_rcsState->Counter = 1;
 
 	// set the number of rounds -v1.0d
-	m_rcsState->Rounds = (Parameters.KeySizes().KeySize() == IK256_SIZE) ?
+	tmpk->Rounds = (Parameters.KeySizes().KeySize() == IK256_SIZE) ?
 		RK256_COUNT : 
 		(Parameters.KeySizes().KeySize() == IK512_SIZE) ?
 			RK512_COUNT : 
@@ -441,6 +598,7 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 			KmacModes::KMAC256;
 
 		m_macAuthenticator.reset(new KMAC(m_rcsState->Authenticator));
+		tmpk->Authenticator = m_rcsState->Authenticator;
 	}
 
 	// store the customization string -v1.0d
@@ -465,6 +623,8 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 
 	// copy the nonce to state
 	MemoryTools::Copy(Parameters.IV(), 0, m_rcsState->Nonce, 0, BLOCK_SIZE);
+	// store the initial counter, Seek positions are relative to it
+	MemoryTools::Copy(Parameters.IV(), 0, m_rcsState->Origin, 0, BLOCK_SIZE);
 
 	// cipher key size determines key expansion function and Mac generator type; 256 or 512-bit
 	m_rcsState->Mode = (Parameters.KeySizes().KeySize() == IK512_SIZE) ?
@@ -473,13 +633,14 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 			ShakeModes::SHAKE256 : 
 			ShakeModes::SHAKE1024;
 
+	tmpk->Mode = m_rcsState->Mode;
 	Kdf::SHAKE gen(m_rcsState->Mode);
 	// initialize cSHAKE with k,c,n
 	gen.Initialize(Parameters.SecureKey(), m_rcsState->Custom, m_rcsState->Name);
 
 	// size the round key array
-	const size_t RNKLEN = static_cast<size_t>(BLOCK_SIZE / sizeof(uint)) * static_cast<size_t>(m_rcsState->Rounds + 1UL);
-	m_rcsState->RoundKeys.resize(RNKLEN);
+	const size_t RNKLEN = static_cast<size_t>(BLOCK_SIZE / sizeof(uint)) * static_cast<size_t>(tmpk->Rounds + 1UL);
+	tmpk->RoundKeys.resize(RNKLEN);
 	// generate the round keys to a temporary byte array
 	SecureVector<byte> tmpr(RNKLEN * sizeof(uint));
 	// generate the ciphers round-keys
@@ -488,7 +649,7 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 	// realign in big endian format for ACS test vectors; RCS is the fallback to the AES-NI implementation
 	for (i = 0; i < tmpr.size() / sizeof(uint); ++i)
 	{
-		m_rcsState->RoundKeys[i] = IntegerTools::BeBytesTo32(tmpr, i * sizeof(uint));
+		tmpk->RoundKeys[i] = IntegerTools::BeBytesTo32(tmpr, i * sizeof(uint));
 	}
 
 	MemoryTools::Clear(tmpr, 0, tmpr.size());
@@ -503,11 +664,13 @@ void RCS::Initialize(bool Encryption, ISymmetricKey &Parameters)
 		SymmetricKey kpm(mack);
 		m_macAuthenticator->Initialize(kpm);
 		// store the key
-		m_rcsState->MacKey.resize(mack.size());
-		SecureMove(mack, 0, m_rcsState->MacKey, 0, mack.size());
+		tmpk->MacKey.resize(mack.size());
+		SecureMove(mack, 0, tmpk->MacKey, 0, mack.size());
 		m_rcsState->MacTag.resize(m_macAuthenticator->TagSize());
 	}
 
+	tmpk->CipherName = Name();
+	m_rcsState->Key = tmpk;
 	m_rcsState->IsEncryption = Encryption;
 	m_rcsState->IsInitialized = true;
 }
@@ -522,6 +685,22 @@ void RCS::ParallelMaxDegree(size_t Degree)
 	m_parallelProfile.SetMaxDegree(Degree);
 }
 
+void RCS::Seek(ulong Position)
+{
+	if (IsInitialized() == false)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Seek"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (IsAuthenticator() == true)
+	{
+		throw CryptoSymmetricException(Name(), std::string("Seek"), std::string("The MAC is computed over the whole message; an authenticated cipher can not seek!"), ErrorCodes::IllegalOperation);
+	}
+
+	// counter = initial counter + block index
+	IntegerTools::LeIncrease8(m_rcsState->Origin, m_rcsState->Nonce, static_cast<ulong>(Position / BLOCK_SIZE));
+	m_rcsState->Offset = Position % BLOCK_SIZE;
+}
+
 void RCS::SetAssociatedData(const std::vector<byte> &Input, size_t Offset, size_t Length)
 {
 	if (IsInitialized() == false)
@@ -543,55 +722,22 @@ void RCS::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the block-size!");
 
-	if (IsEncryption() == true)
+	if (IsEncryption() == true && IsAuthenticator() == true && Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
 	{
-		if (IsAuthenticator() == true)
-		{
-			if (Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
-			{
-				throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
-			}
-
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(m_rcsState->Nonce, 0, BLOCK_SIZE);
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Output, OutOffset, Length);
-			// update the processed bytes counter
-			m_rcsState->Counter += Length;
-			// finalize the mac and copy the tag to the end of the output stream
-			Finalize(m_rcsState, m_macAuthenticator);
-			MemoryTools::Copy(m_rcsState->MacTag, 0, Output, OutOffset + Length, m_rcsState->MacTag.size());
-		}
-		else
-		{
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-		}
+		throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
 	}
-	else
-	{
-		if (IsAuthenticator())
-		{
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(m_rcsState->Nonce, 0, BLOCK_SIZE);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Input, InOffset, Length);
-			// update the processed bytes counter
-			m_rcsState->Counter += Length;
-			// finalize the mac and verify
-			Finalize(m_rcsState, m_macAuthenticator);
 
-			if (!IntegerTools::Compare(Input, InOffset + Length, m_rcsState->MacTag, 0, m_rcsState->MacTag.size()))
-			{
-				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-			}
-		}
+	ProcessStream(Input, InOffset, Output, OutOffset, Length);
+}
 
-		// decrypt the stream
-		Process(Input, InOffset, Output, OutOffset, Length);
-	}
+void RCS::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	const size_t INPLEN = (IsEncryption() == false && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+	const size_t OTPLEN = (IsEncryption() == true && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+
+	ProcessStream(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -621,7 +767,7 @@ void RCS::Finalize(std::unique_ptr<RcsState> &State, std::unique_ptr<IMac> &Auth
 	Authenticator->Finalize(State->MacTag, 0);
 }
 
-void RCS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
+void RCS::Generate(const Span<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
 {
 	size_t bctr;
 
@@ -767,10 +913,39 @@ void RCS::PrefetchSbox()
 }
 CEX_OPTIMIZE_RESUME
 
-void RCS::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void RCS::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	size_t i;
 
+	if (m_rcsState->Offset != 0 && Length != 0)
+	{
+		// finish the partial block left by a Seek, then continue block aligned
+		const size_t BLKOFT = static_cast<size_t>(m_rcsState->Offset);
+		const size_t PRTLEN = IntegerTools::Min(BLOCK_SIZE - BLKOFT, Length);
+		std::vector<byte> tmpc(m_rcsState->Nonce);
+		std::vector<byte> otp(BLOCK_SIZE);
+
+		Generate(otp, 0, BLOCK_SIZE, tmpc);
+
+		for (i = 0; i < PRTLEN; ++i)
+		{
+			Output[OutOffset + i] = Input[InOffset + i] ^ otp[BLKOFT + i];
+		}
+
+		m_rcsState->Offset += PRTLEN;
+
+		if (m_rcsState->Offset == BLOCK_SIZE)
+		{
+			// the block is consumed, keep the incremented counter
+			MemoryTools::Copy(tmpc, 0, m_rcsState->Nonce, 0, BLOCK_SIZE);
+			m_rcsState->Offset = 0;
+		}
+
+		InOffset += PRTLEN;
+		OutOffset += PRTLEN;
+		Length -= PRTLEN;
+	}
+
 	const size_t PRLBLK = m_parallelProfile.ParallelBlockSize();
 
 	if (m_parallelProfile.IsParallel() && Length >= PRLBLK)
@@ -796,7 +971,7 @@ void RCS::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<b
 	}
 }
 
-void RCS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void RCS::ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t OUTLEN = Output.size() - OutOffset < Length ? Output.size() - OutOffset : Length;
 	const size_t CNKLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
@@ -810,10 +985,21 @@ void RCS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 		// offset counter by chunk size / block size  
 		IntegerTools::LeIncrease8(m_rcsState->Nonce, thdc, static_cast<uint>(CTRLEN * i));
 		const size_t STMPOS = i * CNKLEN;
-		// generate random at output offset
-		this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
-		// xor with input at offsets
-		MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+
+		if (Input.data() + InOffset != Output.data() + OutOffset)
+		{
+			// generate random at output offset
+			this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
+			// xor with input at offsets
+			MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+		}
+		else
+		{
+			// in-place; the key-stream is generated to a thread buffer
+			std::vector<byte> thdk(CNKLEN);
+			this->Generate(thdk, 0, CNKLEN, thdc);
+			MemoryTools::XOR(thdk, 0, Output, OutOffset + STMPOS, CNKLEN);
+		}
 
 		// store last counter
 		if (i == m_parallelProfile.ParallelMaxDegree() - 1)
@@ -833,37 +1019,107 @@ void RCS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 		InOffset += ALNLEN;
 		OutOffset += ALNLEN;
 
-		Generate(Output, OutOffset, FNLLEN, m_rcsState->Nonce);
+		std::vector<byte> fnlk(FNLLEN);
+
+		Generate(fnlk, 0, FNLLEN, m_rcsState->Nonce);
 
 		for (size_t i = 0; i < FNLLEN; ++i)
 		{
-			Output[OutOffset + i] ^= Input[InOffset + i];
+			Output[OutOffset + i] = Input[InOffset + i] ^ fnlk[i];
 		}
 	}
 }
 
-void RCS::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void RCS::ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	// get block aligned
 	const size_t ALNLEN = Length - (Length % BLOCK_SIZE);
 	size_t i;
 
-	// generate random
-	Generate(Output, OutOffset, Length, m_rcsState->Nonce);
+	if (Input.data() + InOffset != Output.data() + OutOffset)
+	{
+		// generate random
+		Generate(Output, OutOffset, Length, m_rcsState->Nonce);
+
+		if (ALNLEN != 0)
+		{
+			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		}
 
-	if (ALNLEN != 0)
+		// get the remaining bytes
+		if (ALNLEN != Length)
+		{
+			for (i = ALNLEN; i < Length; ++i)
+			{
+				Output[i + OutOffset] ^= Input[i + InOffset];
+			}
+		}
+	}
+	else
 	{
-		MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		// in-place; the key-stream is generated to a temporary buffer in block-aligned segments
+		const size_t SEGLEN = 64 * BLOCK_SIZE;
+		std::vector<byte> tmpk(Length < SEGLEN ? Length : SEGLEN);
+		size_t plen;
+
+		i = 0;
+
+		while (i != Length)
+		{
+			plen = (Length - i < tmpk.size()) ? Length - i : tmpk.size();
+			Generate(tmpk, 0, plen, m_rcsState->Nonce);
+			MemoryTools::XOR(tmpk, 0, Output, OutOffset + i, plen);
+			i += plen;
+		}
 	}
+}
 
-	// get the remaining bytes
-	if (ALNLEN != Length)
+void RCS::ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (IsEncryption() == true)
 	{
-		for (i = ALNLEN; i < Length; ++i)
+		if (IsAuthenticator() == true)
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(m_rcsState->Nonce, 0, BLOCK_SIZE);
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Output.data() + OutOffset, Length);
+			// update the processed bytes counter
+			m_rcsState->Counter += Length;
+			// finalize the mac and copy the tag to the end of the output stream
+			Finalize(m_rcsState, m_macAuthenticator);
+			MemoryTools::Copy(m_rcsState->MacTag, 0, Output, OutOffset + Length, m_rcsState->MacTag.size());
+		}
+		else
 		{
-			Output[i + OutOffset] ^= Input[i + InOffset];
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
 		}
 	}
+	else
+	{
+		if (IsAuthenticator())
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(m_rcsState->Nonce, 0, BLOCK_SIZE);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Input.data() + InOffset, Length);
+			// update the processed bytes counter
+			m_rcsState->Counter += Length;
+			// finalize the mac and verify
+			Finalize(m_rcsState, m_macAuthenticator);
+
+			if (!IntegerTools::Compare(Input, InOffset + Length, m_rcsState->MacTag, 0, m_rcsState->MacTag.size()))
+			{
+				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+			}
+		}
+
+		// decrypt the stream
+		Process(Input, InOffset, Output, OutOffset, Length);
+	}
 }
 
 void RCS::Reset()
@@ -880,54 +1136,96 @@ void RCS::Reset()
 
 SecureVector<byte> RCS::Serialize()
 {
+	if (m_rcsState->Key == nullptr)
+	{
+		throw CryptoSymmetricException(std::string("RCS"), std::string("Serialize"), std::string("The cipher has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
 	SecureVector<byte> tmps = m_rcsState->Serialize();
 
 	return tmps;
 }
 
-void RCS::Transform256(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RCS::Transform256(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_SSSE3)
+
+	// constant-time vector permute rounds, the block is held as two 128-bit halves
+	std::array<__m128i, 2> state;
+
+	state[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset));
+	state[1] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + 16));
+	VpEncrypt256(state, m_rcsState->Key->RoundKeys, static_cast<size_t>(m_rcsState->Key->Rounds));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset), state[0]);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset + 16), state[1]);
+
+#else
+
 	SecureVector<byte> state(BLOCK_SIZE, 0x00);
 	size_t i;
 
 	MemoryTools::Copy(Input, InOffset, state, 0, BLOCK_SIZE);
-	KeyAddition(state, m_rcsState->RoundKeys, 0);
+	KeyAddition(state, m_rcsState->Key->RoundKeys, 0);
 
 	// pre-load the s-box into L1 cache
-#if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
+#	if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
 	PrefetchSbox();
-#endif
+#	endif
 
-	for (i = 1; i < m_rcsState->Rounds; ++i)
+	for (i = 1; i < m_rcsState->Key->Rounds; ++i)
 	{
 		Substitution(state);
 		ShiftRows256(state);
 		MixColumns(state);
-		KeyAddition(state, m_rcsState->RoundKeys, (i << 3UL));
+		KeyAddition(state, m_rcsState->Key->RoundKeys, (i << 3UL));
 	}
 
 	Substitution(state);
 	ShiftRows256(state);
-	KeyAddition(state, m_rcsState->RoundKeys, static_cast<size_t>(m_rcsState->Rounds) << 3UL);
+	KeyAddition(state, m_rcsState->Key->RoundKeys, static_cast<size_t>(m_rcsState->Key->Rounds) << 3UL);
 
 	MemoryTools::Copy(state, 0, Output, OutOffset, BLOCK_SIZE);
+
+#endif
 }
 
-void RCS::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RCS::Transform1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_SSSE3)
+
+	// 4 blocks, the rounds of all blocks are interleaved
+	std::array<__m128i, 8> state;
+	size_t i;
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		state[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + (i * 16)));
+	}
+
+	VpEncrypt256(state, m_rcsState->Key->RoundKeys, static_cast<size_t>(m_rcsState->Key->Rounds));
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset + (i * 16)), state[i]);
+	}
+
+#else
+
 	Transform256(Input, InOffset, Output, OutOffset);
 	Transform256(Input, InOffset + 32, Output, OutOffset + 32);
 	Transform256(Input, InOffset + 64, Output, OutOffset + 64);
 	Transform256(Input, InOffset + 96, Output, OutOffset + 96);
+
+#endif
 }
 
-void RCS::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RCS::Transform2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	Transform1024(Input, InOffset, Output, OutOffset);
 	Transform1024(Input, InOffset + 128, Output, OutOffset + 128);
 }
 
-void RCS::Transform4096(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RCS::Transform4096(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	Transform2048(Input, InOffset, Output, OutOffset);
 	Transform2048(Input, InOffset + 256, Output, OutOffset + 256);
@@ -188,6 +188,14 @@ void RHX::DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Decrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void RHX::DecryptBlock(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	Decrypt128(INP, 0, OTP, 0);
+}
+
 void RHX::EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
 {
 	Encrypt128(Input, 0, Output, 0);
@@ -198,6 +206,14 @@ void RHX::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Encrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void RHX::EncryptBlock(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	Encrypt128(INP, 0, OTP, 0);
+}
+
 void RHX::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
 	if (!SymmetricKeySize::Contains(m_legalKeySizes, Parameters.KeySizes().KeySize()))
@@ -263,6 +279,21 @@ void RHX::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	}
 }
 
+void RHX::Transform(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	if (m_rhxState->Encryption)
+	{
+		Encrypt128(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt128(INP, 0, OTP, 0);
+	}
+}
+
 void RHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_rhxState->Encryption)
@@ -275,6 +306,21 @@ void RHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vec
 	}
 }
 
+void RHX::Transform512(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 4 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 4 * BLOCK_SIZE);
+
+	if (m_rhxState->Encryption)
+	{
+		Encrypt512(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt512(INP, 0, OTP, 0);
+	}
+}
+
 void RHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_rhxState->Encryption)
@@ -287,6 +333,21 @@ void RHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::ve
 	}
 }
 
+void RHX::Transform1024(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 8 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 8 * BLOCK_SIZE);
+
+	if (m_rhxState->Encryption)
+	{
+		Encrypt1024(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt1024(INP, 0, OTP, 0);
+	}
+}
+
 void RHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_rhxState->Encryption)
@@ -299,6 +360,21 @@ void RHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::ve
 	}
 }
 
+void RHX::Transform2048(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 16 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 16 * BLOCK_SIZE);
+
+	if (m_rhxState->Encryption)
+	{
+		Encrypt2048(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt2048(INP, 0, OTP, 0);
+	}
+}
+
 //~~~Key Schedule~~~//
 
 void RHX::SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<RhxState> &State, std::unique_ptr<IKdf> &Generator)
@@ -467,8 +543,18 @@ void RHX::ExpandSubBlock(SecureVector<uint> &RoundKeys, size_t KeyIndex, size_t
 
 //~~~Rounds Processing~~~//
 
-void RHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_SSSE3)
+
+	std::array<__m128i, 1> state;
+
+	state[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset));
+	VpDecrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset), state[0]);
+
+#else
+
 	SecureVector<byte> state(BLOCK_SIZE, 0x00);
 	size_t i;
 
@@ -476,9 +562,9 @@ void RHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	KeyAddition(state, m_rhxState->RoundKeys, m_rhxState->Rounds << 2);
 
 	// pre-load the s-box into L1 cache
-#if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
+#	if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
 	PrefetchISbox();
-#endif
+#	endif
 
 	for (i = m_rhxState->Rounds - 1; i > 0; --i)
 	{
@@ -493,30 +579,96 @@ void RHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	KeyAddition(state, m_rhxState->RoundKeys, 0);
 
 	MemoryTools::Copy(state, 0, Output, OutOffset, BLOCK_SIZE);
+
+#endif
 }
 
-void RHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Decrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_AVX2)
+
+	// two blocks per register, the rounds of both registers are interleaved
+	std::array<__m256i, 2> state;
+
+	state[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input.data() + InOffset));
+	state[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input.data() + InOffset + 32));
+	VpDecrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output.data() + OutOffset), state[0]);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output.data() + OutOffset + 32), state[1]);
+
+#elif defined(CEX_HAS_SSSE3)
+
+	std::array<__m128i, 4> state;
+	size_t i;
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		state[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + (i * BLOCK_SIZE)));
+	}
+
+	VpDecrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset + (i * BLOCK_SIZE)), state[i]);
+	}
+
+#else
+
 	Decrypt128(Input, InOffset, Output, OutOffset);
 	Decrypt128(Input, InOffset + 16, Output, OutOffset + 16);
 	Decrypt128(Input, InOffset + 32, Output, OutOffset + 32);
 	Decrypt128(Input, InOffset + 48, Output, OutOffset + 48);
+
+#endif
 }
 
-void RHX::Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Decrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_AVX2)
+
+	std::array<__m256i, 4> state;
+	size_t i;
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		state[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input.data() + InOffset + (i * 2 * BLOCK_SIZE)));
+	}
+
+	VpDecrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output.data() + OutOffset + (i * 2 * BLOCK_SIZE)), state[i]);
+	}
+
+#else
+
 	Decrypt512(Input, InOffset, Output, OutOffset);
 	Decrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+
+#endif
 }
 
-void RHX::Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Decrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	Decrypt1024(Input, InOffset, Output, OutOffset);
 	Decrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
 }
 
-void RHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_SSSE3)
+
+	// constant-time vector permute rounds, no secret dependent table lookups
+	std::array<__m128i, 1> state;
+
+	state[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset));
+	VpEncrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset), state[0]);
+
+#else
+
 	SecureVector<byte> state(BLOCK_SIZE, 0x00);
 	size_t i;
 
@@ -524,9 +676,9 @@ void RHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	KeyAddition(state, m_rhxState->RoundKeys, 0);
 
 	// pre-load the s-box into L1 cache
-#if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
+#	if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
 	PrefetchSbox();
-#endif
+#	endif
 
 	for (i = 1; i < m_rhxState->Rounds; ++i)
 	{
@@ -540,23 +692,78 @@ void RHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	ShiftRows128(state);
 	KeyAddition(state, m_rhxState->RoundKeys, (m_rhxState->Rounds << 2));
 	MemoryTools::Copy(state, 0, Output, OutOffset, BLOCK_SIZE);
+
+#endif
 }
 
-void RHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Encrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_AVX2)
+
+	// two blocks per register, the rounds of both registers are interleaved
+	std::array<__m256i, 2> state;
+
+	state[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input.data() + InOffset));
+	state[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input.data() + InOffset + 32));
+	VpEncrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output.data() + OutOffset), state[0]);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output.data() + OutOffset + 32), state[1]);
+
+#elif defined(CEX_HAS_SSSE3)
+
+	std::array<__m128i, 4> state;
+	size_t i;
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		state[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Input.data() + InOffset + (i * BLOCK_SIZE)));
+	}
+
+	VpEncrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Output.data() + OutOffset + (i * BLOCK_SIZE)), state[i]);
+	}
+
+#else
+
 	Encrypt128(Input, InOffset, Output, OutOffset);
 	Encrypt128(Input, InOffset + 16, Output, OutOffset + 16);
 	Encrypt128(Input, InOffset + 32, Output, OutOffset + 32);
 	Encrypt128(Input, InOffset + 48, Output, OutOffset + 48);
+
+#endif
 }
 
-void RHX::Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Encrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
+#if defined(CEX_HAS_AVX2)
+
+	std::array<__m256i, 4> state;
+	size_t i;
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		state[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Input.data() + InOffset + (i * 2 * BLOCK_SIZE)));
+	}
+
+	VpEncrypt128(state, m_rhxState->RoundKeys, m_rhxState->Rounds);
+
+	for (i = 0; i < state.size(); ++i)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output.data() + OutOffset + (i * 2 * BLOCK_SIZE)), state[i]);
+	}
+
+#else
+
 	Encrypt512(Input, InOffset, Output, OutOffset);
 	Encrypt512(Input, InOffset + 64, Output, OutOffset + 64);
+
+#endif
 }
 
-void RHX::Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RHX::Encrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	Encrypt1024(Input, InOffset, Output, OutOffset);
 	Encrypt1024(Input, InOffset + 128, Output, OutOffset + 128);
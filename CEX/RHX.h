@@ -83,7 +83,9 @@ NAMESPACE_BLOCK
 /// </list>
 /// <para>AHX, the Intel AES-NI implementation is considered the primary AES/eAES implementation, with this version used as a fallback. \n
 /// There are two implementations in this version, the constant-time implementation which is the default, and the table-based implementation, 
-/// which is fast but vulnerable to timing related side-channel attacks.</para>
+/// which is fast but vulnerable to timing related side-channel attacks. \n
+/// When compiled with SSSE3 or AVX2, the rounds use a vector permute (pshufb) implementation of the s-box that has no secret dependent memory accesses,
+/// and the 4, 8, and 16 block transforms interleave the rounds of several blocks; with AVX2, two blocks are processed in each 256-bit register.</para>
 /// <para>When using the extended mode of the cipher, the minimum key size is 32 bytes (256 bits), and valid key sizes are 256, 512, and 1024 bits long. \n
 /// RHX is capable of processing up to 38 transformation rounds in extended mode; a 256-bit key uses 22 rounds, a 512-bit key 30 rounds, and a 1024-bit key is set to 38 rounds.</para>
 /// 
@@ -232,6 +234,16 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	void DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Decrypt a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>false</c> before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">Encrypted bytes</param>
+	/// <param name="Output">Decrypted bytes</param>
+	void DecryptBlock(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Encrypt a block of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>true</c> before this method can be used.
@@ -254,6 +266,16 @@ public:
 	/// <param name="OutOffset">Starting offset within the output array</param>
 	void EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Encrypt a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called with the Encryption flag set to <c>true</c> before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void EncryptBlock(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Initialize the cipher with a populated SymmetricKey or SymmetricSecureKey container
 	/// </summary>
@@ -287,6 +309,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform a block of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Transform 4 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -299,6 +331,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform 4 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 4 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform512(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Transform 8 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -311,6 +353,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform 8 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 8 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform1024(const byte* Input, byte* Output) override;
+
 	/// <summary>
 	/// Transform 16 blocks of bytes.
 	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
@@ -323,6 +375,16 @@ public:
 	/// <param name="OutOffset">Starting offset in the output array</param>
 	void Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Transform 16 blocks of bytes using pointers.
+	/// <para><see cref="Initialize(bool, ISymmetricKey)"/> must be called before this method can be used.
+	/// Input and Output must point to at least 16 * <see cref="BlockSize"/> bytes; the Input and Output may be the same buffer.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input bytes</param>
+	/// <param name="Output">A pointer to the output bytes</param>
+	void Transform2048(const byte* Input, byte* Output) override;
+
 private:
 
 	static std::vector<SymmetricKeySize> CalculateKeySizes(BlockCipherExtensions Extension);
@@ -336,14 +398,14 @@ private:
 	static void SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<RhxState> &State, std::unique_ptr<IKdf> &Generator);
 	static void StandardExpand(const SecureVector<byte> &Key, std::unique_ptr<RhxState> &State);
 
-	void Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
-	void Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset);
+	void Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Decrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Decrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Decrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
+	void Encrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset);
 };
 
 NAMESPACE_BLOCKEND
@@ -544,55 +544,22 @@ void RWS::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
 	CEXASSERT(IntegerTools::Min(Input.size() - InOffset, Output.size() - OutOffset) >= Length, "The data arrays are smaller than the block-size!");
 
-	if (IsEncryption() == true)
+	if (IsEncryption() == true && IsAuthenticator() == true && Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
 	{
-		if (IsAuthenticator() == true)
-		{
-			if (Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
-			{
-				throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
-			}
-
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(m_rwsState->Nonce, 0, BLOCK_SIZE);
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Output, OutOffset, Length);
-			// update the processed bytes counter
-			m_rwsState->Counter += Length;
-			// finalize the mac and copy the tag to the end of the output stream
-			Finalize(m_rwsState, m_macAuthenticator);
-			MemoryTools::Copy(m_rwsState->MacTag, 0, Output, OutOffset + Length, m_rwsState->MacTag.size());
-		}
-		else
-		{
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-		}
+		throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
 	}
-	else
-	{
-		if (IsAuthenticator())
-		{
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(m_rwsState->Nonce, 0, BLOCK_SIZE);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Input, InOffset, Length);
-			// update the processed bytes counter
-			m_rwsState->Counter += Length;
-			// finalize the mac and verify
-			Finalize(m_rwsState, m_macAuthenticator);
 
-			if (!IntegerTools::Compare(Input, InOffset + Length, m_rwsState->MacTag, 0, m_rwsState->MacTag.size()))
-			{
-				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-			}
-		}
+	ProcessStream(Input, InOffset, Output, OutOffset, Length);
+}
 
-		// decrypt the stream
-		Process(Input, InOffset, Output, OutOffset, Length);
-	}
+void RWS::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	const size_t INPLEN = (IsEncryption() == false && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+	const size_t OTPLEN = (IsEncryption() == true && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+
+	ProcessStream(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -622,7 +589,7 @@ void RWS::Finalize(std::unique_ptr<RwsState> &State, std::unique_ptr<IMac> &Auth
 	Authenticator->Finalize(State->MacTag, 0);
 }
 
-void RWS::Generate(std::vector<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
+void RWS::Generate(const Span<byte> &Output, size_t OutOffset, size_t Length, std::vector<byte> &Counter)
 {
 	size_t bctr;
 
@@ -768,7 +735,7 @@ void RWS::PrefetchSbox()
 }
 CEX_OPTIMIZE_RESUME
 
-void RWS::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void RWS::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	size_t i;
 
@@ -797,7 +764,7 @@ void RWS::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<b
 	}
 }
 
-void RWS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void RWS::ProcessParallel(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t OUTLEN = Output.size() - OutOffset < Length ? Output.size() - OutOffset : Length;
 	const size_t CNKLEN = m_parallelProfile.ParallelBlockSize() / m_parallelProfile.ParallelMaxDegree();
@@ -811,10 +778,21 @@ void RWS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 		// offset counter by chunk size / block size  
 		IntegerTools::LeIncrease8(m_rwsState->Nonce, thdc, static_cast<uint>(CTRLEN * i));
 		const size_t STMPOS = i * CNKLEN;
-		// generate random at output offset
-		this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
-		// xor with input at offsets
-		MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+
+		if (Input.data() + InOffset != Output.data() + OutOffset)
+		{
+			// generate random at output offset
+			this->Generate(Output, OutOffset + STMPOS, CNKLEN, thdc);
+			// xor with input at offsets
+			MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+		}
+		else
+		{
+			// in-place; the key-stream is generated to a thread buffer
+			std::vector<byte> thdk(CNKLEN);
+			this->Generate(thdk, 0, CNKLEN, thdc);
+			MemoryTools::XOR(thdk, 0, Output, OutOffset + STMPOS, CNKLEN);
+		}
 
 		// store last counter
 		if (i == m_parallelProfile.ParallelMaxDegree() - 1)
@@ -835,37 +813,107 @@ void RWS::ProcessParallel(const std::vector<byte> &Input, size_t InOffset, std::
 		InOffset += ALNLEN;
 		OutOffset += ALNLEN;
 
-		Generate(Output, OutOffset, FNLLEN, m_rwsState->Nonce);
+		std::vector<byte> fnlk(FNLLEN);
+
+		Generate(fnlk, 0, FNLLEN, m_rwsState->Nonce);
 
 		for (size_t i = 0; i < FNLLEN; ++i)
 		{
-			Output[OutOffset + i] ^= Input[InOffset + i];
+			Output[OutOffset + i] = Input[InOffset + i] ^ fnlk[i];
 		}
 	}
 }
 
-void RWS::ProcessSequential(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void RWS::ProcessSequential(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	// get block aligned
 	const size_t ALNLEN = Length - (Length % BLOCK_SIZE);
 	size_t i;
 
-	// generate random
-	Generate(Output, OutOffset, Length, m_rwsState->Nonce);
+	if (Input.data() + InOffset != Output.data() + OutOffset)
+	{
+		// generate random
+		Generate(Output, OutOffset, Length, m_rwsState->Nonce);
 
-	if (ALNLEN != 0)
+		if (ALNLEN != 0)
+		{
+			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		}
+
+		// get the remaining bytes
+		if (ALNLEN != Length)
+		{
+			for (i = ALNLEN; i < Length; ++i)
+			{
+				Output[i + OutOffset] ^= Input[i + InOffset];
+			}
+		}
+	}
+	else
 	{
-		MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+		// in-place; the key-stream is generated to a temporary buffer in block-aligned segments
+		const size_t SEGLEN = 64 * BLOCK_SIZE;
+		std::vector<byte> tmpk(Length < SEGLEN ? Length : SEGLEN);
+		size_t plen;
+
+		i = 0;
+
+		while (i != Length)
+		{
+			plen = (Length - i < tmpk.size()) ? Length - i : tmpk.size();
+			Generate(tmpk, 0, plen, m_rwsState->Nonce);
+			MemoryTools::XOR(tmpk, 0, Output, OutOffset + i, plen);
+			i += plen;
+		}
 	}
+}
 
-	// get the remaining bytes
-	if (ALNLEN != Length)
+void RWS::ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (IsEncryption() == true)
 	{
-		for (i = ALNLEN; i < Length; ++i)
+		if (IsAuthenticator() == true)
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(m_rwsState->Nonce, 0, BLOCK_SIZE);
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Output.data() + OutOffset, Length);
+			// update the processed bytes counter
+			m_rwsState->Counter += Length;
+			// finalize the mac and copy the tag to the end of the output stream
+			Finalize(m_rwsState, m_macAuthenticator);
+			MemoryTools::Copy(m_rwsState->MacTag, 0, Output, OutOffset + Length, m_rwsState->MacTag.size());
+		}
+		else
 		{
-			Output[i + OutOffset] ^= Input[i + InOffset];
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
 		}
 	}
+	else
+	{
+		if (IsAuthenticator())
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(m_rwsState->Nonce, 0, BLOCK_SIZE);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Input.data() + InOffset, Length);
+			// update the processed bytes counter
+			m_rwsState->Counter += Length;
+			// finalize the mac and verify
+			Finalize(m_rwsState, m_macAuthenticator);
+
+			if (!IntegerTools::Compare(Input, InOffset + Length, m_rwsState->MacTag, 0, m_rwsState->MacTag.size()))
+			{
+				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+			}
+		}
+
+		// decrypt the stream
+		Process(Input, InOffset, Output, OutOffset, Length);
+	}
 }
 
 void RWS::Reset()
@@ -887,7 +935,7 @@ SecureVector<byte> RWS::Serialize()
 	return tmps;
 }
 
-void RWS::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RWS::Transform512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	SecureVector<byte> state(BLOCK_SIZE, 0x00);
 	size_t i;
@@ -915,24 +963,73 @@ void RWS::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vec
 	MemoryTools::Copy(state, 0, Output, OutOffset, BLOCK_SIZE);
 }
 
-void RWS::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RWS::Transform2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
-	Transform512(Input, InOffset, Output, OutOffset);
-	Transform512(Input, InOffset + 64, Output, OutOffset + 64);
-	Transform512(Input, InOffset + 128, Output, OutOffset + 128);
-	Transform512(Input, InOffset + 192, Output, OutOffset + 192);
+	TransformWide(Input, InOffset, Output, OutOffset, 4);
 }
 
-void RWS::Transform4096(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RWS::Transform4096(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
-	Transform2048(Input, InOffset, Output, OutOffset);
-	Transform2048(Input, InOffset + 256, Output, OutOffset + 256);
+	TransformWide(Input, InOffset, Output, OutOffset, 8);
 }
 
-void RWS::Transform8192(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void RWS::Transform8192(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	Transform4096(Input, InOffset, Output, OutOffset);
 	Transform4096(Input, InOffset + 512, Output, OutOffset + 512);
 }
 
+void RWS::TransformWide(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Count)
+{
+	// the blocks are transformed together one round at a time; the substitution and column mixing
+	// steps are independent per column, and are applied to the whole state in a single pass
+	SecureVector<byte> state(Count * BLOCK_SIZE, 0x00);
+	const Span<byte> STATE(state);
+	size_t i;
+	size_t j;
+
+	MemoryTools::Copy(Input, InOffset, state, 0, state.size());
+
+	for (j = 0; j < Count; ++j)
+	{
+		Span<byte> blk = STATE.Subspan(j * BLOCK_SIZE, BLOCK_SIZE);
+		KeyAddition(blk, m_rwsState->RoundKeys, 0);
+	}
+
+	// pre-load the s-box into L1 cache
+#if defined(CEX_PREFETCH_RIJNDAEL_TABLES)
+	PrefetchSbox();
+#endif
+
+	for (i = 1; i < m_rwsState->Rounds; ++i)
+	{
+		Substitution(state);
+
+		for (j = 0; j < Count; ++j)
+		{
+			Span<byte> blk = STATE.Subspan(j * BLOCK_SIZE, BLOCK_SIZE);
+			ShiftRows512(blk);
+		}
+
+		MixColumns(state);
+
+		for (j = 0; j < Count; ++j)
+		{
+			Span<byte> blk = STATE.Subspan(j * BLOCK_SIZE, BLOCK_SIZE);
+			KeyAddition(blk, m_rwsState->RoundKeys, (i << 4UL));
+		}
+	}
+
+	Substitution(state);
+
+	for (j = 0; j < Count; ++j)
+	{
+		Span<byte> blk = STATE.Subspan(j * BLOCK_SIZE, BLOCK_SIZE);
+		ShiftRows512(blk);
+		KeyAddition(blk, m_rwsState->RoundKeys, static_cast<size_t>(m_rwsState->Rounds) << 4UL);
+	}
+
+	MemoryTools::Copy(state, 0, Output, OutOffset, state.size());
+}
+
 NAMESPACE_STREAMEND
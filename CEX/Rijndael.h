@@ -21,6 +21,9 @@
 
 #include "CexDomain.h"
 #include "IntegerTools.h"
+#if defined(CEX_HAS_SSSE3)
+#	include "Intrinsics.h"
+#endif
 
 NAMESPACE_RIJNDAELBASE
 
@@ -683,6 +686,441 @@ static uint SubWord(uint X, const ArrayU8 &Sbox)
 		| static_cast<uint>(Sbox[X & 0xFF]);
 }
 
+//~~~Vector Permute Rijndael~~~//
+
+// A constant-time SSSE3/AVX2 Rijndael round built from pshufb nibble lookups, after M. Hamburg,
+// "Accelerating AES with Vector Permute Instructions" (CHES 2009).
+// The state stays in the standard basis so the standard round keys are used unchanged.
+// SubBytes maps each byte into GF((2^4)^2) = GF(2^4)[t]/(t^2 + t + 1/a), a = 2 (GF(2^4) modulo x^4 + x + 1),
+// and inverts it using only 16-entry GF(2^4) tables; 1/0 is represented by 0x80, which pshufb maps back to zero.
+// There are no secret-dependent memory accesses, so the s-box prefetch is not needed on this path.
+
+#if defined(CEX_HAS_SSSE3)
+
+/// <summary>
+/// The GF(2^4) inverse table, 1/0 is mapped to 0x80
+/// </summary>
+static const std::array<byte, 16> VpInv =
+{
+	0x80, 0x01, 0x09, 0x0E, 0x0D, 0x0B, 0x07, 0x06, 0x0F, 0x02, 0x0C, 0x05, 0x0A, 0x04, 0x03, 0x08
+};
+
+/// <summary>
+/// The GF(2^4) a/k table, a/0 is mapped to 0x80
+/// </summary>
+static const std::array<byte, 16> VpInvA =
+{
+	0x80, 0x02, 0x01, 0x0F, 0x09, 0x05, 0x0E, 0x0C, 0x0D, 0x04, 0x0B, 0x0A, 0x07, 0x08, 0x06, 0x03
+};
+
+/// <summary>
+/// The forward s-box input basis transform; low and high nibble tables
+/// </summary>
+static const std::array<byte, 32> VpSboxIn =
+{
+	0x00, 0x01, 0x1C, 0x1D, 0x2D, 0x2C, 0x31, 0x30, 0x27, 0x26, 0x3B, 0x3A, 0x0A, 0x0B, 0x16, 0x17,
+	0x00, 0x86, 0xFD, 0x7B, 0x8E, 0x08, 0x73, 0xF5, 0x77, 0xF1, 0x8A, 0x0C, 0xF9, 0x7F, 0x04, 0x82
+};
+
+/// <summary>
+/// The forward s-box output transform and affine map; io and jo tables
+/// </summary>
+static const std::array<byte, 32> VpSboxOut =
+{
+	0x00, 0xCB, 0xD7, 0xB0, 0x21, 0x8D, 0x67, 0xAC, 0x7B, 0x5A, 0xEA, 0x3D, 0x46, 0xF6, 0x91, 0x1C,
+	0x00, 0x9F, 0x61, 0x16, 0xC2, 0x2A, 0x77, 0xE8, 0x89, 0x4B, 0x5D, 0x3C, 0xB5, 0xA3, 0xD4, 0xFE
+};
+
+/// <summary>
+/// The inverse s-box inverse affine map and input basis transform; low and high nibble tables
+/// </summary>
+static const std::array<byte, 32> VpISboxIn =
+{
+	0x2C, 0x99, 0xF0, 0x45, 0xF7, 0x42, 0x2B, 0x9E, 0x38, 0x8D, 0xE4, 0x51, 0xE3, 0x56, 0x3F, 0x8A,
+	0x00, 0xA7, 0xA8, 0x0F, 0xED, 0x4A, 0x45, 0xE2, 0xD1, 0x76, 0x79, 0xDE, 0x3C, 0x9B, 0x94, 0x33
+};
+
+/// <summary>
+/// The inverse s-box output transform; io and jo tables
+/// </summary>
+static const std::array<byte, 32> VpISboxOut =
+{
+	0x00, 0x3B, 0xE4, 0xC8, 0x03, 0x14, 0x2C, 0x17, 0xF3, 0xF0, 0x38, 0xDC, 0x2F, 0xE7, 0xCB, 0xDF,
+	0x00, 0x24, 0x91, 0x19, 0x23, 0x8F, 0x88, 0xAC, 0x3D, 0x1E, 0x07, 0x96, 0xAB, 0xB2, 0x3A, 0xB5
+};
+
+/// <summary>
+/// Byte shuffle masks: ShiftRows128, InvShiftRows128, the column rotations by one and two rows, the round-key word byte swap,
+/// and the Rijndael-256 ShiftRows from the same and the opposite half (0x80 clears the byte)
+/// </summary>
+static const std::array<byte, 112> VpShuffle =
+{
+	0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11,
+	0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3,
+	1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+	2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+	3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+	0, 5, 14, 0x80, 4, 9, 0x80, 0x80, 8, 13, 0x80, 0x80, 12, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 3, 0x80, 0x80, 2, 7, 0x80, 0x80, 6, 11, 0x80, 1, 10, 15
+};
+
+static const size_t VP_SHIFTROWS = 0;
+static const size_t VP_INVSHIFTROWS = 16;
+static const size_t VP_ROTATE1 = 32;
+static const size_t VP_ROTATE2 = 48;
+static const size_t VP_KEYSWAP = 64;
+static const size_t VP_SHIFTROWS256A = 80;
+static const size_t VP_SHIFTROWS256B = 96;
+
+template<typename ArrayT>
+inline static __m128i VpLoad(const ArrayT &Table, size_t Offset)
+{
+	return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Table.data() + Offset));
+}
+
+inline static __m128i VpSubstitute(const __m128i &State, const std::array<byte, 32> &Input, const std::array<byte, 32> &Output)
+{
+	const __m128i NMASK = _mm_set1_epi8(0x0F);
+	const __m128i INV = VpLoad(VpInv, 0);
+	const __m128i INVA = VpLoad(VpInvA, 0);
+	__m128i i;
+	__m128i j;
+	__m128i k;
+	__m128i iak;
+	__m128i jak;
+
+	// change to the tower field basis
+	k = _mm_shuffle_epi8(VpLoad(Input, 0), _mm_and_si128(State, NMASK));
+	k = _mm_xor_si128(k, _mm_shuffle_epi8(VpLoad(Input, 16), _mm_and_si128(_mm_srli_epi32(State, 4), NMASK)));
+	i = _mm_and_si128(_mm_srli_epi32(k, 4), NMASK);
+	k = _mm_and_si128(k, NMASK);
+	j = _mm_xor_si128(i, k);
+	// iak = 1/i + a/k, jak = 1/j + a/k
+	iak = _mm_shuffle_epi8(INVA, k);
+	jak = _mm_xor_si128(iak, _mm_shuffle_epi8(INV, j));
+	iak = _mm_xor_si128(iak, _mm_shuffle_epi8(INV, i));
+	// io = j + 1/iak, jo = i + 1/jak
+	j = _mm_xor_si128(j, _mm_shuffle_epi8(INV, iak));
+	i = _mm_xor_si128(i, _mm_shuffle_epi8(INV, jak));
+
+	// change back to the output basis
+	return _mm_xor_si128(_mm_shuffle_epi8(VpLoad(Output, 0), j), _mm_shuffle_epi8(VpLoad(Output, 16), i));
+}
+
+inline static __m128i VpXTime(const __m128i &State)
+{
+	const __m128i RMASK = _mm_and_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), State), _mm_set1_epi8(0x1B));
+
+	return _mm_xor_si128(_mm_add_epi8(State, State), RMASK);
+}
+
+/// <summary>
+/// Load a 128-bit round key from the big endian round-key words
+/// </summary>
+template<typename ArrayU32>
+inline static void VpRoundKey(const ArrayU32 &Rkeys, size_t RkOffset, __m128i &Key)
+{
+	Key = _mm_setr_epi32(static_cast<int>(Rkeys[RkOffset]), static_cast<int>(Rkeys[RkOffset + 1]), static_cast<int>(Rkeys[RkOffset + 2]), static_cast<int>(Rkeys[RkOffset + 3]));
+	Key = _mm_shuffle_epi8(Key, VpLoad(VpShuffle, VP_KEYSWAP));
+}
+
+inline static __m128i VpXor(const __m128i &A, const __m128i &B)
+{
+	return _mm_xor_si128(A, B);
+}
+
+/// <summary>
+/// The constant-time Rijndael SubBytes
+/// </summary>
+inline static __m128i VpSubBytes(const __m128i &State)
+{
+	return _mm_xor_si128(VpSubstitute(State, VpSboxIn, VpSboxOut), _mm_set1_epi8(0x63));
+}
+
+/// <summary>
+/// The constant-time Rijndael InvSubBytes
+/// </summary>
+inline static __m128i VpInvSubBytes(const __m128i &State)
+{
+	return VpSubstitute(State, VpISboxIn, VpISboxOut);
+}
+
+/// <summary>
+/// The Rijndael-128 ShiftRows
+/// </summary>
+inline static __m128i VpShiftRows128(const __m128i &State)
+{
+	return _mm_shuffle_epi8(State, VpLoad(VpShuffle, VP_SHIFTROWS));
+}
+
+/// <summary>
+/// The Rijndael-128 InvShiftRows
+/// </summary>
+inline static __m128i VpInvShiftRows128(const __m128i &State)
+{
+	return _mm_shuffle_epi8(State, VpLoad(VpShuffle, VP_INVSHIFTROWS));
+}
+
+/// <summary>
+/// The Rijndael-256 ShiftRows, the block is held as two 128-bit halves
+/// </summary>
+inline static void VpShiftRows256(__m128i &State0, __m128i &State1)
+{
+	const __m128i MASKA = VpLoad(VpShuffle, VP_SHIFTROWS256A);
+	const __m128i MASKB = VpLoad(VpShuffle, VP_SHIFTROWS256B);
+	__m128i tmp;
+
+	tmp = _mm_or_si128(_mm_shuffle_epi8(State0, MASKA), _mm_shuffle_epi8(State1, MASKB));
+	State1 = _mm_or_si128(_mm_shuffle_epi8(State1, MASKA), _mm_shuffle_epi8(State0, MASKB));
+	State0 = tmp;
+}
+
+/// <summary>
+/// The Rijndael MixColumns; b = 2(a + r1(a)) + r1(a) + r2(a + r1(a))
+/// </summary>
+inline static __m128i VpMixColumns(const __m128i &State)
+{
+	const __m128i R1 = _mm_shuffle_epi8(State, VpLoad(VpShuffle, VP_ROTATE1));
+	const __m128i U = _mm_xor_si128(State, R1);
+
+	return _mm_xor_si128(_mm_xor_si128(VpXTime(U), R1), _mm_shuffle_epi8(U, VpLoad(VpShuffle, VP_ROTATE2)));
+}
+
+/// <summary>
+/// The Rijndael InvMixColumns; MixColumns(a + 4(a + r2(a)))
+/// </summary>
+inline static __m128i VpInvMixColumns(const __m128i &State)
+{
+	__m128i tmp;
+
+	tmp = _mm_xor_si128(State, _mm_shuffle_epi8(State, VpLoad(VpShuffle, VP_ROTATE2)));
+	tmp = _mm_xor_si128(State, VpXTime(VpXTime(tmp)));
+
+	return VpMixColumns(tmp);
+}
+
+#endif
+
+#if defined(CEX_HAS_AVX2)
+
+template<typename ArrayT>
+inline static __m256i VpLoad256(const ArrayT &Table, size_t Offset)
+{
+	return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Table.data() + Offset)));
+}
+
+inline static __m256i VpSubstitute(const __m256i &State, const std::array<byte, 32> &Input, const std::array<byte, 32> &Output)
+{
+	const __m256i NMASK = _mm256_set1_epi8(0x0F);
+	const __m256i INV = VpLoad256(VpInv, 0);
+	const __m256i INVA = VpLoad256(VpInvA, 0);
+	__m256i i;
+	__m256i j;
+	__m256i k;
+	__m256i iak;
+	__m256i jak;
+
+	k = _mm256_shuffle_epi8(VpLoad256(Input, 0), _mm256_and_si256(State, NMASK));
+	k = _mm256_xor_si256(k, _mm256_shuffle_epi8(VpLoad256(Input, 16), _mm256_and_si256(_mm256_srli_epi32(State, 4), NMASK)));
+	i = _mm256_and_si256(_mm256_srli_epi32(k, 4), NMASK);
+	k = _mm256_and_si256(k, NMASK);
+	j = _mm256_xor_si256(i, k);
+	iak = _mm256_shuffle_epi8(INVA, k);
+	jak = _mm256_xor_si256(iak, _mm256_shuffle_epi8(INV, j));
+	iak = _mm256_xor_si256(iak, _mm256_shuffle_epi8(INV, i));
+	j = _mm256_xor_si256(j, _mm256_shuffle_epi8(INV, iak));
+	i = _mm256_xor_si256(i, _mm256_shuffle_epi8(INV, jak));
+
+	return _mm256_xor_si256(_mm256_shuffle_epi8(VpLoad256(Output, 0), j), _mm256_shuffle_epi8(VpLoad256(Output, 16), i));
+}
+
+inline static __m256i VpXTime(const __m256i &State)
+{
+	const __m256i RMASK = _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_setzero_si256(), State), _mm256_set1_epi8(0x1B));
+
+	return _mm256_xor_si256(_mm256_add_epi8(State, State), RMASK);
+}
+
+/// <summary>
+/// Load a 128-bit round key into both lanes
+/// </summary>
+template<typename ArrayU32>
+inline static void VpRoundKey(const ArrayU32 &Rkeys, size_t RkOffset, __m256i &Key)
+{
+	__m128i tmpk;
+
+	VpRoundKey(Rkeys, RkOffset, tmpk);
+	Key = _mm256_broadcastsi128_si256(tmpk);
+}
+
+inline static __m256i VpXor(const __m256i &A, const __m256i &B)
+{
+	return _mm256_xor_si256(A, B);
+}
+
+inline static __m256i VpSubBytes(const __m256i &State)
+{
+	return _mm256_xor_si256(VpSubstitute(State, VpSboxIn, VpSboxOut), _mm256_set1_epi8(0x63));
+}
+
+inline static __m256i VpInvSubBytes(const __m256i &State)
+{
+	return VpSubstitute(State, VpISboxIn, VpISboxOut);
+}
+
+inline static __m256i VpShiftRows128(const __m256i &State)
+{
+	return _mm256_shuffle_epi8(State, VpLoad256(VpShuffle, VP_SHIFTROWS));
+}
+
+inline static __m256i VpInvShiftRows128(const __m256i &State)
+{
+	return _mm256_shuffle_epi8(State, VpLoad256(VpShuffle, VP_INVSHIFTROWS));
+}
+
+inline static __m256i VpMixColumns(const __m256i &State)
+{
+	const __m256i R1 = _mm256_shuffle_epi8(State, VpLoad256(VpShuffle, VP_ROTATE1));
+	const __m256i U = _mm256_xor_si256(State, R1);
+
+	return _mm256_xor_si256(_mm256_xor_si256(VpXTime(U), R1), _mm256_shuffle_epi8(U, VpLoad256(VpShuffle, VP_ROTATE2)));
+}
+
+inline static __m256i VpInvMixColumns(const __m256i &State)
+{
+	__m256i tmp;
+
+	tmp = _mm256_xor_si256(State, _mm256_shuffle_epi8(State, VpLoad256(VpShuffle, VP_ROTATE2)));
+	tmp = _mm256_xor_si256(State, VpXTime(VpXTime(tmp)));
+
+	return VpMixColumns(tmp);
+}
+
+#endif
+
+#if defined(CEX_HAS_SSSE3)
+
+/// <summary>
+/// Encrypt a set of Rijndael-128 blocks, the rounds of all blocks are interleaved.
+/// <para>The state type is either __m128i (one block) or __m256i (two blocks).</para>
+/// </summary>
+template<typename T, size_t N, typename ArrayU32>
+static void VpEncrypt128(std::array<T, N> &State, const ArrayU32 &Rkeys, size_t Rounds)
+{
+	T key;
+	size_t i;
+	size_t j;
+
+	VpRoundKey(Rkeys, 0, key);
+
+	for (j = 0; j < N; ++j)
+	{
+		State[j] = VpXor(State[j], key);
+	}
+
+	for (i = 1; i < Rounds; ++i)
+	{
+		VpRoundKey(Rkeys, i << 2, key);
+
+		for (j = 0; j < N; ++j)
+		{
+			State[j] = VpXor(VpMixColumns(VpShiftRows128(VpSubBytes(State[j]))), key);
+		}
+	}
+
+	VpRoundKey(Rkeys, Rounds << 2, key);
+
+	for (j = 0; j < N; ++j)
+	{
+		State[j] = VpXor(VpShiftRows128(VpSubBytes(State[j])), key);
+	}
+}
+
+/// <summary>
+/// Decrypt a set of Rijndael-128 blocks with the standard (not the equivalent inverse) key schedule
+/// </summary>
+template<typename T, size_t N, typename ArrayU32>
+static void VpDecrypt128(std::array<T, N> &State, const ArrayU32 &Rkeys, size_t Rounds)
+{
+	T key;
+	size_t i;
+	size_t j;
+
+	VpRoundKey(Rkeys, Rounds << 2, key);
+
+	for (j = 0; j < N; ++j)
+	{
+		State[j] = VpXor(State[j], key);
+	}
+
+	for (i = Rounds - 1; i > 0; --i)
+	{
+		VpRoundKey(Rkeys, i << 2, key);
+
+		for (j = 0; j < N; ++j)
+		{
+			State[j] = VpInvMixColumns(VpXor(VpInvSubBytes(VpInvShiftRows128(State[j])), key));
+		}
+	}
+
+	VpRoundKey(Rkeys, 0, key);
+
+	for (j = 0; j < N; ++j)
+	{
+		State[j] = VpXor(VpInvSubBytes(VpInvShiftRows128(State[j])), key);
+	}
+}
+
+/// <summary>
+/// Encrypt a set of Rijndael-256 blocks, each block is held as two consecutive 128-bit halves
+/// </summary>
+template<size_t N, typename ArrayU32>
+static void VpEncrypt256(std::array<__m128i, N> &State, const ArrayU32 &Rkeys, size_t Rounds)
+{
+	__m128i key0;
+	__m128i key1;
+	size_t i;
+	size_t j;
+
+	VpRoundKey(Rkeys, 0, key0);
+	VpRoundKey(Rkeys, 4, key1);
+
+	for (j = 0; j < N; j += 2)
+	{
+		State[j] = VpXor(State[j], key0);
+		State[j + 1] = VpXor(State[j + 1], key1);
+	}
+
+	for (i = 1; i < Rounds; ++i)
+	{
+		VpRoundKey(Rkeys, i << 3, key0);
+		VpRoundKey(Rkeys, (i << 3) + 4, key1);
+
+		for (j = 0; j < N; j += 2)
+		{
+			State[j] = VpSubBytes(State[j]);
+			State[j + 1] = VpSubBytes(State[j + 1]);
+			VpShiftRows256(State[j], State[j + 1]);
+			State[j] = VpXor(VpMixColumns(State[j]), key0);
+			State[j + 1] = VpXor(VpMixColumns(State[j + 1]), key1);
+		}
+	}
+
+	VpRoundKey(Rkeys, Rounds << 3, key0);
+	VpRoundKey(Rkeys, (Rounds << 3) + 4, key1);
+
+	for (j = 0; j < N; j += 2)
+	{
+		State[j] = VpSubBytes(State[j]);
+		State[j + 1] = VpSubBytes(State[j + 1]);
+		VpShiftRows256(State[j], State[j + 1]);
+		State[j] = VpXor(State[j], key0);
+		State[j + 1] = VpXor(State[j + 1], key1);
+	}
+}
+
+#endif
+
 
 NAMESPACE_RIJNDAELBASEEND
 #endif
@@ -1,4 +1,5 @@
 #include "SHA2.h"
+#include "CpuDetect.h"
 
 NAMESPACE_DIGEST
 
@@ -66,4 +67,14 @@ const std::vector<ulong> SHA2::SHA2512State =
 	0x5BE0CD19137E2179ULL
 };
 
+//~~~Public Functions~~~//
+
+bool SHA2::HasSHANI()
+{
+	// the processor features are detected once, on the first call
+	static const bool HASSHA = CpuDetect().SHA();
+
+	return HASSHA;
+}
+
 NAMESPACE_DIGESTEND
\ No newline at end of file
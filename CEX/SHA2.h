@@ -30,6 +30,9 @@
 #	include "UInt256.h"
 #	include "ULong256.h"
 #endif
+#if defined(CEX_HAS_SSSE3)
+#	include "Intrinsics.h"
+#endif
 
 NAMESPACE_DIGEST
 
@@ -50,6 +53,8 @@ using Tools::MemoryTools;
 /// The compact forms of the permutations have the suffix C, and are optimized for performance and low memory consumption 
 /// (enabled in the hash function by adding the CEX_DIGEST_COMPACT to the CexConfig file). \n
 /// The Unrolled forms are optimized for speed and timing neutrality (suffix U), and the vertically vectorized functions have the V suffix. \n
+/// The SHA2-512 V function expands the message schedule with vector instructions, and PermuteR80P1024 selects it when AVX2 is available. \n
+/// The SHA2-256 V functions use the SHA-NI instructions; PermuteR64P512 selects PermuteR64P512V at run-time when the processor supports them, and PermuteR64P2x512V interleaves two independent states. \n
 /// The H suffix denotes functions that take an SIMD wrapper class (ULongXXX) as the state values, and process state in SIMD parallel blocks.</para>
 /// <para>This class contains wide forms of the functions; PermuteR64P8x512H and PermuteR80P4x1024H use AVX2. \n
 /// Experimental functions using AVX512 instructions are also implemented; PermuteR64P16x512H and PermuteR80P8x1024H. \n
@@ -129,6 +134,11 @@ public:
 	static const size_t SHA2384_RATE_SIZE = 128;
 	static const size_t SHA2512_RATE_SIZE = 128;
 
+	/// <summary>
+	/// The processor supports the SHA-NI instructions; detected once at run-time
+	/// </summary>
+	static bool HasSHANI();
+
 	//~~~SHA2-256~~~//
 
 	/// <summary>
@@ -153,7 +163,7 @@ public:
 
 		while (InLength >= SHA2256_RATE_SIZE)
 		{
-			PermuteR64P512U(Input, InOffset, state);
+			PermuteR64P512(Input, InOffset, state);
 			InLength -= SHA2256_RATE_SIZE;
 			InOffset += SHA2256_RATE_SIZE;
 			t += SHA2256_RATE_SIZE;
@@ -168,14 +178,14 @@ public:
 
 		if (InLength > 56)
 		{
-			PermuteR64P512U(buf, 0, state);
+			PermuteR64P512(buf, 0, state);
 			MemoryTools::Clear(buf, 0, SHA2256_RATE_SIZE);
 		}
 
 		IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitlen) >> 32), buf, 56);
 		IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitlen)), buf, 60);
 
-		PermuteR64P512U(buf, 0, state);
+		PermuteR64P512(buf, 0, state);
 
 		// copy as big endian aligned to output code
 		IntegerTools::BeUL256ToBlock(state, 0, Output, OutOffset);
@@ -200,29 +210,43 @@ public:
 		const byte IPAD = 0x36;
 		const byte OPAD = 0x5C;
 		std::vector<byte> buf(SHA2256_RATE_SIZE);
-		std::vector<byte> ipad(SHA2256_RATE_SIZE);
-		std::vector<byte> opad(SHA2256_RATE_SIZE);
-		std::array<uint, 8> state = { 0 };
+		std::vector<byte> pads(2 * SHA2256_RATE_SIZE);
+		std::array<uint, 8> istate = { 0 };
+		std::array<uint, 8> ostate = { 0 };
 		ulong bitlen;
 		ulong t;
 
 		// copy in the key and xor the hamming weights into input and output pads
-		MemoryTools::Copy(Key, 0, ipad, 0, Key.size());
-		MemoryTools::Copy(ipad, 0, opad, 0, ipad.size());
-		MemoryTools::XorPad(ipad, IPAD);
-		MemoryTools::XorPad(opad, OPAD);
-
-		// initialize the sha256 state
-		MemoryTools::Copy(SHA2256State, 0, state, 0, state.size() * sizeof(uint));
+		MemoryTools::Copy(Key, 0, buf, 0, Key.size());
+		MemoryTools::XorPad(buf, IPAD);
+		MemoryTools::Copy(buf, 0, pads, 0, SHA2256_RATE_SIZE);
+		MemoryTools::XorPad(buf, IPAD ^ OPAD);
+		MemoryTools::Copy(buf, 0, pads, SHA2256_RATE_SIZE, SHA2256_RATE_SIZE);
+		MemoryTools::Clear(buf, 0, SHA2256_RATE_SIZE);
+
+		// initialize the sha256 states
+		MemoryTools::Copy(SHA2256State, 0, istate, 0, istate.size() * sizeof(uint));
+		MemoryTools::Copy(SHA2256State, 0, ostate, 0, ostate.size() * sizeof(uint));
+
+		// permute the input and output pads; the output pad does not depend on the message
+#if defined(CEX_HAS_AVX2)
+		if (HasSHANI())
+		{
+			PermuteR64P2x512V(pads, 0, istate, ostate);
+		}
+		else
+#endif
+		{
+			PermuteR64P512(pads, 0, istate);
+			PermuteR64P512(pads, SHA2256_RATE_SIZE, ostate);
+		}
 
-		// permute the input pad
-		PermuteR64P512U(ipad, 0, state);
 		t = SHA2256_RATE_SIZE;
 
 		// process the message
 		while (InLength >= SHA2256_RATE_SIZE)
 		{
-			PermuteR64P512U(Input, InOffset, state);
+			PermuteR64P512(Input, InOffset, istate);
 			InLength -= SHA2256_RATE_SIZE;
 			InOffset += SHA2256_RATE_SIZE;
 			t += SHA2256_RATE_SIZE;
@@ -237,32 +261,55 @@ public:
 
 		if (InLength > 56)
 		{
-			PermuteR64P512U(buf, 0, state);
+			PermuteR64P512(buf, 0, istate);
 			MemoryTools::Clear(buf, 0, SHA2256_RATE_SIZE);
 		}
 
 		IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitlen) >> 32), buf, 56);
 		IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitlen)), buf, 60);
-		PermuteR64P512U(buf, 0, state);
+		PermuteR64P512(buf, 0, istate);
 
 		// store the code in the buffer
-		IntegerTools::BeUL256ToBlock(state, 0, buf, 0);
+		IntegerTools::BeUL256ToBlock(istate, 0, buf, 0);
 		MemoryTools::Clear(buf, SHA2256_DIGEST_SIZE, SHA2256_DIGEST_SIZE);
-		// reset the sha2 state
-		MemoryTools::Copy(SHA2256State, 0, state, 0, state.size() * sizeof(uint));
 
-		// permute the output pad
-		PermuteR64P512U(opad, 0, state);
 		// finalize the buffer
 		t = SHA2256_RATE_SIZE + SHA2256_DIGEST_SIZE;
 		bitlen = (t << 3);
 		buf[SHA2256_DIGEST_SIZE] = 128;
 		IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitlen) >> 32), buf, 56);
 		IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitlen)), buf, 60);
-		PermuteR64P512U(buf, 0, state);
+		PermuteR64P512(buf, 0, ostate);
 
 		// copy as big endian aligned to output code
-		IntegerTools::BeUL256ToBlock(state, 0, Output, OutOffset);
+		IntegerTools::BeUL256ToBlock(ostate, 0, Output, OutOffset);
+	}
+
+	/// <summary>
+	/// The SHA2-256 permutation function.
+	/// <para>Selects the SHA-NI form of the permutation if the processor supports it, otherwise the compact or unrolled form.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The input message array</param>
+	/// <param name="InOffset">The starting offset within the Input array</param>
+	/// <param name="State">The permutations state array</param>
+	template<typename ArrayU8, typename ArrayU32x8>
+	static void PermuteR64P512(const ArrayU8 &Input, size_t InOffset, ArrayU32x8 &State)
+	{
+#if defined(CEX_HAS_AVX2)
+		if (HasSHANI())
+		{
+			PermuteR64P512V(Input, InOffset, State);
+		}
+		else
+#endif
+		{
+#if defined(CEX_DIGEST_COMPACT)
+			PermuteR64P512C(Input, InOffset, State);
+#else
+			PermuteR64P512U(Input, InOffset, State);
+#endif
+		}
 	}
 
 	/// <summary>
@@ -833,6 +880,355 @@ public:
 		_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[0]), s0);
 		_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[4]), s1);
 	}
+
+	/// <summary>
+	/// The two-way interleaved form of the vectorized SHA2-256 permutation function.
+	/// <para>This function uses the Intel SHA-NI instructions to permute two independent states, the first with the block at InOffset, the second with the block at InOffset + 64.
+	/// The rounds of the two states are interleaved, so the latency of each sha256rnds2 instruction is hidden by the other state.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The input message array; contains two consecutive blocks</param>
+	/// <param name="InOffset">The starting offset within the Input array</param>
+	/// <param name="State0">The state array of the first block</param>
+	/// <param name="State1">The state array of the second block</param>
+	template<typename ArrayU8, typename ArrayU32x8>
+	static void PermuteR64P2x512V(const ArrayU8 &Input, size_t InOffset, ArrayU32x8 &State0, ArrayU32x8 &State1)
+	{
+		__m128i m0a;
+		__m128i m0b;
+		__m128i m1a;
+		__m128i m1b;
+		__m128i m2a;
+		__m128i m2b;
+		__m128i m3a;
+		__m128i m3b;
+		__m128i mask;
+		__m128i pmsga;
+		__m128i pmsgb;
+		__m128i ptmpa;
+		__m128i ptmpb;
+		__m128i rk;
+		__m128i s0a;
+		__m128i s0b;
+		__m128i s1a;
+		__m128i s1b;
+		__m128i t0a;
+		__m128i t0b;
+		__m128i t1a;
+		__m128i t1b;
+
+		// load initial values
+		ptmpa = _mm_loadu_si128(reinterpret_cast<__m128i*>(&State0[0]));
+		ptmpb = _mm_loadu_si128(reinterpret_cast<__m128i*>(&State1[0]));
+		s1a = _mm_loadu_si128(reinterpret_cast<__m128i*>(&State0[4]));
+		s1b = _mm_loadu_si128(reinterpret_cast<__m128i*>(&State1[4]));
+		mask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+		ptmpa = _mm_shuffle_epi32(ptmpa, 0xB1);	// CDAB
+		ptmpb = _mm_shuffle_epi32(ptmpb, 0xB1);
+		s1a = _mm_shuffle_epi32(s1a, 0x1B);		// EFGH
+		s1b = _mm_shuffle_epi32(s1b, 0x1B);
+		s0a = _mm_alignr_epi8(ptmpa, s1a, 8);		// ABEF
+		s0b = _mm_alignr_epi8(ptmpb, s1b, 8);
+		s1a = _mm_blend_epi16(s1a, ptmpa, 0xF0);	// CDGH
+		s1b = _mm_blend_epi16(s1b, ptmpb, 0xF0);
+		t0a = s0a;
+		t0b = s0b;
+		t1a = s1a;
+		t1b = s1b;
+
+		// rounds 0-3
+		pmsga = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset]));
+		pmsgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64]));
+		m0a = _mm_shuffle_epi8(pmsga, mask);
+		m0b = _mm_shuffle_epi8(pmsgb, mask);
+		rk = _mm_set_epi64x(0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL);
+		pmsga = _mm_add_epi32(m0a, rk);
+		pmsgb = _mm_add_epi32(m0b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		// rounds 4-7
+		m1a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16]));
+		m1b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80]));
+		m1a = _mm_shuffle_epi8(m1a, mask);
+		m1b = _mm_shuffle_epi8(m1b, mask);
+		rk = _mm_set_epi64x(0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL);
+		pmsga = _mm_add_epi32(m1a, rk);
+		pmsgb = _mm_add_epi32(m1b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m0a = _mm_sha256msg1_epu32(m0a, m1a);
+		m0b = _mm_sha256msg1_epu32(m0b, m1b);
+		// rounds 8-11
+		m2a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32]));
+		m2b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96]));
+		m2a = _mm_shuffle_epi8(m2a, mask);
+		m2b = _mm_shuffle_epi8(m2b, mask);
+		rk = _mm_set_epi64x(0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL);
+		pmsga = _mm_add_epi32(m2a, rk);
+		pmsgb = _mm_add_epi32(m2b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m1a = _mm_sha256msg1_epu32(m1a, m2a);
+		m1b = _mm_sha256msg1_epu32(m1b, m2b);
+		// rounds 12-15
+		m3a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48]));
+		m3b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112]));
+		m3a = _mm_shuffle_epi8(m3a, mask);
+		m3b = _mm_shuffle_epi8(m3b, mask);
+		rk = _mm_set_epi64x(0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL);
+		pmsga = _mm_add_epi32(m3a, rk);
+		pmsgb = _mm_add_epi32(m3b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m3a, m2a, 4);
+		ptmpb = _mm_alignr_epi8(m3b, m2b, 4);
+		m0a = _mm_add_epi32(m0a, ptmpa);
+		m0b = _mm_add_epi32(m0b, ptmpb);
+		m0a = _mm_sha256msg2_epu32(m0a, m3a);
+		m0b = _mm_sha256msg2_epu32(m0b, m3b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m2a = _mm_sha256msg1_epu32(m2a, m3a);
+		m2b = _mm_sha256msg1_epu32(m2b, m3b);
+		// rounds 16-19
+		rk = _mm_set_epi64x(0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL);
+		pmsga = _mm_add_epi32(m0a, rk);
+		pmsgb = _mm_add_epi32(m0b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m0a, m3a, 4);
+		ptmpb = _mm_alignr_epi8(m0b, m3b, 4);
+		m1a = _mm_add_epi32(m1a, ptmpa);
+		m1b = _mm_add_epi32(m1b, ptmpb);
+		m1a = _mm_sha256msg2_epu32(m1a, m0a);
+		m1b = _mm_sha256msg2_epu32(m1b, m0b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m3a = _mm_sha256msg1_epu32(m3a, m0a);
+		m3b = _mm_sha256msg1_epu32(m3b, m0b);
+		// rounds 20-23
+		rk = _mm_set_epi64x(0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL);
+		pmsga = _mm_add_epi32(m1a, rk);
+		pmsgb = _mm_add_epi32(m1b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m1a, m0a, 4);
+		ptmpb = _mm_alignr_epi8(m1b, m0b, 4);
+		m2a = _mm_add_epi32(m2a, ptmpa);
+		m2b = _mm_add_epi32(m2b, ptmpb);
+		m2a = _mm_sha256msg2_epu32(m2a, m1a);
+		m2b = _mm_sha256msg2_epu32(m2b, m1b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m0a = _mm_sha256msg1_epu32(m0a, m1a);
+		m0b = _mm_sha256msg1_epu32(m0b, m1b);
+		// rounds 24-27
+		rk = _mm_set_epi64x(0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL);
+		pmsga = _mm_add_epi32(m2a, rk);
+		pmsgb = _mm_add_epi32(m2b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m2a, m1a, 4);
+		ptmpb = _mm_alignr_epi8(m2b, m1b, 4);
+		m3a = _mm_add_epi32(m3a, ptmpa);
+		m3b = _mm_add_epi32(m3b, ptmpb);
+		m3a = _mm_sha256msg2_epu32(m3a, m2a);
+		m3b = _mm_sha256msg2_epu32(m3b, m2b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m1a = _mm_sha256msg1_epu32(m1a, m2a);
+		m1b = _mm_sha256msg1_epu32(m1b, m2b);
+		// rounds 28-31
+		rk = _mm_set_epi64x(0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL);
+		pmsga = _mm_add_epi32(m3a, rk);
+		pmsgb = _mm_add_epi32(m3b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m3a, m2a, 4);
+		ptmpb = _mm_alignr_epi8(m3b, m2b, 4);
+		m0a = _mm_add_epi32(m0a, ptmpa);
+		m0b = _mm_add_epi32(m0b, ptmpb);
+		m0a = _mm_sha256msg2_epu32(m0a, m3a);
+		m0b = _mm_sha256msg2_epu32(m0b, m3b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m2a = _mm_sha256msg1_epu32(m2a, m3a);
+		m2b = _mm_sha256msg1_epu32(m2b, m3b);
+		// rounds 32-35
+		rk = _mm_set_epi64x(0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL);
+		pmsga = _mm_add_epi32(m0a, rk);
+		pmsgb = _mm_add_epi32(m0b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m0a, m3a, 4);
+		ptmpb = _mm_alignr_epi8(m0b, m3b, 4);
+		m1a = _mm_add_epi32(m1a, ptmpa);
+		m1b = _mm_add_epi32(m1b, ptmpb);
+		m1a = _mm_sha256msg2_epu32(m1a, m0a);
+		m1b = _mm_sha256msg2_epu32(m1b, m0b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m3a = _mm_sha256msg1_epu32(m3a, m0a);
+		m3b = _mm_sha256msg1_epu32(m3b, m0b);
+		// rounds 36-39
+		rk = _mm_set_epi64x(0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL);
+		pmsga = _mm_add_epi32(m1a, rk);
+		pmsgb = _mm_add_epi32(m1b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m1a, m0a, 4);
+		ptmpb = _mm_alignr_epi8(m1b, m0b, 4);
+		m2a = _mm_add_epi32(m2a, ptmpa);
+		m2b = _mm_add_epi32(m2b, ptmpb);
+		m2a = _mm_sha256msg2_epu32(m2a, m1a);
+		m2b = _mm_sha256msg2_epu32(m2b, m1b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m0a = _mm_sha256msg1_epu32(m0a, m1a);
+		m0b = _mm_sha256msg1_epu32(m0b, m1b);
+		// rounds 40-43
+		rk = _mm_set_epi64x(0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL);
+		pmsga = _mm_add_epi32(m2a, rk);
+		pmsgb = _mm_add_epi32(m2b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m2a, m1a, 4);
+		ptmpb = _mm_alignr_epi8(m2b, m1b, 4);
+		m3a = _mm_add_epi32(m3a, ptmpa);
+		m3b = _mm_add_epi32(m3b, ptmpb);
+		m3a = _mm_sha256msg2_epu32(m3a, m2a);
+		m3b = _mm_sha256msg2_epu32(m3b, m2b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m1a = _mm_sha256msg1_epu32(m1a, m2a);
+		m1b = _mm_sha256msg1_epu32(m1b, m2b);
+		// rounds 44-47
+		rk = _mm_set_epi64x(0x106AA070F40E3585ULL, 0xD6990624D192E819ULL);
+		pmsga = _mm_add_epi32(m3a, rk);
+		pmsgb = _mm_add_epi32(m3b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m3a, m2a, 4);
+		ptmpb = _mm_alignr_epi8(m3b, m2b, 4);
+		m0a = _mm_add_epi32(m0a, ptmpa);
+		m0b = _mm_add_epi32(m0b, ptmpb);
+		m0a = _mm_sha256msg2_epu32(m0a, m3a);
+		m0b = _mm_sha256msg2_epu32(m0b, m3b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m2a = _mm_sha256msg1_epu32(m2a, m3a);
+		m2b = _mm_sha256msg1_epu32(m2b, m3b);
+		// rounds 48-51
+		rk = _mm_set_epi64x(0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL);
+		pmsga = _mm_add_epi32(m0a, rk);
+		pmsgb = _mm_add_epi32(m0b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m0a, m3a, 4);
+		ptmpb = _mm_alignr_epi8(m0b, m3b, 4);
+		m1a = _mm_add_epi32(m1a, ptmpa);
+		m1b = _mm_add_epi32(m1b, ptmpb);
+		m1a = _mm_sha256msg2_epu32(m1a, m0a);
+		m1b = _mm_sha256msg2_epu32(m1b, m0b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		m3a = _mm_sha256msg1_epu32(m3a, m0a);
+		m3b = _mm_sha256msg1_epu32(m3b, m0b);
+		// rounds 52-55
+		rk = _mm_set_epi64x(0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL);
+		pmsga = _mm_add_epi32(m1a, rk);
+		pmsgb = _mm_add_epi32(m1b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m1a, m0a, 4);
+		ptmpb = _mm_alignr_epi8(m1b, m0b, 4);
+		m2a = _mm_add_epi32(m2a, ptmpa);
+		m2b = _mm_add_epi32(m2b, ptmpb);
+		m2a = _mm_sha256msg2_epu32(m2a, m1a);
+		m2b = _mm_sha256msg2_epu32(m2b, m1b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		// rounds 56-59
+		rk = _mm_set_epi64x(0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL);
+		pmsga = _mm_add_epi32(m2a, rk);
+		pmsgb = _mm_add_epi32(m2b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		ptmpa = _mm_alignr_epi8(m2a, m1a, 4);
+		ptmpb = _mm_alignr_epi8(m2b, m1b, 4);
+		m3a = _mm_add_epi32(m3a, ptmpa);
+		m3b = _mm_add_epi32(m3b, ptmpb);
+		m3a = _mm_sha256msg2_epu32(m3a, m2a);
+		m3b = _mm_sha256msg2_epu32(m3b, m2b);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+		// rounds 60-63
+		rk = _mm_set_epi64x(0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL);
+		pmsga = _mm_add_epi32(m3a, rk);
+		pmsgb = _mm_add_epi32(m3b, rk);
+		s1a = _mm_sha256rnds2_epu32(s1a, s0a, pmsga);
+		s1b = _mm_sha256rnds2_epu32(s1b, s0b, pmsgb);
+		pmsga = _mm_shuffle_epi32(pmsga, 0x0E);
+		pmsgb = _mm_shuffle_epi32(pmsgb, 0x0E);
+		s0a = _mm_sha256rnds2_epu32(s0a, s1a, pmsga);
+		s0b = _mm_sha256rnds2_epu32(s0b, s1b, pmsgb);
+
+		// combine state 
+		s0a = _mm_add_epi32(s0a, t0a);
+		s0b = _mm_add_epi32(s0b, t0b);
+		s1a = _mm_add_epi32(s1a, t1a);
+		s1b = _mm_add_epi32(s1b, t1b);
+		ptmpa = _mm_shuffle_epi32(s0a, 0x1B);		// FEBA
+		ptmpb = _mm_shuffle_epi32(s0b, 0x1B);
+		s1a = _mm_shuffle_epi32(s1a, 0xB1);		// DCHG
+		s1b = _mm_shuffle_epi32(s1b, 0xB1);
+		s0a = _mm_blend_epi16(ptmpa, s1a, 0xF0);	// DCBA
+		s0b = _mm_blend_epi16(ptmpb, s1b, 0xF0);
+		s1a = _mm_alignr_epi8(s1a, ptmpa, 8);		// ABEF
+		s1b = _mm_alignr_epi8(s1b, ptmpb, 8);
+
+		// store
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&State0[0]), s0a);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&State0[4]), s1a);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&State1[0]), s0b);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&State1[4]), s1b);
+	}
 #endif
 
 #if defined(CEX_HAS_AVX512)
@@ -863,7 +1259,7 @@ public:
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint))),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 64),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 128),
-				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 196),
+				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 192),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 256),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 320),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 384),
@@ -953,7 +1349,7 @@ public:
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint))),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 64),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 128),
-				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 196),
+				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 192),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 256),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 320),
 				IntegerTools::BeBytesTo32(Input, InOffset + (i * sizeof(uint)) + 384),
@@ -1032,7 +1428,7 @@ public:
 
 		while (InLength >= SHA2384_RATE_SIZE)
 		{
-			PermuteR80P1024U(Input, InOffset, state);
+			PermuteR80P1024(Input, InOffset, state);
 			InLength -= SHA2384_RATE_SIZE;
 			InOffset += SHA2384_RATE_SIZE;
 			t[0] += SHA2384_RATE_SIZE;
@@ -1047,14 +1443,14 @@ public:
 
 		if (InLength > 112)
 		{
-			PermuteR80P1024U(buf, 0, state);
+			PermuteR80P1024(buf, 0, state);
 			MemoryTools::Clear(buf, 0, SHA2384_RATE_SIZE);
 		}
 
 		IntegerTools::Be64ToBytes(t[1], buf, 112);
 		IntegerTools::Be64ToBytes(bitlen, buf, 120);
 
-		PermuteR80P1024U(buf, 0, state);
+		PermuteR80P1024(buf, 0, state);
 
 		// copy as big endian aligned to output code
 		IntegerTools::Be64ToBytes(state[0], Output, OutOffset);
@@ -1088,7 +1484,7 @@ public:
 
 		while (InLength >= SHA2512_RATE_SIZE)
 		{
-			PermuteR80P1024U(Input, InOffset, state);
+			PermuteR80P1024(Input, InOffset, state);
 			InLength -= SHA2512_RATE_SIZE;
 			InOffset += SHA2512_RATE_SIZE;
 			t[0] += SHA2512_RATE_SIZE;
@@ -1103,14 +1499,14 @@ public:
 
 		if (InLength > 112)
 		{
-			PermuteR80P1024U(buf, 0, state);
+			PermuteR80P1024(buf, 0, state);
 			MemoryTools::Clear(buf, 0, SHA2512_RATE_SIZE);
 		}
 
 		IntegerTools::Be64ToBytes(t[1], buf, 112);
 		IntegerTools::Be64ToBytes(bitlen, buf, 120);
 
-		PermuteR80P1024U(buf, 0, state);
+		PermuteR80P1024(buf, 0, state);
 
 		// copy as big endian aligned to output code
 		IntegerTools::BeULL512ToBlock(state, 0, Output, OutOffset);
@@ -1151,13 +1547,13 @@ public:
 		MemoryTools::Copy(SHA2512State, 0, state, 0, state.size() * sizeof(ulong));
 
 		// permute the input pad
-		PermuteR80P1024U(ipad, 0, state);
+		PermuteR80P1024(ipad, 0, state);
 		t[0] = SHA2512_RATE_SIZE;
 
 		// process the message
 		while (InLength >= SHA2512_RATE_SIZE)
 		{
-			PermuteR80P1024U(Input, InOffset, state);
+			PermuteR80P1024(Input, InOffset, state);
 			InLength -= SHA2512_RATE_SIZE;
 			InOffset += SHA2512_RATE_SIZE;
 			t[0] += SHA2512_RATE_SIZE;
@@ -1172,13 +1568,13 @@ public:
 
 		if (InLength > 112)
 		{
-			PermuteR80P1024U(buf, 0, state);
+			PermuteR80P1024(buf, 0, state);
 			MemoryTools::Clear(buf, 0, SHA2512_RATE_SIZE);
 		}
 
 		IntegerTools::Be64ToBytes(t[1], buf, 112);
 		IntegerTools::Be64ToBytes(bitlen, buf, 120);
-		PermuteR80P1024U(buf, 0, state);
+		PermuteR80P1024(buf, 0, state);
 
 		// store the code in the buffer
 		IntegerTools::BeULL512ToBlock(state, 0, buf, 0);
@@ -1187,19 +1583,40 @@ public:
 		MemoryTools::Copy(SHA2512State, 0, state, 0, state.size() * sizeof(ulong));
 
 		// permute the output pad
-		PermuteR80P1024U(opad, 0, state);
+		PermuteR80P1024(opad, 0, state);
 		// finalize the buffer
 		t[0] = SHA2512_RATE_SIZE + SHA2512_DIGEST_SIZE;
 		bitlen = (t[0] << 3);
 		buf[SHA2512_DIGEST_SIZE] = 128;
 		IntegerTools::Be64ToBytes(t[1], buf, 112);
 		IntegerTools::Be64ToBytes(bitlen, buf, 120);
-		PermuteR80P1024U(buf, 0, state);
+		PermuteR80P1024(buf, 0, state);
 
 		// copy as big endian aligned to output code
 		IntegerTools::BeULL512ToBlock(state, 0, Output, OutOffset);
 	}
 
+	/// <summary>
+	/// The SHA2-512 permutation function.
+	/// <para>Selects the compact form if CEX_DIGEST_COMPACT is defined, otherwise the vectorized form on SSSE3 builds without BMI2, and the unrolled form on all others.
+	/// With BMI2 the compiler uses the non-destructive rorx rotate in the scalar rounds, and the unrolled form is on par with the vectorized form.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The input message array</param>
+	/// <param name="InOffset">The starting offset within the Input array</param>
+	/// <param name="State">The permutations state array</param>
+	template<typename ArrayU8, typename ArrayU64x8>
+	static void PermuteR80P1024(const ArrayU8 &Input, size_t InOffset, ArrayU64x8 &State)
+	{
+#if defined(CEX_DIGEST_COMPACT)
+		PermuteR80P1024C(Input, InOffset, State);
+#elif defined(CEX_HAS_SSSE3) && !defined(CEX_HAS_BMI2)
+		PermuteR80P1024V(Input, InOffset, State);
+#else
+		PermuteR80P1024U(Input, InOffset, State);
+#endif
+	}
+
 	/// <summary>
 	/// The compact form of the SHA2-512 permutation function.
 	/// <para>This function has been optimized for a small memory consumption.
@@ -1647,6 +2064,374 @@ public:
 		State[7] += H;
 	}
 
+#if defined(CEX_HAS_SSSE3)
+
+	/// <summary>
+	/// The vectorized form of the SHA2-512 permutation function.
+	/// <para>The message schedule is expanded two words at a time with 128-bit SSSE3 instructions, and the round constants are added in the same step; the rounds remain scalar.
+	/// The expansion of the next eight words is interleaved with each group of eight scalar rounds, so the vector and integer units run in parallel.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The input message array</param>
+	/// <param name="InOffset">The starting offset within the Input array</param>
+	/// <param name="State">The permutations state array</param>
+	template<typename ArrayU8, typename ArrayU64x8>
+	static void PermuteR80P1024V(const ArrayU8 &Input, size_t InOffset, ArrayU64x8 &State)
+	{
+		std::array<ulong, 80> WK;
+		__m128i mask;
+		__m128i W0;
+		__m128i W1;
+		__m128i W2;
+		__m128i W3;
+		__m128i W4;
+		__m128i W5;
+		__m128i W6;
+		__m128i W7;
+		__m128i X;
+		__m128i Y;
+		ulong A;
+		ulong B;
+		ulong C;
+		ulong D;
+		ulong E;
+		ulong F;
+		ulong G;
+		ulong H;
+
+		A = State[0];
+		B = State[1];
+		C = State[2];
+		D = State[3];
+		E = State[4];
+		F = State[5];
+		G = State[6];
+		H = State[7];
+
+		// load the message as big endian word pairs, and add the first sixteen round constants
+		mask = _mm_set_epi64x(0x08090A0B0C0D0E0FULL, 0x0001020304050607ULL);
+		W0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 0])), mask);
+		W1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 16])), mask);
+		W2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 32])), mask);
+		W3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 48])), mask);
+		W4 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 64])), mask);
+		W5 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 80])), mask);
+		W6 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 96])), mask);
+		W7 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Input[InOffset + 112])), mask);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[0]), _mm_add_epi64(W0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[0]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[2]), _mm_add_epi64(W1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[2]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[4]), _mm_add_epi64(W2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[4]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[6]), _mm_add_epi64(W3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[6]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[8]), _mm_add_epi64(W4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[8]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[10]), _mm_add_epi64(W5, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[10]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[12]), _mm_add_epi64(W6, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[12]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[14]), _mm_add_epi64(W7, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[14]))));
+
+		// each group of rounds is interleaved with the expansion of the words used sixteen rounds later;
+		// the eight vectors hold the previous sixteen words, the pair (t - 16, t - 15) is replaced with (t, t + 1)
+		// expand words 16-23
+		X = _mm_alignr_epi8(W1, W0, 8);
+		Y = _mm_alignr_epi8(W5, W4, 8);
+		W0 = _mm_add_epi64(W0, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W7;
+		W0 = _mm_add_epi64(W0, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[16]), _mm_add_epi64(W0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[16]))));
+		X = _mm_alignr_epi8(W2, W1, 8);
+		Y = _mm_alignr_epi8(W6, W5, 8);
+		W1 = _mm_add_epi64(W1, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W0;
+		W1 = _mm_add_epi64(W1, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[18]), _mm_add_epi64(W1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[18]))));
+		X = _mm_alignr_epi8(W3, W2, 8);
+		Y = _mm_alignr_epi8(W7, W6, 8);
+		W2 = _mm_add_epi64(W2, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W1;
+		W2 = _mm_add_epi64(W2, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[20]), _mm_add_epi64(W2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[20]))));
+		X = _mm_alignr_epi8(W4, W3, 8);
+		Y = _mm_alignr_epi8(W0, W7, 8);
+		W3 = _mm_add_epi64(W3, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W2;
+		W3 = _mm_add_epi64(W3, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[22]), _mm_add_epi64(W3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[22]))));
+		// rounds 0-7
+		Round512(A, B, C, D, E, F, G, H, WK[0], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[1], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[2], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[3], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[4], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[5], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[6], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[7], 0);
+		// expand words 24-31
+		X = _mm_alignr_epi8(W5, W4, 8);
+		Y = _mm_alignr_epi8(W1, W0, 8);
+		W4 = _mm_add_epi64(W4, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W3;
+		W4 = _mm_add_epi64(W4, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[24]), _mm_add_epi64(W4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[24]))));
+		X = _mm_alignr_epi8(W6, W5, 8);
+		Y = _mm_alignr_epi8(W2, W1, 8);
+		W5 = _mm_add_epi64(W5, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W4;
+		W5 = _mm_add_epi64(W5, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[26]), _mm_add_epi64(W5, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[26]))));
+		X = _mm_alignr_epi8(W7, W6, 8);
+		Y = _mm_alignr_epi8(W3, W2, 8);
+		W6 = _mm_add_epi64(W6, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W5;
+		W6 = _mm_add_epi64(W6, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[28]), _mm_add_epi64(W6, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[28]))));
+		X = _mm_alignr_epi8(W0, W7, 8);
+		Y = _mm_alignr_epi8(W4, W3, 8);
+		W7 = _mm_add_epi64(W7, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W6;
+		W7 = _mm_add_epi64(W7, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[30]), _mm_add_epi64(W7, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[30]))));
+		// rounds 8-15
+		Round512(A, B, C, D, E, F, G, H, WK[8], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[9], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[10], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[11], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[12], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[13], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[14], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[15], 0);
+		// expand words 32-39
+		X = _mm_alignr_epi8(W1, W0, 8);
+		Y = _mm_alignr_epi8(W5, W4, 8);
+		W0 = _mm_add_epi64(W0, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W7;
+		W0 = _mm_add_epi64(W0, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[32]), _mm_add_epi64(W0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[32]))));
+		X = _mm_alignr_epi8(W2, W1, 8);
+		Y = _mm_alignr_epi8(W6, W5, 8);
+		W1 = _mm_add_epi64(W1, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W0;
+		W1 = _mm_add_epi64(W1, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[34]), _mm_add_epi64(W1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[34]))));
+		X = _mm_alignr_epi8(W3, W2, 8);
+		Y = _mm_alignr_epi8(W7, W6, 8);
+		W2 = _mm_add_epi64(W2, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W1;
+		W2 = _mm_add_epi64(W2, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[36]), _mm_add_epi64(W2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[36]))));
+		X = _mm_alignr_epi8(W4, W3, 8);
+		Y = _mm_alignr_epi8(W0, W7, 8);
+		W3 = _mm_add_epi64(W3, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W2;
+		W3 = _mm_add_epi64(W3, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[38]), _mm_add_epi64(W3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[38]))));
+		// rounds 16-23
+		Round512(A, B, C, D, E, F, G, H, WK[16], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[17], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[18], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[19], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[20], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[21], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[22], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[23], 0);
+		// expand words 40-47
+		X = _mm_alignr_epi8(W5, W4, 8);
+		Y = _mm_alignr_epi8(W1, W0, 8);
+		W4 = _mm_add_epi64(W4, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W3;
+		W4 = _mm_add_epi64(W4, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[40]), _mm_add_epi64(W4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[40]))));
+		X = _mm_alignr_epi8(W6, W5, 8);
+		Y = _mm_alignr_epi8(W2, W1, 8);
+		W5 = _mm_add_epi64(W5, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W4;
+		W5 = _mm_add_epi64(W5, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[42]), _mm_add_epi64(W5, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[42]))));
+		X = _mm_alignr_epi8(W7, W6, 8);
+		Y = _mm_alignr_epi8(W3, W2, 8);
+		W6 = _mm_add_epi64(W6, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W5;
+		W6 = _mm_add_epi64(W6, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[44]), _mm_add_epi64(W6, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[44]))));
+		X = _mm_alignr_epi8(W0, W7, 8);
+		Y = _mm_alignr_epi8(W4, W3, 8);
+		W7 = _mm_add_epi64(W7, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W6;
+		W7 = _mm_add_epi64(W7, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[46]), _mm_add_epi64(W7, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[46]))));
+		// rounds 24-31
+		Round512(A, B, C, D, E, F, G, H, WK[24], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[25], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[26], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[27], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[28], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[29], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[30], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[31], 0);
+		// expand words 48-55
+		X = _mm_alignr_epi8(W1, W0, 8);
+		Y = _mm_alignr_epi8(W5, W4, 8);
+		W0 = _mm_add_epi64(W0, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W7;
+		W0 = _mm_add_epi64(W0, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[48]), _mm_add_epi64(W0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[48]))));
+		X = _mm_alignr_epi8(W2, W1, 8);
+		Y = _mm_alignr_epi8(W6, W5, 8);
+		W1 = _mm_add_epi64(W1, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W0;
+		W1 = _mm_add_epi64(W1, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[50]), _mm_add_epi64(W1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[50]))));
+		X = _mm_alignr_epi8(W3, W2, 8);
+		Y = _mm_alignr_epi8(W7, W6, 8);
+		W2 = _mm_add_epi64(W2, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W1;
+		W2 = _mm_add_epi64(W2, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[52]), _mm_add_epi64(W2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[52]))));
+		X = _mm_alignr_epi8(W4, W3, 8);
+		Y = _mm_alignr_epi8(W0, W7, 8);
+		W3 = _mm_add_epi64(W3, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W2;
+		W3 = _mm_add_epi64(W3, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[54]), _mm_add_epi64(W3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[54]))));
+		// rounds 32-39
+		Round512(A, B, C, D, E, F, G, H, WK[32], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[33], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[34], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[35], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[36], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[37], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[38], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[39], 0);
+		// expand words 56-63
+		X = _mm_alignr_epi8(W5, W4, 8);
+		Y = _mm_alignr_epi8(W1, W0, 8);
+		W4 = _mm_add_epi64(W4, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W3;
+		W4 = _mm_add_epi64(W4, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[56]), _mm_add_epi64(W4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[56]))));
+		X = _mm_alignr_epi8(W6, W5, 8);
+		Y = _mm_alignr_epi8(W2, W1, 8);
+		W5 = _mm_add_epi64(W5, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W4;
+		W5 = _mm_add_epi64(W5, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[58]), _mm_add_epi64(W5, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[58]))));
+		X = _mm_alignr_epi8(W7, W6, 8);
+		Y = _mm_alignr_epi8(W3, W2, 8);
+		W6 = _mm_add_epi64(W6, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W5;
+		W6 = _mm_add_epi64(W6, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[60]), _mm_add_epi64(W6, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[60]))));
+		X = _mm_alignr_epi8(W0, W7, 8);
+		Y = _mm_alignr_epi8(W4, W3, 8);
+		W7 = _mm_add_epi64(W7, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W6;
+		W7 = _mm_add_epi64(W7, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[62]), _mm_add_epi64(W7, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[62]))));
+		// rounds 40-47
+		Round512(A, B, C, D, E, F, G, H, WK[40], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[41], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[42], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[43], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[44], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[45], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[46], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[47], 0);
+		// expand words 64-71
+		X = _mm_alignr_epi8(W1, W0, 8);
+		Y = _mm_alignr_epi8(W5, W4, 8);
+		W0 = _mm_add_epi64(W0, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W7;
+		W0 = _mm_add_epi64(W0, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[64]), _mm_add_epi64(W0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[64]))));
+		X = _mm_alignr_epi8(W2, W1, 8);
+		Y = _mm_alignr_epi8(W6, W5, 8);
+		W1 = _mm_add_epi64(W1, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W0;
+		W1 = _mm_add_epi64(W1, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[66]), _mm_add_epi64(W1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[66]))));
+		X = _mm_alignr_epi8(W3, W2, 8);
+		Y = _mm_alignr_epi8(W7, W6, 8);
+		W2 = _mm_add_epi64(W2, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W1;
+		W2 = _mm_add_epi64(W2, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[68]), _mm_add_epi64(W2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[68]))));
+		X = _mm_alignr_epi8(W4, W3, 8);
+		Y = _mm_alignr_epi8(W0, W7, 8);
+		W3 = _mm_add_epi64(W3, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W2;
+		W3 = _mm_add_epi64(W3, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[70]), _mm_add_epi64(W3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[70]))));
+		// rounds 48-55
+		Round512(A, B, C, D, E, F, G, H, WK[48], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[49], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[50], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[51], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[52], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[53], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[54], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[55], 0);
+		// expand words 72-79
+		X = _mm_alignr_epi8(W5, W4, 8);
+		Y = _mm_alignr_epi8(W1, W0, 8);
+		W4 = _mm_add_epi64(W4, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W3;
+		W4 = _mm_add_epi64(W4, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[72]), _mm_add_epi64(W4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[72]))));
+		X = _mm_alignr_epi8(W6, W5, 8);
+		Y = _mm_alignr_epi8(W2, W1, 8);
+		W5 = _mm_add_epi64(W5, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W4;
+		W5 = _mm_add_epi64(W5, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[74]), _mm_add_epi64(W5, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[74]))));
+		X = _mm_alignr_epi8(W7, W6, 8);
+		Y = _mm_alignr_epi8(W3, W2, 8);
+		W6 = _mm_add_epi64(W6, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W5;
+		W6 = _mm_add_epi64(W6, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[76]), _mm_add_epi64(W6, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[76]))));
+		X = _mm_alignr_epi8(W0, W7, 8);
+		Y = _mm_alignr_epi8(W4, W3, 8);
+		W7 = _mm_add_epi64(W7, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 1), _mm_slli_epi64(X, 63)), _mm_or_si128(_mm_srli_epi64(X, 8), _mm_slli_epi64(X, 56))), _mm_srli_epi64(X, 7)));
+		X = W6;
+		W7 = _mm_add_epi64(W7, _mm_add_epi64(Y, _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(X, 19), _mm_slli_epi64(X, 45)), _mm_or_si128(_mm_srli_epi64(X, 61), _mm_slli_epi64(X, 3))), _mm_srli_epi64(X, 6))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&WK[78]), _mm_add_epi64(W7, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA2512_RC80[78]))));
+		// rounds 56-63
+		Round512(A, B, C, D, E, F, G, H, WK[56], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[57], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[58], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[59], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[60], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[61], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[62], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[63], 0);
+		// rounds 64-71
+		Round512(A, B, C, D, E, F, G, H, WK[64], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[65], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[66], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[67], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[68], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[69], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[70], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[71], 0);
+		// rounds 72-79
+		Round512(A, B, C, D, E, F, G, H, WK[72], 0);
+		Round512(H, A, B, C, D, E, F, G, WK[73], 0);
+		Round512(G, H, A, B, C, D, E, F, WK[74], 0);
+		Round512(F, G, H, A, B, C, D, E, WK[75], 0);
+		Round512(E, F, G, H, A, B, C, D, WK[76], 0);
+		Round512(D, E, F, G, H, A, B, C, WK[77], 0);
+		Round512(C, D, E, F, G, H, A, B, WK[78], 0);
+		Round512(B, C, D, E, F, G, H, A, WK[79], 0);
+
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+
+#endif
+
 #if defined(CEX_HAS_AVX512)
 
 	/// <summary>
@@ -1,4 +1,5 @@
 #include "SHA2256.h"
+#include "DigestBatch.h"
 #include "SHA2.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
@@ -18,6 +19,9 @@ class SHA2256::SHA2256State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = (8 * sizeof(uint)) + sizeof(ulong);
+
 	std::array<uint, 8> H = { 0 };
 	ulong T;
 
@@ -33,6 +37,13 @@ public:
 		T = 0;
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, H, 0, H.size() * sizeof(uint));
+		Offset += H.size() * sizeof(uint);
+		MemoryTools::CopyToObject(SecureState, Offset, &T, sizeof(ulong));
+	}
+
 	void Increase(size_t Length)
 	{
 		T += Length;
@@ -43,6 +54,166 @@ public:
 		T = 0;
 		MemoryTools::Copy(SHA2::SHA2256State, 0, H, 0, H.size() * sizeof(uint));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(H, 0, SecureState, Offset, H.size() * sizeof(uint));
+		Offset += H.size() * sizeof(uint);
+		MemoryTools::CopyFromObject(&T, SecureState, Offset, sizeof(ulong));
+	}
+};
+
+class SHA2256::SHA2256Lanes
+{
+private:
+
+#if defined(CEX_HAS_AVX512)
+	static const size_t WIDE_LANES = 16;
+#elif defined(CEX_HAS_AVX2)
+	static const size_t WIDE_LANES = 8;
+#else
+	static const size_t WIDE_LANES = 1;
+#endif
+
+	bool m_hasSha2;
+
+public:
+
+	typedef SHA2256State State;
+
+	static const size_t BLOCK_SIZE = SHA2::SHA2256_RATE_SIZE;
+	static const size_t DIGEST_SIZE = SHA2::SHA2256_DIGEST_SIZE;
+
+	explicit SHA2256Lanes(bool HasSHA2)
+		:
+		m_hasSha2(HasSHA2)
+	{
+	}
+
+	size_t Lanes()
+	{
+#if defined(CEX_HAS_AVX2)
+		// two interleaved sha-ni permutations are faster than the lanes of the wide permutation
+		return m_hasSha2 ? 2 : WIDE_LANES;
+#else
+		return WIDE_LANES;
+#endif
+	}
+
+	size_t Blocks(size_t Length)
+	{
+		// the message, the 0x80 pad byte, and the 64-bit bit length
+		return (Length + 9 + (BLOCK_SIZE - 1)) / BLOCK_SIZE;
+	}
+
+	void Block(const std::vector<byte> &Message, size_t Index, std::vector<byte> &Output, size_t Lane, State &Value)
+	{
+		const size_t MSGOFT = Index * BLOCK_SIZE;
+		const size_t OUTOFT = Lane * BLOCK_SIZE;
+
+		if (MSGOFT + BLOCK_SIZE <= Message.size())
+		{
+			MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, BLOCK_SIZE);
+		}
+		else
+		{
+			const size_t RMDLEN = (Message.size() > MSGOFT) ? Message.size() - MSGOFT : 0;
+
+			MemoryTools::Clear(Output, OUTOFT, BLOCK_SIZE);
+
+			if (RMDLEN != 0)
+			{
+				MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, RMDLEN);
+			}
+
+			// the pad byte is in the block holding the end of the message, the length is in the last block
+			if (MSGOFT <= Message.size())
+			{
+				Output[OUTOFT + RMDLEN] = 0x80;
+			}
+
+			if (Index == Blocks(Message.size()) - 1)
+			{
+				IntegerTools::Be64ToBytes(static_cast<ulong>(Message.size()) << 3, Output, OUTOFT + BLOCK_SIZE - sizeof(ulong));
+			}
+		}
+	}
+
+	void Finalize(State &Value, std::vector<byte> &Output)
+	{
+		IntegerTools::BeUL256ToBlock(Value.H, 0, Output, 0);
+	}
+
+	void Permute(const std::vector<byte> &Input, State &Value)
+	{
+#if defined(CEX_HAS_AVX2)
+		if (m_hasSha2)
+		{
+			SHA2::PermuteR64P512V(Input, 0, Value.H);
+		}
+		else
+#endif
+		{
+#if defined(CEX_DIGEST_COMPACT)
+			SHA2::PermuteR64P512C(Input, 0, Value.H);
+#else
+			SHA2::PermuteR64P512U(Input, 0, Value.H);
+#endif
+		}
+	}
+
+	void PermuteW(const std::vector<byte> &Input, std::vector<State> &Values)
+	{
+#if defined(CEX_HAS_AVX512) || defined(CEX_HAS_AVX2)
+
+		if (m_hasSha2)
+		{
+			SHA2::PermuteR64P2x512V(Input, 0, Values[0].H, Values[1].H);
+			return;
+		}
+
+#	if defined(CEX_HAS_AVX512)
+		std::array<UInt512, 8> wstate;
+#	else
+		std::array<UInt256, 8> wstate;
+#	endif
+		std::array<uint, 8 * WIDE_LANES> tmps;
+		size_t i;
+		size_t j;
+
+		// the wide permutation loads the block at lane offset j into the vector element (WIDE_LANES - 1 - j)
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)] = Values[j].H[i];
+			}
+		}
+
+		MemoryTools::Copy(tmps, 0, wstate, 0, tmps.size() * sizeof(uint));
+#	if defined(CEX_HAS_AVX512)
+		SHA2::PermuteR64P16x512H(Input, 0, wstate);
+#	else
+		SHA2::PermuteR64P8x512H(Input, 0, wstate);
+#	endif
+		MemoryTools::Copy(wstate, 0, tmps, 0, tmps.size() * sizeof(uint));
+
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				Values[j].H[i] = tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)];
+			}
+		}
+
+		MemoryTools::Clear(tmps, 0, tmps.size() * sizeof(uint));
+
+#else
+
+		Permute(Input, Values[0]);
+
+#endif
+	}
 };
 
 //~~~Constructor~~~//
@@ -61,6 +232,12 @@ SHA2256::SHA2256(bool Parallel)
 		SHA2Params(SHA2::SHA2256_DIGEST_SIZE, static_cast<byte>(SHA2::SHA2256_RATE_SIZE), static_cast<byte>(DEF_PRLDEGREE)) :
 		SHA2Params(SHA2::SHA2256_DIGEST_SIZE, 0UL, 0x00))
 {
+	if (Parallel)
+	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+	}
+
 	Reset();
 }
 
@@ -145,6 +322,56 @@ void SHA2256::Compute(const std::vector<byte> &Input, std::vector<byte> &Output)
 	Finalize(Output, 0);
 }
 
+void SHA2256::Compute(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	SHA2256Lanes lanes(m_parallelProfile.HasSHA2());
+	SHA2256State init;
+
+	init.Reset();
+	DigestBatch::Compute(lanes, Input, Output, init);
+}
+
+void SHA2256::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * SHA2256State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += SHA2256State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void SHA2256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < SHA2::SHA2256_DIGEST_SIZE)
@@ -152,6 +379,12 @@ void SHA2256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void SHA2256::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, SHA2::SHA2256_DIGEST_SIZE);
 	size_t bctr;
 	size_t boff;
 	size_t i;
@@ -206,13 +439,13 @@ void SHA2256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, boff, m_msgLength, proot);
-		IntegerTools::BeUL256ToBlock(proot.H, 0, Output, OutOffset);
+		IntegerTools::BeUL256ToBlock(proot.H, 0, OTP, 0);
 	}
 	else
 	{
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, m_dgtState[0]);
-		IntegerTools::BeUL256ToBlock(m_dgtState[0].H, 0, Output, OutOffset);
+		IntegerTools::BeUL256ToBlock(m_dgtState[0].H, 0, OTP, 0);
 	}
 
 	Reset();
@@ -253,6 +486,37 @@ void SHA2256::Reset()
 	}
 }
 
+SecureVector<byte> SHA2256::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * SHA2256State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += SHA2256State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void SHA2256::Update(byte Input) // Note: expand or remove? ushort, uint, ulong..?
 {
 	std::vector<byte> inp(1, Input);
@@ -277,6 +541,70 @@ void SHA2256::Update(const std::vector<byte> &Input, size_t InOffset, size_t Len
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void SHA2256::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void SHA2256::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA2256State &State)
+{
+	State.T += Length;
+	ulong bitLen = (State.T << 3);
+
+	if (Length == SHA2::SHA2256_RATE_SIZE)
+	{
+		Permute(Input, InOffset, State);
+		Length = 0;
+	}
+
+	Input[InOffset + Length] = 128;
+	++Length;
+
+	// padding
+	if (Length < SHA2::SHA2256_RATE_SIZE)
+	{
+		MemoryTools::Clear(Input, InOffset + Length, SHA2::SHA2256_RATE_SIZE - Length);
+	}
+
+	if (Length > 56)
+	{
+		Permute(Input, InOffset, State);
+		MemoryTools::Clear(Input, 0, SHA2::SHA2256_RATE_SIZE);
+	}
+
+	// finalize state with counter and last compression
+	IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitLen) >> 32), Input, InOffset + 56);
+	IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitLen)), Input, InOffset + 60);
+	Permute(Input, InOffset, State);
+}
+
+void SHA2256::Permute(const Span<const byte> &Input, size_t InOffset, SHA2256State &State)
+{
+#if defined(CEX_HAS_AVX2)
+	if (m_parallelProfile.HasSHA2())
+	{
+		SHA2::PermuteR64P512V(Input, InOffset, State.H);
+	}
+	else
+#endif
+	{
+#if defined(CEX_DIGEST_COMPACT)
+		SHA2::PermuteR64P512C(Input, InOffset, State.H);
+#else
+		SHA2::PermuteR64P512U(Input, InOffset, State.H);
+#endif
+	}
+
+	State.Increase(SHA2::SHA2256_RATE_SIZE);
+}
+
+void SHA2256::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_parallelProfile.IsParallel())
@@ -364,61 +692,7 @@ void SHA2256::Update(const std::vector<byte> &Input, size_t InOffset, size_t Len
 	}
 }
 
-//~~~Private Functions~~~//
-
-void SHA2256::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA2256State &State)
-{
-	State.T += Length;
-	ulong bitLen = (State.T << 3);
-
-	if (Length == SHA2::SHA2256_RATE_SIZE)
-	{
-		Permute(Input, InOffset, State);
-		Length = 0;
-	}
-
-	Input[InOffset + Length] = 128;
-	++Length;
-
-	// padding
-	if (Length < SHA2::SHA2256_RATE_SIZE)
-	{
-		MemoryTools::Clear(Input, InOffset + Length, SHA2::SHA2256_RATE_SIZE - Length);
-	}
-
-	if (Length > 56)
-	{
-		Permute(Input, InOffset, State);
-		MemoryTools::Clear(Input, 0, SHA2::SHA2256_RATE_SIZE);
-	}
-
-	// finalize state with counter and last compression
-	IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitLen) >> 32), Input, InOffset + 56);
-	IntegerTools::Be32ToBytes(static_cast<uint>(static_cast<ulong>(bitLen)), Input, InOffset + 60);
-	Permute(Input, InOffset, State);
-}
-
-void SHA2256::Permute(const std::vector<byte> &Input, size_t InOffset, SHA2256State &State)
-{
-#if defined(CEX_HAS_AVX2)
-	if (m_parallelProfile.HasSHA2())
-	{
-		SHA2::PermuteR64P512V(Input, InOffset, State.H);
-	}
-	else
-#endif
-	{
-#if defined(CEX_DIGEST_COMPACT)
-		SHA2::PermuteR64P512C(Input, InOffset, State.H);
-#else
-		SHA2::PermuteR64P512U(Input, InOffset, State.H);
-#endif
-	}
-
-	State.Increase(SHA2::SHA2256_RATE_SIZE);
-}
-
-void SHA2256::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, SHA2256State &State, ulong Length)
+void SHA2256::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, SHA2256State &State, ulong Length)
 {
 	do
 	{
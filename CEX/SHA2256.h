@@ -67,9 +67,11 @@ NAMESPACE_DIGEST
 /// <list type="bullet">
 /// <item><description>State block size is 64 bytes, (512 bits), in parallel mode the ParallelBlockSize() is used to trigger multi-threaded processing.</description></item>
 /// <item><description>Digest output size is 32 bytes, (256 bits).</description></item>
+/// <item><description>The batch Compute function hashes many independent messages in the lanes of the wide SIMD permutation; suitable for large numbers of small messages.</description></item>
 /// <item><description>The ComputeHash(byte[], byte[]) function wraps the Update(byte[], size_t, size_t) and Finalize(byte[], size_t) functions; (suitable for small data).</description>/></item>
 /// <item><description>The Update functions process message input, this can be a byte, 32--bit or 64-bit unsigned integer, or a vector of bytes.</description></item>
 /// <item><description>The Finalize(byte[], size_t) function returns the hash code but does not reset the internal state, call Reset() to reinitialize to default state.</description></item>
+/// <item><description>The Serialize function saves the midstate of the digest, which can be restored with DeSerialize; the state is in native byte order, and is not portable between platforms of different endianness.</description></item>
 /// <item><description>Setting Parallel to true in the constructor instantiates the multi-threaded variant.</description></item>
 /// <item><description>Multi-threaded and sequential versions produce a different output hash for a message, this is expected.</description></item>
 /// </list>
@@ -95,7 +97,10 @@ private:
 	static const size_t MAX_PRLDEGREE = 64;
 	// size of reserved state buffer subtracted from parallel size calculations
 	static const size_t STATE_PRECACHED = 2048;
+	// the serialized state header; the digest type, the number of leaf states, and the buffered message length
+	static const size_t STATE_HEADER = sizeof(byte) + sizeof(ushort) + sizeof(ulong);
 
+	class SHA2256Lanes;
 	class SHA2256State;
 	std::vector<SHA2256State> m_dgtState;
 	std::vector<byte> m_msgBuffer;
@@ -201,6 +206,29 @@ public:
 	/// <exception cref="CryptoDigestException">Thrown if the output buffer is too short</exception>
 	void Compute(const std::vector<byte> &Input, std::vector<byte> &Output) override;
 
+	/// <summary>
+	/// Compute the hash values of a batch of independent messages.
+	/// <para>Each message is hashed in a lane of the horizontally vectorized permutation, 8 lanes with AVX2, or 16 lanes with AVX512.
+	/// Messages of different lengths are scheduled into the lanes as they become free, and the last messages of the batch are finished sequentially.
+	/// On a processor with the SHA extensions, the messages are hashed sequentially with the SHA-NI permutation.
+	/// The hash values are the sequential SHA2-256 hash of each message; the state of this instance is not used or changed.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">The batch of input messages</param>
+	/// <param name="Output">The vector receiving the hash code of each message, in the order of the input messages</param>
+	void Compute(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output);
+
+	/// <summary>
+	/// Restore the internal state of the digest from a state created by the Serialize function.
+	/// <para>The leaf states and the buffered message bytes are replaced with the saved state, and processing continues from the position at which the state was saved.
+	/// The state must be created by an instance of this digest with the same parallel configuration.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The serialized digest state</param>
+	///
+	/// <exception cref="CryptoDigestException">Thrown if the state array is malformed, or was created by a different digest or configuration</exception>
+	void DeSerialize(const SecureVector<byte> &State) override;
+
 	/// <summary>
 	/// Finalize message processing and return the hash code.
 	/// <para>Used in conjunction with the Update api to process a message, and then return the finalized hash code.</para>
@@ -212,6 +240,15 @@ public:
 	/// <exception cref="CryptoDigestException">Thrown if the output array is too short</exception>
 	void Finalize(std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Finalize message processing and write the hash code to a pointer.
+	/// <para>The hash code is written to the callers memory directly, without an intermediate vector.
+	/// Used in conjunction with the Update api to process a message, and then return the finalized hash code.</para>
+	/// </summary>
+	/// 
+	/// <param name="Output">A pointer to the output buffer receiving the hash code; must be at least DigestSize in length</param>
+	void Finalize(byte* Output) override;
+
 	/// <summary>
 	/// Set the number of threads allocated when using multi-threaded tree hashing processing.
 	/// <para>Thread count must be an even number, and not exceed the number of processor cores.
@@ -228,6 +265,15 @@ public:
 	/// </summary>
 	void Reset() override;
 
+	/// <summary>
+	/// Save the internal state of the digest (the midstate) to a secure vector.
+	/// <para>The state contains the leaf states and the buffered message bytes; it can be restored to this or another instance of the digest with the DeSerialize function.
+	/// This can be used to precompute the state of a common message prefix once, or to checkpoint the hashing of a large message and resume it later.</para>
+	/// </summary>
+	///
+	/// <returns>The serialized digest state</returns>
+	SecureVector<byte> Serialize() override;
+
 	/// <summary>
 	/// Update the hash with a single byte
 	/// </summary>
@@ -259,11 +305,22 @@ public:
 	/// <param name="Length">The number of message bytes to process</param>
 	void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) override;
 
+	/// <summary>
+	/// Update the message digest with a length of bytes using a pointer.
+	/// <para>The message is read from the callers memory directly, without an intermediate vector.
+	/// Used in conjunction with the Finalize function, processes message data used to generate the hash code.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input message bytes</param>
+	/// <param name="Length">The number of bytes to process</param>
+	void Update(const byte* Input, size_t Length) override;
+
 private:
 
 	void HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA2256State &State);
-	void Permute(const std::vector<byte> &Input, size_t InOffset, SHA2256State &State);
-	void ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, SHA2256State &State, ulong Length);
+	void Permute(const Span<const byte> &Input, size_t InOffset, SHA2256State &State);
+	void Process(const Span<const byte> &Input, size_t InOffset, size_t Length);
+	void ProcessLeaf(const Span<const byte> &Input, size_t InOffset, SHA2256State &State, ulong Length);
 };
 
 NAMESPACE_DIGESTEND
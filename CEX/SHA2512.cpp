@@ -1,4 +1,5 @@
 #include "SHA2512.h"
+#include "DigestBatch.h"
 #include "SHA2.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
@@ -15,6 +16,9 @@ class SHA2512::SHA2512State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = (8 * sizeof(ulong)) + (2 * sizeof(ulong));
+
 	std::array<ulong, 8> H = { 0 };
 	std::array<ulong, 2> T = { 0 };
 
@@ -28,6 +32,13 @@ public:
 		MemoryTools::Clear(T, 0, T.size() * sizeof(ulong));
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, H, 0, H.size() * sizeof(ulong));
+		Offset += H.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, T, 0, T.size() * sizeof(ulong));
+	}
+
 	void Increase(size_t Length)
 	{
 		T[0] += Length;
@@ -45,6 +56,135 @@ public:
 		T[1] = 0;
 		MemoryTools::Copy(SHA2::SHA2512State, 0, H, 0, H.size() * sizeof(ulong));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(H, 0, SecureState, Offset, H.size() * sizeof(ulong));
+		Offset += H.size() * sizeof(ulong);
+		MemoryTools::Copy(T, 0, SecureState, Offset, T.size() * sizeof(ulong));
+	}
+};
+
+class SHA2512::SHA2512Lanes
+{
+private:
+
+#if defined(CEX_HAS_AVX512)
+	static const size_t WIDE_LANES = 8;
+#elif defined(CEX_HAS_AVX2)
+	static const size_t WIDE_LANES = 4;
+#else
+	static const size_t WIDE_LANES = 1;
+#endif
+
+public:
+
+	typedef SHA2512State State;
+
+	static const size_t BLOCK_SIZE = SHA2::SHA2512_RATE_SIZE;
+	static const size_t DIGEST_SIZE = SHA2::SHA2512_DIGEST_SIZE;
+
+	size_t Lanes()
+	{
+		return WIDE_LANES;
+	}
+
+	size_t Blocks(size_t Length)
+	{
+		// the message, the 0x80 pad byte, and the 128-bit bit length
+		return (Length + 17 + (BLOCK_SIZE - 1)) / BLOCK_SIZE;
+	}
+
+	void Block(const std::vector<byte> &Message, size_t Index, std::vector<byte> &Output, size_t Lane, State &Value)
+	{
+		const size_t MSGOFT = Index * BLOCK_SIZE;
+		const size_t OUTOFT = Lane * BLOCK_SIZE;
+
+		if (MSGOFT + BLOCK_SIZE <= Message.size())
+		{
+			MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, BLOCK_SIZE);
+		}
+		else
+		{
+			const size_t RMDLEN = (Message.size() > MSGOFT) ? Message.size() - MSGOFT : 0;
+
+			MemoryTools::Clear(Output, OUTOFT, BLOCK_SIZE);
+
+			if (RMDLEN != 0)
+			{
+				MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, RMDLEN);
+			}
+
+			// the pad byte is in the block holding the end of the message, the length is in the last block
+			if (MSGOFT <= Message.size())
+			{
+				Output[OUTOFT + RMDLEN] = 0x80;
+			}
+
+			if (Index == Blocks(Message.size()) - 1)
+			{
+				IntegerTools::Be64ToBytes(static_cast<ulong>(Message.size()) >> 61, Output, OUTOFT + BLOCK_SIZE - (2 * sizeof(ulong)));
+				IntegerTools::Be64ToBytes(static_cast<ulong>(Message.size()) << 3, Output, OUTOFT + BLOCK_SIZE - sizeof(ulong));
+			}
+		}
+	}
+
+	void Finalize(State &Value, std::vector<byte> &Output)
+	{
+		IntegerTools::BeULL512ToBlock(Value.H, 0, Output, 0);
+	}
+
+	void Permute(const std::vector<byte> &Input, State &Value)
+	{
+		SHA2::PermuteR80P1024(Input, 0, Value.H);
+	}
+
+	void PermuteW(const std::vector<byte> &Input, std::vector<State> &Values)
+	{
+#if defined(CEX_HAS_AVX512) || defined(CEX_HAS_AVX2)
+
+#	if defined(CEX_HAS_AVX512)
+		std::array<ULong512, 8> wstate;
+#	else
+		std::array<ULong256, 8> wstate;
+#	endif
+		std::array<ulong, 8 * WIDE_LANES> tmps;
+		size_t i;
+		size_t j;
+
+		// the wide permutation loads the block at lane offset j into the vector element (WIDE_LANES - 1 - j)
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)] = Values[j].H[i];
+			}
+		}
+
+		MemoryTools::Copy(tmps, 0, wstate, 0, tmps.size() * sizeof(ulong));
+#	if defined(CEX_HAS_AVX512)
+		SHA2::PermuteR80P8x1024H(Input, 0, wstate);
+#	else
+		SHA2::PermuteR80P4x1024H(Input, 0, wstate);
+#	endif
+		MemoryTools::Copy(wstate, 0, tmps, 0, tmps.size() * sizeof(ulong));
+
+		for (i = 0; i < 8; ++i)
+		{
+			for (j = 0; j < WIDE_LANES; ++j)
+			{
+				Values[j].H[i] = tmps[(i * WIDE_LANES) + (WIDE_LANES - 1 - j)];
+			}
+		}
+
+		MemoryTools::Clear(tmps, 0, tmps.size() * sizeof(ulong));
+
+#else
+
+		Permute(Input, Values[0]);
+
+#endif
+	}
 };
 
 //~~~Constructor~~~//
@@ -62,6 +202,12 @@ SHA2512::SHA2512(bool Parallel)
 	m_treeParams(Parallel ? SHA2Params(SHA2::SHA2512_DIGEST_SIZE, static_cast<byte>(SHA2::SHA2512_RATE_SIZE), static_cast<byte>(DEF_PRLDEGREE)) :
 		SHA2Params(SHA2::SHA2512_DIGEST_SIZE, 0UL, 0x00))
 {
+	if (Parallel)
+	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+	}
+
 	Reset();
 }
 
@@ -146,6 +292,56 @@ void SHA2512::Compute(const std::vector<byte> &Input, std::vector<byte> &Output)
 	Finalize(Output, 0);
 }
 
+void SHA2512::Compute(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	SHA2512Lanes lanes;
+	SHA2512State init;
+
+	init.Reset();
+	DigestBatch::Compute(lanes, Input, Output, init);
+}
+
+void SHA2512::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * SHA2512State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += SHA2512State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void SHA2512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < SHA2::SHA2512_DIGEST_SIZE)
@@ -153,6 +349,12 @@ void SHA2512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void SHA2512::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, SHA2::SHA2512_DIGEST_SIZE);
 	size_t bctr;
 	size_t boff;
 	size_t i;
@@ -207,13 +409,13 @@ void SHA2512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, boff, m_msgLength, proot);
-		IntegerTools::BeULL512ToBlock(proot.H, 0, Output, OutOffset);
+		IntegerTools::BeULL512ToBlock(proot.H, 0, OTP, 0);
 	}
 	else
 	{
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, m_dgtState[0]);
-		IntegerTools::BeULL512ToBlock(m_dgtState[0].H, 0, Output, OutOffset);
+		IntegerTools::BeULL512ToBlock(m_dgtState[0].H, 0, OTP, 0);
 	}
 
 	Reset();
@@ -253,6 +455,37 @@ void SHA2512::Reset()
 	}
 }
 
+SecureVector<byte> SHA2512::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * SHA2512State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += SHA2512State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void SHA2512::Update(byte Input)
 {
 	std::vector<byte> inp(1, Input);
@@ -277,6 +510,57 @@ void SHA2512::Update(const std::vector<byte> &Input, size_t InOffset, size_t Len
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void SHA2512::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void SHA2512::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA2512State &State)
+{
+	State.Increase(Length);
+	ulong bitLen = (State.T[0] << 3);
+
+	if (Length == SHA2::SHA2512_RATE_SIZE)
+	{
+		Permute(Input, InOffset, State);
+		Length = 0;
+	}
+
+	Input[InOffset + Length] = 128;
+	++Length;
+
+	// padding
+	if (Length < SHA2::SHA2512_RATE_SIZE)
+	{
+		MemoryTools::Clear(Input, InOffset + Length, SHA2::SHA2512_RATE_SIZE - Length);
+	}
+
+	if (Length > 112)
+	{
+		Permute(Input, InOffset, State);
+		MemoryTools::Clear(Input, InOffset, SHA2::SHA2512_RATE_SIZE);
+	}
+
+	// finalize state with counter and last compression
+	IntegerTools::Be64ToBytes(State.T[1], Input, InOffset + 112);
+	IntegerTools::Be64ToBytes(bitLen, Input, InOffset + 120);
+	Permute(Input, InOffset, State);
+}
+
+void SHA2512::Permute(const Span<const byte> &Input, size_t InOffset, SHA2512State &State)
+{
+	SHA2::PermuteR80P1024(Input, InOffset, State.H);
+
+	State.Increase(SHA2::SHA2512_RATE_SIZE);
+}
+
+void SHA2512::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_parallelProfile.IsParallel())
@@ -362,52 +646,7 @@ void SHA2512::Update(const std::vector<byte> &Input, size_t InOffset, size_t Len
 	}
 }
 
-//~~~Private Functions~~~//
-
-void SHA2512::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA2512State &State)
-{
-	State.Increase(Length);
-	ulong bitLen = (State.T[0] << 3);
-
-	if (Length == SHA2::SHA2512_RATE_SIZE)
-	{
-		Permute(Input, InOffset, State);
-		Length = 0;
-	}
-
-	Input[InOffset + Length] = 128;
-	++Length;
-
-	// padding
-	if (Length < SHA2::SHA2512_RATE_SIZE)
-	{
-		MemoryTools::Clear(Input, InOffset + Length, SHA2::SHA2512_RATE_SIZE - Length);
-	}
-
-	if (Length > 112)
-	{
-		Permute(Input, InOffset, State);
-		MemoryTools::Clear(Input, InOffset, SHA2::SHA2512_RATE_SIZE);
-	}
-
-	// finalize state with counter and last compression
-	IntegerTools::Be64ToBytes(State.T[1], Input, InOffset + 112);
-	IntegerTools::Be64ToBytes(bitLen, Input, InOffset + 120);
-	Permute(Input, InOffset, State);
-}
-
-void SHA2512::Permute(const std::vector<byte> &Input, size_t InOffset, SHA2512State &State)
-{
-#if defined(CEX_DIGEST_COMPACT)
-	SHA2::PermuteR80P1024C(Input, InOffset, State.H);
-#else
-	SHA2::PermuteR80P1024U(Input, InOffset, State.H);
-#endif
-
-	State.Increase(SHA2::SHA2512_RATE_SIZE);
-}
-
-void SHA2512::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, SHA2512State &State, ulong Length)
+void SHA2512::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, SHA2512State &State, ulong Length)
 {
 	do
 	{
@@ -15,6 +15,9 @@ class SHA31024::SHA31024State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = 25 * sizeof(ulong);
+
 	std::array<ulong, 25> H = { 0 };
 
 	SHA31024State()
@@ -26,10 +29,20 @@ public:
 		Reset();
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, H, 0, H.size() * sizeof(ulong));
+	}
+
 	void Reset()
 	{
 		MemoryTools::Clear(H, 0, H.size() * sizeof(ulong));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(H, 0, SecureState, Offset, H.size() * sizeof(ulong));
+	}
 };
 
 //~~~Constructor~~~//
@@ -130,6 +143,47 @@ void SHA31024::Compute(const std::vector<byte> &Input, std::vector<byte> &Output
 	Finalize(Output, 0);
 }
 
+void SHA31024::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * SHA31024State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += SHA31024State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void SHA31024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < Keccak::KECCAK1024_DIGEST_SIZE)
@@ -137,6 +191,12 @@ void SHA31024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void SHA31024::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, Keccak::KECCAK1024_DIGEST_SIZE);
 	size_t bctr;
 	size_t boft;
 	size_t i;
@@ -195,7 +255,7 @@ void SHA31024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		std::vector<byte> tmph(Keccak::KECCAK1024_RATE_SIZE * 4);
 		Keccak::AbsorbR48(tmpd, boft, m_msgLength, Keccak::KECCAK1024_RATE_SIZE, Keccak::KECCAK_SHA3_DOMAIN, proot.H);
 		Keccak::SqueezeR48(proot.H, tmph, 0, 4, Keccak::KECCAK1024_RATE_SIZE);
-		MemoryTools::Copy(tmph, 0, Output, OutOffset, Keccak::KECCAK1024_DIGEST_SIZE);
+		MemoryTools::Copy(tmph, 0, OTP, 0, Keccak::KECCAK1024_DIGEST_SIZE);
 	}
 	else
 	{
@@ -207,7 +267,7 @@ void SHA31024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		std::vector<byte> tmph(Keccak::KECCAK1024_RATE_SIZE * 4);
 		Keccak::AbsorbR48(m_msgBuffer, 0, m_msgLength, Keccak::KECCAK1024_RATE_SIZE, Keccak::KECCAK_SHA3_DOMAIN, m_dgtState[0].H);
 		Keccak::SqueezeR48(m_dgtState[0].H, tmph, 0, 4, Keccak::KECCAK1024_RATE_SIZE);
-		MemoryTools::Copy(tmph, 0, Output, OutOffset, Keccak::KECCAK1024_DIGEST_SIZE);
+		MemoryTools::Copy(tmph, 0, OTP, 0, Keccak::KECCAK1024_DIGEST_SIZE);
 	}
 
 	Reset();
@@ -250,6 +310,37 @@ void SHA31024::Reset()
 	}
 }
 
+SecureVector<byte> SHA31024::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * SHA31024State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += SHA31024State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void SHA31024::Update(byte Input)
 {
 	std::vector<byte> tmp(1, Input);
@@ -274,6 +365,29 @@ void SHA31024::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void SHA31024::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void SHA31024::Permute(std::array<ulong, 25> &State)
+{
+	Keccak::PermuteR48P1600(State);
+}
+
+void SHA31024::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA31024State &State)
+{
+	Keccak::AbsorbR48(Input, InOffset, Length, Keccak::KECCAK1024_RATE_SIZE, Keccak::KECCAK_SHA3_DOMAIN, State.H);
+	Permute(State.H);
+}
+
+void SHA31024::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_parallelProfile.IsParallel())
@@ -365,24 +479,7 @@ void SHA31024::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	}
 }
 
-//~~~Private Functions~~~//
-
-void SHA31024::Permute(std::array<ulong, 25> &State)
-{
-#if defined(CEX_DIGEST_COMPACT)
-	Keccak::PermuteR48P1600C(State);
-#else
-	Keccak::PermuteR48P1600U(State);
-#endif
-}
-
-void SHA31024::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA31024State &State)
-{
-	Keccak::AbsorbR48(Input, InOffset, Length, Keccak::KECCAK1024_RATE_SIZE, Keccak::KECCAK_SHA3_DOMAIN, State.H);
-	Permute(State.H);
-}
-
-void SHA31024::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, SHA31024State &State, ulong Length)
+void SHA31024::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, SHA31024State &State, ulong Length)
 {
 	do
 	{
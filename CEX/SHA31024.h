@@ -71,6 +71,7 @@ NAMESPACE_DIGEST
 /// <item><description>The ComputeHash(byte[], byte[]) function wraps the Update(byte[], size_t, size_t) and Finalize(byte[], size_t) functions; (suitable for small data).</description>/></item>
 /// <item><description>The Update functions process message input, this can be a byte, 32--bit or 64-bit unsigned integer, or a vector of bytes.</description></item>
 /// <item><description>The Finalize(byte[], size_t) function returns the hash code but does not reset the internal state, call Reset() to reinitialize to default state.</description></item>
+/// <item><description>The Serialize function saves the midstate of the digest, which can be restored with DeSerialize; the state is in native byte order, and is not portable between platforms of different endianness.</description></item>
 /// <item><description>Setting Parallel to true in the constructor instantiates the multi-threaded variant.</description></item>
 /// <item><description>Multi-threaded and sequential versions produce a different output hash for a message, this is expected.</description></item>
 /// </list>
@@ -94,6 +95,8 @@ private:
 	static const size_t MAX_PRLDEGREE = 64;
 	// size of reserved state buffer subtracted from parallel size calculations
 	static const size_t STATE_PRECACHED = 2048;
+	// the serialized state header; the digest type, the number of leaf states, and the buffered message length
+	static const size_t STATE_HEADER = sizeof(byte) + sizeof(ushort) + sizeof(ulong);
 
 	class SHA31024State;
 	std::vector<SHA31024State> m_dgtState;
@@ -200,6 +203,17 @@ public:
 	/// <exception cref="CryptoDigestException">Thrown if the output buffer is too short</exception>
 	void Compute(const std::vector<byte> &Input, std::vector<byte> &Output) override;
 
+	/// <summary>
+	/// Restore the internal state of the digest from a state created by the Serialize function.
+	/// <para>The leaf states and the buffered message bytes are replaced with the saved state, and processing continues from the position at which the state was saved.
+	/// The state must be created by an instance of this digest with the same parallel configuration.</para>
+	/// </summary>
+	/// 
+	/// <param name="State">The serialized digest state</param>
+	///
+	/// <exception cref="CryptoDigestException">Thrown if the state array is malformed, or was created by a different digest or configuration</exception>
+	void DeSerialize(const SecureVector<byte> &State) override;
+
 	/// <summary>
 	/// Finalize message processing and return the hash code.
 	/// <para>Used in conjunction with the Update api to process a message, and then return the finalized hash code.</para>
@@ -211,6 +225,15 @@ public:
 	/// <exception cref="CryptoDigestException">Thrown if the output buffer is too short</exception>
 	void Finalize(std::vector<byte> &Output, size_t OutOffset) override;
 
+	/// <summary>
+	/// Finalize message processing and write the hash code to a pointer.
+	/// <para>The hash code is written to the callers memory directly, without an intermediate vector.
+	/// Used in conjunction with the Update api to process a message, and then return the finalized hash code.</para>
+	/// </summary>
+	/// 
+	/// <param name="Output">A pointer to the output buffer receiving the hash code; must be at least DigestSize in length</param>
+	void Finalize(byte* Output) override;
+
 	/// <summary>
 	/// Set the number of threads allocated when using multi-threaded tree hashing processing.
 	/// <para>Thread count must be an even number, and not exceed the number of processor cores.
@@ -227,6 +250,15 @@ public:
 	/// </summary>
 	void Reset() override;
 
+	/// <summary>
+	/// Save the internal state of the digest (the midstate) to a secure vector.
+	/// <para>The state contains the leaf states and the buffered message bytes; it can be restored to this or another instance of the digest with the DeSerialize function.
+	/// This can be used to precompute the state of a common message prefix once, or to checkpoint the hashing of a large message and resume it later.</para>
+	/// </summary>
+	///
+	/// <returns>The serialized digest state</returns>
+	SecureVector<byte> Serialize() override;
+
 	/// <summary>
 	/// Update the digest with a single byte
 	/// </summary>
@@ -260,11 +292,22 @@ public:
 	/// <exception cref="CryptoDigestException">Thrown if the input buffer is too short</exception>
 	void Update(const std::vector<byte> &Input, size_t InOffset, size_t Length) override;
 
+	/// <summary>
+	/// Update the message digest with a length of bytes using a pointer.
+	/// <para>The message is read from the callers memory directly, without an intermediate vector.
+	/// Used in conjunction with the Finalize function, processes message data used to generate the hash code.</para>
+	/// </summary>
+	/// 
+	/// <param name="Input">A pointer to the input message bytes</param>
+	/// <param name="Length">The number of bytes to process</param>
+	void Update(const byte* Input, size_t Length) override;
+
 private:
 
 	static void HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA31024State &State);
 	static void Permute(std::array<ulong, 25> &State);
-	void ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, SHA31024State &State, ulong Length);
+	void Process(const Span<const byte> &Input, size_t InOffset, size_t Length);
+	void ProcessLeaf(const Span<const byte> &Input, size_t InOffset, SHA31024State &State, ulong Length);
 };
 
 NAMESPACE_DIGESTEND
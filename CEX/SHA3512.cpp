@@ -1,4 +1,5 @@
 #include "SHA3512.h"
+#include "DigestBatch.h"
 #include "Keccak.h"
 #include "IntegerTools.h"
 #include "MemoryTools.h"
@@ -15,6 +16,9 @@ class SHA3512::SHA3512State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = 25 * sizeof(ulong);
+
 	std::array<ulong, 25> H = { 0 };
 
 	SHA3512State()
@@ -26,10 +30,137 @@ public:
 		Reset();
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, H, 0, H.size() * sizeof(ulong));
+	}
+
 	void Reset()
 	{
 		MemoryTools::Clear(H, 0, H.size() * sizeof(ulong));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(H, 0, SecureState, Offset, H.size() * sizeof(ulong));
+	}
+};
+
+class SHA3512::SHA3512Lanes
+{
+private:
+
+#if defined(CEX_HAS_AVX512)
+	static const size_t WIDE_LANES = 8;
+#elif defined(CEX_HAS_AVX2)
+	static const size_t WIDE_LANES = 4;
+#else
+	static const size_t WIDE_LANES = 1;
+#endif
+
+public:
+
+	typedef SHA3512State State;
+
+	static const size_t BLOCK_SIZE = Keccak::KECCAK512_RATE_SIZE;
+	static const size_t DIGEST_SIZE = Keccak::KECCAK512_DIGEST_SIZE;
+
+	size_t Lanes()
+	{
+		return WIDE_LANES;
+	}
+
+	size_t Blocks(size_t Length)
+	{
+		// the padded final block always follows the full blocks
+		return (Length / BLOCK_SIZE) + 1;
+	}
+
+	void Block(const std::vector<byte> &Message, size_t Index, std::vector<byte> &Output, size_t Lane, State &Value)
+	{
+		const size_t MSGOFT = Index * BLOCK_SIZE;
+		const size_t OUTOFT = Lane * BLOCK_SIZE;
+
+		if (MSGOFT + BLOCK_SIZE <= Message.size())
+		{
+			MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, BLOCK_SIZE);
+		}
+		else
+		{
+			const size_t RMDLEN = Message.size() - MSGOFT;
+
+			MemoryTools::Clear(Output, OUTOFT, BLOCK_SIZE);
+
+			if (RMDLEN != 0)
+			{
+				MemoryTools::Copy(Message, MSGOFT, Output, OUTOFT, RMDLEN);
+			}
+
+			Output[OUTOFT + RMDLEN] = Keccak::KECCAK_SHA3_DOMAIN;
+			Output[OUTOFT + BLOCK_SIZE - 1] |= 0x80;
+		}
+	}
+
+	void Finalize(State &Value, std::vector<byte> &Output)
+	{
+		IntegerTools::LeULL512ToBlock(Value.H, 0, Output, 0);
+	}
+
+	void Permute(const std::vector<byte> &Input, State &Value)
+	{
+		Keccak::FastAbsorb(Input, 0, BLOCK_SIZE, Value.H);
+
+		Keccak::PermuteR24P1600(Value.H);
+	}
+
+	void PermuteW(const std::vector<byte> &Input, std::vector<State> &Values)
+	{
+#if defined(CEX_HAS_AVX512) || defined(CEX_HAS_AVX2)
+
+#	if defined(CEX_HAS_AVX512)
+		std::array<ULong512, Keccak::KECCAK_STATE_SIZE> wstate;
+#	else
+		std::array<ULong256, Keccak::KECCAK_STATE_SIZE> wstate;
+#	endif
+		std::array<ulong, Keccak::KECCAK_STATE_SIZE * WIDE_LANES> tmps;
+		size_t i;
+		size_t j;
+
+		// absorb each lanes block, then permute the lane states together
+		for (j = 0; j < WIDE_LANES; ++j)
+		{
+			Keccak::FastAbsorb(Input, j * BLOCK_SIZE, BLOCK_SIZE, Values[j].H);
+
+			for (i = 0; i < Keccak::KECCAK_STATE_SIZE; ++i)
+			{
+				tmps[(i * WIDE_LANES) + j] = Values[j].H[i];
+			}
+		}
+
+		MemoryTools::Copy(tmps, 0, wstate, 0, tmps.size() * sizeof(ulong));
+#	if defined(CEX_HAS_AVX512)
+		Keccak::PermuteR24P8x1600H(wstate);
+#	else
+		Keccak::PermuteR24P4x1600H(wstate);
+#	endif
+		MemoryTools::Copy(wstate, 0, tmps, 0, tmps.size() * sizeof(ulong));
+
+		for (j = 0; j < WIDE_LANES; ++j)
+		{
+			for (i = 0; i < Keccak::KECCAK_STATE_SIZE; ++i)
+			{
+				Values[j].H[i] = tmps[(i * WIDE_LANES) + j];
+			}
+		}
+
+		MemoryTools::Clear(tmps, 0, tmps.size() * sizeof(ulong));
+
+#else
+
+		Permute(Input, Values[0]);
+
+#endif
+	}
 };
 
 //~~~Constructor~~~//
@@ -48,6 +179,12 @@ SHA3512::SHA3512(bool Parallel)
 		KeccakParams(Keccak::KECCAK512_DIGEST_SIZE, static_cast<byte>(Keccak::KECCAK512_RATE_SIZE), static_cast<byte>(m_parallelProfile.ParallelMaxDegree())) :
 		KeccakParams(Keccak::KECCAK512_DIGEST_SIZE, 0x00, 0x00))
 {
+	if (Parallel)
+	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+	}
+
 	Reset();
 }
 
@@ -130,6 +267,55 @@ void SHA3512::Compute(const std::vector<byte> &Input, std::vector<byte> &Output)
 	Finalize(Output, 0);
 }
 
+void SHA3512::Compute(const std::vector<std::vector<byte>> &Input, std::vector<std::vector<byte>> &Output)
+{
+	SHA3512Lanes lanes;
+	SHA3512State init;
+
+	DigestBatch::Compute(lanes, Input, Output, init);
+}
+
+void SHA3512::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * SHA3512State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += SHA3512State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void SHA3512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < Keccak::KECCAK512_DIGEST_SIZE)
@@ -137,6 +323,12 @@ void SHA3512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void SHA3512::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, Keccak::KECCAK512_DIGEST_SIZE);
 	size_t bctr;
 	size_t boft;
 	size_t i;
@@ -192,7 +384,7 @@ void SHA3512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, boft, m_msgLength, proot);
-		IntegerTools::LeULL512ToBlock(proot.H, 0, Output, OutOffset);
+		IntegerTools::LeULL512ToBlock(proot.H, 0, OTP, 0);
 	}
 	else
 	{
@@ -202,7 +394,7 @@ void SHA3512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		}
 
 		HashFinal(m_msgBuffer, 0, m_msgLength, m_dgtState[0]);
-		IntegerTools::LeULL512ToBlock(m_dgtState[0].H, 0, Output, OutOffset);
+		IntegerTools::LeULL512ToBlock(m_dgtState[0].H, 0, OTP, 0);
 	}
 
 	Reset();
@@ -240,6 +432,37 @@ void SHA3512::Reset()
 	}
 }
 
+SecureVector<byte> SHA3512::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * SHA3512State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += SHA3512State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void SHA3512::Update(byte Input)
 {
 	std::vector<byte> one(1, Input);
@@ -264,6 +487,29 @@ void SHA3512::Update(const std::vector<byte> &Input, size_t InOffset, size_t Len
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void SHA3512::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void SHA3512::Permute(std::array<ulong, 25> & State)
+{
+	Keccak::PermuteR24P1600(State);
+}
+
+void SHA3512::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA3512State &State)
+{
+	Keccak::Absorb(Input, InOffset, Length, Keccak::KECCAK512_RATE_SIZE, Keccak::KECCAK_SHA3_DOMAIN, State.H);
+	Permute(State.H);
+}
+
+void SHA3512::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_parallelProfile.IsParallel())
@@ -355,24 +601,7 @@ void SHA3512::Update(const std::vector<byte> &Input, size_t InOffset, size_t Len
 	}
 }
 
-//~~~Private Functions~~~//
-
-void SHA3512::Permute(std::array<ulong, 25> & State)
-{
-#if defined(CEX_DIGEST_COMPACT)
-	Keccak::PermuteR24P1600C(State);
-#else
-	Keccak::PermuteR24P1600U(State);
-#endif
-}
-
-void SHA3512::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, SHA3512State &State)
-{
-	Keccak::Absorb(Input, InOffset, Length, Keccak::KECCAK512_RATE_SIZE, Keccak::KECCAK_SHA3_DOMAIN, State.H);
-	Permute(State.H);
-}
-
-void SHA3512::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, SHA3512State &State, ulong Length)
+void SHA3512::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, SHA3512State &State, ulong Length)
 {
 	do
 	{
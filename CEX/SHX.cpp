@@ -196,6 +196,14 @@ void SHX::DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Decrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void SHX::DecryptBlock(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	Decrypt128(INP, 0, OTP, 0);
+}
+
 void SHX::EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
 {
 	Encrypt128(Input, 0, Output, 0);
@@ -206,6 +214,14 @@ void SHX::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vec
 	Encrypt128(Input, InOffset, Output, OutOffset);
 }
 
+void SHX::EncryptBlock(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	Encrypt128(INP, 0, OTP, 0);
+}
+
 void SHX::Initialize(bool Encryption, ISymmetricKey &Parameters)
 {
 	if (!SymmetricKeySize::Contains(m_legalKeySizes, Parameters.KeySizes().KeySize()))
@@ -265,6 +281,21 @@ void SHX::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector
 	}
 }
 
+void SHX::Transform(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, BLOCK_SIZE);
+	const Span<byte> OTP(Output, BLOCK_SIZE);
+
+	if (m_shxState->Encryption)
+	{
+		Encrypt128(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt128(INP, 0, OTP, 0);
+	}
+}
+
 void SHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_shxState->Encryption)
@@ -277,6 +308,21 @@ void SHX::Transform512(const std::vector<byte> &Input, size_t InOffset, std::vec
 	}
 }
 
+void SHX::Transform512(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 4 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 4 * BLOCK_SIZE);
+
+	if (m_shxState->Encryption)
+	{
+		Encrypt512(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt512(INP, 0, OTP, 0);
+	}
+}
+
 void SHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_shxState->Encryption)
@@ -289,6 +335,21 @@ void SHX::Transform1024(const std::vector<byte> &Input, size_t InOffset, std::ve
 	}
 }
 
+void SHX::Transform1024(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 8 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 8 * BLOCK_SIZE);
+
+	if (m_shxState->Encryption)
+	{
+		Encrypt1024(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt1024(INP, 0, OTP, 0);
+	}
+}
+
 void SHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
 {
 	if (m_shxState->Encryption)
@@ -301,6 +362,21 @@ void SHX::Transform2048(const std::vector<byte> &Input, size_t InOffset, std::ve
 	}
 }
 
+void SHX::Transform2048(const byte* Input, byte* Output)
+{
+	const Span<const byte> INP(Input, 16 * BLOCK_SIZE);
+	const Span<byte> OTP(Output, 16 * BLOCK_SIZE);
+
+	if (m_shxState->Encryption)
+	{
+		Encrypt2048(INP, 0, OTP, 0);
+	}
+	else
+	{
+		Decrypt2048(INP, 0, OTP, 0);
+	}
+}
+
 //~~~Key Schedule~~~//
 
 void SHX::SecureExpand(const SecureVector<byte> &Key, std::unique_ptr<ShxState> &State, std::unique_ptr<IKdf> &Generator)
@@ -433,7 +509,7 @@ void SHX::StandardExpand(const SecureVector<byte> &Key, std::unique_ptr<ShxState
 
 //~~~Rounds Processing~~~//
 
-void SHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Decrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = 4;
 	size_t kctr;
@@ -529,7 +605,7 @@ void SHX::Decrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	IntegerTools::Le32ToBytes(R0 ^ m_shxState->RoundKeys[kctr - 4], Output, OutOffset);
 }
 
-void SHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Decrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 #if (!defined(CEX_HAS_AVX512)) && (!defined(CEX_HAS_AVX2)) && defined(CEX_HAS_AVX)
 	DecryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
@@ -541,7 +617,7 @@ void SHX::Decrypt512(const std::vector<byte> &Input, size_t InOffset, std::vecto
 #endif
 }
 
-void SHX::Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Decrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 #if (!defined(CEX_HAS_AVX512)) && defined(CEX_HAS_AVX2)
 	DecryptW<Numeric::UInt256>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
@@ -560,7 +636,7 @@ void SHX::Decrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vect
 #endif
 }
 
-void SHX::Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Decrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 #if defined(CEX_HAS_AVX512)
 	DecryptW<Numeric::UInt512>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
@@ -592,7 +668,7 @@ void SHX::Decrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vect
 #endif
 }
 
-void SHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Encrypt128(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 	const size_t RNDCNT = m_shxState->RoundKeys.size() - 4;
 	size_t kctr;
@@ -682,7 +758,7 @@ void SHX::Encrypt128(const std::vector<byte> &Input, size_t InOffset, std::vecto
 	IntegerTools::Le32ToBytes(m_shxState->RoundKeys[kctr + 3] ^ R3, Output, OutOffset + 12);
 }
 
-void SHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Encrypt512(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 #if (!defined(CEX_HAS_AVX512)) && (!defined(CEX_HAS_AVX2)) && defined(CEX_HAS_AVX)
 	EncryptW<Numeric::UInt128>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
@@ -694,7 +770,7 @@ void SHX::Encrypt512(const std::vector<byte> &Input, size_t InOffset, std::vecto
 #endif
 }
 
-void SHX::Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Encrypt1024(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 #if (!defined(CEX_HAS_AVX512)) && defined(CEX_HAS_AVX2)
 	EncryptW<Numeric::UInt256>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
@@ -713,7 +789,7 @@ void SHX::Encrypt1024(const std::vector<byte> &Input, size_t InOffset, std::vect
 #endif
 }
 
-void SHX::Encrypt2048(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+void SHX::Encrypt2048(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset)
 {
 #if defined(CEX_HAS_AVX512)
 	EncryptW<Numeric::UInt512>(Input, InOffset, Output, OutOffset, m_shxState->RoundKeys);
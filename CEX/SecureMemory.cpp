@@ -175,6 +175,10 @@ void SecureMemory::Free(void* Pointer, size_t Length)
 
 size_t SecureMemory::Limit()
 {
+	size_t lockable;
+
+	lockable = 0;
+
 #if defined(CEX_OS_POSIX)
 
 	size_t mreq = CEX_SECMEMALLOC_MAXKB;
@@ -205,19 +209,18 @@ size_t SecureMemory::Limit()
 			::getrlimit(RLIMIT_MEMLOCK, &limits);
 		}
 
-		return std::min<size_t>(limits.rlim_cur, mreq * 1024);
+		lockable = std::min<size_t>(limits.rlim_cur, mreq * 1024);
 	}
 
 #	else
 
 	// if RLIMIT_MEMLOCK is not defined, likely the OS does not support unprivileged mlock calls
-	return 0;
+	lockable = 0;
 
 #	endif
 
 #elif defined(CEX_OS_WINDOWS)
 
-	size_t lockable;
 	size_t overhead;
 	SIZE_T wmax;
 	SIZE_T wmin;
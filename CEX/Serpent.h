@@ -30,8 +30,8 @@ NAMESPACE_SERPENTBASE
 
 using Tools::IntegerTools;
 
-template<typename T, typename ArrayA, typename ArrayB>
-static void DecryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, ArrayB &Key)
+template<typename T, typename ArrayA, typename ArrayB, typename ArrayC>
+static void DecryptW(const ArrayA &Input, size_t InOffset, ArrayC &Output, size_t OutOffset, ArrayB &Key)
 {
 #if defined(CEX_HAS_AVX) || defined(CEX_HAS_AVX2) || defined(CEX_HAS_AVX512)
 
@@ -172,8 +172,8 @@ static void DecryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Ou
 #endif
 }
 
-template<typename T, typename ArrayA, typename ArrayB>
-static void EncryptW(const ArrayA &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, ArrayB &Key)
+template<typename T, typename ArrayA, typename ArrayB, typename ArrayC>
+static void EncryptW(const ArrayA &Input, size_t InOffset, ArrayC &Output, size_t OutOffset, ArrayB &Key)
 {
 #if defined(CEX_HAS_AVX) || defined(CEX_HAS_AVX2) || defined(CEX_HAS_AVX512)
 
@@ -15,6 +15,9 @@ class Skein1024::Skein1024State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = (16 * sizeof(ulong)) + (16 * sizeof(ulong)) + (2 * sizeof(ulong));
+
 	// state
 	std::array<ulong, 16> S = { 0 };
 	// config
@@ -31,6 +34,15 @@ public:
 		Reset();
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, S, 0, S.size() * sizeof(ulong));
+		Offset += S.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, V, 0, V.size() * sizeof(ulong));
+		Offset += V.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, T, 0, T.size() * sizeof(ulong));
+	}
+
 	void Increase(size_t Length)
 	{
 		T[0] += Length;
@@ -42,6 +54,15 @@ public:
 		MemoryTools::Clear(T, 0, T.size() * sizeof(ulong));
 		MemoryTools::Clear(V, 0, V.size() * sizeof(ulong));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(S, 0, SecureState, Offset, S.size() * sizeof(ulong));
+		Offset += S.size() * sizeof(ulong);
+		MemoryTools::Copy(V, 0, SecureState, Offset, V.size() * sizeof(ulong));
+		Offset += V.size() * sizeof(ulong);
+		MemoryTools::Copy(T, 0, SecureState, Offset, T.size() * sizeof(ulong));
+	}
 };
 
 //~~~Constructor~~~//
@@ -144,6 +165,47 @@ void Skein1024::Compute(const std::vector<byte> &Input, std::vector<byte> &Outpu
 	Finalize(Output, 0);
 }
 
+void Skein1024::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * Skein1024State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += Skein1024State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void Skein1024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < Skein::SKEIN1024_DIGEST_SIZE)
@@ -151,6 +213,12 @@ void Skein1024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void Skein1024::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, Skein::SKEIN1024_DIGEST_SIZE);
 	size_t bctr;
 	size_t i;
 
@@ -193,7 +261,7 @@ void Skein1024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, proot);
-		IntegerTools::LeULL1024ToBlock(proot.S, 0, Output, OutOffset);
+		IntegerTools::LeULL1024ToBlock(proot.S, 0, OTP, 0);
 	}
 	else
 	{
@@ -205,7 +273,7 @@ void Skein1024::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, m_dgtState[0]);
-		IntegerTools::LeULL1024ToBlock(m_dgtState[0].S, 0, Output, OutOffset);
+		IntegerTools::LeULL1024ToBlock(m_dgtState[0].S, 0, OTP, 0);
 	}
 
 	Reset();
@@ -244,6 +312,37 @@ void Skein1024::Reset()
 	m_msgLength = 0;
 }
 
+SecureVector<byte> Skein1024::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * Skein1024State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += Skein1024State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void Skein1024::Update(byte Input)
 {
 	std::vector<byte> one(1, Input);
@@ -268,6 +367,97 @@ void Skein1024::Update(const std::vector<byte> &Input, size_t InOffset, size_t L
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void Skein1024::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void Skein1024::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, Skein1024State &State)
+{
+	// process message block
+	SkeinUbiTweak::IsFinalBlock(State.T, true);
+
+	if (Length != 0)
+	{
+		while (Length != 0)
+		{
+			const size_t MSGRMD = (Length >= Skein::SKEIN1024_RATE_SIZE) ? Skein::SKEIN1024_RATE_SIZE : Length;
+			ProcessBlock(Input, InOffset, State, MSGRMD);
+			Length -= MSGRMD;
+			InOffset += MSGRMD;
+		}
+	}
+	else
+	{
+		ProcessBlock(Input, InOffset, State, 0);
+	}
+
+	// finalize block
+	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Out);
+	SkeinUbiTweak::IsFinalBlock(State.T, true);
+	std::vector<byte> tmp(Skein::SKEIN1024_RATE_SIZE);
+	ProcessBlock(tmp, 0, State, 8);
+}
+
+void Skein1024::Initialize(std::vector<Skein1024State> &State, SkeinParams &Params)
+{
+	std::vector<ulong> tmp = Params.GetConfig();
+	std::array<ulong, 16> cfg{ tmp[0], tmp[1], tmp[2], tmp[3], tmp[4], tmp[5], tmp[6], tmp[7], tmp[8], tmp[9], tmp[10], tmp[11], tmp[12], tmp[13], tmp[14], tmp[15] };
+	size_t i;
+
+	LoadState(State[0], cfg);
+
+	for (i = 1; i < State.size(); ++i)
+	{
+		// create unique state for each node
+		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Config);
+		SkeinUbiTweak::IsFinalBlock(State[i].T, true);
+		State[i].Increase(32);
+		// compress previous state
+		Permute(State[i - 1].V, State[i]);
+		// store the new state in V for reset
+		MemoryTools::Copy(State[i].S, 0, State[i].V, 0, State[i].V.size() * sizeof(ulong));
+		// mix config with state
+		MemoryTools::XOR1024(cfg, 0, State[i].V, 0);
+	}
+
+	for (i = 0; i < State.size(); ++i)
+	{
+		// copy the configuration value to the state
+		State[i].S = State[i].V;
+		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Message);
+	}
+}
+
+void Skein1024::LoadState(Skein1024State &State, std::array<ulong, 16> &Config)
+{
+	// initialize the tweak value
+	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Config);
+	SkeinUbiTweak::IsFinalBlock(State.T, true);
+	State.Increase(32);
+	Permute(Config, State);
+	// store the initial state for reset
+	MemoryTools::Copy(State.S, 0, State.V, 0, State.V.size() * sizeof(ulong));
+	// add the config string
+	MemoryTools::XOR1024(Config, 0, State.V, 0);
+}
+
+void Skein1024::Permute(std::array<ulong, 16> &Message, Skein1024State &State)
+{
+#if defined(CEX_DIGEST_COMPACT)
+	Skein::PemuteP1024C(Message, State.T, State.S, 80);
+#else
+	Skein::PemuteR80P1024U(Message, State.T, State.S);
+#endif
+}
+
+void Skein1024::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_parallelProfile.IsParallel())
@@ -354,88 +544,7 @@ void Skein1024::Update(const std::vector<byte> &Input, size_t InOffset, size_t L
 	}
 }
 
-//~~~Private Functions~~~//
-
-void Skein1024::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, Skein1024State &State)
-{
-	// process message block
-	SkeinUbiTweak::IsFinalBlock(State.T, true);
-
-	if (Length != 0)
-	{
-		while (Length != 0)
-		{
-			const size_t MSGRMD = (Length >= Skein::SKEIN1024_RATE_SIZE) ? Skein::SKEIN1024_RATE_SIZE : Length;
-			ProcessBlock(Input, InOffset, State, MSGRMD);
-			Length -= MSGRMD;
-			InOffset += MSGRMD;
-		}
-	}
-	else
-	{
-		ProcessBlock(Input, InOffset, State, 0);
-	}
-
-	// finalize block
-	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Out);
-	SkeinUbiTweak::IsFinalBlock(State.T, true);
-	std::vector<byte> tmp(Skein::SKEIN1024_RATE_SIZE);
-	ProcessBlock(tmp, 0, State, 8);
-}
-
-void Skein1024::Initialize(std::vector<Skein1024State> &State, SkeinParams &Params)
-{
-	std::vector<ulong> tmp = Params.GetConfig();
-	std::array<ulong, 16> cfg{ tmp[0], tmp[1], tmp[2], tmp[3], tmp[4], tmp[5], tmp[6], tmp[7], tmp[8], tmp[9], tmp[10], tmp[11], tmp[12], tmp[13], tmp[14], tmp[15] };
-	size_t i;
-
-	LoadState(State[0], cfg);
-
-	for (i = 1; i < State.size(); ++i)
-	{
-		// create unique state for each node
-		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Config);
-		SkeinUbiTweak::IsFinalBlock(State[i].T, true);
-		State[i].Increase(32);
-		// compress previous state
-		Permute(State[i - 1].V, State[i]);
-		// store the new state in V for reset
-		MemoryTools::Copy(State[i].S, 0, State[i].V, 0, State[i].V.size() * sizeof(ulong));
-		// mix config with state
-		MemoryTools::XOR1024(cfg, 0, State[i].V, 0);
-	}
-
-	for (i = 0; i < State.size(); ++i)
-	{
-		// copy the configuration value to the state
-		State[i].S = State[i].V;
-		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Message);
-	}
-}
-
-void Skein1024::LoadState(Skein1024State &State, std::array<ulong, 16> &Config)
-{
-	// initialize the tweak value
-	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Config);
-	SkeinUbiTweak::IsFinalBlock(State.T, true);
-	State.Increase(32);
-	Permute(Config, State);
-	// store the initial state for reset
-	MemoryTools::Copy(State.S, 0, State.V, 0, State.V.size() * sizeof(ulong));
-	// add the config string
-	MemoryTools::XOR1024(Config, 0, State.V, 0);
-}
-
-void Skein1024::Permute(std::array<ulong, 16> &Message, Skein1024State &State)
-{
-#if defined(CEX_DIGEST_COMPACT)
-	Skein::PemuteP1024C(Message, State.T, State.S, 80);
-#else
-	Skein::PemuteR80P1024U(Message, State.T, State.S);
-#endif
-}
-
-void Skein1024::ProcessBlock(const std::vector<byte> &Input, size_t InOffset, Skein1024State &State, size_t Length)
+void Skein1024::ProcessBlock(const Span<const byte> &Input, size_t InOffset, Skein1024State &State, size_t Length)
 {
 	// update length
 	State.Increase(Length);
@@ -453,7 +562,7 @@ void Skein1024::ProcessBlock(const std::vector<byte> &Input, size_t InOffset, Sk
 	}
 }
 
-void Skein1024::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, Skein1024State &State, ulong Length)
+void Skein1024::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, Skein1024State &State, ulong Length)
 {
 	do
 	{
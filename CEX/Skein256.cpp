@@ -14,6 +14,9 @@ class Skein256::Skein256State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = (4 * sizeof(ulong)) + (4 * sizeof(ulong)) + (2 * sizeof(ulong));
+
 	// state
 	std::array<ulong, 4> S = { 0 };
 	// config
@@ -30,6 +33,15 @@ public:
 		Reset();
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, S, 0, S.size() * sizeof(ulong));
+		Offset += S.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, V, 0, V.size() * sizeof(ulong));
+		Offset += V.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, T, 0, T.size() * sizeof(ulong));
+	}
+
 	void Increase(size_t Length)
 	{
 		T[0] += Length;
@@ -41,6 +53,15 @@ public:
 		MemoryTools::Clear(T, 0, T.size() * sizeof(ulong));
 		MemoryTools::Clear(V, 0, V.size() * sizeof(ulong));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(S, 0, SecureState, Offset, S.size() * sizeof(ulong));
+		Offset += S.size() * sizeof(ulong);
+		MemoryTools::Copy(V, 0, SecureState, Offset, V.size() * sizeof(ulong));
+		Offset += V.size() * sizeof(ulong);
+		MemoryTools::Copy(T, 0, SecureState, Offset, T.size() * sizeof(ulong));
+	}
 };
 
 //~~~Constructor~~~//
@@ -143,6 +164,47 @@ void Skein256::Compute(const std::vector<byte> &Input, std::vector<byte> &Output
 	Finalize(Output, 0);
 }
 
+void Skein256::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * Skein256State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += Skein256State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void Skein256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < Skein::SKEIN256_DIGEST_SIZE)
@@ -150,6 +212,12 @@ void Skein256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void Skein256::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, Skein::SKEIN256_DIGEST_SIZE);
 	size_t bctr;
 	size_t i;
 
@@ -192,7 +260,7 @@ void Skein256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, proot);
-		IntegerTools::LeULL256ToBlock(proot.S, 0, Output, OutOffset);
+		IntegerTools::LeULL256ToBlock(proot.S, 0, OTP, 0);
 	}
 	else
 	{
@@ -200,7 +268,7 @@ void Skein256::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		MemoryTools::Clear(m_msgBuffer, m_msgLength, m_msgBuffer.size() - m_msgLength);
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, m_dgtState[0]);
-		IntegerTools::LeULL256ToBlock(m_dgtState[0].S, 0, Output, OutOffset);
+		IntegerTools::LeULL256ToBlock(m_dgtState[0].S, 0, OTP, 0);
 	}
 
 	Reset();
@@ -239,6 +307,37 @@ void Skein256::Reset()
 	m_msgLength = 0;
 }
 
+SecureVector<byte> Skein256::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * Skein256State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += Skein256State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void Skein256::Update(byte Input)
 {
 	std::vector<byte> one(1, Input);
@@ -263,6 +362,88 @@ void Skein256::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
+	Process(Input, InOffset, Length);
+}
+
+void Skein256::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
+}
+
+//~~~Private Functions~~~//
+
+void Skein256::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, Skein256State &State)
+{
+	// process message block
+	SkeinUbiTweak::IsFinalBlock(State.T, true);
+
+	if (Length != 0)
+	{
+		while (Length != 0)
+		{
+			const size_t MSGRMD = (Length >= Skein::SKEIN256_RATE_SIZE) ? Skein::SKEIN256_RATE_SIZE : Length;
+			ProcessBlock(Input, InOffset, State, MSGRMD);
+			Length -= MSGRMD;
+			InOffset += MSGRMD;
+		}
+	}
+	else
+	{
+		ProcessBlock(Input, InOffset, State, 0);
+	}
+
+	// finalize block
+	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Out);
+	SkeinUbiTweak::IsFinalBlock(State.T, true);
+	std::vector<byte> tmp(Skein::SKEIN256_RATE_SIZE);
+	ProcessBlock(tmp, 0, State, 8);
+}
+
+void Skein256::Initialize(std::vector<Skein256State> &State, SkeinParams &Params)
+{
+	std::vector<ulong> tmp = Params.GetConfig();
+	std::array<ulong, 4> cfg{ tmp[0], tmp[1], tmp[2], tmp[3] };
+	size_t i;
+
+	LoadState(State[0], cfg);
+
+	for (i = 1; i < State.size(); ++i)
+	{
+		// create unique state for each node
+		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Config);
+		SkeinUbiTweak::IsFinalBlock(State[i].T, true);
+		State[i].Increase(32);
+		// compress previous state
+		Permute(State[i - 1].V, State[i]);
+		// store the new state in V for reset
+		MemoryTools::Copy(State[i].S, 0, State[i].V, 0, State[i].V.size() * sizeof(ulong));
+		// mix config with state
+		MemoryTools::XOR256(cfg, 0, State[i].V, 0);
+	}
+
+	for (i = 0; i < State.size(); ++i)
+	{
+		// copy the configuration value to the state
+		State[i].S = State[i].V;
+		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Message);
+	}
+}
+
+void Skein256::LoadState(Skein256State &State, std::array<ulong, 4> &Config)
+{
+	// initialize the tweak value
+	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Config);
+	SkeinUbiTweak::IsFinalBlock(State.T, true);
+	State.Increase(32);
+	Permute(Config, State);
+	// store the initial state for reset
+	MemoryTools::Copy(State.S, 0, State.V, 0, State.V.size() * sizeof(ulong));
+	// add the config string
+	MemoryTools::XOR256(Config, 0, State.V, 0);
+}
+
+void Skein256::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
 	if (Length != 0)
 	{
 		if (m_parallelProfile.IsParallel())
@@ -349,79 +530,7 @@ void Skein256::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 	}
 }
 
-//~~~Private Functions~~~//
-
-void Skein256::HashFinal(std::vector<byte> &Input, size_t InOffset, size_t Length, Skein256State &State)
-{
-	// process message block
-	SkeinUbiTweak::IsFinalBlock(State.T, true);
-
-	if (Length != 0)
-	{
-		while (Length != 0)
-		{
-			const size_t MSGRMD = (Length >= Skein::SKEIN256_RATE_SIZE) ? Skein::SKEIN256_RATE_SIZE : Length;
-			ProcessBlock(Input, InOffset, State, MSGRMD);
-			Length -= MSGRMD;
-			InOffset += MSGRMD;
-		}
-	}
-	else
-	{
-		ProcessBlock(Input, InOffset, State, 0);
-	}
-
-	// finalize block
-	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Out);
-	SkeinUbiTweak::IsFinalBlock(State.T, true);
-	std::vector<byte> tmp(Skein::SKEIN256_RATE_SIZE);
-	ProcessBlock(tmp, 0, State, 8);
-}
-
-void Skein256::Initialize(std::vector<Skein256State> &State, SkeinParams &Params)
-{
-	std::vector<ulong> tmp = Params.GetConfig();
-	std::array<ulong, 4> cfg{ tmp[0], tmp[1], tmp[2], tmp[3] };
-	size_t i;
-
-	LoadState(State[0], cfg);
-
-	for (i = 1; i < State.size(); ++i)
-	{
-		// create unique state for each node
-		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Config);
-		SkeinUbiTweak::IsFinalBlock(State[i].T, true);
-		State[i].Increase(32);
-		// compress previous state
-		Permute(State[i - 1].V, State[i]);
-		// store the new state in V for reset
-		MemoryTools::Copy(State[i].S, 0, State[i].V, 0, State[i].V.size() * sizeof(ulong));
-		// mix config with state
-		MemoryTools::XOR256(cfg, 0, State[i].V, 0);
-	}
-
-	for (i = 0; i < State.size(); ++i)
-	{
-		// copy the configuration value to the state
-		State[i].S = State[i].V;
-		SkeinUbiTweak::StartNewBlockType(State[i].T, SkeinUbiType::Message);
-	}
-}
-
-void Skein256::LoadState(Skein256State &State, std::array<ulong, 4> &Config)
-{
-	// initialize the tweak value
-	SkeinUbiTweak::StartNewBlockType(State.T, SkeinUbiType::Config);
-	SkeinUbiTweak::IsFinalBlock(State.T, true);
-	State.Increase(32);
-	Permute(Config, State);
-	// store the initial state for reset
-	MemoryTools::Copy(State.S, 0, State.V, 0, State.V.size() * sizeof(ulong));
-	// add the config string
-	MemoryTools::XOR256(Config, 0, State.V, 0);
-}
-
-void Skein256::ProcessBlock(const std::vector<byte> &Input, size_t InOffset, Skein256State &State, size_t Length)
+void Skein256::ProcessBlock(const Span<const byte> &Input, size_t InOffset, Skein256State &State, size_t Length)
 {
 	// update length
 	State.Increase(Length);
@@ -439,7 +548,7 @@ void Skein256::ProcessBlock(const std::vector<byte> &Input, size_t InOffset, Ske
 	}
 }
 
-void Skein256::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, Skein256State &State, ulong Length)
+void Skein256::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, Skein256State &State, ulong Length)
 {
 	do
 	{
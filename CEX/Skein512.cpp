@@ -15,6 +15,9 @@ class Skein512::Skein512State
 {
 public:
 
+	// the byte size of the serialized state
+	static const size_t SERIAL_SIZE = (8 * sizeof(ulong)) + (8 * sizeof(ulong)) + (2 * sizeof(ulong));
+
 	// state
 	std::array<ulong, 8> S = { 0 };
 	// config
@@ -31,6 +34,15 @@ public:
 		Reset();
 	}
 
+	void DeSerialize(const SecureVector<byte> &SecureState, size_t Offset)
+	{
+		MemoryTools::Copy(SecureState, Offset, S, 0, S.size() * sizeof(ulong));
+		Offset += S.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, V, 0, V.size() * sizeof(ulong));
+		Offset += V.size() * sizeof(ulong);
+		MemoryTools::Copy(SecureState, Offset, T, 0, T.size() * sizeof(ulong));
+	}
+
 	void Increase(size_t Length)
 	{
 		T[0] += Length;
@@ -42,6 +54,15 @@ public:
 		MemoryTools::Clear(T, 0, T.size() * sizeof(ulong));
 		MemoryTools::Clear(V, 0, V.size() * sizeof(ulong));
 	}
+
+	void Serialize(SecureVector<byte> &SecureState, size_t Offset) const
+	{
+		MemoryTools::Copy(S, 0, SecureState, Offset, S.size() * sizeof(ulong));
+		Offset += S.size() * sizeof(ulong);
+		MemoryTools::Copy(V, 0, SecureState, Offset, V.size() * sizeof(ulong));
+		Offset += V.size() * sizeof(ulong);
+		MemoryTools::Copy(T, 0, SecureState, Offset, T.size() * sizeof(ulong));
+	}
 };
 
 //~~~Constructor~~~//
@@ -144,6 +165,47 @@ void Skein512::Compute(const std::vector<byte> &Input, std::vector<byte> &Output
 	Finalize(Output, 0);
 }
 
+void Skein512::DeSerialize(const SecureVector<byte> &State)
+{
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	if (State.size() < STATE_HEADER)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is too small!"), ErrorCodes::InvalidSize);
+	}
+
+	scnt = 0;
+	mlen = 0;
+	MemoryTools::CopyToObject(State, sizeof(byte), &scnt, sizeof(ushort));
+	MemoryTools::CopyToObject(State, sizeof(byte) + sizeof(ushort), &mlen, sizeof(ulong));
+
+	// the state must be created by an instance with the same digest type and parallel degree
+	if (State[0] != static_cast<byte>(Enumeral()) || scnt != m_dgtState.size() || mlen > m_msgBuffer.size() ||
+		State.size() != STATE_HEADER + (scnt * Skein512State::SERIAL_SIZE) + mlen)
+	{
+		throw CryptoDigestException(Name(), std::string("DeSerialize"), std::string("The state array is invalid for this digest configuration!"), ErrorCodes::InvalidState);
+	}
+
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].DeSerialize(State, soff);
+		soff += Skein512State::SERIAL_SIZE;
+	}
+
+	MemoryTools::Clear(m_msgBuffer, 0, m_msgBuffer.size());
+	m_msgLength = static_cast<size_t>(mlen);
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(State, soff, m_msgBuffer, 0, m_msgLength);
+	}
+}
+
 void Skein512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 {
 	if (Output.size() - OutOffset < Skein::SKEIN512_DIGEST_SIZE)
@@ -151,6 +213,12 @@ void Skein512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 		throw CryptoDigestException(Name(), std::string("Finalize"), std::string("The output vector is too small!"), ErrorCodes::InvalidSize);
 	}
 
+	Finalize(Output.data() + OutOffset);
+}
+
+void Skein512::Finalize(byte* Output)
+{
+	const Span<byte> OTP(Output, Skein::SKEIN512_DIGEST_SIZE);
 	size_t bctr;
 	size_t i;
 
@@ -193,7 +261,7 @@ void Skein512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, proot);
-		IntegerTools::LeULL512ToBlock(proot.S, 0, Output, OutOffset);
+		IntegerTools::LeULL512ToBlock(proot.S, 0, OTP, 0);
 	}
 	else
 	{
@@ -205,7 +273,7 @@ void Skein512::Finalize(std::vector<byte> &Output, size_t OutOffset)
 
 		// finalize and store
 		HashFinal(m_msgBuffer, 0, m_msgLength, m_dgtState[0]);
-		IntegerTools::LeULL512ToBlock(m_dgtState[0].S, 0, Output, OutOffset);
+		IntegerTools::LeULL512ToBlock(m_dgtState[0].S, 0, OTP, 0);
 	}
 
 	Reset();
@@ -244,6 +312,37 @@ void Skein512::Reset()
 	m_msgLength = 0;
 }
 
+SecureVector<byte> Skein512::Serialize()
+{
+	const size_t STALEN = STATE_HEADER + (m_dgtState.size() * Skein512State::SERIAL_SIZE) + m_msgLength;
+
+	SecureVector<byte> state(STALEN);
+	ulong mlen;
+	size_t i;
+	size_t soff;
+	ushort scnt;
+
+	state[0] = static_cast<byte>(Enumeral());
+	scnt = static_cast<ushort>(m_dgtState.size());
+	MemoryTools::CopyFromObject(&scnt, state, sizeof(byte), sizeof(ushort));
+	mlen = static_cast<ulong>(m_msgLength);
+	MemoryTools::CopyFromObject(&mlen, state, sizeof(byte) + sizeof(ushort), sizeof(ulong));
+	soff = STATE_HEADER;
+
+	for (i = 0; i < m_dgtState.size(); ++i)
+	{
+		m_dgtState[i].Serialize(state, soff);
+		soff += Skein512State::SERIAL_SIZE;
+	}
+
+	if (m_msgLength != 0)
+	{
+		MemoryTools::Copy(m_msgBuffer, 0, state, soff, m_msgLength);
+	}
+
+	return state;
+}
+
 void Skein512::Update(byte Input)
 {
 	std::vector<byte> one(1, Input);
@@ -268,90 +367,12 @@ void Skein512::Update(const std::vector<byte> &Input, size_t InOffset, size_t Le
 {
 	CEXASSERT(Input.size() - InOffset >= Length, "The input buffer is too short!");
 
-	if (Length != 0)
-	{
-		if (m_parallelProfile.IsParallel())
-		{
-			if (m_msgLength != 0 && Length + m_msgLength >= m_msgBuffer.size())
-			{
-				// fill buffer
-				const size_t RMDLEN = m_msgBuffer.size() - m_msgLength;
-				if (RMDLEN != 0)
-				{
-					MemoryTools::Copy(Input, InOffset, m_msgBuffer, m_msgLength, RMDLEN);
-				}
-
-				// empty the message buffer
-				ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset](size_t i)
-				{
-					ProcessBlock(m_msgBuffer, i * Skein::SKEIN512_RATE_SIZE, m_dgtState[i], Skein::SKEIN512_RATE_SIZE);
-				});
-
-				m_msgLength = 0;
-				Length -= RMDLEN;
-				InOffset += RMDLEN;
-			}
-
-			if (Length >= m_parallelProfile.ParallelBlockSize())
-			{
-				// calculate working set size
-				const size_t PRCLEN = Length - (Length % m_parallelProfile.ParallelBlockSize());
-
-				// process large blocks
-				ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, PRCLEN](size_t i)
-				{
-					ProcessLeaf(Input, InOffset + (i * Skein::SKEIN512_RATE_SIZE), m_dgtState[i], PRCLEN);
-				});
-
-				Length -= PRCLEN;
-				InOffset += PRCLEN;
-			}
-
-			if (Length >= m_parallelProfile.ParallelMinimumSize())
-			{
-				const size_t PRMLEN = Length - (Length % m_parallelProfile.ParallelMinimumSize());
-
-				ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, PRMLEN](size_t i)
-				{
-					ProcessLeaf(Input, InOffset + (i * Skein::SKEIN512_RATE_SIZE), m_dgtState[i], PRMLEN);
-				});
-
-				Length -= PRMLEN;
-				InOffset += PRMLEN;
-			}
-		}
-		else
-		{
-			if (m_msgLength != 0 && (m_msgLength + Length > Skein::SKEIN512_RATE_SIZE))
-			{
-				const size_t RMDLEN = Skein::SKEIN512_RATE_SIZE - m_msgLength;
-				if (RMDLEN != 0)
-				{
-					MemoryTools::Copy(Input, InOffset, m_msgBuffer, m_msgLength, RMDLEN);
-				}
-
-				ProcessBlock(m_msgBuffer, 0, m_dgtState[0], Skein::SKEIN512_RATE_SIZE);
-				m_msgLength = 0;
-				InOffset += RMDLEN;
-				Length -= RMDLEN;
-			}
-
-			// sequential loop through blocks
-			while (Length > Skein::SKEIN512_RATE_SIZE)
-			{
-				ProcessBlock(Input, InOffset, m_dgtState[0], Skein::SKEIN512_RATE_SIZE);
-				InOffset += Skein::SKEIN512_RATE_SIZE;
-				Length -= Skein::SKEIN512_RATE_SIZE;
-			}
-		}
+	Process(Input, InOffset, Length);
+}
 
-		// store unaligned bytes
-		if (Length != 0)
-		{
-			MemoryTools::Copy(Input, InOffset, m_msgBuffer, m_msgLength, Length);
-			m_msgLength += Length;
-		}
-	}
+void Skein512::Update(const byte* Input, size_t Length)
+{
+	Process(Span<const byte>(Input, Length), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -439,7 +460,95 @@ void Skein512::Permute(std::array<ulong, 8> &Message, Skein512State &State)
 #endif
 }
 
-void Skein512::ProcessBlock(const std::vector<byte> &Input, size_t InOffset, Skein512State &State, size_t Length)
+void Skein512::Process(const Span<const byte> &Input, size_t InOffset, size_t Length)
+{
+	if (Length != 0)
+	{
+		if (m_parallelProfile.IsParallel())
+		{
+			if (m_msgLength != 0 && Length + m_msgLength >= m_msgBuffer.size())
+			{
+				// fill buffer
+				const size_t RMDLEN = m_msgBuffer.size() - m_msgLength;
+				if (RMDLEN != 0)
+				{
+					MemoryTools::Copy(Input, InOffset, m_msgBuffer, m_msgLength, RMDLEN);
+				}
+
+				// empty the message buffer
+				ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset](size_t i)
+				{
+					ProcessBlock(m_msgBuffer, i * Skein::SKEIN512_RATE_SIZE, m_dgtState[i], Skein::SKEIN512_RATE_SIZE);
+				});
+
+				m_msgLength = 0;
+				Length -= RMDLEN;
+				InOffset += RMDLEN;
+			}
+
+			if (Length >= m_parallelProfile.ParallelBlockSize())
+			{
+				// calculate working set size
+				const size_t PRCLEN = Length - (Length % m_parallelProfile.ParallelBlockSize());
+
+				// process large blocks
+				ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, PRCLEN](size_t i)
+				{
+					ProcessLeaf(Input, InOffset + (i * Skein::SKEIN512_RATE_SIZE), m_dgtState[i], PRCLEN);
+				});
+
+				Length -= PRCLEN;
+				InOffset += PRCLEN;
+			}
+
+			if (Length >= m_parallelProfile.ParallelMinimumSize())
+			{
+				const size_t PRMLEN = Length - (Length % m_parallelProfile.ParallelMinimumSize());
+
+				ParallelTools::ParallelFor(0, m_parallelProfile.ParallelMaxDegree(), [this, &Input, InOffset, PRMLEN](size_t i)
+				{
+					ProcessLeaf(Input, InOffset + (i * Skein::SKEIN512_RATE_SIZE), m_dgtState[i], PRMLEN);
+				});
+
+				Length -= PRMLEN;
+				InOffset += PRMLEN;
+			}
+		}
+		else
+		{
+			if (m_msgLength != 0 && (m_msgLength + Length > Skein::SKEIN512_RATE_SIZE))
+			{
+				const size_t RMDLEN = Skein::SKEIN512_RATE_SIZE - m_msgLength;
+				if (RMDLEN != 0)
+				{
+					MemoryTools::Copy(Input, InOffset, m_msgBuffer, m_msgLength, RMDLEN);
+				}
+
+				ProcessBlock(m_msgBuffer, 0, m_dgtState[0], Skein::SKEIN512_RATE_SIZE);
+				m_msgLength = 0;
+				InOffset += RMDLEN;
+				Length -= RMDLEN;
+			}
+
+			// sequential loop through blocks
+			while (Length > Skein::SKEIN512_RATE_SIZE)
+			{
+				ProcessBlock(Input, InOffset, m_dgtState[0], Skein::SKEIN512_RATE_SIZE);
+				InOffset += Skein::SKEIN512_RATE_SIZE;
+				Length -= Skein::SKEIN512_RATE_SIZE;
+			}
+		}
+
+		// store unaligned bytes
+		if (Length != 0)
+		{
+			MemoryTools::Copy(Input, InOffset, m_msgBuffer, m_msgLength, Length);
+			m_msgLength += Length;
+		}
+	}
+}
+
+void Skein512::ProcessBlock(const Span<const byte> &Input, size_t InOffset, Skein512State &State, size_t Length)
 {
 	std::array<ulong, 8> msg;
 
@@ -459,7 +568,7 @@ void Skein512::ProcessBlock(const std::vector<byte> &Input, size_t InOffset, Ske
 	}
 }
 
-void Skein512::ProcessLeaf(const std::vector<byte> &Input, size_t InOffset, Skein512State &State, ulong Length)
+void Skein512::ProcessLeaf(const Span<const byte> &Input, size_t InOffset, Skein512State &State, ulong Length)
 {
 	do
 	{
@@ -0,0 +1,180 @@
+#ifndef CEX_SPAN_H
+#define CEX_SPAN_H
+
+#include "CexDomain.h"
+#include <array>
+#include <type_traits>
+#include <vector>
+
+NAMESPACE_ROOT
+
+/// <summary>
+/// A non-owning view of a contiguous range of integers.
+/// <para>Implements the subset of the standard vector interface used by the library array templates (value_type, size, data, and the subscript operator),
+/// so a raw pointer and length can be passed through the same kernels as a vector, without copying.
+/// A span does not extend the lifetime of the memory it refers to; the caller must keep the underlying buffer alive while the span is in use.</para>
+/// </summary>
+template <typename T>
+class Span
+{
+public:
+
+	typedef typename std::remove_const<T>::type value_type;
+	typedef size_t size_type;
+	typedef T* iterator;
+	typedef const T* const_iterator;
+
+private:
+
+	T* m_data;
+	size_t m_length;
+
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Constructor: instantiate an empty span
+	/// </summary>
+	Span()
+		:
+		m_data(nullptr),
+		m_length(0)
+	{
+	}
+
+	/// <summary>
+	/// Constructor: instantiate a span over a pointer and a length
+	/// </summary>
+	///
+	/// <param name="Data">A pointer to the first element</param>
+	/// <param name="Length">The number of elements in the range</param>
+	Span(T* Data, size_t Length)
+		:
+		m_data(Data),
+		m_length(Length)
+	{
+	}
+
+	/// <summary>
+	/// Constructor: instantiate a span over the elements of a vector
+	/// </summary>
+	///
+	/// <param name="Input">The source vector</param>
+	template <typename U, typename Allocator>
+	Span(std::vector<U, Allocator> &Input)
+		:
+		m_data(Input.data()),
+		m_length(Input.size())
+	{
+	}
+
+	/// <summary>
+	/// Constructor: instantiate a read-only span over the elements of a vector
+	/// </summary>
+	///
+	/// <param name="Input">The source vector</param>
+	template <typename U, typename Allocator>
+	Span(const std::vector<U, Allocator> &Input)
+		:
+		m_data(Input.data()),
+		m_length(Input.size())
+	{
+	}
+
+	/// <summary>
+	/// Constructor: instantiate a span over the elements of an array
+	/// </summary>
+	///
+	/// <param name="Input">The source array</param>
+	template <typename U, size_t N>
+	Span(std::array<U, N> &Input)
+		:
+		m_data(Input.data()),
+		m_length(N)
+	{
+	}
+
+	/// <summary>
+	/// Constructor: instantiate a read-only span from a writeable span
+	/// </summary>
+	///
+	/// <param name="Input">The source span</param>
+	template <typename U>
+	Span(const Span<U> &Input)
+		:
+		m_data(Input.data()),
+		m_length(Input.size())
+	{
+	}
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: A pointer to the first element
+	/// </summary>
+	T* data() const
+	{
+		return m_data;
+	}
+
+	/// <summary>
+	/// Read Only: The span contains no elements
+	/// </summary>
+	bool empty() const
+	{
+		return (m_length == 0);
+	}
+
+	/// <summary>
+	/// Read Only: The number of elements in the span
+	/// </summary>
+	size_t size() const
+	{
+		return m_length;
+	}
+
+	/// <summary>
+	/// Read Only: An iterator to the first element
+	/// </summary>
+	T* begin() const
+	{
+		return m_data;
+	}
+
+	/// <summary>
+	/// Read Only: An iterator past the last element
+	/// </summary>
+	T* end() const
+	{
+		return m_data + m_length;
+	}
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Get a reference to an element
+	/// </summary>
+	///
+	/// <param name="Index">The element index</param>
+	T &operator[](size_t Index) const
+	{
+		return m_data[Index];
+	}
+
+	/// <summary>
+	/// Get a span over a sub-range of this span
+	/// </summary>
+	///
+	/// <param name="Offset">The index of the first element of the sub-range</param>
+	/// <param name="Length">The number of elements in the sub-range</param>
+	///
+	/// <returns>The sub-range span</returns>
+	Span Subspan(size_t Offset, size_t Length) const
+	{
+		return Span(m_data + Offset, Length);
+	}
+};
+
+NAMESPACE_ROOTEND
+#endif
@@ -25,7 +25,15 @@ enum class StreamModes : byte
 	/// <summary>
 	/// A SecureStream class, provides streaming encrytped memory storage
 	/// </summary>
-	SecureStream = 4
+	SecureStream = 4,
+	/// <summary>
+	/// A MappedFileStream class, provides memory-mapped file access
+	/// </summary>
+	MappedFileStream = 8,
+	/// <summary>
+	/// A DirectFileStream class, provides descriptor based file access for large sequential files
+	/// </summary>
+	DirectFileStream = 16
 };
 
 NAMESPACE_ENUMERATIONEND
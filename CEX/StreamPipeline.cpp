@@ -0,0 +1,334 @@
+#include "StreamPipeline.h"
+#include "MemoryTools.h"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+NAMESPACE_PROCESSING
+
+using Enumeration::ErrorCodes;
+using Tools::MemoryTools;
+
+const std::string StreamPipeline::CLASS_NAME("StreamPipeline");
+
+class StreamPipeline::PipelineState
+{
+public:
+
+	std::vector<std::vector<byte>> Input;
+	std::vector<std::vector<byte>> Output;
+	std::vector<size_t> Lengths;
+	std::vector<size_t> OutLengths;
+	std::condition_variable Signal;
+	std::mutex Lock;
+	std::exception_ptr Error;
+	size_t BufferSize;
+	size_t Depth;
+	// the number of buffers read, processed, and written; buffer i occupies slot i % Depth
+	size_t Filled;
+	size_t Processed;
+	size_t Written;
+	bool Abort;
+	bool Writing;
+
+	PipelineState(size_t Size, size_t Count)
+		:
+		Input(Count, std::vector<byte>(Size)),
+		Output(0),
+		Lengths(Count, 0),
+		OutLengths(Count, 0),
+		Signal(),
+		Lock(),
+		Error(nullptr),
+		BufferSize(Size),
+		Depth(Count),
+		Filled(0),
+		Processed(0),
+		Written(0),
+		Abort(false),
+		Writing(false)
+	{
+	}
+
+	~PipelineState()
+	{
+		for (size_t i = 0; i < Input.size(); ++i)
+		{
+			MemoryTools::Clear(Input[i], 0, Input[i].size());
+		}
+
+		for (size_t i = 0; i < Output.size(); ++i)
+		{
+			MemoryTools::Clear(Output[i], 0, Output[i].size());
+		}
+
+		BufferSize = 0;
+		Depth = 0;
+		Filled = 0;
+		Processed = 0;
+		Written = 0;
+		Abort = false;
+		Writing = false;
+	}
+
+	void Fail(std::exception_ptr Exception)
+	{
+		{
+			std::lock_guard<std::mutex> lck(Lock);
+
+			if (Error == nullptr)
+			{
+				Error = Exception;
+			}
+
+			Abort = true;
+		}
+
+		Signal.notify_all();
+	}
+
+	void Reset(bool IsWriting)
+	{
+		Error = nullptr;
+		Filled = 0;
+		Processed = 0;
+		Written = 0;
+		Abort = false;
+		Writing = IsWriting;
+	}
+};
+
+//~~~Constructor~~~//
+
+StreamPipeline::StreamPipeline(size_t BufferSize, size_t Depth)
+	:
+	m_pipelineState(BufferSize != 0 && Depth >= 2 ? new PipelineState(BufferSize, Depth) :
+		throw CryptoProcessingException(CLASS_NAME, std::string("Constructor"), std::string("The buffer size can not be zero, and the depth must be at least 2!"), ErrorCodes::InvalidParam))
+{
+}
+
+StreamPipeline::~StreamPipeline()
+{
+}
+
+//~~~Accessors~~~//
+
+const size_t StreamPipeline::BufferSize()
+{
+	return m_pipelineState->BufferSize;
+}
+
+const size_t StreamPipeline::Depth()
+{
+	return m_pipelineState->Depth;
+}
+
+//~~~Public Functions~~~//
+
+void StreamPipeline::Process(IByteStream* InStream, size_t Length, const std::function<void(const std::vector<byte>&, size_t)> &Consume)
+{
+	PipelineState* state = m_pipelineState.get();
+
+	Run(InStream, nullptr, Length, [state, &Consume](size_t Slot)
+	{
+		Consume(state->Input[Slot], state->Lengths[Slot]);
+	});
+}
+
+void StreamPipeline::Process(IByteStream* InStream, IByteStream* OutStream, size_t Length, const std::function<void(const std::vector<byte>&, std::vector<byte>&, size_t)> &Transform)
+{
+	if (InStream == OutStream)
+	{
+		throw CryptoProcessingException(CLASS_NAME, std::string("Process"), std::string("The input and output streams can not be the same instance!"), ErrorCodes::IllegalOperation);
+	}
+
+	PipelineState* state = m_pipelineState.get();
+
+	if (state->Output.size() != state->Depth)
+	{
+		state->Output.resize(state->Depth, std::vector<byte>(state->BufferSize));
+	}
+
+	Run(InStream, OutStream, Length, [state, &Transform](size_t Slot)
+	{
+		// the output length is copied, the reader can refill the input slot before the writer is done with the output
+		state->OutLengths[Slot] = state->Lengths[Slot];
+		Transform(state->Input[Slot], state->Output[Slot], state->OutLengths[Slot]);
+	});
+}
+
+//~~~Private Functions~~~//
+
+void StreamPipeline::Run(IByteStream* InStream, IByteStream* OutStream, size_t Length, const std::function<void(size_t)> &Stage)
+{
+	PipelineState* state = m_pipelineState.get();
+	const size_t BUFCNT = (Length + state->BufferSize - 1) / state->BufferSize;
+	size_t i;
+
+	if (BUFCNT == 0)
+	{
+		return;
+	}
+
+	state->Reset(OutStream != nullptr);
+
+	std::thread reader(&StreamPipeline::ReadStage, state, InStream, Length, BUFCNT);
+	std::thread writer;
+
+	if (state->Writing)
+	{
+		writer = std::thread(&StreamPipeline::WriteStage, state, OutStream, BUFCNT);
+	}
+
+	try
+	{
+		for (i = 0; i < BUFCNT; ++i)
+		{
+			{
+				std::unique_lock<std::mutex> lck(state->Lock);
+
+				// wait for the reader to fill the slot, and for the writer to empty its previous output
+				state->Signal.wait(lck, [state, i]()
+				{
+					return state->Abort || (state->Filled > i && (!state->Writing || i < state->Written + state->Depth));
+				});
+
+				if (state->Abort)
+				{
+					break;
+				}
+			}
+
+			Stage(i % state->Depth);
+
+			{
+				std::lock_guard<std::mutex> lck(state->Lock);
+				++state->Processed;
+			}
+
+			state->Signal.notify_all();
+		}
+	}
+	catch (...)
+	{
+		state->Fail(std::current_exception());
+	}
+
+	reader.join();
+
+	if (writer.joinable())
+	{
+		writer.join();
+	}
+
+	if (state->Error != nullptr)
+	{
+		std::exception_ptr err = state->Error;
+		state->Error = nullptr;
+		std::rethrow_exception(err);
+	}
+}
+
+void StreamPipeline::ReadStage(PipelineState* State, IByteStream* InStream, size_t Length, size_t Count)
+{
+	size_t i;
+	size_t rmdlen;
+
+	rmdlen = Length;
+
+	try
+	{
+		for (i = 0; i < Count; ++i)
+		{
+			const size_t SLTIDX = i % State->Depth;
+			const size_t RDLEN = rmdlen < State->BufferSize ? rmdlen : State->BufferSize;
+			size_t pread;
+
+			{
+				std::unique_lock<std::mutex> lck(State->Lock);
+
+				// the slot is free once the buffer that last occupied it has been processed
+				State->Signal.wait(lck, [State, i]()
+				{
+					return State->Abort || i < State->Processed + State->Depth;
+				});
+
+				if (State->Abort)
+				{
+					break;
+				}
+			}
+
+			pread = 0;
+
+			while (pread != RDLEN)
+			{
+				const size_t RLEN = InStream->Read(State->Input[SLTIDX], pread, RDLEN - pread);
+
+				if (RLEN == 0)
+				{
+					throw CryptoProcessingException(CLASS_NAME, std::string("Process"), std::string("The input stream ended before the expected length!"), ErrorCodes::BadRead);
+				}
+
+				pread += RLEN;
+			}
+
+			State->Lengths[SLTIDX] = RDLEN;
+			rmdlen -= RDLEN;
+
+			{
+				std::lock_guard<std::mutex> lck(State->Lock);
+				++State->Filled;
+			}
+
+			State->Signal.notify_all();
+		}
+	}
+	catch (...)
+	{
+		State->Fail(std::current_exception());
+	}
+}
+
+void StreamPipeline::WriteStage(PipelineState* State, IByteStream* OutStream, size_t Count)
+{
+	size_t i;
+
+	try
+	{
+		for (i = 0; i < Count; ++i)
+		{
+			const size_t SLTIDX = i % State->Depth;
+
+			{
+				std::unique_lock<std::mutex> lck(State->Lock);
+
+				State->Signal.wait(lck, [State, i]()
+				{
+					return State->Abort || State->Processed > i;
+				});
+
+				if (State->Abort)
+				{
+					break;
+				}
+			}
+
+			OutStream->Write(State->Output[SLTIDX], 0, State->OutLengths[SLTIDX]);
+
+			{
+				std::lock_guard<std::mutex> lck(State->Lock);
+				++State->Written;
+			}
+
+			State->Signal.notify_all();
+		}
+	}
+	catch (...)
+	{
+		State->Fail(std::current_exception());
+	}
+}
+
+NAMESPACE_PROCESSINGEND
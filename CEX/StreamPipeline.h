@@ -0,0 +1,165 @@
+// The GPL version 3 License (GPLv3)
+//
+// Copyright (c) 2020 vtdev.com
+// This file is part of the CEX Cryptographic library.
+//
+// This program is free software : you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+//
+// Implementation Details:
+// A bounded ring of stream buffers, that overlaps stream reads and writes with the processing stage.
+// Contact: develop@vtdev.com
+
+#ifndef CEX_STREAMPIPELINE_H
+#define CEX_STREAMPIPELINE_H
+
+#include "CexDomain.h"
+#include "CryptoProcessingException.h"
+#include "IByteStream.h"
+#include <functional>
+
+NAMESPACE_PROCESSING
+
+using Exception::CryptoProcessingException;
+using IO::IByteStream;
+
+/// <summary>
+/// A pipelined stream processor, used by the CipherStream, DigestStream, and MacStream classes.
+/// <para>The input stream is read by a reader thread into a bounded ring of buffers, the buffers are processed in order on the calling thread,
+/// and the processed buffers are written to the output stream by a writer thread.
+/// Disk reads, the cipher or digest, and disk writes run concurrently, so the throughput approaches the slowest of the three stages.</para>
+/// </summary>
+///
+/// <example>
+/// <description>Transforming a stream:</description>
+/// <code>
+/// StreamPipeline pipe(Cipher->ParallelBlockSize());
+/// pipe.Process(InStream, OutStream, Length, [Cipher](const std::vector&lt;byte&gt; &amp;Input, std::vector&lt;byte&gt; &amp;Output, size_t Length)
+/// {
+///		Cipher->Transform(Input, 0, Output, 0, Length);
+/// });
+/// </code>
+/// </example>
+///
+/// <remarks>
+/// <description>Implementation Notes:</description>
+/// <list type="bullet">
+/// <item><description>The processing delegate always runs on the calling thread, in stream order; a parallel cipher or digest can use the thread pool from within the delegate.</description></item>
+/// <item><description>The reader and writer are dedicated threads, so blocking stream I/O never occupies a thread pool worker.</description></item>
+/// <item><description>The ring holds Depth buffers; the reader can run at most Depth buffers ahead of the processing stage, and the processing stage at most Depth buffers ahead of the writer.</description></item>
+/// <item><description>An exception thrown by any stage stops the pipeline, and the first exception is re-thrown on the calling thread once both threads have exited.</description></item>
+/// <item><description>The input and output streams must be different instances; the two streams are accessed concurrently.</description></item>
+/// </list>
+/// </remarks>
+class StreamPipeline
+{
+private:
+
+	static const std::string CLASS_NAME;
+
+	class PipelineState;
+	std::unique_ptr<PipelineState> m_pipelineState;
+
+public:
+
+	/// <summary>
+	/// The default number of buffers in the ring
+	/// </summary>
+	static const size_t DEF_DEPTH = 4;
+
+	/// <summary>
+	/// The default buffer size used by the sequential processing stages
+	/// </summary>
+	static const size_t DEF_BUFFER = 64 * 1024;
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	StreamPipeline(const StreamPipeline&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	StreamPipeline& operator=(const StreamPipeline&) = delete;
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	StreamPipeline() = delete;
+
+	/// <summary>
+	/// Initialize the pipeline and allocate the buffer ring
+	/// </summary>
+	///
+	/// <param name="BufferSize">The size in bytes of each buffer in the ring; each buffer is processed by one call to the delegate</param>
+	/// <param name="Depth">The number of buffers in the ring, the minimum is 2</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the buffer size is zero, or the depth is less than 2</exception>
+	StreamPipeline(size_t BufferSize, size_t Depth = DEF_DEPTH);
+
+	/// <summary>
+	/// Destructor: finalize this class
+	/// </summary>
+	~StreamPipeline();
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The size in bytes of each buffer in the ring
+	/// </summary>
+	const size_t BufferSize();
+
+	/// <summary>
+	/// Read Only: The number of buffers in the ring
+	/// </summary>
+	const size_t Depth();
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Read a length of bytes from the input stream, and pass each buffer to a consuming delegate, i.e. a digest or MAC update.
+	/// <para>The final buffer may be shorter than BufferSize.</para>
+	/// </summary>
+	///
+	/// <param name="InStream">The source stream, read from its current position</param>
+	/// <param name="Length">The number of bytes to process</param>
+	/// <param name="Consume">The delegate that receives each buffer and its length, called on the calling thread</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the input stream ends before Length bytes have been read</exception>
+	void Process(IByteStream* InStream, size_t Length, const std::function<void(const std::vector<byte>&, size_t)> &Consume);
+
+	/// <summary>
+	/// Read a length of bytes from the input stream, transform each buffer, and write the transformed buffers to the output stream.
+	/// <para>The transform delegate writes the same number of bytes it receives; the final buffer may be shorter than BufferSize.</para>
+	/// </summary>
+	///
+	/// <param name="InStream">The source stream, read from its current position</param>
+	/// <param name="OutStream">The destination stream, written at its current position</param>
+	/// <param name="Length">The number of bytes to process</param>
+	/// <param name="Transform">The delegate that transforms the input buffer to the output buffer, called on the calling thread</param>
+	///
+	/// <exception cref="CryptoProcessingException">Thrown if the input and output streams are the same instance, or the input stream ends before Length bytes have been read</exception>
+	void Process(IByteStream* InStream, IByteStream* OutStream, size_t Length, const std::function<void(const std::vector<byte>&, std::vector<byte>&, size_t)> &Transform);
+
+private:
+
+	void Run(IByteStream* InStream, IByteStream* OutStream, size_t Length, const std::function<void(size_t)> &Stage);
+	static void ReadStage(PipelineState* State, IByteStream* InStream, size_t Length, size_t Count);
+	static void WriteStage(PipelineState* State, IByteStream* OutStream, size_t Count);
+};
+
+NAMESPACE_PROCESSINGEND
+#endif
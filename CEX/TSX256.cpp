@@ -312,57 +312,20 @@ void TSX256::SetAssociatedData(const std::vector<byte> &Input, size_t Offset, si
 
 void TSX256::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
 {
-	if (IsEncryption() == true)
+	if (IsEncryption() == true && IsAuthenticator() == true && Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
 	{
-		if (IsAuthenticator() == true)
-		{
-			if (Output.size() < Length + OutOffset + m_macAuthenticator->TagSize())
-			{
-				throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
-			}
-
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[0]), 0, sizeof(ulong));
-			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[1]), 0, sizeof(ulong));
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Output, OutOffset, Length);
-			// update the mac counter
-			m_tsx256State->Counter += Length;
-			// finalize the mac and add the tag to the stream
-			Finalize(m_tsx256State, m_macAuthenticator);
-			MemoryTools::Copy(m_tsx256State->MacTag, 0, Output, OutOffset + Length, m_tsx256State->MacTag.size());
-		}
-		else
-		{
-			// encrypt the stream
-			Process(Input, InOffset, Output, OutOffset, Length);
-		}
+		throw CryptoSymmetricException(Name(), std::string("Transform"), std::string("The vector is not long enough to add the MAC code!"), ErrorCodes::InvalidSize);
 	}
-	else
-	{
-		if (IsAuthenticator())
-		{
-			// add the starting position of the nonce
-			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[0]), 0, sizeof(ulong));
-			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[1]), 0, sizeof(ulong));
-			// update the mac with the ciphertext
-			m_macAuthenticator->Update(Input, InOffset, Length);
-			// update the mac counter
-			m_tsx256State->Counter += Length;
-			// finalize the mac and verify
-			Finalize(m_tsx256State, m_macAuthenticator);
 
-			if (!IntegerTools::Compare(Input, InOffset + Length, m_tsx256State->MacTag, 0, m_tsx256State->MacTag.size()))
-			{
-				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
-			}
-		}
+	ProcessStream(Input, InOffset, Output, OutOffset, Length);
+}
 
-		// decrypt the stream
-		Process(Input, InOffset, Output, OutOffset, Length);
-	}
+void TSX256::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	const size_t INPLEN = (IsEncryption() == false && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+	const size_t OTPLEN = (IsEncryption() == true && IsAuthenticator() == true) ? Length + m_macAuthenticator->TagSize() : Length;
+
+	ProcessStream(Span<const byte>(Input, INPLEN), 0, Span<byte>(Output, OTPLEN), 0, Length);
 }
 
 //~~~Private Functions~~~//
@@ -379,7 +342,7 @@ void TSX256::Finalize(std::unique_ptr<TSX256State> &State, std::unique_ptr<IMac>
 	Authenticator->Finalize(State->MacTag, 0);
 }
 
-void TSX256::Generate(std::unique_ptr<TSX256State> &State, std::array<ulong, 2> &Nonce, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void TSX256::Generate(std::unique_ptr<TSX256State> &State, std::array<ulong, 2> &Nonce, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	size_t ctr;
 
@@ -489,28 +452,49 @@ void TSX256::Generate(std::unique_ptr<TSX256State> &State, std::array<ulong, 2>
 	}
 }
 
-void TSX256::Process(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+void TSX256::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
 {
 	const size_t PRCLEN = Length;
 
 	if (!m_parallelProfile.IsParallel() || PRCLEN < m_parallelProfile.ParallelMinimumSize())
 	{
-		// generate random
-		Generate(m_tsx256State, m_tsx256State->Nonce, Output, OutOffset, PRCLEN);
-		// output is input ^ random
-		const size_t ALNLEN = PRCLEN - (PRCLEN % BLOCK_SIZE);
-
-		if (ALNLEN != 0)
+		if (Input.data() + InOffset != Output.data() + OutOffset)
 		{
-			MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
-		}
+			// generate random
+			Generate(m_tsx256State, m_tsx256State->Nonce, Output, OutOffset, PRCLEN);
+			// output is input ^ random
+			const size_t ALNLEN = PRCLEN - (PRCLEN % BLOCK_SIZE);
 
-		// process the remaining bytes
-		if (ALNLEN != PRCLEN)
+			if (ALNLEN != 0)
+			{
+				MemoryTools::XOR(Input, InOffset, Output, OutOffset, ALNLEN);
+			}
+
+			// process the remaining bytes
+			if (ALNLEN != PRCLEN)
+			{
+				for (size_t i = ALNLEN; i < PRCLEN; ++i)
+				{
+					Output[i + OutOffset] ^= Input[i + InOffset];
+				}
+			}
+		}
+		else
 		{
-			for (size_t i = ALNLEN; i < PRCLEN; ++i)
+			// in-place; the key-stream is generated to a temporary buffer in block-aligned segments
+			const size_t SEGLEN = 64 * BLOCK_SIZE;
+			std::vector<byte> tmpk(PRCLEN < SEGLEN ? PRCLEN : SEGLEN);
+			size_t plen;
+			size_t pos;
+
+			pos = 0;
+
+			while (pos != PRCLEN)
 			{
-				Output[i + OutOffset] ^= Input[i + InOffset];
+				plen = (PRCLEN - pos < tmpk.size()) ? PRCLEN - pos : tmpk.size();
+				Generate(m_tsx256State, m_tsx256State->Nonce, tmpk, 0, plen);
+				MemoryTools::XOR(tmpk, 0, Output, OutOffset + pos, plen);
+				pos += plen;
 			}
 		}
 	}
@@ -529,10 +513,21 @@ void TSX256::Process(const std::vector<byte> &Input, size_t InOffset, std::vecto
 			// offset counter by chunk size
 			IntegerTools::LeIncreaseW(m_tsx256State->Nonce, thdCtr, (CTROFT * i));
 			const size_t STMPOS = i * CNKLEN;
-			// create random at offset position
-			this->Generate(m_tsx256State, thdCtr, Output, OutOffset + STMPOS, CNKLEN);
-			// xor with input at offset
-			MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+
+			if (Input.data() + InOffset != Output.data() + OutOffset)
+			{
+				// create random at offset position
+				this->Generate(m_tsx256State, thdCtr, Output, OutOffset + STMPOS, CNKLEN);
+				// xor with input at offset
+				MemoryTools::XOR(Input, InOffset + STMPOS, Output, OutOffset + STMPOS, CNKLEN);
+			}
+			else
+			{
+				// in-place; the key-stream is generated to a thread buffer
+				std::vector<byte> thdk(CNKLEN);
+				this->Generate(m_tsx256State, thdCtr, thdk, 0, CNKLEN);
+				MemoryTools::XOR(thdk, 0, Output, OutOffset + STMPOS, CNKLEN);
+			}
 			// store last counter
 			if (i == m_parallelProfile.ParallelMaxDegree() - 1)
 			{
@@ -550,16 +545,68 @@ void TSX256::Process(const std::vector<byte> &Input, size_t InOffset, std::vecto
 			InOffset += ALNLEN;
 			OutOffset += ALNLEN;
 
-			Generate(m_tsx256State, m_tsx256State->Nonce, Output, OutOffset, FNLLEN);
+			std::vector<byte> fnlk(FNLLEN);
+
+			Generate(m_tsx256State, m_tsx256State->Nonce, fnlk, 0, FNLLEN);
 
 			for (size_t i = 0; i < FNLLEN; ++i)
 			{
-				Output[OutOffset + i] ^= Input[InOffset + i];
+				Output[OutOffset + i] = Input[InOffset + i] ^ fnlk[i];
 			}
 		}
 	}
 }
 
+void TSX256::ProcessStream(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (IsEncryption() == true)
+	{
+		if (IsAuthenticator() == true)
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[0]), 0, sizeof(ulong));
+			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[1]), 0, sizeof(ulong));
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Output.data() + OutOffset, Length);
+			// update the mac counter
+			m_tsx256State->Counter += Length;
+			// finalize the mac and add the tag to the stream
+			Finalize(m_tsx256State, m_macAuthenticator);
+			MemoryTools::Copy(m_tsx256State->MacTag, 0, Output, OutOffset + Length, m_tsx256State->MacTag.size());
+		}
+		else
+		{
+			// encrypt the stream
+			Process(Input, InOffset, Output, OutOffset, Length);
+		}
+	}
+	else
+	{
+		if (IsAuthenticator())
+		{
+			// add the starting position of the nonce
+			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[0]), 0, sizeof(ulong));
+			m_macAuthenticator->Update(IntegerTools::Le64ToBytes<std::vector<byte>>(m_tsx256State->Nonce[1]), 0, sizeof(ulong));
+			// update the mac with the ciphertext
+			m_macAuthenticator->Update(Input.data() + InOffset, Length);
+			// update the mac counter
+			m_tsx256State->Counter += Length;
+			// finalize the mac and verify
+			Finalize(m_tsx256State, m_macAuthenticator);
+
+			if (!IntegerTools::Compare(Input, InOffset + Length, m_tsx256State->MacTag, 0, m_tsx256State->MacTag.size()))
+			{
+				throw CryptoAuthenticationFailure(Name(), std::string("Transform"), std::string("The authentication tag does not match!"), ErrorCodes::AuthenticationFailure);
+			}
+		}
+
+		// decrypt the stream
+		Process(Input, InOffset, Output, OutOffset, Length);
+	}
+}
+
 void TSX256::Reset()
 {
 	m_tsx256State->Reset();
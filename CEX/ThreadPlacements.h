@@ -0,0 +1,36 @@
+#ifndef CEX_THREADPLACEMENTS_H
+#define CEX_THREADPLACEMENTS_H
+
+#include "CexDomain.h"
+
+NAMESPACE_ENUMERATION
+
+/// <summary>
+/// Worker thread placement policies used by the parallel processing thread pool
+/// </summary>
+enum class ThreadPlacements : byte
+{
+	/// <summary>
+	/// The worker threads are not pinned, the operating system schedules them
+	/// </summary>
+	None = 0,
+	/// <summary>
+	/// One worker thread is pinned to the first logical processor of each physical core; SMT siblings are left idle
+	/// </summary>
+	Physical = 1,
+	/// <summary>
+	/// Worker threads fill every logical processor of a core before moving to the next core
+	/// </summary>
+	Pack = 2,
+	/// <summary>
+	/// Worker threads are spread across the physical cores first, SMT siblings are used only when every core is occupied
+	/// </summary>
+	Spread = 3,
+	/// <summary>
+	/// Worker threads are pinned to a user defined set of logical processors
+	/// </summary>
+	Explicit = 4
+};
+
+NAMESPACE_ENUMERATIONEND
+#endif
@@ -0,0 +1,565 @@
+#include "ThreadPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+#	include <pthread.h>
+#	include <sched.h>
+#elif defined(CEX_OS_WINDOWS)
+#	include <windows.h>
+#endif
+
+NAMESPACE_TOOLS
+
+const std::string ThreadPool::CLASS_NAME("ThreadPool");
+
+class ThreadPool::PoolState
+{
+public:
+
+	// a set of jobs submitted by one call to Execute; lives on the callers stack
+	class JobBatch
+	{
+	public:
+
+		const std::function<void(size_t)>* Task;
+		std::exception_ptr Error;
+		std::mutex ErrorLock;
+		size_t Pending;
+		std::condition_variable Completed;
+		std::mutex CompletedLock;
+
+		JobBatch(const std::function<void(size_t)>* Delegate, size_t Count)
+			:
+			Task(Delegate),
+			Error(nullptr),
+			ErrorLock(),
+			Pending(Count),
+			Completed(),
+			CompletedLock()
+		{
+		}
+	};
+
+	struct Job
+	{
+		JobBatch* Owner;
+		size_t Index;
+	};
+
+	struct JobQueue
+	{
+		std::deque<Job> Jobs;
+		std::mutex Lock;
+	};
+
+	std::atomic_size_t Active;
+	std::vector<size_t> DefaultCpus;
+	std::atomic_bool Pinned;
+	std::atomic_size_t Queued;
+	std::vector<std::unique_ptr<JobQueue>> Queues;
+	std::atomic_size_t Rotation;
+	std::atomic_bool Shutdown;
+	std::condition_variable WakeCondition;
+	std::mutex WakeLock;
+	std::vector<std::thread> Workers;
+
+	PoolState(size_t ThreadCount)
+		:
+		// the calling thread replaces one worker while unpinned
+		Active(ThreadCount > 1 ? ThreadCount - 1 : 0),
+		DefaultCpus(0),
+		Pinned(false),
+		Queued(0),
+		Queues(0),
+		Rotation(0),
+		Shutdown(false),
+		WakeCondition(),
+		WakeLock(),
+		Workers(0)
+	{
+		size_t i;
+
+		for (i = 0; i < ThreadCount; ++i)
+		{
+			Queues.push_back(std::unique_ptr<JobQueue>(new JobQueue()));
+		}
+	}
+
+	~PoolState()
+	{
+		DefaultCpus.clear();
+		Queues.clear();
+		Workers.clear();
+	}
+
+	// the logical processors the process is allowed to run on
+	static std::vector<size_t> AllowedCpus()
+	{
+		std::vector<size_t> cpus(0);
+		size_t i;
+
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+
+		if (sched_getaffinity(0, sizeof(set), &set) == 0)
+		{
+			for (i = 0; i < CPU_SETSIZE; ++i)
+			{
+				if (CPU_ISSET(i, &set))
+				{
+					cpus.push_back(i);
+				}
+			}
+		}
+#elif defined(CEX_OS_WINDOWS)
+		DWORD_PTR prcmsk;
+		DWORD_PTR sysmsk;
+
+		if (GetProcessAffinityMask(GetCurrentProcess(), &prcmsk, &sysmsk) != FALSE)
+		{
+			for (i = 0; i < sizeof(DWORD_PTR) * 8; ++i)
+			{
+				if ((prcmsk & (static_cast<DWORD_PTR>(1) << i)) != 0)
+				{
+					cpus.push_back(i);
+				}
+			}
+		}
+#else
+		static_cast<void>(i);
+#endif
+
+		return cpus;
+	}
+
+	// restrict a thread to a set of logical processors
+	static bool PinThread(std::thread &Thread, const std::vector<size_t> &Cpus)
+	{
+		bool res;
+
+		res = false;
+
+#if defined(CEX_OS_LINUX) || defined(CEX_OS_ANDROID)
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+
+		for (size_t cpu : Cpus)
+		{
+			if (cpu < CPU_SETSIZE)
+			{
+				CPU_SET(cpu, &set);
+			}
+		}
+
+		res = (CPU_COUNT(&set) != 0 && pthread_setaffinity_np(Thread.native_handle(), sizeof(set), &set) == 0);
+#elif defined(CEX_OS_WINDOWS)
+		DWORD_PTR mask;
+
+		mask = 0;
+
+		for (size_t cpu : Cpus)
+		{
+			if (cpu < sizeof(DWORD_PTR) * 8)
+			{
+				mask |= (static_cast<DWORD_PTR>(1) << cpu);
+			}
+		}
+
+		res = (mask != 0 && SetThreadAffinityMask(Thread.native_handle(), mask) != 0);
+#else
+		static_cast<void>(Thread);
+		static_cast<void>(Cpus);
+#endif
+
+		return res;
+	}
+
+	// the queue index and pool of the current worker thread
+	static size_t &WorkerIndex()
+	{
+		static thread_local size_t idx = static_cast<size_t>(-1);
+		return idx;
+	}
+
+	static PoolState* &WorkerOwner()
+	{
+		static thread_local PoolState* owner = nullptr;
+		return owner;
+	}
+
+	size_t LocalQueue()
+	{
+		return (WorkerOwner() == this) ? WorkerIndex() : Queues.size();
+	}
+
+	void Push(size_t Target, const Job &Item)
+	{
+		{
+			std::lock_guard<std::mutex> lock(Queues[Target]->Lock);
+			Queues[Target]->Jobs.push_back(Item);
+		}
+
+		{
+			// the counter is raised under the wake lock so a sleeping worker can not miss the notification
+			std::lock_guard<std::mutex> lock(WakeLock);
+			++Queued;
+		}
+
+		// a parked worker would absorb a single notification, so wake all of them while any are parked
+		if (Active < Workers.size())
+		{
+			WakeCondition.notify_all();
+		}
+		else
+		{
+			WakeCondition.notify_one();
+		}
+	}
+
+	bool PopLocal(size_t Index, Job &Item)
+	{
+		bool res;
+
+		res = false;
+
+		if (Index < Queues.size())
+		{
+			std::lock_guard<std::mutex> lock(Queues[Index]->Lock);
+
+			if (!Queues[Index]->Jobs.empty())
+			{
+				Item = Queues[Index]->Jobs.back();
+				Queues[Index]->Jobs.pop_back();
+				--Queued;
+				res = true;
+			}
+		}
+
+		return res;
+	}
+
+	bool Steal(size_t Index, Job &Item)
+	{
+		const size_t QUECNT = Queues.size();
+		size_t i;
+		size_t idx;
+		bool res;
+
+		res = false;
+
+		for (i = 1; i <= QUECNT && res == false; ++i)
+		{
+			idx = (Index + i) % QUECNT;
+
+			if (idx != Index)
+			{
+				std::lock_guard<std::mutex> lock(Queues[idx]->Lock);
+
+				if (!Queues[idx]->Jobs.empty())
+				{
+					Item = Queues[idx]->Jobs.front();
+					Queues[idx]->Jobs.pop_front();
+					--Queued;
+					res = true;
+				}
+			}
+		}
+
+		return res;
+	}
+
+	static void Run(const Job &Item)
+	{
+		JobBatch* batch = Item.Owner;
+
+		try
+		{
+			(*batch->Task)(Item.Index);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(batch->ErrorLock);
+
+			if (batch->Error == nullptr)
+			{
+				batch->Error = std::current_exception();
+			}
+		}
+
+		// the batch may be released by its owner as soon as the lock is dropped; do not touch it afterwards
+		std::lock_guard<std::mutex> lock(batch->CompletedLock);
+		--batch->Pending;
+
+		if (batch->Pending == 0)
+		{
+			batch->Completed.notify_all();
+		}
+	}
+
+	void Work(size_t Index)
+	{
+		Job job;
+
+		WorkerOwner() = this;
+		WorkerIndex() = Index;
+
+		while (true)
+		{
+			// a worker outside the active set sleeps until it is re-admitted
+			if (Index < Active && (PopLocal(Index, job) || Steal(Index, job)))
+			{
+				Run(job);
+			}
+			else
+			{
+				std::unique_lock<std::mutex> lock(WakeLock);
+				WakeCondition.wait(lock, [this, Index]() -> bool { return Shutdown || (Queued != 0 && Index < Active); });
+
+				if (Shutdown && Queued == 0)
+				{
+					break;
+				}
+			}
+		}
+	}
+};
+
+//~~~Constructor~~~//
+
+ThreadPool::ThreadPool(size_t ThreadCount)
+	:
+	m_poolState(new PoolState(ThreadCount))
+{
+	size_t i;
+
+	for (i = 0; i < ThreadCount; ++i)
+	{
+		PoolState* state = m_poolState.get();
+		m_poolState->Workers.push_back(std::thread([state, i]() { state->Work(i); }));
+	}
+
+	m_poolState->DefaultCpus = PoolState::AllowedCpus();
+}
+
+ThreadPool::~ThreadPool()
+{
+	if (m_poolState != nullptr)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_poolState->WakeLock);
+			m_poolState->Shutdown = true;
+		}
+
+		m_poolState->WakeCondition.notify_all();
+
+		for (auto &thd : m_poolState->Workers)
+		{
+			if (thd.joinable())
+			{
+				thd.join();
+			}
+		}
+
+		m_poolState.reset(nullptr);
+	}
+}
+
+//~~~Accessors~~~//
+
+const size_t ThreadPool::Concurrency()
+{
+	return m_poolState->Pinned ? m_poolState->Active.load() : m_poolState->Active + 1;
+}
+
+const bool ThreadPool::IsPinned()
+{
+	return m_poolState->Pinned;
+}
+
+const size_t ThreadPool::ThreadCount()
+{
+	return m_poolState->Workers.size();
+}
+
+//~~~Public Functions~~~//
+
+ThreadPool &ThreadPool::Instance()
+{
+	// started on first use, joined at process exit
+	static ThreadPool pool((std::thread::hardware_concurrency() > 1) ? static_cast<size_t>(std::thread::hardware_concurrency()) : 0);
+
+	return pool;
+}
+
+void ThreadPool::Execute(size_t Count, const std::function<void(size_t)> &Task)
+{
+	const size_t QUECNT = m_poolState->Queues.size();
+	const size_t ACTCNT = m_poolState->Active;
+	size_t i;
+
+	if (Count == 1 || ACTCNT == 0)
+	{
+		std::exception_ptr err(nullptr);
+
+		// every job runs before the first error is re-thrown, as on the pooled path
+		for (i = 0; i < Count; ++i)
+		{
+			try
+			{
+				Task(i);
+			}
+			catch (...)
+			{
+				if (err == nullptr)
+				{
+					err = std::current_exception();
+				}
+			}
+		}
+
+		if (err != nullptr)
+		{
+			std::rethrow_exception(err);
+		}
+	}
+	else if (Count != 0)
+	{
+		PoolState::JobBatch batch(&Task, Count);
+		PoolState::Job job;
+		const size_t LCLIDX = m_poolState->LocalQueue();
+		const size_t RTNIDX = m_poolState->Rotation.fetch_add(1);
+		// a pinned pool runs every job on its workers, unless the caller is itself a worker
+		const bool DLGALL = (m_poolState->Pinned && LCLIDX >= QUECNT);
+
+		// deal the jobs round-robin across the active worker queues, a nested call keeps them in the workers own queue
+		for (i = Count - 1; i > 0; --i)
+		{
+			job.Owner = &batch;
+			job.Index = i;
+			m_poolState->Push((LCLIDX < QUECNT) ? LCLIDX : ((RTNIDX + i) % ACTCNT), job);
+		}
+
+		job.Owner = &batch;
+		job.Index = 0;
+
+		if (DLGALL)
+		{
+			m_poolState->Push(RTNIDX % ACTCNT, job);
+
+			std::unique_lock<std::mutex> lock(batch.CompletedLock);
+			batch.Completed.wait(lock, [&batch]() -> bool { return batch.Pending == 0; });
+		}
+		else
+		{
+			// the caller runs the first job, then helps drain the queues until its own batch is complete
+			PoolState::Run(job);
+
+			while (true)
+			{
+				{
+					std::lock_guard<std::mutex> lock(batch.CompletedLock);
+
+					if (batch.Pending == 0)
+					{
+						break;
+					}
+				}
+
+				if (m_poolState->PopLocal(LCLIDX, job) || m_poolState->Steal((LCLIDX < QUECNT) ? LCLIDX : QUECNT, job))
+				{
+					PoolState::Run(job);
+				}
+				else
+				{
+					std::unique_lock<std::mutex> lock(batch.CompletedLock);
+					batch.Completed.wait(lock, [&batch]() -> bool { return batch.Pending == 0; });
+					break;
+				}
+			}
+		}
+
+		if (batch.Error != nullptr)
+		{
+			std::rethrow_exception(batch.Error);
+		}
+	}
+	else
+	{
+		// misra
+	}
+}
+
+bool ThreadPool::SetAffinity(const std::vector<size_t> &Cpus)
+{
+	const size_t THDCNT = m_poolState->Workers.size();
+	const size_t CPUCNT = (Cpus.size() < THDCNT) ? Cpus.size() : THDCNT;
+	size_t i;
+	bool res;
+
+	res = true;
+
+	if (Cpus.size() != 0 && CPUCNT != 0)
+	{
+		for (i = 0; i < THDCNT && res == true; ++i)
+		{
+			if (i < CPUCNT)
+			{
+				res = PoolState::PinThread(m_poolState->Workers[i], std::vector<size_t>(1, Cpus[i]));
+			}
+			else if (m_poolState->DefaultCpus.size() != 0)
+			{
+				// idle workers are returned to the default affinity
+				PoolState::PinThread(m_poolState->Workers[i], m_poolState->DefaultCpus);
+			}
+			else
+			{
+				// misra
+			}
+		}
+
+		if (res == true)
+		{
+			std::lock_guard<std::mutex> lock(m_poolState->WakeLock);
+			m_poolState->Active = CPUCNT;
+			m_poolState->Pinned = true;
+		}
+		else
+		{
+			// a partial placement is not useful; restore the defaults
+			SetAffinity(std::vector<size_t>(0));
+		}
+	}
+	else if (Cpus.size() == 0)
+	{
+		if (m_poolState->DefaultCpus.size() != 0)
+		{
+			for (i = 0; i < THDCNT; ++i)
+			{
+				PoolState::PinThread(m_poolState->Workers[i], m_poolState->DefaultCpus);
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_poolState->WakeLock);
+		m_poolState->Active = (THDCNT > 1) ? THDCNT - 1 : 0;
+		m_poolState->Pinned = false;
+	}
+	else
+	{
+		// the pool has no workers to pin
+		res = false;
+	}
+
+	// re-admitted workers may have queued jobs waiting
+	m_poolState->WakeCondition.notify_all();
+
+	return res;
+}
+
+NAMESPACE_TOOLSEND
@@ -2,214 +2,111 @@
 #define CEX_THREADPOOL_H
 
 #include "CexDomain.h"
-#include <atomic>
-#include <condition_variable>
 #include <functional>
-#include <list>
-#include <mutex>
-#include <thread>
+#include <vector>
 
-NAMESPACE_ROOT
+NAMESPACE_TOOLS
 
 /// <summary>
-/// A thread pool with dynamically sized thread allocations
+/// A persistent work-stealing thread pool.
+/// <para>Each worker thread owns a double-ended job queue; a worker takes jobs from the back of its own queue (LIFO),
+/// and when its queue is empty, steals jobs from the front of the other workers queues (FIFO).
+/// The calling thread participates in the execution of its own jobs, so nested calls from inside a job can not dead-lock the pool.
+/// The process-wide instance is started lazily on the first call to Instance(), and is shared by all ParallelTools callers.</para>
+/// <para>The worker threads can be pinned to a set of logical processors with SetAffinity(); while the pool is pinned, 
+/// a batch of two or more jobs runs entirely on the pinned workers and the calling thread only waits for completion, so each job is placed on a known processor.
+/// While unpinned, one worker is held in reserve and the calling thread takes its place.</para>
 /// </summary>
-class ThreadPool 
+class ThreadPool
 {
 private:
 
-    static const size_t DEF_MAXTHREADS = 1024;
+	static const std::string CLASS_NAME;
+	class PoolState;
 
-    std::vector<std::thread> m_threadPool;
-    std::list<std::function<void(void)>> m_threadQueue;
-    std::atomic_size_t      m_jobsRemaining;
-    std::atomic_size_t      m_maxThreads;
-    std::atomic_bool        m_jobsAbort;
-    std::atomic_bool        m_jobsFinished;
-    std::condition_variable m_jobsAvailable;
-    std::condition_variable m_waitCondition;
-    std::mutex              m_queueMutex;
-    std::mutex              m_waitMutex;
+	std::unique_ptr<PoolState> m_poolState;
 
 public:
 
-    /// <summary>
-    /// The threadpool constructor
-    /// </summary>
-    /// 
-    /// <param name="MaximumThreads">The maximum number of threads in the queue.
-    /// <para>The thread count must be between 2 and 128 threads.</para></param>
-    ThreadPool(size_t MaximumThreads = DEF_MAXTHREADS)
-        : 
-        m_threadPool(0),
-        m_threadQueue(0),
-        m_jobsRemaining(0),
-        m_maxThreads(MaximumThreads > 1 && MaximumThreads <= DEF_MAXTHREADS ?
-            MaximumThreads : 
-            DEF_MAXTHREADS),
-        m_jobsAbort(false), 
-        m_jobsFinished(false)
-    {
-    }
-
-    /// <summary>
-    /// Destructor
-    /// </summary>
-    ~ThreadPool() 
-    {
-        JoinAll();
-    }
-
-    /// <summary>
-    /// Get: The number of threads in the queue
-    /// </summary>
-    const size_t ThreadCount()
-    {
-        std::lock_guard<std::mutex> guard(m_queueMutex);
-
-        return m_threadPool.size();
-    }
-
-    /// <summary>
-    /// Get: The number of jobs remaining in the queue
-    /// </summary>
-    const size_t JobsRemaining() 
-    {
-        std::lock_guard<std::mutex> guard(m_queueMutex);
-
-        return m_threadQueue.size();
-    }
-
-    /// <summary>
-    /// Get: The maximum number of threads the queue can hold
-    /// </summary>
-    const size_t MaximumThreads()
-    {
-        std::lock_guard<std::mutex> guard(m_queueMutex);
-
-        return DEF_MAXTHREADS;
-    }
-
-    /// <summary>
-    /// Add a new job to the thread pool
-    /// </summary>
-    /// 
-    /// <param name="Task">The asynchronous task to run</param>
-    void AddTask(std::function<void(void)> Task)
-    {
-        std::lock_guard<std::mutex> guard(m_queueMutex);
-
-        if (ThreadCount() < MaximumThreads())
-        {
-            m_threadPool.push_back(std::thread([this] { this->Task(); }));
-        }
-
-        m_threadQueue.emplace_back(Task);
-        ++m_jobsRemaining;
-        m_jobsAvailable.notify_one();
-    }
-
-    /// <summary>
-    /// Add a detached new job to the thread pool
-    /// </summary>
-    /// 
-    /// <param name="Task">The asynchronous task to run</param>
-    void AddDetachedTask(std::function<void(void)> Task)
-    {
-        std::lock_guard<std::mutex> guard(m_queueMutex);
-
-        if (ThreadCount() < MaximumThreads())
-        {
-            std::thread thd([this] { this->Task(); });
-            thd.detach();
-            m_threadPool.push_back(thd);
-        }
-
-        m_threadQueue.emplace_back(Task);
-        ++m_jobsRemaining;
-        m_jobsAvailable.notify_one();
-    }
-
-    /// <summary>
-    /// Join all threads in the pool.
-    /// </summary>
-    /// 
-    /// <param name="WaitForAll">If true, waits for the thread queue to empty, else completes current jobs</param>
-    void JoinAll(bool WaitForAll = true)
-    {
-        if (!m_jobsFinished)
-        {
-            if (WaitForAll)
-            {
-                WaitAll();
-            }
-
-            // wake up any thread that's waiting for a new job
-            m_jobsAbort = true;
-
-            m_jobsAvailable.notify_all();
-
-            for (auto &x : m_threadPool)
-            {
-                if (x.joinable())
-                {
-                    x.join();
-                }
-            }
-
-            m_jobsFinished = true;
-        }
-    }
-
-    /// <summary>
-    /// Wait for the pool to empty all work items
-    /// </summary>
-    void WaitAll()
-    {
-        if (m_jobsRemaining > 0)
-        {
-            std::unique_lock<std::mutex> lock(m_waitMutex);
-            m_waitCondition.wait(lock, [this] { return this->m_jobsRemaining == 0; });
-            lock.unlock();
-        }
-    }
-
-private:
-
-    void Task()
-    {
-        while (!m_jobsAbort)
-        {
-            NextJob()();
-
-            --m_jobsRemaining;
-            m_waitCondition.notify_one();
-        }
-    }
-
-    std::function<void(void)> NextJob()
-    {
-        std::unique_lock<std::mutex> lock(m_queueMutex);
-        std::function<void(void)> func;
-
-        // wait for a job if we don't have any.
-        m_jobsAvailable.wait(lock, [this]() ->bool { return m_threadQueue.size() || m_jobsAbort; });
-
-        // get job from the thread queue
-        if (!m_jobsAbort)
-        {
-            func = m_threadQueue.front();
-            m_threadQueue.pop_front();
-        }
-        else
-        {
-            func = []{};
-            ++m_jobsRemaining;
-        }
-
-        return func;
-    }
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	ThreadPool(const ThreadPool&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	ThreadPool() = delete;
+
+	/// <summary>
+	/// Constructor: instantiate this class and start the worker threads
+	/// </summary>
+	///
+	/// <param name="ThreadCount">The number of worker threads, and the maximum number of jobs that can run concurrently.
+	/// <para>While the pool is unpinned, one worker is held in reserve and the calling thread participates in its place.
+	/// A value of zero or one executes all jobs on the calling thread.</para></param>
+	explicit ThreadPool(size_t ThreadCount);
+
+	/// <summary>
+	/// Destructor: signal the worker threads to exit and join them
+	/// </summary>
+	~ThreadPool();
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The number of threads that execute jobs concurrently, including the calling thread when the pool is unpinned
+	/// </summary>
+	const size_t Concurrency();
+
+	/// <summary>
+	/// Read Only: The worker threads are pinned to logical processors
+	/// </summary>
+	const bool IsPinned();
+
+	/// <summary>
+	/// Read Only: The number of worker threads in the pool
+	/// </summary>
+	const size_t ThreadCount();
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Get the process-wide thread pool instance.
+	/// <para>The pool is created on the first call, with one worker thread per processor; while unpinned, the calling thread takes the place of one worker.</para>
+	/// </summary>
+	///
+	/// <returns>A reference to the shared thread pool</returns>
+	static ThreadPool &Instance();
+
+	/// <summary>
+	/// Pin the worker threads to a list of logical processors.
+	/// <para>Worker i is pinned to Cpus[i], and only the pinned workers accept jobs; the list is truncated to the worker count.
+	/// An empty list restores the processor affinity the pool was created with, and re-admits every worker.
+	/// The placement applies to every caller of the pool; it should be changed while the pool is idle.</para>
+	/// </summary>
+	///
+	/// <param name="Cpus">The ordered list of logical processor indices, or an empty list to unpin the workers</param>
+	///
+	/// <returns>Returns false if the operating system rejected an affinity request, or thread affinity is not supported on this platform</returns>
+	bool SetAffinity(const std::vector<size_t> &Cpus);
+
+	/// <summary>
+	/// Execute a function once for each index in the range 0 to Count, and block until every job has completed.
+	/// <para>The first exception thrown by a job is re-thrown on the calling thread once all of the jobs have finished.</para>
+	/// </summary>
+	///
+	/// <param name="Count">The number of jobs to run</param>
+	/// <param name="Task">The function delegate; receives the job index</param>
+	void Execute(size_t Count, const std::function<void(size_t)> &Task);
 };
 
-NAMESPACE_ROOTEND
+NAMESPACE_TOOLSEND
 #endif
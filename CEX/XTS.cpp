@@ -0,0 +1,515 @@
+#include "XTS.h"
+#include "BlockCipherFromName.h"
+#include "IntegerTools.h"
+#include "MemoryTools.h"
+#include "ParallelTools.h"
+#include "SymmetricKey.h"
+
+NAMESPACE_MODE
+
+using Enumeration::BlockCipherConvert;
+using Enumeration::CipherModeConvert;
+using Tools::IntegerTools;
+using Tools::MemoryTools;
+using Tools::ParallelTools;
+using Cipher::SymmetricKey;
+
+class XTS::XtsState
+{
+public:
+
+	std::vector<SymmetricKeySize> LegalKeySizes;
+	std::vector<byte> Nonce;
+	ulong Sector;
+	size_t SectorSize;
+	bool Destroyed;
+	bool Encryption;
+	bool Initialized;
+
+	XtsState(bool IsDestroyed, size_t SectorLength)
+		:
+		LegalKeySizes(0),
+		Nonce(BLOCK_SIZE, 0x00),
+		Sector(0),
+		SectorSize(SectorLength),
+		Destroyed(IsDestroyed),
+		Encryption(false),
+		Initialized(false)
+	{
+	}
+
+	~XtsState()
+	{
+		Reset();
+		LegalKeySizes.clear();
+		SectorSize = 0;
+	}
+
+	void Reset()
+	{
+		MemoryTools::Clear(Nonce, 0, Nonce.size());
+		Sector = 0;
+		Destroyed = false;
+		Encryption = false;
+		Initialized = false;
+	}
+};
+
+//~~~Constructor~~~//
+
+XTS::XTS(BlockCiphers CipherType, size_t SectorSize)
+	:
+	m_xtsState(SectorSize != 0 && SectorSize % BLOCK_SIZE == 0 ?
+		new XtsState(true, SectorSize) :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::XTS), std::string("Constructor"), std::string("The sector size must be a non-zero multiple of the block size!"), ErrorCodes::InvalidSize)),
+	m_blockCipher(CipherType != BlockCiphers::None ?
+		Helper::BlockCipherFromName::GetInstance(CipherType) :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::XTS), std::string("Constructor"), std::string("The cipher type can not be none!"), ErrorCodes::InvalidParam)),
+	m_tweakCipher(Helper::BlockCipherFromName::GetInstance(CipherType)),
+	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
+{
+	for (size_t i = 0; i < m_blockCipher->LegalKeySizes().size(); ++i)
+	{
+		SymmetricKeySize KS = m_blockCipher->LegalKeySizes()[i];
+		m_xtsState->LegalKeySizes.push_back(SymmetricKeySize(2 * KS.KeySize(), BLOCK_SIZE, KS.InfoSize()));
+	}
+}
+
+XTS::XTS(IBlockCipher* Cipher, size_t SectorSize)
+	:
+	m_xtsState(SectorSize != 0 && SectorSize % BLOCK_SIZE == 0 ?
+		new XtsState(false, SectorSize) :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::XTS), std::string("Constructor"), std::string("The sector size must be a non-zero multiple of the block size!"), ErrorCodes::InvalidSize)),
+	m_blockCipher(Cipher != nullptr ?
+		Cipher :
+		throw CryptoCipherModeException(CipherModeConvert::ToName(CipherModes::XTS), std::string("Constructor"), std::string("The cipher type can not be null!"), ErrorCodes::IllegalOperation)),
+	m_tweakCipher(Helper::BlockCipherFromName::GetInstance(Cipher->Enumeral())),
+	m_parallelProfile(BLOCK_SIZE, true, m_blockCipher->StateCacheSize(), true)
+{
+	for (size_t i = 0; i < m_blockCipher->LegalKeySizes().size(); ++i)
+	{
+		SymmetricKeySize KS = m_blockCipher->LegalKeySizes()[i];
+		m_xtsState->LegalKeySizes.push_back(SymmetricKeySize(2 * KS.KeySize(), BLOCK_SIZE, KS.InfoSize()));
+	}
+}
+
+XTS::~XTS()
+{
+	if (m_xtsState->Destroyed)
+	{
+		if (m_blockCipher != nullptr)
+		{
+			m_blockCipher.reset(nullptr);
+		}
+	}
+	else
+	{
+		if (m_blockCipher != nullptr)
+		{
+			m_blockCipher.release();
+		}
+	}
+
+	if (m_tweakCipher != nullptr)
+	{
+		m_tweakCipher.reset(nullptr);
+	}
+}
+
+//~~~Accessors~~~//
+
+const size_t XTS::BlockSize()
+{
+	return BLOCK_SIZE;
+}
+
+const BlockCiphers XTS::CipherType()
+{
+	return m_blockCipher->Enumeral();
+}
+
+IBlockCipher* XTS::Engine()
+{
+	return m_blockCipher.get();
+}
+
+const CipherModes XTS::Enumeral()
+{
+	return CipherModes::XTS;
+}
+
+const bool XTS::IsEncryption()
+{
+	return m_xtsState->Encryption;
+}
+
+const bool XTS::IsInitialized()
+{
+	return m_xtsState->Initialized;
+}
+
+const bool XTS::IsParallel()
+{
+	return m_parallelProfile.IsParallel();
+}
+
+const std::vector<SymmetricKeySize> &XTS::LegalKeySizes()
+{
+	return m_xtsState->LegalKeySizes;
+}
+
+const std::string XTS::Name()
+{
+	std::string tmpn;
+
+	tmpn = CipherModeConvert::ToName(Enumeral()) + std::string("-") + BlockCipherConvert::ToName(m_blockCipher->Enumeral());
+
+	return tmpn;
+}
+
+const size_t XTS::ParallelBlockSize()
+{
+	return m_parallelProfile.ParallelBlockSize();
+}
+
+ParallelOptions &XTS::ParallelProfile()
+{
+	return m_parallelProfile;
+}
+
+const ulong XTS::SectorIndex()
+{
+	return m_xtsState->Sector;
+}
+
+const size_t XTS::SectorSize()
+{
+	return m_xtsState->SectorSize;
+}
+
+//~~~Public Functions~~~//
+
+void XTS::DecryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(!IsEncryption(), "The cipher mode has been initialized for encryption!");
+
+	if (Input.size() < BLOCK_SIZE || Output.size() < BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("DecryptBlock"), std::string("The data arrays are smaller than the block-size!"), ErrorCodes::InvalidSize);
+	}
+
+	ProcessSector(Input, 0, Output, 0, BLOCK_SIZE, m_xtsState->Sector);
+	++m_xtsState->Sector;
+}
+
+void XTS::DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(!IsEncryption(), "The cipher mode has been initialized for encryption!");
+
+	if (Input.size() < InOffset + BLOCK_SIZE || Output.size() < OutOffset + BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("DecryptBlock"), std::string("The data arrays are smaller than the block-size!"), ErrorCodes::InvalidSize);
+	}
+
+	ProcessSector(Input, InOffset, Output, OutOffset, BLOCK_SIZE, m_xtsState->Sector);
+	++m_xtsState->Sector;
+}
+
+void XTS::EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(IsEncryption(), "The cipher mode has been initialized for decryption!");
+
+	if (Input.size() < BLOCK_SIZE || Output.size() < BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("EncryptBlock"), std::string("The data arrays are smaller than the block-size!"), ErrorCodes::InvalidSize);
+	}
+
+	ProcessSector(Input, 0, Output, 0, BLOCK_SIZE, m_xtsState->Sector);
+	++m_xtsState->Sector;
+}
+
+void XTS::EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset)
+{
+	CEXASSERT(IsInitialized(), "The cipher mode has not been initialized!");
+	CEXASSERT(IsEncryption(), "The cipher mode has been initialized for decryption!");
+
+	if (Input.size() < InOffset + BLOCK_SIZE || Output.size() < OutOffset + BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("EncryptBlock"), std::string("The data arrays are smaller than the block-size!"), ErrorCodes::InvalidSize);
+	}
+
+	ProcessSector(Input, InOffset, Output, OutOffset, BLOCK_SIZE, m_xtsState->Sector);
+	++m_xtsState->Sector;
+}
+
+void XTS::Initialize(bool Encryption, ISymmetricKey &Parameters)
+{
+	if (!SymmetricKeySize::Contains(LegalKeySizes(), Parameters.KeySizes().KeySize()))
+	{
+		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid key size; key must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidKey);
+	}
+	if (Parameters.KeySizes().IVSize() != BLOCK_SIZE)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("Invalid nonce size; nonce must be one of the LegalKeySizes members in length!"), ErrorCodes::InvalidNonce);
+	}
+
+	const size_t KEYLEN = Parameters.KeySizes().KeySize() / 2;
+	std::vector<byte> tmpk = Parameters.Key();
+
+	// IEEE 1619-2018: the data and tweak keys must differ
+	if (IntegerTools::Compare(tmpk, 0, tmpk, KEYLEN, KEYLEN))
+	{
+		throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The data key and the tweak key can not be identical!"), ErrorCodes::InvalidKey);
+	}
+
+	if (m_parallelProfile.IsParallel())
+	{
+		// apply a calibrated parallel block size, if one was loaded
+		m_parallelProfile.LoadProfile(Name());
+
+		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() < m_parallelProfile.ParallelMinimumSize() || m_parallelProfile.ParallelBlockSize() > m_parallelProfile.ParallelMaximumSize())
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size is out of bounds!"), ErrorCodes::InvalidSize);
+		}
+		if (m_parallelProfile.IsParallel() && m_parallelProfile.ParallelBlockSize() % m_parallelProfile.ParallelMinimumSize() != 0)
+		{
+			throw CryptoCipherModeException(Name(), std::string("Initialize"), std::string("The parallel block size must be evenly aligned to the ParallelMinimumSize!"), ErrorCodes::InvalidParam);
+		}
+	}
+
+	std::vector<byte> dkey(tmpk.begin(), tmpk.begin() + KEYLEN);
+	std::vector<byte> tkey(tmpk.begin() + KEYLEN, tmpk.end());
+	std::vector<byte> tmpn(0);
+
+	// the data cipher runs in the mode direction, the tweak cipher always encrypts
+	SymmetricKey kpd(dkey, tmpn, Parameters.Info());
+	m_blockCipher->Initialize(Encryption, kpd);
+	SymmetricKey kpt(tkey, tmpn, Parameters.Info());
+	m_tweakCipher->Initialize(true, kpt);
+
+	MemoryTools::Clear(dkey, 0, dkey.size());
+	MemoryTools::Clear(tkey, 0, tkey.size());
+	MemoryTools::Clear(tmpk, 0, tmpk.size());
+
+	MemoryTools::Copy(Parameters.IV(), 0, m_xtsState->Nonce, 0, BLOCK_SIZE);
+	m_xtsState->Sector = 0;
+	m_xtsState->Encryption = Encryption;
+	m_xtsState->Initialized = true;
+}
+
+void XTS::ParallelMaxDegree(size_t Degree)
+{
+	if (Degree == 0 || Degree % 2 != 0 || Degree > m_parallelProfile.ProcessorCount())
+	{
+		throw CryptoCipherModeException(Name(), std::string("ParallelMaxDegree"), std::string("Degree setting is invalid!"), ErrorCodes::InvalidParam);
+	}
+
+	m_parallelProfile.SetMaxDegree(Degree);
+}
+
+void XTS::SetSector(ulong Index)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("SetSector"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+
+	m_xtsState->Sector = Index;
+}
+
+void XTS::Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (Length % BLOCK_SIZE != 0)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The length must be a multiple of the block-size!"), ErrorCodes::InvalidSize);
+	}
+	if (Input.size() < InOffset || Input.size() - InOffset < Length || Output.size() < OutOffset || Output.size() - OutOffset < Length)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The data arrays are smaller than the length!"), ErrorCodes::InvalidSize);
+	}
+
+	Process(Input, InOffset, Output, OutOffset, Length);
+}
+
+void XTS::Transform(const byte* Input, byte* Output, size_t Length)
+{
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (Length % BLOCK_SIZE != 0)
+	{
+		throw CryptoCipherModeException(Name(), std::string("Transform"), std::string("The length must be a multiple of the block-size!"), ErrorCodes::InvalidSize);
+	}
+
+	Process(Span<const byte>(Input, Length), 0, Span<byte>(Output, Length), 0, Length);
+}
+
+void XTS::TransformSectors(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, const std::vector<ulong> &Sectors)
+{
+	const size_t SECLEN = m_xtsState->SectorSize;
+	const size_t BATLEN = Sectors.size() * SECLEN;
+
+	if (!IsInitialized())
+	{
+		throw CryptoCipherModeException(Name(), std::string("TransformSectors"), std::string("The cipher mode has not been initialized!"), ErrorCodes::NotInitialized);
+	}
+	if (Input.size() < InOffset + BATLEN || Output.size() < OutOffset + BATLEN)
+	{
+		throw CryptoCipherModeException(Name(), std::string("TransformSectors"), std::string("The data arrays are smaller than the sector batch!"), ErrorCodes::InvalidSize);
+	}
+
+	const Span<const byte> INP(Input.data() + InOffset, BATLEN);
+	const Span<byte> OTP(Output.data() + OutOffset, BATLEN);
+
+	if (m_parallelProfile.IsParallel() && Sectors.size() > 1 && BATLEN >= m_parallelProfile.ParallelMinimumSize())
+	{
+		// each thread claims a run of sectors, the sectors are independent
+		const size_t GRNLEN = (Sectors.size() + m_parallelProfile.ParallelMaxDegree() - 1) / m_parallelProfile.ParallelMaxDegree();
+
+		ParallelTools::ParallelFor(0, Sectors.size(), GRNLEN, [this, &INP, &OTP, &Sectors, SECLEN](size_t Start, size_t End)
+		{
+			for (size_t i = Start; i < End; ++i)
+			{
+				this->ProcessSector(INP, i * SECLEN, OTP, i * SECLEN, SECLEN, Sectors[i]);
+			}
+		});
+	}
+	else
+	{
+		for (size_t i = 0; i < Sectors.size(); ++i)
+		{
+			ProcessSector(INP, i * SECLEN, OTP, i * SECLEN, SECLEN, Sectors[i]);
+		}
+	}
+}
+
+//~~~Private Functions~~~//
+
+void XTS::Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length)
+{
+	const size_t SECLEN = m_xtsState->SectorSize;
+	const size_t SECCNT = (Length + SECLEN - 1) / SECLEN;
+	const ulong SECIDX = m_xtsState->Sector;
+
+	if (m_parallelProfile.IsParallel() && SECCNT > 1 && Length >= m_parallelProfile.ParallelMinimumSize())
+	{
+		// each thread claims a run of consecutive sectors
+		const size_t GRNLEN = (SECCNT + m_parallelProfile.ParallelMaxDegree() - 1) / m_parallelProfile.ParallelMaxDegree();
+
+		ParallelTools::ParallelFor(0, SECCNT, GRNLEN, [this, &Input, InOffset, &Output, OutOffset, Length, SECLEN, SECIDX](size_t Start, size_t End)
+		{
+			for (size_t i = Start; i < End; ++i)
+			{
+				const size_t SECOFT = i * SECLEN;
+				this->ProcessSector(Input, InOffset + SECOFT, Output, OutOffset + SECOFT, IntegerTools::Min(SECLEN, Length - SECOFT), SECIDX + i);
+			}
+		});
+	}
+	else
+	{
+		for (size_t i = 0; i < SECCNT; ++i)
+		{
+			const size_t SECOFT = i * SECLEN;
+			ProcessSector(Input, InOffset + SECOFT, Output, OutOffset + SECOFT, IntegerTools::Min(SECLEN, Length - SECOFT), SECIDX + i);
+		}
+	}
+
+	m_xtsState->Sector += SECCNT;
+}
+
+void XTS::ProcessSector(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length, ulong Index)
+{
+	const size_t W2048 = 16 * BLOCK_SIZE;
+	const size_t W1024 = 8 * BLOCK_SIZE;
+	const size_t W512 = 4 * BLOCK_SIZE;
+	std::array<byte, BLOCK_SIZE> tblk;
+	std::array<byte, BLOCK_SIZE> tenc;
+	std::array<byte, W2048> tseq;
+	size_t bctr;
+	size_t i;
+	ulong thi;
+	ulong tlo;
+
+	if (Length == 0 || Length % BLOCK_SIZE != 0 || Length > m_xtsState->SectorSize || Input.size() - InOffset < Length || Output.size() - OutOffset < Length)
+	{
+		throw CryptoCipherModeException(Name(), std::string("ProcessSector"), std::string("The sector length is invalid!"), ErrorCodes::InvalidSize);
+	}
+
+	// T0 = E(K2, base + index)
+	IntegerTools::LeIncrease8(m_xtsState->Nonce, tblk, Index);
+	m_tweakCipher->Transform(tblk.data(), tenc.data());
+	tlo = IntegerTools::LeBytesTo64(tenc, 0);
+	thi = IntegerTools::LeBytesTo64(tenc, 8);
+	MemoryTools::Clear(tenc, 0, tenc.size());
+
+	// whiten the input into the output, so the block-cipher kernels run in place
+	if (Input.data() + InOffset != Output.data() + OutOffset)
+	{
+		MemoryTools::Copy(Input, InOffset, Output, OutOffset, Length);
+	}
+
+	bctr = 0;
+
+	while (bctr != Length)
+	{
+		const size_t CHKLEN = IntegerTools::Min(Length - bctr, W2048);
+		byte* pblk = Output.data() + OutOffset + bctr;
+
+		// the tweak sequence for up to 16 blocks; Tj+1 = Tj * a in GF(2^128), little-endian
+		for (i = 0; i < CHKLEN; i += BLOCK_SIZE)
+		{
+			IntegerTools::Le64ToBytes(tlo, tseq, i);
+			IntegerTools::Le64ToBytes(thi, tseq, i + sizeof(ulong));
+
+			const ulong CARRY = thi >> 63;
+			thi = (thi << 1) | (tlo >> 63);
+			tlo = (tlo << 1) ^ (0x87ULL & (0ULL - CARRY));
+		}
+
+		MemoryTools::XOR(tseq, 0, Output, OutOffset + bctr, CHKLEN);
+
+		// the block-cipher runs the widest kernel first, each kernel uses the best instructions available
+		if (CHKLEN == W2048)
+		{
+			m_blockCipher->Transform2048(pblk, pblk);
+		}
+		else
+		{
+			i = 0;
+
+			if (CHKLEN - i >= W1024)
+			{
+				m_blockCipher->Transform1024(pblk + i, pblk + i);
+				i += W1024;
+			}
+
+			if (CHKLEN - i >= W512)
+			{
+				m_blockCipher->Transform512(pblk + i, pblk + i);
+				i += W512;
+			}
+
+			while (i != CHKLEN)
+			{
+				m_blockCipher->Transform(pblk + i, pblk + i);
+				i += BLOCK_SIZE;
+			}
+		}
+
+		// remove the whitening
+		MemoryTools::XOR(tseq, 0, Output, OutOffset + bctr, CHKLEN);
+		bctr += CHKLEN;
+	}
+
+	MemoryTools::Clear(tseq, 0, tseq.size());
+}
+
+NAMESPACE_MODEEND
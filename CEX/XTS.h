@@ -0,0 +1,361 @@
+﻿// The GPL version 3 License (GPLv3)
+//
+// Copyright (c) 2020 vtdev.com
+// This file is part of the CEX Cryptographic library.
+//
+// This program is free software : you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+//
+// Implementation Details:
+// An implementation of the XTS tweakable sector encryption mode (IEEE 1619).
+// Contact: develop@vtdev.com
+
+#ifndef CEX_XTS_H
+#define CEX_XTS_H
+
+#include "ICipherMode.h"
+
+NAMESPACE_MODE
+
+/// <summary>
+/// XTS: An implementation of the IEEE 1619 XEX-based Tweaked-codebook sector encryption mode
+/// </summary>
+///
+/// <example>
+/// <description>Encrypting a range of consecutive sectors:</description>
+/// <code>
+/// XTS cipher(BlockCiphers::AES, 4096);
+/// // the key is the data key followed by the tweak key, the nonce is the tweak base (normally zeroes)
+/// SymmetricKey kp(Key, Nonce);
+/// cipher.Initialize(true, kp);
+/// // position the mode at the first sector
+/// cipher.SetSector(Index);
+/// cipher.Transform(Input, 0, Output, 0, Input.size());
+/// </code>
+/// </example>
+///
+/// <example>
+/// <description>Decrypting a batch of non-contiguous sectors:</description>
+/// <code>
+/// XTS cipher(BlockCiphers::AES, 4096);
+/// cipher.Initialize(false, kp);
+/// // the input holds Sectors.size() sectors, each is decrypted with its own index
+/// cipher.TransformSectors(Input, 0, Output, 0, Sectors);
+/// </code>
+/// </example>
+///
+/// <remarks>
+/// <description><B>Overview:</B></description>
+/// <para>XTS is a tweakable block-cipher mode designed for encrypting fixed size data units, such as the sectors of a disk or virtual disk image. \n
+/// Each sector is encrypted independently, using a tweak derived from the sector index, so any sector can be read or re-written without processing its neighbours, and without storing a per-sector IV. \n
+/// The ciphertext is the same size as the plaintext. Identical plaintext at different sector positions produces different ciphertext,
+/// but a sector that is re-written with the same content at the same position produces the same ciphertext; XTS provides confidentiality, not authentication.</para>
+///
+/// <description><B>Description:</B></description>
+/// <para><EM>Legend:</EM> \n
+/// <B>C</B>=ciphertext, <B>P</B>=plaintext, <B>K1</B>=data key, <B>K2</B>=tweak key, <B>E</B>=encrypt, <B>i</B>=sector tweak, <B>a</B>=primitive element of GF(2^128), <B>^</B>=XOR \n
+/// <EM>Encryption</EM> \n
+/// T0 ← EK2(i). For 0 ≤ j &lt; t, Cj ← EK1(Pj ^ Tj) ^ Tj, Tj+1 ← Tj * a.</para> \n
+///
+/// <description><B>Multi-Threading:</B></description>
+/// <para>Sectors have no dependency on one another, and a multi-sector transform is divided between threads on sector boundaries.
+/// Within a sector, the tweak sequence is computed first, the whitened blocks are then processed with the widest AVX-512, AVX2, or AVX block-cipher kernel available.</para>
+///
+/// <description>Implementation Notes:</description>
+/// <list type="bullet">
+/// <item><description>The key is the concatenation of the data key and the tweak key; each is one of the block-ciphers legal key sizes, and the two halves can not be identical.</description></item>
+/// <item><description>The nonce is a 16 byte little-endian tweak base, the tweak of a sector is the sum of the base and the sector index; an all zeroes nonce produces the IEEE 1619 data unit sequence numbers.</description></item>
+/// <item><description>The sector size is set through the constructor, and must be a multiple of the 16 byte block size; the default is 4096 bytes.</description></item>
+/// <item><description>The Transform length must be a multiple of the block size; the last sector of a transform may be shorter than the sector size.</description></item>
+/// <item><description>A Transform processes consecutive sectors beginning at the current sector index, and advances the index by the number of sectors processed.</description></item>
+/// <item><description>The TransformSectors function processes a batch of sectors, each with its own index, and does not change the current sector index.</description></item>
+/// <item><description>A cipher mode constructor can either be initialized with a block-cipher instance, or using the block ciphers enumeration name.</description></item>
+/// <item><description>A block-cipher instance created using the enumeration constructor, is automatically deleted when the class is destroyed.</description></item>
+/// <item><description>The transformation methods can not be called until the Initialize(bool, ISymmetricKey) function has been called.</description></item>
+/// </list>
+///
+/// <description>Guiding Publications:</description>
+/// <list type="number">
+/// <item><description>IEEE Std 1619-2018: <a href="https://standards.ieee.org/standard/1619-2018.html">Cryptographic Protection of Data on Block-Oriented Storage Devices</a>.</description></item>
+/// <item><description>NIST <a href="https://nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-38e.pdf">SP800-38E</a>: The XTS-AES Mode for Confidentiality on Storage Devices.</description></item>
+/// <item><description>Rogaway: <a href="https://www.cs.ucdavis.edu/~rogaway/papers/offsets.pdf">Efficient Instantiations of Tweakable Blockciphers</a>.</description></item>
+/// </list>
+/// </remarks>
+class XTS final : public ICipherMode
+{
+private:
+
+	static const size_t BLOCK_SIZE = 16;
+	static const size_t SECTOR_SIZE = 4096;
+
+	class XtsState;
+	std::unique_ptr<XtsState> m_xtsState;
+	std::unique_ptr<IBlockCipher> m_blockCipher;
+	std::unique_ptr<IBlockCipher> m_tweakCipher;
+	ParallelOptions m_parallelProfile;
+
+public:
+
+	//~~~Constructor~~~//
+
+	/// <summary>
+	/// Copy constructor: copy is restricted, this function has been deleted
+	/// </summary>
+	XTS(const XTS&) = delete;
+
+	/// <summary>
+	/// Copy operator: copy is restricted, this function has been deleted
+	/// </summary>
+	XTS& operator=(const XTS&) = delete;
+
+	/// <summary>
+	/// Default constructor: default is restricted, this function has been deleted
+	/// </summary>
+	XTS() = delete;
+
+	/// <summary>
+	/// Initialize the Cipher Mode using a block-cipher type name
+	/// </summary>
+	///
+	/// <param name="CipherType">The enumeration type name of the block-cipher</param>
+	/// <param name="SectorSize">The size of a sector in bytes; must be a non-zero multiple of the block size</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if an undefined block-cipher type name, or an invalid sector size is used</exception>
+	explicit XTS(BlockCiphers CipherType, size_t SectorSize = SECTOR_SIZE);
+
+	/// <summary>
+	/// Initialize the Cipher Mode using a block-cipher instance.
+	/// <para>The tweak cipher is a second instance of the same block-cipher type, created and owned by this class.</para>
+	/// </summary>
+	///
+	/// <param name="Cipher">The uninitialized block-cipher instance; can not be null</param>
+	/// <param name="SectorSize">The size of a sector in bytes; must be a non-zero multiple of the block size</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if a null block-cipher, or an invalid sector size is used</exception>
+	explicit XTS(IBlockCipher* Cipher, size_t SectorSize = SECTOR_SIZE);
+
+	/// <summary>
+	/// Destructor: finalize this class
+	/// </summary>
+	~XTS() override;
+
+	//~~~Accessors~~~//
+
+	/// <summary>
+	/// Read Only: The block-size of the underlying block-cipher in bytes
+	/// </summary>
+	const size_t BlockSize() override;
+
+	/// <summary>
+	/// Read Only: The block ciphers enumeration type name
+	/// </summary>
+	const BlockCiphers CipherType() override;
+
+	/// <summary>
+	/// Read Only: A pointer to the underlying data block-cipher instance
+	/// </summary>
+	IBlockCipher* Engine() override;
+
+	/// <summary>
+	/// Read Only: The cipher modes type name
+	/// </summary>
+	const CipherModes Enumeral() override;
+
+	/// <summary>
+	/// Read Only: True if initialized for encryption, False for decryption
+	/// </summary>
+	const bool IsEncryption() override;
+
+	/// <summary>
+	/// Read Only: The block-cipher mode has been keyed and is ready to transform data
+	/// </summary>
+	const bool IsInitialized() override;
+
+	/// <summary>
+	/// Read Only: Processor parallelization availability.
+	/// <para>Indicates whether parallel processing is available with this mode.
+	/// If parallel capable, input/output data arrays passed to the transform must be ParallelBlockSize in bytes to trigger parallelization.</para>
+	/// </summary>
+	const bool IsParallel() override;
+
+	/// <summary>
+	/// Read Only: A vector of allowed cipher-mode input key byte-sizes; each key size is twice a legal key size of the block-cipher
+	/// </summary>
+	const std::vector<SymmetricKeySize> &LegalKeySizes() override;
+
+	/// <summary>
+	/// Read Only: The cipher-modes formal class and block-cipher name
+	/// </summary>
+	const std::string Name() override;
+
+	/// <summary>
+	/// Read Only: Parallel block size; set either automatically, or through the ParallelProfile() property
+	/// <para>This value can be changed through the ParallelProfile class.</para>
+	/// </summary>
+	const size_t ParallelBlockSize() override;
+
+	/// <summary>
+	/// Read/Write: Contains parallel and SIMD capability flags and sizes
+	/// </summary>
+	ParallelOptions &ParallelProfile() override;
+
+	/// <summary>
+	/// Read Only: The index of the sector processed by the next call to Transform
+	/// </summary>
+	const ulong SectorIndex();
+
+	/// <summary>
+	/// Read Only: The size of a sector in bytes
+	/// </summary>
+	const size_t SectorSize();
+
+	//~~~Public Functions~~~//
+
+	/// <summary>
+	/// Decrypt a single block of bytes.
+	/// <para>The block is treated as a one block sector at the current sector index, and the index is advanced by one.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input vector of cipher-text bytes</param>
+	/// <param name="Output">The output vector of plain-text bytes</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the vectors are smaller than the block size</exception>
+	void DecryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output) override;
+
+	/// <summary>
+	/// Decrypt a block of bytes with offset parameters.
+	/// <para>The block is treated as a one block sector at the current sector index, and the index is advanced by one.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input vector of cipher-text bytes</param>
+	/// <param name="InOffset">Starting offset within the input vector</param>
+	/// <param name="Output">The output vector of plain-text bytes</param>
+	/// <param name="OutOffset">Starting offset within the output vector</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the vectors are smaller than the block size</exception>
+	void DecryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
+
+	/// <summary>
+	/// Encrypt a single block of bytes.
+	/// <para>The block is treated as a one block sector at the current sector index, and the index is advanced by one.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input vector of plain-text bytes</param>
+	/// <param name="Output">The output vector of cipher-text bytes</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the vectors are smaller than the block size</exception>
+	void EncryptBlock(const std::vector<byte> &Input, std::vector<byte> &Output) override;
+
+	/// <summary>
+	/// Encrypt a block of bytes using offset parameters.
+	/// <para>The block is treated as a one block sector at the current sector index, and the index is advanced by one.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input vector of plain-text bytes</param>
+	/// <param name="InOffset">Starting offset within the input vector</param>
+	/// <param name="Output">The output vector of cipher-text bytes</param>
+	/// <param name="OutOffset">Starting offset within the output vector</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the vectors are smaller than the block size</exception>
+	void EncryptBlock(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset) override;
+
+	/// <summary>
+	/// Initialize the cipher-mode instance.
+	/// <para>The sector index is reset to zero.</para>
+	/// </summary>
+	///
+	/// <param name="Encryption">Operation mode, true if cipher is used for encryption, false to decrypt</param>
+	/// <param name="Parameters">SymmetricKey containing the data key followed by the tweak key, and the 16 byte tweak base nonce</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if an invalid key or nonce is used, or if the two key halves are identical</exception>
+	void Initialize(bool Encryption, ISymmetricKey &Parameters) override;
+
+	/// <summary>
+	/// Set the maximum number of threads allocated when using multi-threaded processing.
+	/// <para>When set to zero, thread count is set automatically. If set to 1, sets IsParallel() to false and runs in sequential mode.
+	/// Thread count must be an even number, and not exceed the number of processor cores.</para>
+	/// </summary>
+	///
+	/// <param name="Degree">The number of threads to allocate</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the degree parameter is invalid</exception>
+	void ParallelMaxDegree(size_t Degree) override;
+
+	/// <summary>
+	/// Set the index of the sector processed by the next call to Transform
+	/// </summary>
+	///
+	/// <param name="Index">The sector index</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the cipher mode has not been initialized</exception>
+	void SetSector(ulong Index);
+
+	/// <summary>
+	/// Transform a length of bytes with offset parameters.
+	/// <para>The input is processed as consecutive sectors beginning at the current sector index; the last sector may be shorter than SectorSize.
+	/// The length must be a multiple of the block size, and the sector index is advanced by the number of sectors processed.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input vector of bytes to transform</param>
+	/// <param name="InOffset">Starting offset within the input vector</param>
+	/// <param name="Output">The output vector of transformed bytes</param>
+	/// <param name="OutOffset">Starting offset within the output vector</param>
+	/// <param name="Length">The number of bytes to transform</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the cipher mode is not initialized, the length is not a multiple of the block size, or the vectors are smaller than the length</exception>
+	void Transform(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, size_t Length) override;
+
+	/// <summary>
+	/// Transform a length of bytes using pointers.
+	/// <para>The input is processed as consecutive sectors beginning at the current sector index; the last sector may be shorter than SectorSize.
+	/// The length must be a multiple of the block size, and the sector index is advanced by the number of sectors processed.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input bytes to transform</param>
+	/// <param name="Output">The output bytes</param>
+	/// <param name="Length">The number of bytes to transform</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the cipher mode is not initialized, or the length is not a multiple of the block size</exception>
+	void Transform(const byte* Input, byte* Output, size_t Length) override;
+
+	/// <summary>
+	/// Transform a batch of sectors, each with its own sector index.
+	/// <para>The input holds Sectors.size() sectors of SectorSize bytes, sector n is transformed with the index Sectors[n].
+	/// The batch is divided between threads on sector boundaries, and the current sector index is not changed.
+	/// Initialize(bool, ISymmetricKey) must be called before this method can be used.</para>
+	/// </summary>
+	///
+	/// <param name="Input">The input vector of sectors to transform</param>
+	/// <param name="InOffset">Starting offset within the input vector</param>
+	/// <param name="Output">The output vector of transformed sectors</param>
+	/// <param name="OutOffset">Starting offset within the output vector</param>
+	/// <param name="Sectors">The sector index of each sector in the batch</param>
+	///
+	/// <exception cref="CryptoCipherModeException">Thrown if the cipher mode is not initialized, or the vectors are too small for the batch</exception>
+	void TransformSectors(const std::vector<byte> &Input, size_t InOffset, std::vector<byte> &Output, size_t OutOffset, const std::vector<ulong> &Sectors);
+
+private:
+
+	void Process(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length);
+	void ProcessSector(const Span<const byte> &Input, size_t InOffset, const Span<byte> &Output, size_t OutOffset, size_t Length, ulong Index);
+};
+
+NAMESPACE_MODEEND
+#endif
@@ -1,19 +1,25 @@
 #include "AeadTest.h"
+#include "../CEX/BlockCipherContext.h"
 #include "../CEX/GCM.h"
+#include "../CEX/GHASH.h"
 #include "../CEX/HBA.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/RHX.h"
 #include "../CEX/SecureRandom.h"
 
 namespace Test
 {
 	using Enumeration::AeadModes;
 	using Enumeration::AeadModeConvert;
+	using Cipher::Block::Mode::BlockCipherContext;
 	using Enumeration::BlockCiphers;
 	using Exception::CryptoAuthenticationFailure;
 	using Exception::CryptoCipherModeException;
 	using Cipher::Block::Mode::GCM;
+	using Digest::GHASH;
 	using Cipher::Block::Mode::HBA;
 	using Cipher::Block::IBlockCipher;
+	using Cipher::Block::RHX;
 	using Tools::IntegerTools;
 	using Enumeration::StreamAuthenticators;
 	using Cipher::SymmetricKeySize;
@@ -118,6 +124,10 @@ namespace Test
 			Stress(hbar256k256);
 			OnProgress(std::string("AeadTest: Passed HBA stress tests.."));
 
+			Pointer(hbar256k256);
+			Pointer(hbar512h512);
+			OnProgress(std::string("AeadTest: Passed HBA pointer and in-place transform tests.."));
+
 			delete hbaa256h256;
 			delete hbaa256k256;
 			delete hbar256k256;
@@ -146,10 +156,24 @@ namespace Test
 			Kat(gcm1, m_key[18], m_nonce[18], m_associatedText[18], m_plainText[18], m_cipherText[51]);
 			Kat(gcm1, m_key[19], m_nonce[19], m_associatedText[19], m_plainText[19], m_cipherText[52]);
 			Kat(gcm1, m_key[20], m_nonce[20], m_associatedText[20], m_plainText[20], m_cipherText[53]);
-			delete gcm1;
-
 			OnProgress(std::string("AeadTest: Passed GCM known answer comparison tests.."));
 
+			Stitch(gcm1);
+			OnProgress(std::string("AeadTest: Passed GCM single-pass encryption tests.."));
+
+			Context();
+			OnProgress(std::string("AeadTest: Passed GCM shared key context tests.."));
+
+			Ghash();
+			OnProgress(std::string("AeadTest: Passed GHASH parallel power-split update tests.."));
+
+			Parallel(gcm1);
+			OnProgress(std::string("AeadTest: Passed GCM parallel tests.."));
+
+			Pointer(gcm1);
+			OnProgress(std::string("AeadTest: Passed GCM pointer and in-place transform tests.."));
+			delete gcm1;
+
 			return SUCCESS;
 		}
 		catch (TestException const &ex)
@@ -166,6 +190,90 @@ namespace Test
 		}
 	}
 
+	void AeadTest::Context()
+	{
+		GCM ref(BlockCiphers::AES);
+		Prng::SecureRandom rng;
+		std::vector<byte> ad(static_cast<size_t>(rng.NextUInt32(64, 1)));
+		std::vector<byte> dec;
+		std::vector<byte> enc1;
+		std::vector<byte> enc2;
+		std::vector<byte> exp1;
+		std::vector<byte> exp2;
+		std::vector<byte> key(32);
+		std::vector<byte> msg(static_cast<size_t>(rng.NextUInt32(4096, 1024)));
+		std::vector<byte> nonce1(12);
+		std::vector<byte> nonce2(12);
+
+		dec.resize(msg.size());
+		enc1.resize(msg.size() + ref.TagSize());
+		enc2.resize(msg.size() + ref.TagSize());
+		exp1.resize(msg.size() + ref.TagSize());
+		exp2.resize(msg.size() + ref.TagSize());
+		rng.Generate(ad);
+		rng.Generate(key);
+		rng.Generate(msg);
+		rng.Generate(nonce1);
+		rng.Generate(nonce2);
+
+		SymmetricKey kp(key);
+		SymmetricKey kp1(key, nonce1);
+		SymmetricKey kp2(key, nonce2);
+		SymmetricKey kpn1(std::vector<byte>(0), nonce1);
+		SymmetricKey kpn2(std::vector<byte>(0), nonce2);
+
+		// two instances sharing one key schedule, each with its own nonce
+		std::shared_ptr<BlockCipherContext> ctx = std::make_shared<BlockCipherContext>(BlockCiphers::AES, kp);
+		GCM gcm1(ctx);
+		GCM gcm2(ctx);
+
+		gcm1.Initialize(true, kpn1);
+		gcm2.Initialize(true, kpn2);
+		gcm1.SetAssociatedData(ad, 0, ad.size());
+		gcm2.SetAssociatedData(ad, 0, ad.size());
+		gcm1.Transform(msg, 0, enc1, 0, msg.size());
+		gcm2.Transform(msg, 0, enc2, 0, msg.size());
+
+		// the cipher-text and the tag must match an independently keyed instance
+		ref.Initialize(true, kp1);
+		ref.SetAssociatedData(ad, 0, ad.size());
+		ref.Transform(msg, 0, exp1, 0, msg.size());
+		ref.Initialize(true, kp2);
+		ref.SetAssociatedData(ad, 0, ad.size());
+		ref.Transform(msg, 0, exp2, 0, msg.size());
+
+		if (enc1 != exp1)
+		{
+			throw TestException(std::string("Context"), ref.Name(), std::string("AeadTest: Output is not equal to the keyed instance! -AC1"));
+		}
+
+		if (enc2 != exp2)
+		{
+			throw TestException(std::string("Context"), ref.Name(), std::string("AeadTest: Output is not equal to the keyed instance! -AC2"));
+		}
+
+		// an instance bound to the context can not be re-keyed
+		try
+		{
+			gcm1.Initialize(true, kp2);
+
+			throw TestException(std::string("Context"), ref.Name(), std::string("AeadTest: Exception handling failure! -AC3"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+
+		// the rejected key has not altered the context; decrypt and verify the other instance's output
+		gcm1.Initialize(false, kpn2);
+		gcm1.SetAssociatedData(ad, 0, ad.size());
+		gcm1.Transform(enc2, 0, dec, 0, dec.size());
+
+		if (dec != msg)
+		{
+			throw TestException(std::string("Context"), ref.Name(), std::string("AeadTest: Decrypted output is not equal! -AC4"));
+		}
+	}
+
 	void AeadTest::Exception()
 	{
 		// test modes enumeration constructors for invalid block-cipher type //
@@ -332,6 +440,57 @@ namespace Test
 		}
 	}
 
+	void AeadTest::Ghash()
+	{
+		const std::vector<size_t> DEGREE = { 2, 4, 8 };
+		GHASH gen1;
+		GHASH gen2;
+		std::vector<ulong> key(2);
+		std::vector<byte> msg;
+		std::vector<byte> tag1(gen1.TagSize());
+		std::vector<byte> tag2(gen2.TagSize());
+		Prng::SecureRandom rng;
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			// from a single block to many aggregated blocks per segment, with a partial trailing block
+			const size_t MSGLEN = static_cast<size_t>(rng.NextUInt32(16384, 1));
+			// a leading partial block leaves the buffer unaligned, which must disable the split
+			const size_t PRELEN = (i % 2 == 0) ? 0 : static_cast<size_t>(rng.NextUInt32(15, 1));
+
+			key[0] = rng.NextUInt64();
+			key[1] = rng.NextUInt64();
+			msg.resize(PRELEN + MSGLEN);
+			rng.Generate(msg);
+
+			for (j = 0; j < DEGREE.size(); ++j)
+			{
+				std::fill(tag1.begin(), tag1.end(), 0x00);
+				std::fill(tag2.begin(), tag2.end(), 0x00);
+
+				gen1.Initialize(key);
+				gen1.Update(msg, 0, tag1, PRELEN);
+				gen1.Update(msg, PRELEN, tag1, MSGLEN);
+				gen1.Finalize(tag1, 0, msg.size());
+
+				gen2.Initialize(key);
+				gen2.Update(msg, 0, tag2, PRELEN);
+				gen2.ParallelUpdate(msg, PRELEN, tag2, MSGLEN, DEGREE[j]);
+				gen2.Finalize(tag2, 0, msg.size());
+
+				if (tag1 != tag2)
+				{
+					throw TestException(std::string("Ghash"), std::string("GHASH"), std::string("AeadTest: The power-split hash is not equal! -AG1"));
+				}
+
+				gen1.Reset();
+				gen2.Reset();
+			}
+		}
+	}
+
 	void AeadTest::Kat(IAeadMode* Cipher, const std::vector<byte> &Key, const std::vector<byte> &Nonce, 
 		const std::vector<byte> &AssociatedText, const std::vector<byte> &PlainText, const std::vector<byte> &CipherText)
 	{
@@ -446,6 +605,89 @@ namespace Test
 		}
 	}
 
+	void AeadTest::Pointer(IAeadMode* Cipher)
+	{
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Cipher->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> assoc(16);
+		std::vector<byte> data;
+		std::vector<byte> dec;
+		std::vector<byte> enc1;
+		std::vector<byte> enc2;
+		std::vector<byte> key(32);
+		std::vector<SymmetricKeySize> keySizes = Cipher->LegalKeySizes();
+		std::vector<byte> nonce(keySizes[0].IVSize());
+		std::vector<byte> otp;
+		size_t i;
+		Prng::SecureRandom rng;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			data.resize(MSGLEN[i]);
+			rng.Generate(data);
+			rng.Generate(nonce);
+			rng.Generate(key);
+			rng.Generate(assoc);
+			SymmetricKey kp(key, nonce);
+
+			// the vector transform is the reference
+			enc1.resize(MSGLEN[i] + Cipher->TagSize());
+			Cipher->Initialize(true, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+			Cipher->Transform(data, 0, enc1, 0, data.size());
+
+			// the pointer output receives the cipher-text and the tag
+			enc2.resize(MSGLEN[i] + Cipher->TagSize());
+			Cipher->Initialize(true, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+			Cipher->Transform(data.data(), enc2.data(), data.size());
+
+			if (enc1 != enc2)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("AeadTest: Pointer encryption output is not equal! -AX1"));
+			}
+
+			dec.resize(MSGLEN[i]);
+			Cipher->Initialize(false, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+			Cipher->Transform(enc2.data(), dec.data(), dec.size());
+
+			if (dec != data)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("AeadTest: Pointer decryption output is not equal! -AX2"));
+			}
+
+			// in-place, the buffer holds the message and the tag
+			otp = data;
+			otp.resize(MSGLEN[i] + Cipher->TagSize());
+			Cipher->Initialize(true, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+			Cipher->Transform(otp.data(), otp.data(), data.size());
+
+			if (otp != enc1)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("AeadTest: In-place encryption output is not equal! -AX3"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->SetAssociatedData(assoc, 0, assoc.size());
+
+			try
+			{
+				Cipher->Transform(otp.data(), otp.data(), data.size());
+			}
+			catch (CryptoAuthenticationFailure const&)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("AeadTest: In-place authentication failure! -AX4"));
+			}
+
+			if (IntegerTools::Compare(otp, 0, data, 0, data.size()) == false)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("AeadTest: In-place decryption output is not equal! -AX5"));
+			}
+		}
+	}
+
 	void AeadTest::Sequential(IAeadMode* Cipher, const std::vector<byte> &PlainText, 
 		const std::vector<byte> &Output1, const std::vector<byte> &Output2, const std::vector<byte> &Output3)
 	{
@@ -532,6 +774,153 @@ namespace Test
 		}
 	}
 
+	void AeadTest::Stitch(IAeadMode* Cipher)
+	{
+		// encryption with AES-NI and CLMUL interleaves the cipher rounds with the hash of the preceding 8 blocks;
+		// the tags were generated with an independent AES-GCM implementation, each message byte is its index modulo 256
+		const std::vector<size_t> MSGLEN = { 65536, 70001 };
+		const std::vector<std::string> EXPTAG = { std::string("61B260B5B00975C5F383198C6B9A508D"), std::string("6BDE72E7103F79474BFE6933C2D6F76E") };
+		// group boundaries, and a single group with a partial tail
+		const std::vector<size_t> EDGLEN = { 128, 255, 256, 257, 383, 384, 1024, 1040 };
+		const bool PRLPRC = Cipher->ParallelProfile().IsParallel();
+		RHX* eng = new RHX();
+		GCM ref(eng);
+		Prng::SecureRandom rng;
+		std::vector<byte> ad;
+		std::vector<byte> dec;
+		std::vector<byte> enc;
+		std::vector<byte> exp;
+		std::vector<byte> key;
+		std::vector<byte> msg;
+		std::vector<byte> nonce;
+		std::vector<byte> otp;
+		size_t i;
+		size_t j;
+
+		HexConverter::Decode(std::string("FEFFE9928665731C6D6A8F9467308308"), key);
+		HexConverter::Decode(std::string("CAFEBABEFACEDBADDECAF888"), nonce);
+		HexConverter::Decode(std::string("FEEDFACEDEADBEEFFEEDFACEDEADBEEFABADDAD2"), ad);
+		SymmetricKey kp(key, nonce);
+		Cipher->ParallelProfile().IsParallel() = false;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			dec.resize(MSGLEN[i]);
+			enc.resize(MSGLEN[i] + Cipher->TagSize());
+
+			for (j = 0; j < msg.size(); ++j)
+			{
+				msg[j] = static_cast<byte>(j);
+			}
+
+			Cipher->Initialize(true, kp);
+			Cipher->SetAssociatedData(ad, 0, ad.size());
+			Cipher->Transform(msg, 0, enc, 0, msg.size());
+			HexConverter::Decode(EXPTAG[i], exp);
+
+			if (IntegerTools::Compare(enc, msg.size(), exp, 0, exp.size()) == false)
+			{
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: Authentication tag is not equal! -AT1"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->SetAssociatedData(ad, 0, ad.size());
+			Cipher->Transform(enc, 0, dec, 0, dec.size());
+
+			if (dec != msg)
+			{
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: Decrypted output is not equal! -AT2"));
+			}
+
+			// the tag is checked before decryption, a modified cipher-text must leave the output untouched
+			enc[msg.size() / 2] ^= 0x01;
+			dec.assign(dec.size(), 0xFF);
+			Cipher->Initialize(false, kp);
+			Cipher->SetAssociatedData(ad, 0, ad.size());
+
+			try
+			{
+				Cipher->Transform(enc, 0, dec, 0, dec.size());
+
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: Authentication failure was not detected! -AT3"));
+			}
+			catch (CryptoAuthenticationFailure const &)
+			{
+			}
+
+			if (dec != std::vector<byte>(dec.size(), 0xFF))
+			{
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: Output was written before authentication! -AT4"));
+			}
+
+			// an in-place decryption that fails must leave the cipher-text intact
+			otp = enc;
+			Cipher->Initialize(false, kp);
+			Cipher->SetAssociatedData(ad, 0, ad.size());
+
+			try
+			{
+				Cipher->Transform(otp.data(), otp.data(), msg.size());
+
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: Authentication failure was not detected! -AT5"));
+			}
+			catch (CryptoAuthenticationFailure const &)
+			{
+			}
+
+			if (otp != enc)
+			{
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: The cipher-text was modified! -AT6"));
+			}
+		}
+
+		// compare with the two-pass path of a cipher without the stitched kernel, in and out of place
+		for (i = 0; i < EDGLEN.size() + TEST_CYCLES; ++i)
+		{
+			const size_t KEYLEN = Cipher->LegalKeySizes()[i % Cipher->LegalKeySizes().size()].KeySize();
+			const size_t TXTLEN = (i < EDGLEN.size()) ? EDGLEN[i] : static_cast<size_t>(rng.NextUInt32(4096, 1));
+
+			key.resize(KEYLEN);
+			rng.Generate(key);
+			rng.Generate(nonce);
+			ad.resize(static_cast<size_t>(rng.NextUInt32(64, 1)));
+			rng.Generate(ad);
+			msg.resize(TXTLEN);
+			rng.Generate(msg);
+			enc.resize(TXTLEN + Cipher->TagSize());
+			exp.resize(TXTLEN + ref.TagSize());
+			SymmetricKey kp2(key, nonce);
+
+			ref.Initialize(true, kp2);
+			ref.SetAssociatedData(ad, 0, ad.size());
+			ref.Transform(msg, 0, exp, 0, msg.size());
+
+			Cipher->Initialize(true, kp2);
+			Cipher->SetAssociatedData(ad, 0, ad.size());
+			Cipher->Transform(msg, 0, enc, 0, msg.size());
+
+			if (enc != exp)
+			{
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: Output is not equal to the two-pass transform! -AT7"));
+			}
+
+			otp = msg;
+			otp.resize(enc.size());
+			Cipher->Initialize(true, kp2);
+			Cipher->SetAssociatedData(ad, 0, ad.size());
+			Cipher->Transform(otp.data(), otp.data(), msg.size());
+
+			if (otp != exp)
+			{
+				throw TestException(std::string("Stitch"), Cipher->Name(), std::string("AeadTest: In-place output is not equal to the two-pass transform! -AT8"));
+			}
+		}
+
+		Cipher->ParallelProfile().IsParallel() = PRLPRC;
+		delete eng;
+	}
+
 	void AeadTest::Stress(IAeadMode* Cipher)
 	{
 		SymmetricKeySize keySize = Cipher->LegalKeySizes()[0];
@@ -67,11 +67,21 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare two GCM instances sharing a key context to independently keyed instances, including the tag, and test that a keyed initialization is rejected
+		/// </summary>
+		void Context();
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
 		void Exception();
 
+		/// <summary>
+		/// Compare the GHASH parallel power-split update to the sequential update, with 2, 4, and 8 segments
+		/// </summary>
+		void Ghash();
+
 		/// <summary>
 		/// Compare output with known answer vectors
 		/// </summary>
@@ -92,6 +102,13 @@ namespace Test
 		/// <param name="Cipher">The cipher instance</param>
 		void Parallel(IAeadMode* Cipher);
 
+		/// <summary>
+		/// Compare the pointer transform, including in-place operation, with the vector transform
+		/// </summary>
+		///
+		/// <param name="Cipher">The cipher instance</param>
+		void Pointer(IAeadMode* Cipher);
+
 		/// <summary>
 		/// Test a single initialization and sequential successive calls to the transform
 		/// </summary>
@@ -104,6 +121,13 @@ namespace Test
 		void Sequential(IAeadMode* Cipher, const std::vector<byte> &PlainText, const std::vector<byte> &Output1, 
 			const std::vector<byte> &Output2, const std::vector<byte> &Output3);
 
+		/// <summary>
+		/// Test the single-pass GCM encryption against known answers and the two-pass transform, and that a modified cipher-text is rejected before any output is written
+		/// </summary>
+		///
+		/// <param name="Cipher">The cipher instance</param>
+		void Stitch(IAeadMode* Cipher);
+
 		/// <summary>
 		/// Test operations in a looping stress test
 		/// </summary>
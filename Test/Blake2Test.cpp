@@ -102,23 +102,43 @@ namespace Test
 
 			Blake256* dgt256s = new Blake256(false);
 			Stress(dgt256s);
-			delete dgt256s;
 			OnProgress(std::string("Blake2Test: Passed Passed Blake2-S sequential stress tests.."));
+			Pointer(dgt256s);
+			OnProgress(std::string("Blake2Test: Passed Blake2-S sequential pointer update and finalize tests.."));
+			Midstate(dgt256s);
+			OnProgress(std::string("Blake2Test: Passed Blake2-S sequential midstate serialization tests.."));
+			Batch(dgt256s);
+			delete dgt256s;
+			OnProgress(std::string("Blake2Test: Passed Blake2-S batch hashing tests.."));
 
 			Blake512* dgt512s = new Blake512(false);
 			Stress(dgt512s);
-			delete dgt512s;
 			OnProgress(std::string("Blake2Test: Passed Passed Blake2-B sequential stress tests.."));
+			Pointer(dgt512s);
+			OnProgress(std::string("Blake2Test: Passed Blake2-B sequential pointer update and finalize tests.."));
+			Midstate(dgt512s);
+			OnProgress(std::string("Blake2Test: Passed Blake2-B sequential midstate serialization tests.."));
+			Batch(dgt512s);
+			delete dgt512s;
+			OnProgress(std::string("Blake2Test: Passed Blake2-B batch hashing tests.."));
 
 			if (detect.VirtualCores() >= 2)
 			{
 				Blake256* dgt256p = new Blake256(true);
 				Stress(dgt256p);
 				OnProgress(std::string("Blake2Test: Passed Passed Blake2-SP parallel stress tests.."));
+				Pointer(dgt256p);
+				OnProgress(std::string("Blake2Test: Passed Blake2-SP parallel pointer update and finalize tests.."));
+				Midstate(dgt256p);
+				OnProgress(std::string("Blake2Test: Passed Blake2-SP parallel midstate serialization tests.."));
 
 				Blake512* dgt512p = new Blake512(true);
 				Stress(dgt512p);
 				OnProgress(std::string("Blake2Test: Passed Passed Blake2-BP parallel stress tests.."));
+				Pointer(dgt512p);
+				OnProgress(std::string("Blake2Test: Passed Blake2-BP parallel pointer update and finalize tests.."));
+				Midstate(dgt512p);
+				OnProgress(std::string("Blake2Test: Passed Blake2-BP parallel midstate serialization tests.."));
 
 				Parallel(dgt256p);
 				delete dgt256p;
@@ -148,6 +168,45 @@ namespace Test
 		}
 	}
 
+	template<typename T>
+	void Blake2Test::Batch(T* Digest)
+	{
+		const size_t MAXSMP = 4096;
+		const size_t MSGCNT = 41;
+		std::vector<std::vector<byte>> codes;
+		std::vector<std::vector<byte>> msgs(MSGCNT);
+		std::vector<byte> code(Digest->DigestSize());
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			// lengths on either side of the padding block boundary, then random lengths
+			const size_t INPLEN = (i < 16) ? Digest->BlockSize() + i - 10 : static_cast<size_t>(rnd.NextUInt32(MAXSMP, 0));
+			msgs[i].resize(INPLEN);
+			rnd.Generate(msgs[i], 0, msgs[i].size());
+		}
+
+		try
+		{
+			Digest->Compute(msgs, codes);
+		}
+		catch (const std::exception&)
+		{
+			throw TestException(std::string("Batch"), Digest->Name(), std::string("The digest has thrown an exception! -BB1"));
+		}
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			Digest->Compute(msgs[i], code);
+
+			if (codes[i] != code)
+			{
+				throw TestException(std::string("Batch"), Digest->Name(), std::string("Hash output is not equal! -BB2"));
+			}
+		}
+	}
+
 	void Blake2Test::Exception()
 	{
 		// test params constructor Blake256
@@ -624,6 +683,67 @@ namespace Test
 		stream.close();
 	}
 
+	void Blake2Test::Midstate(IDigest* Digest)
+	{
+		const uint MINPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize());
+		const uint MAXPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize() * 4);
+
+		std::vector<byte> code1(Digest->DigestSize());
+		std::vector<byte> code2(Digest->DigestSize());
+		std::vector<byte> msg;
+		SecureVector<byte> state;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			const size_t INPLEN = static_cast<size_t>(rnd.NextUInt32(MAXPRL, MINPRL));
+			const size_t PRELEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(INPLEN), 1));
+
+			msg.resize(INPLEN);
+			rnd.Generate(msg, 0, msg.size());
+
+			try
+			{
+				Digest->Compute(msg, code1);
+				// save the state after the prefix, then overwrite it
+				Digest->Update(msg, 0, PRELEN);
+				state = Digest->Serialize();
+				Digest->Update(msg, 0, msg.size());
+				// restore the state and finish the message
+				Digest->DeSerialize(state);
+				Digest->Update(msg, PRELEN, msg.size() - PRELEN);
+				Digest->Finalize(code2, 0);
+			}
+			catch (const std::exception&)
+			{
+				throw TestException(std::string("Midstate"), Digest->Name(), std::string("The digest has thrown an exception! -BM1"));
+			}
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Midstate"), Digest->Name(), std::string("Hash output is not equal! -BM2"));
+			}
+		}
+
+		// a truncated state must be rejected
+		try
+		{
+			state = Digest->Serialize();
+			state.resize(state.size() - 1);
+			Digest->DeSerialize(state);
+
+			throw TestException(std::string("Midstate"), Digest->Name(), std::string("Exception handling failure! -BM3"));
+		}
+		catch (CryptoDigestException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+	}
+
 	void Blake2Test::Parallel(IDigest* Digest)
 	{
 		const size_t MINSMP = 2048;
@@ -668,6 +788,62 @@ namespace Test
 		}
 	}
 
+	void Blake2Test::Pointer(IDigest* Digest)
+	{
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Digest->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> code1(Digest->DigestSize());
+		std::vector<byte> code2(Digest->DigestSize());
+		std::vector<byte> msg;
+		std::vector<size_t> seg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t moff;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			rnd.Generate(msg, 0, msg.size());
+
+			// uneven segments exercise the input buffering
+			seg.clear();
+			moff = 0;
+
+			while (moff != msg.size())
+			{
+				seg.push_back(IntegerTools::Min(static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(Digest->BlockSize() * 3), 1)), msg.size() - moff));
+				moff += seg.back();
+			}
+
+			// the vector functions are the reference
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Digest->Update(msg, moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Digest->Finalize(code1, 0);
+
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Digest->Update(msg.data() + moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Digest->Finalize(code2.data());
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Pointer"), Digest->Name(), std::string("The pointer hash output is not equal! -SX1"));
+			}
+		}
+	}
+
 	void Blake2Test::Stress(IDigest* Digest)
 	{
 		const uint MINPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize());
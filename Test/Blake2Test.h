@@ -63,6 +63,14 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare the batch Compute output of randomly sized, pseudo-random messages to the sequential Compute output
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		template<typename T>
+		void Batch(T* Digest);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
@@ -88,6 +96,13 @@ namespace Test
 		/// </summary>
 		void KatBlake2SP();
 
+		/// <summary>
+		/// Compare the output of a message hashed in two parts, with the state serialized and restored between the parts, to the output of a single pass
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		void Midstate(IDigest* Digest);
+
 		/// <summary>
 		/// Compares synchronous to parallel random-sized, pseudo-random arrays in a looping [TEST_CYCLES] stress-test
 		/// </summary>
@@ -105,6 +120,13 @@ namespace Test
 		/// </summary>
 		void PermutationR12P1024();
 
+		/// <summary>
+		/// Compare the pointer Update and Finalize functions with the vector functions over the same uneven input segments
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		void Pointer(IDigest* Digest);
+
 		/// <summary>
 		/// Test behavior parallel and sequential processing in a looping [TEST_CYCLES] stress-test using randomly sized input and data
 		/// </summary>
@@ -80,6 +80,9 @@ namespace Test
 			Stress(cmacaes);
 			OnProgress(std::string("CMACTest: Passed CMAC stress tests.."));
 
+			Pointer(cmacaes);
+			OnProgress(std::string("CMACTest: Passed CMAC pointer update and finalize tests.."));
+
 			delete cmacaes;
 
 			CMAC* cmacahxh256 = new CMAC(BlockCiphers::RHXH256);
@@ -297,6 +300,71 @@ namespace Test
 		}
 	}
 
+	void CMACTest::Pointer(IMac* Generator)
+	{
+		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
+		// a partial block, and a long message
+		const std::vector<size_t> MSGLEN = { 100, MAXM_ALLOC };
+		std::vector<byte> code1(Generator->TagSize());
+		std::vector<byte> code2(Generator->TagSize());
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> msg;
+		std::vector<size_t> seg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t moff;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(msg, 0, msg.size());
+			SymmetricKey kp(key);
+
+			// uneven segments exercise the input buffering
+			seg.clear();
+			moff = 0;
+
+			while (moff != msg.size())
+			{
+				seg.push_back(IntegerTools::Min(static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(Generator->BlockSize() * 3), 1)), msg.size() - moff));
+				moff += seg.back();
+			}
+
+			// the vector functions are the reference
+			Generator->Initialize(kp);
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Generator->Update(msg, moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Generator->Finalize(code1, 0);
+
+			Generator->Initialize(kp);
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Generator->Update(msg.data() + moff, seg[j]);
+				moff += seg[j];
+			}
+
+			if (Generator->Finalize(code2.data()) != code2.size())
+			{
+				throw TestException(std::string("Pointer"), Generator->Name(), std::string("The pointer finalize returned an invalid length! -CX1"));
+			}
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Pointer"), Generator->Name(), std::string("The pointer mac output is not equal! -CX2"));
+			}
+		}
+	}
+
 	void CMACTest::Stress(IMac* Generator)
 	{
 		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
@@ -93,6 +93,10 @@ namespace Test
 			CompareP256();
 			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 permutation variants equivalence test.."));
 
+			// test the shared key context and nonce-only initialization
+			Context();
+			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 shared key context tests.."));
+
 			// test all exception handlers for correct operation
 			Exception(csx256s);
 			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 exception handling tests.."));
@@ -124,10 +128,18 @@ namespace Test
 			Parallel(csx256s);
 			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 parallel to sequential equivalence test.."));
 
+			// compare a transform from an unaligned seek position to the same slice of the full stream
+			Seek();
+			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 random-access seek tests.."));
+
 			// looping test of successful decryption with random keys and input
 			Stress(csx256s);
 			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 stress tests.."));
 
+			Pointer(csx256s);
+			Pointer(csx256a);
+			OnProgress(std::string("ChaChaTest: Passed ChaCha-256 pointer and in-place transform tests.."));
+
 			delete csx256a;
 			delete csx256s;
 
@@ -166,6 +178,10 @@ namespace Test
 			Stress(csx512s);
 			OnProgress(std::string("ChaChaTest: Passed CSX-512 stress tests.."));
 
+			Pointer(csx512s);
+			Pointer(csx512a);
+			OnProgress(std::string("ChaChaTest: Passed CSX-512 pointer and in-place transform tests.."));
+
 			delete csx512a;
 			delete csx512s;
 
@@ -367,6 +383,88 @@ namespace Test
 #endif
 	}
 
+	void ChaChaTest::Context()
+	{
+		const size_t MSGLEN = 137;
+		CSX256 cpr1(true);
+		SymmetricKeySize ks = cpr1.LegalKeySizes()[0];
+		std::vector<byte> cpt1(MSGLEN + cpr1.TagSize());
+		std::vector<byte> cpt2(MSGLEN + cpr1.TagSize());
+		std::vector<byte> cpt3(MSGLEN + cpr1.TagSize());
+		std::vector<byte> cust(ks.InfoSize());
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> msg(MSGLEN);
+		std::vector<byte> nonce1(ks.IVSize());
+		std::vector<byte> nonce2(ks.IVSize());
+		std::vector<byte> plt(MSGLEN);
+		SecureRandom rnd;
+
+		rnd.Generate(cust);
+		rnd.Generate(key);
+		rnd.Generate(msg);
+		rnd.Generate(nonce1);
+		rnd.Generate(nonce2);
+
+		SymmetricKey kp1(key, nonce1, cust);
+		SymmetricKey kp2(key, nonce2, cust);
+		SymmetricKey kpn1(std::vector<byte>(0), nonce1);
+		SymmetricKey kpn2(std::vector<byte>(0), nonce2);
+		cpr1.Initialize(true, kp1);
+
+		// two instances sharing the key schedule of the first, with different nonces
+		CSX256 cpr2(cpr1.Context());
+		CSX256 cpr3(cpr1.Context());
+		cpr2.Initialize(true, kpn1);
+		cpr3.Initialize(true, kpn2);
+
+		cpr1.Transform(msg, 0, cpt1, 0, msg.size());
+		cpr2.Transform(msg, 0, cpt2, 0, msg.size());
+
+		if (cpt1 != cpt2)
+		{
+			throw TestException(std::string("Context"), cpr1.Name(), std::string("Transformation output is not equal! -CX1"));
+		}
+
+		// a nonce-only initialization must match an independently keyed instance
+		CSX256 cpr4(true);
+		cpr4.Initialize(true, kp2);
+		cpr4.Transform(msg, 0, cpt1, 0, msg.size());
+		cpr3.Transform(msg, 0, cpt3, 0, msg.size());
+
+		if (cpt1 != cpt3)
+		{
+			throw TestException(std::string("Context"), cpr1.Name(), std::string("Transformation output is not equal! -CX2"));
+		}
+
+		// an instance bound to the context can not be re-keyed
+		try
+		{
+			cpr2.Initialize(true, kp2);
+
+			throw TestException(std::string("Context"), cpr1.Name(), std::string("Exception handling failure! -CX3"));
+		}
+		catch (CryptoSymmetricException const &)
+		{
+		}
+
+		// the shared context is unchanged; decrypt and authenticate with the other instances
+		cpr2.Initialize(false, kpn2);
+		cpr2.Transform(cpt3, 0, plt, 0, plt.size());
+
+		if (plt != msg)
+		{
+			throw TestException(std::string("Context"), cpr1.Name(), std::string("Decrypted output is not equal! -CX4"));
+		}
+
+		cpr1.Initialize(false, kpn2);
+		cpr1.Transform(cpt3, 0, plt, 0, plt.size());
+
+		if (plt != msg)
+		{
+			throw TestException(std::string("Context"), cpr1.Name(), std::string("Decrypted output is not equal! -CX5"));
+		}
+	}
+
 	void ChaChaTest::Exception(IStreamCipher* Cipher)
 	{
 		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
@@ -555,6 +653,128 @@ namespace Test
 		}
 	}
 
+	void ChaChaTest::Pointer(IStreamCipher* Cipher)
+	{
+		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		// the authenticated variants append the tag to the cipher-text
+		const size_t TAGLEN = Cipher->IsAuthenticator() ? Cipher->TagSize() : 0;
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Cipher->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> cpt;
+		std::vector<byte> exp;
+		std::vector<byte> inp;
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<byte> otp;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			exp.resize(MSGLEN[i] + TAGLEN);
+			inp.resize(MSGLEN[i]);
+			otp.resize(MSGLEN[i]);
+
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(inp, 0, inp.size());
+			rnd.Generate(nonce, 0, nonce.size());
+			SymmetricKey kp(key, nonce);
+
+			// the vector transform is the reference
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp, 0, exp, 0, inp.size());
+
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer encryption output is not equal! -TX1"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), otp.data(), otp.size());
+
+			if (otp != inp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer decryption output is not equal! -TX2"));
+			}
+
+			// in-place, the buffer holds the message and the tag
+			cpt = inp;
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place encryption output is not equal! -TX3"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (IntegerTools::Compare(cpt, 0, inp, 0, inp.size()) == false)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place decryption output is not equal! -TX4"));
+			}
+		}
+	}
+
+	void ChaChaTest::Seek()
+	{
+		const size_t MSGLEN = static_cast<size_t>(SecureRandom().NextUInt32(MAXM_ALLOC, 1024));
+		CSX256 cpr(false);
+		CSX256 cpra(true);
+		SymmetricKeySize ks = cpr.LegalKeySizes()[0];
+		std::vector<byte> exp(MSGLEN);
+		std::vector<byte> inp(MSGLEN);
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<byte> otp(MSGLEN);
+		SecureRandom rnd;
+		size_t j;
+
+		rnd.Generate(inp);
+		rnd.Generate(key);
+		rnd.Generate(nonce);
+		SymmetricKey kp(key, nonce);
+
+		// the reference stream, processed from the start
+		cpr.Initialize(true, kp);
+		cpr.Transform(inp, 0, exp, 0, MSGLEN);
+
+		for (j = 0; j < TEST_CYCLES; ++j)
+		{
+			// an odd position is never block aligned, the length is random
+			const size_t POS = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(MSGLEN - 2), 0)) | 1;
+			const size_t LEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(MSGLEN - POS), 1));
+
+			cpr.Initialize(true, kp);
+			cpr.Seek(POS);
+			cpr.Transform(inp, POS, otp, 0, LEN);
+
+			if (IntegerTools::Compare(otp, 0, exp, POS, LEN) == false)
+			{
+				throw TestException(std::string("Seek"), cpr.Name(), std::string("The seek output is not equal! -XS1"));
+			}
+		}
+
+		// the mac covers the message in order, an authenticated instance can not seek
+		cpra.Initialize(true, kp);
+
+		try
+		{
+			cpra.Seek(1);
+
+			throw TestException(std::string("Seek"), cpra.Name(), std::string("Exception handling failure! -XS2"));
+		}
+		catch (CryptoSymmetricException const &)
+		{
+		}
+	}
+
 	void ChaChaTest::Sequential(IStreamCipher* Cipher, const std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce,
 		const std::vector<byte> &Output1, const std::vector<byte> &Output2, const std::vector<byte> &Output3)
 	{
@@ -679,6 +899,23 @@ namespace Test
 		{
 			throw TestException(std::string("Serialization"), cpr1.Name(), std::string("Transformation output is not equal! -SS2"));
 		}
+
+		// a CSX-256 state without the trailing seek offset was serialized by an earlier version, and is rejected
+		CSX256 cpr4(true);
+		SymmetricKey kp256(std::vector<byte>(cpr4.LegalKeySizes()[0].KeySize(), 0x01), std::vector<byte>(cpr4.LegalKeySizes()[0].IVSize(), 0x04));
+		cpr4.Initialize(true, kp256);
+		SecureVector<byte> sta3 = cpr4.Serialize();
+		sta3.resize(sta3.size() - sizeof(ulong));
+
+		try
+		{
+			CSX256 cpr5(sta3);
+
+			throw TestException(std::string("Serialization"), cpr4.Name(), std::string("Exception handling failure! -SS3"));
+		}
+		catch (CryptoSymmetricException const &)
+		{
+		}
 	}
 
 	void ChaChaTest::Stress(IStreamCipher* Cipher)
@@ -90,6 +90,11 @@ namespace Test
 		/// </summary>
 		void CompareP1024();
 
+		/// <summary>
+		/// Tests two instances sharing a key context against an independently keyed instance, and rejection of a keyed re-initialization
+		/// </summary>
+		void Context();
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
@@ -126,6 +131,13 @@ namespace Test
 		/// <param name="Cipher">The cipher instance pointer</param>
 		void Parallel(IStreamCipher* Cipher);
 
+		/// <summary>
+		/// Compare the pointer transform, including in-place operation, with the vector transform
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Pointer(IStreamCipher* Cipher);
+
 		/// <summary>
 		/// Test a single initialization and sequential successive calls to the transform
 		/// </summary>
@@ -140,6 +152,11 @@ namespace Test
 		void Sequential(IStreamCipher* Cipher, const std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce,
 			const std::vector<byte> &Output1, const std::vector<byte> &Output2, const std::vector<byte> &Output3);
 
+		/// <summary>
+		/// Compare a CSX-256 transform that starts at an unaligned Seek position to the same slice of a full transform, and test that an authenticated instance rejects Seek
+		/// </summary>
+		void Seek();
+
 		/// <summary>
 		/// Tests the the ciphers state serialization function
 		/// </summary>
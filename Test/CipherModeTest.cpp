@@ -1,12 +1,15 @@
 #include "CipherModeTest.h"
+#include "../CEX/BlockCipherContext.h"
 #include "../CEX/CBC.h"
 #include "../CEX/CFB.h"
 #include "../CEX/CTR.h"
 #include "../CEX/ECB.h"
 #include "../CEX/ICM.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/MemoryTools.h"
 #include "../CEX/OFB.h"
 #include "../CEX/SecureRandom.h"
+#include "../CEX/XTS.h"
 
 namespace Test
 {
@@ -14,11 +17,12 @@ namespace Test
 	using Enumeration::BlockCiphers;
 	using Enumeration::CipherModeConvert;
 	using Tools::IntegerTools;
+	using Tools::MemoryTools;
 	using Prng::SecureRandom;
 	using Cipher::SymmetricKey;
 
 	const std::string CipherModeTest::CLASSNAME = "CipherModeTest";
-	const std::string CipherModeTest::DESCRIPTION = "NIST SP800-38A KATs testing CBC, CFB, CTR, ECB, and OFB modes.";
+	const std::string CipherModeTest::DESCRIPTION = "NIST SP800-38A KATs testing CBC, CFB, CTR, ECB, and OFB modes, and IEEE 1619 KATs testing XTS mode.";
 	const std::string CipherModeTest::SUCCESS = "SUCCESS! Cipher Mode tests have executed succesfully.";
 
 	//~~~Constructor~~~//
@@ -71,6 +75,7 @@ namespace Test
 			ECB* ecbm = new ECB(BlockCiphers::AES);
 			ICM* icmm = new ICM(BlockCiphers::AES);
 			OFB* ofbm = new OFB(BlockCiphers::AES);
+			XTS* xtsm = new XTS(BlockCiphers::AES);
 
 			// CBC 128bit key
 			Kat(cbcm, m_keys[0], m_nonce[0], m_message[0], m_expected[0], true);
@@ -129,6 +134,18 @@ namespace Test
 			Kat(icmm, m_keys[2], m_nonce[1], m_message[29], m_expected[29], false);
 			OnProgress(std::string("CipherModeTest: Passed ICM 128/192/256 bit key encryption/decryption tests.."));
 
+			Seek();
+			OnProgress(std::string("CipherModeTest: Passed CTR and ICM random-access seek tests.."));
+
+			Context();
+			OnProgress(std::string("CipherModeTest: Passed CTR and ICM shared key context tests.."));
+
+			Batch();
+			OnProgress(std::string("CipherModeTest: Passed CBC same-key and multi-key batch encryption tests.."));
+
+			Xts();
+			OnProgress(std::string("CipherModeTest: Passed XTS IEEE 1619 vector and sector batch tests.."));
+
 			// OFB 128bit key
 			Kat(ofbm, m_keys[0], m_nonce[0], m_message[30], m_expected[30], true);
 			Kat(ofbm, m_keys[0], m_nonce[0], m_message[31], m_expected[31], false);
@@ -155,12 +172,25 @@ namespace Test
 			Stress(ofbm);
 			OnProgress(std::string("Passed OFB stress tests.."));
 
+			Stress(xtsm);
+			OnProgress(std::string("Passed XTS stress tests.."));
+
+			Pointer(cbcm);
+			Pointer(cfbm);
+			Pointer(ctrm);
+			Pointer(ecbm);
+			Pointer(icmm);
+			Pointer(ofbm);
+			Pointer(xtsm);
+			OnProgress(std::string("CipherModeTest: Passed CBC/CFB/CTR/ECB/ICM/OFB/XTS pointer and in-place transform tests.."));
+
 			delete cbcm;
 			delete cfbm;
 			delete ctrm;
 			delete ecbm;
 			delete icmm;
 			delete ofbm;
+			delete xtsm;
 
 			return SUCCESS;
 		}
@@ -178,6 +208,296 @@ namespace Test
 		}
 	}
 
+	void CipherModeTest::Batch()
+	{
+		// lane lengths in blocks; unequal, including an empty message, and more lanes than the widest cipher kernel
+		const std::vector<size_t> BLKCNT = { 3, 17, 1, 0, 8, 33, 2, 16, 5, 9, 1, 24, 7, 4, 12, 6, 19 };
+		const size_t LANCNT = BLKCNT.size();
+		std::vector<std::vector<byte>> exp(LANCNT);
+		std::vector<std::vector<byte>> inp(LANCNT);
+		std::vector<std::vector<byte>> ivs(LANCNT);
+		std::vector<std::vector<byte>> keys(LANCNT);
+		std::vector<std::vector<byte>> otp(LANCNT);
+		std::vector<CBC*> refs(LANCNT);
+		std::vector<CBC*> mods(LANCNT);
+		std::vector<byte> key(32);
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+
+		rnd.Generate(key);
+
+		for (i = 0; i < LANCNT; ++i)
+		{
+			inp[i].resize(BLKCNT[i] * 16);
+			otp[i].resize(inp[i].size());
+			exp[i].resize(inp[i].size());
+			ivs[i].resize(16);
+			rnd.Generate(inp[i], 0, inp[i].size());
+			rnd.Generate(ivs[i]);
+		}
+
+		// same-key batch; each lane is compared with a sequential transform from the same iv, over two calls to test iv continuation
+		CBC cbcb(BlockCiphers::AES);
+		SymmetricKey kp(key, ivs[0]);
+		cbcb.Initialize(true, kp);
+
+		for (i = 0; i < LANCNT; ++i)
+		{
+			SymmetricKey kpr(key, ivs[i]);
+			refs[i] = new CBC(BlockCiphers::AES);
+			refs[i]->Initialize(true, kpr);
+		}
+
+		for (j = 0; j < 2; ++j)
+		{
+			cbcb.EncryptBatch(inp, otp, ivs);
+
+			for (i = 0; i < LANCNT; ++i)
+			{
+				refs[i]->Transform(inp[i], 0, exp[i], 0, inp[i].size());
+
+				if (otp[i] != exp[i])
+				{
+					throw TestException(std::string("Batch"), cbcb.Name(), std::string("Batch output is not equal! -MB1"));
+				}
+
+				// the iv is the last cipher-text block, or is unchanged by an empty message
+				if (inp[i].size() != 0 && IntegerTools::Compare(ivs[i], 0, otp[i], otp[i].size() - 16, 16) == false)
+				{
+					throw TestException(std::string("Batch"), cbcb.Name(), std::string("Batch iv was not updated! -MB2"));
+				}
+			}
+		}
+
+		// multi-key batch with AES-NI engines of equal rounds, interleaved by the lane kernel when available
+		for (i = 0; i < LANCNT; ++i)
+		{
+			keys[i].resize(32);
+			rnd.Generate(keys[i]);
+			SymmetricKey kpm(keys[i], ivs[i]);
+			mods[i] = new CBC(BlockCiphers::AES);
+			mods[i]->Initialize(true, kpm);
+			refs[i]->Initialize(true, kpm);
+		}
+
+		for (j = 0; j < 2; ++j)
+		{
+			CBC::EncryptBatch(mods, inp, otp);
+
+			for (i = 0; i < LANCNT; ++i)
+			{
+				refs[i]->Transform(inp[i], 0, exp[i], 0, inp[i].size());
+
+				if (otp[i] != exp[i])
+				{
+					throw TestException(std::string("Batch"), cbcb.Name(), std::string("Multi-key batch output is not equal! -MB3"));
+				}
+			}
+		}
+
+		// mixed engines and key sizes; the lanes fall back to the cipher of each instance
+		for (i = 0; i < LANCNT; ++i)
+		{
+			const BlockCiphers CPRTYP = (i % 3 == 2) ? BlockCiphers::Serpent : BlockCiphers::AES;
+
+			keys[i].resize((i % 3 == 1) ? 16 : 32);
+			rnd.Generate(keys[i]);
+			SymmetricKey kpm(keys[i], ivs[i]);
+			delete mods[i];
+			delete refs[i];
+			mods[i] = new CBC(CPRTYP);
+			mods[i]->Initialize(true, kpm);
+			refs[i] = new CBC(CPRTYP);
+			refs[i]->Initialize(true, kpm);
+		}
+
+		CBC::EncryptBatch(mods, inp, otp);
+
+		for (i = 0; i < LANCNT; ++i)
+		{
+			refs[i]->Transform(inp[i], 0, exp[i], 0, inp[i].size());
+
+			if (otp[i] != exp[i])
+			{
+				throw TestException(std::string("Batch"), mods[i]->Name(), std::string("Mixed batch output is not equal! -MB4"));
+			}
+		}
+
+		// a message that is not block aligned, and an output that is too small, are rejected
+		inp[0].resize(inp[0].size() + 1);
+
+		try
+		{
+			cbcb.EncryptBatch(inp, otp, ivs);
+
+			throw TestException(std::string("Batch"), cbcb.Name(), std::string("Exception handling failure! -MB5"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		inp[0].resize(inp[0].size() + 15);
+
+		try
+		{
+			CBC::EncryptBatch(mods, inp, otp);
+
+			throw TestException(std::string("Batch"), cbcb.Name(), std::string("Exception handling failure! -MB6"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		// a mode that is initialized for decryption, or not initialized, is rejected
+		SymmetricKey kpd(keys[0], ivs[0]);
+		mods[0]->Initialize(false, kpd);
+		inp[0].resize(otp[0].size());
+
+		try
+		{
+			CBC::EncryptBatch(mods, inp, otp);
+
+			throw TestException(std::string("Batch"), cbcb.Name(), std::string("Exception handling failure! -MB7"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		CBC cbcu(BlockCiphers::AES);
+
+		try
+		{
+			cbcu.EncryptBatch(inp, otp, ivs);
+
+			throw TestException(std::string("Batch"), cbcu.Name(), std::string("Exception handling failure! -MB8"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		for (i = 0; i < LANCNT; ++i)
+		{
+			delete mods[i];
+			delete refs[i];
+		}
+	}
+
+	void CipherModeTest::Context()
+	{
+		std::vector<byte> dec;
+		std::vector<byte> enc1;
+		std::vector<byte> enc2;
+		std::vector<byte> exp1;
+		std::vector<byte> exp2;
+		std::vector<byte> key(32);
+		std::vector<byte> key2(32);
+		std::vector<byte> msg;
+		std::vector<byte> nonce1(16);
+		std::vector<byte> nonce2(16);
+		SecureRandom rnd;
+		size_t i;
+
+		const size_t MSGLEN = static_cast<size_t>(rnd.NextUInt32(MAXM_ALLOC, MINM_ALLOC));
+		dec.resize(MSGLEN);
+		enc1.resize(MSGLEN);
+		enc2.resize(MSGLEN);
+		exp1.resize(MSGLEN);
+		exp2.resize(MSGLEN);
+		msg.resize(MSGLEN);
+		rnd.Generate(key);
+		rnd.Generate(key2);
+		rnd.Generate(msg);
+		rnd.Generate(nonce1);
+		rnd.Generate(nonce2);
+
+		SymmetricKey kp(key);
+		SymmetricKey kp1(key, nonce1);
+		SymmetricKey kp2(key, nonce2);
+		SymmetricKey kpn1(std::vector<byte>(0), nonce1);
+		SymmetricKey kpn2(std::vector<byte>(0), nonce2);
+		SymmetricKey kpx(key2);
+
+		for (i = 0; i < 2; ++i)
+		{
+			// two instances sharing one key schedule, each with its own nonce
+			std::shared_ptr<BlockCipherContext> ctx = std::make_shared<BlockCipherContext>(BlockCiphers::AES, kp);
+			std::unique_ptr<ICipherMode> cpr1(i == 0 ? static_cast<ICipherMode*>(new CTR(ctx)) : static_cast<ICipherMode*>(new ICM(ctx)));
+			std::unique_ptr<ICipherMode> cpr2(i == 0 ? static_cast<ICipherMode*>(new CTR(ctx)) : static_cast<ICipherMode*>(new ICM(ctx)));
+			std::unique_ptr<ICipherMode> ref(i == 0 ? static_cast<ICipherMode*>(new CTR(BlockCiphers::AES)) : static_cast<ICipherMode*>(new ICM(BlockCiphers::AES)));
+
+			cpr1->Initialize(true, kpn1);
+			cpr2->Initialize(true, kpn2);
+			cpr1->Transform(msg, 0, enc1, 0, MSGLEN);
+			cpr2->Transform(msg, 0, enc2, 0, MSGLEN);
+
+			// the output must match an independently keyed instance
+			ref->Initialize(true, kp1);
+			ref->Transform(msg, 0, exp1, 0, MSGLEN);
+			ref->Initialize(true, kp2);
+			ref->Transform(msg, 0, exp2, 0, MSGLEN);
+
+			if (enc1 != exp1)
+			{
+				throw TestException(std::string("Context"), ref->Name(), std::string("Output is not equal to the keyed instance! -MK1"));
+			}
+
+			if (enc2 != exp2)
+			{
+				throw TestException(std::string("Context"), ref->Name(), std::string("Output is not equal to the keyed instance! -MK2"));
+			}
+
+			// an instance bound to the context can not be re-keyed
+			try
+			{
+				cpr1->Initialize(true, kp2);
+
+				throw TestException(std::string("Context"), ref->Name(), std::string("Exception handling failure! -MK3"));
+			}
+			catch (CryptoCipherModeException const &)
+			{
+			}
+
+			// the rejected key has not altered the context
+			cpr1->Initialize(false, kpn2);
+			cpr1->Transform(enc2, 0, dec, 0, MSGLEN);
+
+			if (dec != msg)
+			{
+				throw TestException(std::string("Context"), ref->Name(), std::string("Decrypted output is not equal! -MK4"));
+			}
+
+			// a re-keyed engine is detected by the next nonce-only initialization
+			ctx->Engine()->Initialize(true, kpx);
+
+			try
+			{
+				cpr2->Initialize(true, kpn1);
+
+				throw TestException(std::string("Context"), ref->Name(), std::string("Exception handling failure! -MK5"));
+			}
+			catch (CryptoCipherModeException const &)
+			{
+			}
+		}
+	}
+
 	void CipherModeTest::Exception()
 	{
 		// test every modes enumeration constructors for invalid block-cipher type //
@@ -689,6 +1009,103 @@ namespace Test
 		}
 	}
 
+	void CipherModeTest::Pointer(ICipherMode* Cipher)
+	{
+		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		const size_t BLKLEN = Cipher->BlockSize();
+		// a short message, and one spanning the parallel block size with a trailing block
+		const std::vector<size_t> MSGLEN = { BLKLEN * 3, Cipher->ParallelBlockSize() + BLKLEN };
+		std::vector<byte> blk(256);
+		std::vector<byte> cpt;
+		std::vector<byte> exp;
+		std::vector<byte> inp;
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<byte> otp;
+		SecureRandom rnd;
+		size_t i;
+
+		rnd.Generate(key, 0, key.size());
+		rnd.Generate(nonce, 0, nonce.size());
+		SymmetricKey kp(key, nonce);
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			cpt.resize(MSGLEN[i]);
+			exp.resize(MSGLEN[i]);
+			inp.resize(MSGLEN[i]);
+			otp.resize(MSGLEN[i]);
+			rnd.Generate(inp, 0, inp.size());
+
+			// the vector transform is the reference
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp, 0, exp, 0, exp.size());
+
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp.data(), cpt.data(), cpt.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer encryption output is not equal! -TP1"));
+			}
+
+			otp = inp;
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(otp.data(), otp.data(), otp.size());
+
+			if (otp != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place encryption output is not equal! -TP2"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(otp.data(), otp.data(), otp.size());
+
+			if (otp != inp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place decryption output is not equal! -TP3"));
+			}
+		}
+
+		// the block cipher pointer functions against the vector functions
+		rnd.Generate(blk, 0, blk.size());
+		Cipher->Initialize(true, kp);
+		cpt.resize(blk.size());
+		exp.resize(blk.size());
+
+		Cipher->Engine()->Transform(blk, 0, exp, 0);
+		Cipher->Engine()->Transform(blk.data(), cpt.data());
+
+		if (IntegerTools::Compare(cpt, 0, exp, 0, BLKLEN) == false)
+		{
+			throw TestException(std::string("Pointer"), Cipher->Engine()->Name(), std::string("The block cipher pointer transform is not equal! -TP4"));
+		}
+
+		Cipher->Engine()->Transform512(blk, 0, exp, 0);
+		Cipher->Engine()->Transform512(blk.data(), cpt.data());
+
+		if (IntegerTools::Compare(cpt, 0, exp, 0, 64) == false)
+		{
+			throw TestException(std::string("Pointer"), Cipher->Engine()->Name(), std::string("The block cipher pointer 512 bit transform is not equal! -TP5"));
+		}
+
+		Cipher->Engine()->Transform1024(blk, 0, exp, 0);
+		Cipher->Engine()->Transform1024(blk.data(), cpt.data());
+
+		if (IntegerTools::Compare(cpt, 0, exp, 0, 128) == false)
+		{
+			throw TestException(std::string("Pointer"), Cipher->Engine()->Name(), std::string("The block cipher pointer 1024 bit transform is not equal! -TP6"));
+		}
+
+		Cipher->Engine()->Transform2048(blk, 0, exp, 0);
+		Cipher->Engine()->Transform2048(blk.data(), cpt.data());
+
+		if (cpt != exp)
+		{
+			throw TestException(std::string("Pointer"), Cipher->Engine()->Name(), std::string("The block cipher pointer 2048 bit transform is not equal! -TP7"));
+		}
+	}
+
 	void CipherModeTest::Register()
 	{
 		std::vector<byte> inp;
@@ -727,6 +1144,234 @@ namespace Test
 		}
 	}
 
+	void CipherModeTest::Seek()
+	{
+		CTR ctrm(BlockCiphers::AES);
+		ICM icmm(BlockCiphers::AES);
+		std::vector<byte> ctrc;
+		std::vector<byte> icmc;
+		std::vector<byte> inp;
+		std::vector<byte> key(32);
+		std::vector<byte> otp;
+		SecureRandom rnd;
+		size_t i;
+
+		const size_t MSGLEN = static_cast<size_t>(rnd.NextUInt32(MAXM_ALLOC, MINM_ALLOC));
+		ctrc.resize(MSGLEN);
+		icmc.resize(MSGLEN);
+		inp.resize(MSGLEN);
+		otp.resize(MSGLEN);
+		rnd.Generate(inp, 0, inp.size());
+		rnd.Generate(key, 0, key.size());
+
+		// the F.5 nonce carries across the low counter bytes
+		SymmetricKey kp(key, m_nonce[1]);
+
+		// the reference streams, processed from the start
+		ctrm.Initialize(true, kp);
+		ctrm.Transform(inp, 0, ctrc, 0, MSGLEN);
+		icmm.Initialize(true, kp);
+		icmm.Transform(inp, 0, icmc, 0, MSGLEN);
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			const size_t POS = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(MSGLEN - 1), 0));
+			const size_t LEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(MSGLEN - POS), 1));
+			// the first call completes the block containing the position
+			const size_t SPLIT = IntegerTools::Min(LEN, 16 - (POS % 16));
+
+			ctrm.Initialize(true, kp);
+			ctrm.Seek(POS);
+			ctrm.Transform(inp, POS, otp, 0, SPLIT);
+			ctrm.Transform(inp, POS + SPLIT, otp, SPLIT, LEN - SPLIT);
+
+			if (IntegerTools::Compare(otp, 0, ctrc, POS, LEN) == false)
+			{
+				throw TestException(std::string("Seek"), ctrm.Name(), std::string("The seek output is not equal! -MS1"));
+			}
+
+			icmm.Initialize(true, kp);
+			icmm.Seek(POS);
+			icmm.Transform(inp, POS, otp, 0, SPLIT);
+			icmm.Transform(inp, POS + SPLIT, otp, SPLIT, LEN - SPLIT);
+
+			if (IntegerTools::Compare(otp, 0, icmc, POS, LEN) == false)
+			{
+				throw TestException(std::string("Seek"), icmm.Name(), std::string("The seek output is not equal! -MS2"));
+			}
+		}
+	}
+
+	void CipherModeTest::Xts()
+	{
+		std::vector<byte> dec;
+		std::vector<byte> enc;
+		std::vector<byte> exp;
+		std::vector<byte> inp;
+		std::vector<byte> key;
+		std::vector<byte> nonce(16, 0x00);
+
+		// IEEE 1619-2007 vector 2: XTS-AES-128, data unit sequence number 0x3333333333
+		HexConverter::Decode(std::string("1111111111111111111111111111111122222222222222222222222222222222"), key);
+		HexConverter::Decode(std::string("4444444444444444444444444444444444444444444444444444444444444444"), inp);
+		HexConverter::Decode(std::string("C454185E6A16936E39334038ACEF838BFB186FFF7480ADC4289382ECD6D394F0"), exp);
+		enc.resize(inp.size());
+		dec.resize(inp.size());
+
+		XTS xts128(BlockCiphers::AES);
+		SymmetricKey kp1(key, nonce);
+		xts128.Initialize(true, kp1);
+		xts128.SetSector(0x3333333333ULL);
+		xts128.Transform(inp, 0, enc, 0, inp.size());
+
+		if (enc != exp)
+		{
+			throw TestException(std::string("Xts"), xts128.Name(), std::string("Encrypted arrays are not equal! -MX1"));
+		}
+
+		xts128.Initialize(false, kp1);
+		xts128.SetSector(0x3333333333ULL);
+		xts128.Transform(enc, 0, dec, 0, enc.size());
+
+		if (dec != inp)
+		{
+			throw TestException(std::string("Xts"), xts128.Name(), std::string("Decrypted arrays are not equal! -MX2"));
+		}
+
+		// XTS-AES-256 with 512 byte sectors; two consecutive sectors, 0x1234 and 0x1235
+		HexConverter::Decode(std::string("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"), key);
+		const std::string SEC1 =
+			std::string("D868E289515EDE6C1F02174E88C40FA9E9BE1E0C179B16BE21BA352695C096BB95D54E236B24863DB03A5707213AEF1CF525FD87F51F9A36934CCCCEE92F5E95") +
+			std::string("C4C829A04573040BEA4F24DF07F2A74340D546DE892A65893D35E92C7489CC6FFC260F91E7AAAC8D9AF89A681B0BD7DE87EDAE49CFAE151CC17D054134908BCA") +
+			std::string("547CFCD139E8083920598829C3E23394CA39D2C65FBE55C22DC886DCB1F4C04D124070679FB4914972429824DC597E4C6AD0B7E66E74C4AD774BB6324DF6C6F9") +
+			std::string("5C80D07FA83FC858592190A9D8185D9A7B48BD905DDB2BCEC4CA3406EE200A9EB8E9EE099D3E25097C8DCB16828FC021105C64BF52CA55A491F08AF83D837257") +
+			std::string("5524E900AA63A0328BB6033EEF522399E5D8DA1BFA923763977C4E8D7C7FD1A1027429C51094788517C394EE0C929F517FF93A08CEF9A159D3CD860A9DA9957B") +
+			std::string("E22A6F87DE7DBE4F826C598D7DE171ABEC097F543D7E38CE00E8DA6E116A3110D97D4074BEE12CC121DD306DCD3BEF008ACC6C99713D971E8DED0D0CB092E6A7") +
+			std::string("5571D247ECE2A716BDF619369FA94BCAAA6CB0EF1A437BEBE17D2056D466F5BD643001C57F0D8FF850D5BBBFA2610E0AA78B98CAF45E06D11E247B652149E202") +
+			std::string("38C0CE740B9DDB9B9C80F2D01346579632EC50AA41B5E9C56068C6F414DABBF822C9032F8DD0E84623FCE6AD3AAAEE89F66E78DD09C2B0076A9768F9B9CCE60C");
+		const std::string SEC2 =
+			std::string("48DF0D88C711A41F278F60BEA7AC7F33DE287AC439A95433E4A39709B8D536E747FC7EF505B207353F45C115FB30D43D4C3CF668AB4B989C40C9494DA44B4EE2") +
+			std::string("D3A5AB7FDEDD95BAA45299567FFB4790F351F76DF0B90D18B76385D18A15FF518EF5285DD5DE44252E8B786F082C23B89E570A02285B090039D2DC3618541E12") +
+			std::string("A18C921998877EE74BA84F5C570096AB3A5D0A29F272C72D5AA75CDBE8DFE09E83667E27A13987EAEEDCD5A17279D55FB37F18186F7D7C472638FF9C6EA9FFF1") +
+			std::string("E3BE4167AABB5B5FDF5B66424F80966C11ECF2CBA00BE73FEC712BDA8C20E60526132414B736F70C6DF053C6A7820E0BB963B36FB666C9B765C1826F2A37B9DA") +
+			std::string("A47D441327B1BCE485B999DF3BC0D5DE28B950DBA681E4FD74B65CE652F7470687DDBCA0046648F70D4BD79D23CA9339DEDB746EFBB5F4F62B76CAC95A8DB5D2") +
+			std::string("84399341BB6E2E719A972FC4DB8DC56EB1CE955B18D3DBFB5B0551162FDA52E75F86D59927223C9A091B810C87B93ED57D7ACFE6BC818FB0E7B0EF906BFD7C2D") +
+			std::string("D65C70998B1DFF4E6E889D888CAF3542AAA860260BD78CE12FD4EE795D4C36C3E78E46A44937CBDAF68018427ACD0217A33CE7C9DE0568D6F731D7083360CF36") +
+			std::string("123D1FFFDD1960C55E3812373F98B32D986EA09FBBE6C1726098F00ECCF8C2B74691D7F2AC5B302E8D44E7B755DFB9F10F41B181D11789EE44954AEE42BB447A");
+		HexConverter::Decode(SEC1 + SEC2, exp);
+		inp.resize(1024);
+		enc.resize(inp.size());
+		dec.resize(inp.size());
+
+		for (size_t i = 0; i < inp.size(); ++i)
+		{
+			inp[i] = static_cast<byte>(i);
+		}
+
+		XTS xts256(BlockCiphers::AES, 512);
+		SymmetricKey kp2(key, nonce);
+		xts256.Initialize(true, kp2);
+		xts256.SetSector(0x1234);
+		xts256.Transform(inp, 0, enc, 0, inp.size());
+
+		if (enc != exp || xts256.SectorIndex() != 0x1236)
+		{
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Encrypted arrays are not equal! -MX3"));
+		}
+
+		// the batch function decrypts sectors out of order, each with its own index
+		std::vector<byte> bat(1024);
+		const std::vector<ulong> SECIDX = { 0x1235, 0x1234 };
+		MemoryTools::Copy(enc, 512, bat, 0, 512);
+		MemoryTools::Copy(enc, 0, bat, 512, 512);
+		xts256.Initialize(false, kp2);
+		xts256.TransformSectors(bat, 0, dec, 0, SECIDX);
+
+		if (IntegerTools::Compare(dec, 0, inp, 512, 512) == false || IntegerTools::Compare(dec, 512, inp, 0, 512) == false)
+		{
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Decrypted arrays are not equal! -MX4"));
+		}
+
+		// consecutive block calls are one block sectors with advancing indices; equal to a transform with 16 byte sectors
+		std::vector<byte> blk(64);
+		std::vector<byte> otp(64);
+		XTS xtsb(BlockCiphers::AES, 16);
+		xts256.Initialize(true, kp2);
+		xts256.SetSector(0x1234);
+		xtsb.Initialize(true, kp2);
+		xtsb.SetSector(0x1234);
+
+		for (size_t i = 0; i < blk.size(); i += 16)
+		{
+			xts256.EncryptBlock(inp, i, blk, i);
+		}
+
+		xtsb.Transform(inp, 0, otp, 0, otp.size());
+
+		if (blk != otp || xts256.SectorIndex() != 0x1238 || xtsb.SectorIndex() != 0x1238)
+		{
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Block tweaks are not sequential! -MX5"));
+		}
+
+		// a length that is not a multiple of the block size is rejected
+		try
+		{
+			xts256.Transform(inp, 0, enc, 0, 520);
+
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Exception handling failure! -MX6"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		try
+		{
+			xts256.Transform(inp.data(), enc.data(), 15);
+
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Exception handling failure! -MX7"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		// input and output vectors smaller than the length are rejected
+		try
+		{
+			xts256.Transform(inp, 16, enc, 0, inp.size());
+
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Exception handling failure! -MX8"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+
+		try
+		{
+			xts256.EncryptBlock(inp, 0, enc, enc.size() - 8);
+
+			throw TestException(std::string("Xts"), xts256.Name(), std::string("Exception handling failure! -MX9"));
+		}
+		catch (CryptoCipherModeException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+	}
+
 	//~~~Private Functions~~~//
 
 	void CipherModeTest::Initialize()
@@ -64,6 +64,16 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare the CBC same-key and multi-key batch encryption functions with sequential transforms, and test the batch exception handlers
+		/// </summary>
+		void Batch();
+
+		/// <summary>
+		/// Compare two CTR and ICM instances sharing a key context to independently keyed instances, and test that a keyed initialization and a re-keyed engine are rejected
+		/// </summary>
+		void Context();
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
@@ -80,11 +90,23 @@ namespace Test
 		/// <param name="Encryption">Set the transformation mode to encrypt ot decrypt</param>
 		void Kat(ICipherMode* Cipher, std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<std::vector<byte>> &Message, std::vector<std::vector<byte>> &Expected, bool Encryption);
 
+		/// <summary>
+		/// Compare the pointer transform, including in-place operation, and the block cipher pointer functions with the vector transforms
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher mode instance pointer</param>
+		void Pointer(ICipherMode* Cipher);
+
 		/// <summary>
 		/// Test the CFB mode output with a an 8-bit register
 		/// </summary>
 		void Register();
 
+		/// <summary>
+		/// Test that a CTR or ICM stream positioned with Seek matches the same range of a stream processed from the start
+		/// </summary>
+		void Seek();
+
 		/// <summary>
 		/// Test transformation and inverse with random in a looping [TEST_CYCLES] stress-test
 		/// </summary>
@@ -92,6 +114,11 @@ namespace Test
 		/// <param name="Cipher">The cipher mode instance pointer</param>
 		void Stress(ICipherMode* Cipher);
 
+		/// <summary>
+		/// Test the XTS mode with the IEEE 1619 vectors, and the multi-sector and sector batch functions
+		/// </summary>
+		void Xts();
+
     private:
 
 		void Initialize();
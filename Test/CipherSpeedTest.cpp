@@ -77,6 +77,10 @@ namespace Test
 			CBCSpeedTest(true, false);
 			OnProgress(std::string("***AES-CBC Parallel Decryption***"));
 			CBCSpeedTest(false, true);
+			OnProgress(std::string("***AES-CBC Batch Encryption: 64 x 1KB Messages, Same Key***"));
+			CBCBatchSpeedTest(false);
+			OnProgress(std::string("***AES-CBC Batch Encryption: 64 x 1KB Messages, Independent Keys***"));
+			CBCBatchSpeedTest(true);
 
 			OnProgress(std::string("***AES-CFB Sequential Encryption***"));
 			CFBSpeedTest(true, false);
@@ -177,6 +181,85 @@ namespace Test
 
 	//*** Cipher Mode Tests ***//
 
+	void CipherSpeedTest::CBCBatchSpeedTest(bool MultiKey)
+	{
+		const size_t LANCNT = 64;
+		const size_t MSGLEN = 1024;
+		const size_t BATLEN = LANCNT * MSGLEN;
+		const size_t ALNLEN = DATA_SIZE - (DATA_SIZE % BATLEN);
+		std::vector<IBlockCipher*> engs(MultiKey ? LANCNT : 1);
+		std::vector<CBC*> mods(engs.size());
+		std::vector<std::vector<byte>> input(LANCNT, std::vector<byte>(MSGLEN, 0x00));
+		std::vector<std::vector<byte>> output(LANCNT, std::vector<byte>(MSGLEN, 0x00));
+		std::vector<std::vector<byte>> ivs(LANCNT, std::vector<byte>(DEF_IVSIZE, 0x00));
+		std::string glen;
+		std::string mbps;
+		std::string resp;
+		std::string secs;
+		uint64_t dur;
+		uint64_t len;
+		uint64_t rate;
+		uint64_t start;
+		size_t i;
+		size_t lctr;
+
+		for (i = 0; i < engs.size(); ++i)
+		{
+#if defined(__AVX__)
+			if (HAS_AESNI)
+			{
+				engs[i] = new AHX();
+			}
+			else
+#endif
+			{
+				engs[i] = new RHX();
+			}
+
+			mods[i] = new CBC(engs[i]);
+			Cipher::SymmetricKey* keyParam = TestUtils::GetRandomKey(DEF_KEYSIZE, DEF_IVSIZE);
+			mods[i]->Initialize(true, *keyParam);
+			delete keyParam;
+		}
+
+		start = TestUtils::GetTimeMs64();
+
+		for (i = 0; i < DEF_ITERATIONS; ++i)
+		{
+			lctr = 0;
+
+			while (lctr < ALNLEN)
+			{
+				if (MultiKey)
+				{
+					CBC::EncryptBatch(mods, input, output);
+				}
+				else
+				{
+					mods[0]->EncryptBatch(input, output, ivs);
+				}
+
+				lctr += BATLEN;
+			}
+		}
+
+		dur = TestUtils::GetTimeMs64() - start;
+		len = static_cast<ulong>(DEF_ITERATIONS) * ALNLEN;
+		rate = GetBytesPerSecond(dur, len);
+		glen = TestUtils::ToString(len / GB1);
+		mbps = TestUtils::ToString((rate / MB1));
+		secs = TestUtils::ToString(static_cast<double>(dur) / 1000.0);
+		resp = std::string(glen + "GB in " + secs + " seconds, avg. " + mbps + " MB per Second");
+		OnProgress(resp);
+		OnProgress(std::string(""));
+
+		for (i = 0; i < engs.size(); ++i)
+		{
+			delete mods[i];
+			delete engs[i];
+		}
+	}
+
 	void CipherSpeedTest::CBCSpeedTest(bool Encrypt, bool Parallel)
 	{
 #if defined(__AVX__)
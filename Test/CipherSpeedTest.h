@@ -151,6 +151,7 @@ namespace Test
 		}
 
 		static bool HasAESNI();
+		void CBCBatchSpeedTest(bool MultiKey);
 		void CBCSpeedTest(bool Encrypt, bool Parallel);
 		void CFBSpeedTest(bool Encrypt, bool Parallel);
 		void CTRSpeedTest(bool Encrypt, bool Parallel);
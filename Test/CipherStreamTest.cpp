@@ -3,9 +3,12 @@
 #include "../CEX/CTR.h"
 #include "../CEX/CBC.h"
 #include "../CEX/CFB.h"
+#include "../CEX/CryptoProcessingException.h"
+#include "../CEX/DirectFileStream.h"
 #include "../CEX/FileStream.h"
 #include "../CEX/ICM.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/MappedFileStream.h"
 #include "../CEX/MemoryStream.h"
 #include "../CEX/OFB.h"
 #include "../CEX/SecureRandom.h"
@@ -13,7 +16,10 @@
 namespace Test
 {
 	using namespace Cipher::Block::Mode;
+	using Exception::CryptoProcessingException;
+	using IO::DirectFileStream;
 	using Tools::IntegerTools;
+	using IO::MappedFileStream;
 	using IO::MemoryStream;
 	using Enumeration::PaddingModes;
 	using Prng::SecureRandom;
@@ -79,6 +85,24 @@ namespace Test
 			Parameters();
 			OnProgress(std::string("Passed Cipher Parameters tests.."));
 
+			Pipeline(cbcm);
+			OnProgress(std::string("Passed CBC Pipeline tests.."));
+
+			Pipeline(ctrm);
+			OnProgress(std::string("Passed CTR Pipeline tests.."));
+
+			Mapped(cbcm);
+			OnProgress(std::string("Passed CBC mapped file tests.."));
+
+			Mapped(ctrm);
+			OnProgress(std::string("Passed CTR mapped file tests.."));
+
+			Direct(cbcm);
+			OnProgress(std::string("Passed CBC direct file tests.."));
+
+			Direct(ctrm);
+			OnProgress(std::string("Passed CTR direct file tests.."));
+
 			Stress(cfbm);
 			OnProgress(std::string("Passed CFB stress tests.."));
 
@@ -116,6 +140,70 @@ namespace Test
 		}
 	}
 
+	void CipherStreamTest::Direct(CipherStream* Cipher)
+	{
+		const std::string INPNME = "cipherstreamtest.inp";
+		const std::string OUTNME = "cipherstreamtest.out";
+		std::vector<byte> iv(16);
+		std::vector<byte> key(32);
+		std::vector<byte> enc(0);
+		std::vector<byte> otp(0);
+		std::vector<byte> pln(0);
+		SecureRandom rng;
+
+		rng.Generate(iv);
+		rng.Generate(key);
+		SymmetricKey kp(key, iv);
+
+		// an unaligned length exercises the buffered tail write of a direct I/O file
+		const uint SMPLEN = rng.NextUInt32(static_cast<uint>(Cipher->ParallelProfile().ParallelBlockSize() * 4), static_cast<uint>(Cipher->ParallelProfile().ParallelBlockSize())) | 1;
+		pln.resize(SMPLEN);
+		enc.resize(SMPLEN);
+		rng.Generate(pln);
+
+		// expected output from the byte array interface
+		Cipher->Initialize(true, kp);
+		Cipher->Write(pln, 0, enc, 0);
+
+		{
+			DirectFileStream fpln(INPNME, DirectFileStream::DirectAccess::Create, true);
+			fpln.Write(pln, 0, pln.size());
+		}
+
+		// direct input and direct output, the output is preallocated by the cipher stream
+		{
+			DirectFileStream fpln(INPNME, DirectFileStream::DirectAccess::Read, true);
+			DirectFileStream fenc(OUTNME, DirectFileStream::DirectAccess::Create, true);
+			Cipher->Initialize(true, kp);
+			Cipher->Write(&fpln, &fenc);
+
+			otp.resize(static_cast<size_t>(fenc.Length()));
+			fenc.Reset();
+			fenc.Read(otp, 0, otp.size());
+
+			if (otp != enc)
+			{
+				throw TestException(std::string("Direct"), Cipher->Name(), std::string("Encrypted arrays are not equal! -CD1"));
+			}
+		}
+
+		// direct input and memory output
+		{
+			DirectFileStream fenc(OUTNME, DirectFileStream::DirectAccess::Read);
+			MemoryStream mdec;
+			Cipher->Initialize(false, kp);
+			Cipher->Write(&fenc, &mdec);
+
+			if (mdec.ToArray() != pln)
+			{
+				throw TestException(std::string("Direct"), Cipher->Name(), std::string("Decrypted arrays are not equal! -CD2"));
+			}
+		}
+
+		std::remove(INPNME.c_str());
+		std::remove(OUTNME.c_str());
+	}
+
 	void CipherStreamTest::File()
 	{
 		using namespace CEX::IO;
@@ -234,6 +322,102 @@ namespace Test
 		}
 	}
 
+	void CipherStreamTest::Mapped(CipherStream* Cipher)
+	{
+		const std::string INPNME = "cipherstreamtest.inp";
+		const std::string OUTNME = "cipherstreamtest.out";
+		std::vector<byte> iv(16);
+		std::vector<byte> key(32);
+		std::vector<byte> enc(0);
+		std::vector<byte> pln(0);
+		SecureRandom rng;
+
+		rng.Generate(iv);
+		rng.Generate(key);
+		SymmetricKey kp(key, iv);
+
+		const uint SMPLEN = rng.NextUInt32(static_cast<uint>(Cipher->ParallelProfile().ParallelBlockSize() * 4), static_cast<uint>(Cipher->ParallelProfile().ParallelBlockSize()));
+		pln.resize(SMPLEN);
+		enc.resize(SMPLEN);
+		rng.Generate(pln);
+
+		// expected output from the byte array interface
+		Cipher->Initialize(true, kp);
+		Cipher->Write(pln, 0, enc, 0);
+
+		// write the plaintext through a writable view of a new file
+		{
+			MappedFileStream fpln(INPNME, MappedFileStream::MappedAccess::Create, SMPLEN);
+			Span<byte> view = fpln.WritableView(0, SMPLEN);
+			std::memcpy(view.data(), pln.data(), SMPLEN);
+		}
+
+		// mapped input and mapped output
+		{
+			MappedFileStream fpln(INPNME, MappedFileStream::MappedAccess::Read);
+			MappedFileStream fenc(OUTNME, MappedFileStream::MappedAccess::Create);
+			Cipher->Initialize(true, kp);
+			Cipher->Write(&fpln, &fenc);
+
+			if (fenc.Length() != enc.size() || std::memcmp(fenc.View(0, enc.size()).data(), enc.data(), enc.size()) != 0)
+			{
+				throw TestException(std::string("Mapped"), Cipher->Name(), std::string("Encrypted arrays are not equal! -CF1"));
+			}
+		}
+
+		// mapped input and memory output
+		{
+			MappedFileStream fenc(OUTNME, MappedFileStream::MappedAccess::Read);
+			MemoryStream mdec;
+			Cipher->Initialize(false, kp);
+			Cipher->Write(&fenc, &mdec);
+
+			if (mdec.ToArray() != pln)
+			{
+				throw TestException(std::string("Mapped"), Cipher->Name(), std::string("Decrypted arrays are not equal! -CF2"));
+			}
+		}
+
+		// a position past the end of the mapping reads nothing
+		{
+			MappedFileStream fenc(OUTNME, MappedFileStream::MappedAccess::Read);
+			std::vector<byte> tmpr(16);
+
+			fenc.Seek(fenc.Length() + 1, IO::SeekOrigin::Begin);
+
+			if (fenc.Read(tmpr, 0, tmpr.size()) != 0)
+			{
+				throw TestException(std::string("Mapped"), Cipher->Name(), std::string("Read past the end of the stream! -CF3"));
+			}
+
+			try
+			{
+				fenc.ReadByte();
+
+				throw TestException(std::string("Mapped"), Cipher->Name(), std::string("Read a byte past the end of the stream! -CF4"));
+			}
+			catch (CryptoProcessingException const &)
+			{
+			}
+		}
+
+		// a writable view that stays within the reserved capacity does not remap the views already taken
+		{
+			MappedFileStream fpln(INPNME, MappedFileStream::MappedAccess::Create);
+			fpln.WriteByte(pln[0]);
+			Span<byte> view1 = fpln.WritableView(0, 1);
+			Span<byte> view2 = fpln.WritableView(1, 16);
+
+			if (view2.data() != view1.data() + 1 || fpln.Length() != 17)
+			{
+				throw TestException(std::string("Mapped"), Cipher->Name(), std::string("The mapping was moved by a view within its capacity! -CF5"));
+			}
+		}
+
+		std::remove(INPNME.c_str());
+		std::remove(OUTNME.c_str());
+	}
+
 	void CipherStreamTest::Memory()
 	{
 		std::vector<byte> data(255);
@@ -427,6 +611,77 @@ namespace Test
 		}
 	}
 
+	void CipherStreamTest::Pipeline(CipherStream* Cipher)
+	{
+		std::vector<byte> iv(16);
+		std::vector<byte> key(32);
+		std::vector<byte> enc(0);
+		std::vector<byte> pln(0);
+		SecureRandom rng;
+		size_t i;
+
+		rng.Generate(iv);
+		rng.Generate(key);
+		SymmetricKey kp(key, iv);
+		const bool ISPRL = Cipher->ParallelProfile().IsParallel();
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			// the sequential pipeline buffer is 64KB, the parallel buffer is ParallelBlockSize
+			const size_t BUFLEN = IntegerTools::Max(static_cast<size_t>(64 * 1024), Cipher->ParallelProfile().ParallelBlockSize());
+			const uint SMPLEN = rng.NextUInt32(static_cast<uint>(BUFLEN * 6), static_cast<uint>(BUFLEN * 2));
+			const bool PRLMOD = (i % 2 == 0);
+
+			pln.resize(SMPLEN);
+			enc.resize(SMPLEN);
+			rng.Generate(pln);
+
+			Cipher->ParallelProfile().IsParallel() = ISPRL && PRLMOD;
+
+			// byte array interface, the expected output
+			Cipher->Initialize(true, kp);
+			Cipher->Write(pln, 0, enc, 0);
+
+			// pipelined stream interface
+			MemoryStream mpln(pln);
+			MemoryStream menc;
+			Cipher->IsPipelined() = true;
+			Cipher->Initialize(true, kp);
+			Cipher->Write(&mpln, &menc);
+
+			if (menc.ToArray() != enc)
+			{
+				throw TestException(std::string("Pipeline"), Cipher->Name(), std::string("Encrypted arrays are not equal! -CP1"));
+			}
+
+			// sequential stream interface
+			MemoryStream mpln2(pln);
+			MemoryStream menc2;
+			Cipher->IsPipelined() = false;
+			Cipher->Initialize(true, kp);
+			Cipher->Write(&mpln2, &menc2);
+
+			if (menc2.ToArray() != enc)
+			{
+				throw TestException(std::string("Pipeline"), Cipher->Name(), std::string("Encrypted arrays are not equal! -CP2"));
+			}
+
+			// pipelined decryption
+			MemoryStream mdec;
+			menc.Seek(0, IO::SeekOrigin::Begin);
+			Cipher->IsPipelined() = true;
+			Cipher->Initialize(false, kp);
+			Cipher->Write(&menc, &mdec);
+
+			if (mdec.ToArray() != pln)
+			{
+				throw TestException(std::string("Pipeline"), Cipher->Name(), std::string("Decrypted arrays are not equal! -CP3"));
+			}
+		}
+
+		Cipher->ParallelProfile().IsParallel() = ISPRL;
+	}
+
 	void CipherStreamTest::Stress(CipherStream* Cipher)
 	{
 		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
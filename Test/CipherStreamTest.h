@@ -60,11 +60,25 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Test the direct file stream input and output paths against the byte array interface
+		/// </summary>
+		///
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Direct(CipherStream* Cipher);
+
 		/// <summary>
 		/// Test file stream access (manual)
 		/// </summary>
 		void File();
 
+		/// <summary>
+		/// Test the mapped file stream input and output paths against the byte array interface
+		/// </summary>
+		///
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Mapped(CipherStream* Cipher);
+
 		/// <summary>
 		/// Test memory stream access
 		/// </summary>
@@ -79,6 +93,13 @@ namespace Test
 		/// Test parameters for correct operation
 		/// </summary>
 		void Parameters();
+
+		/// <summary>
+		/// Test the pipelined stream processor output against the sequential stream and byte array interfaces
+		/// </summary>
+		///
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Pipeline(CipherStream* Cipher);
 		
 		/// <summary>
 		/// Test transformation and inverse with random in a looping [TEST_CYCLES] stress-test
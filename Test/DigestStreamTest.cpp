@@ -79,6 +79,24 @@ namespace Test
 		{
 			throw TestException(std::string("Evaluate"), GENNME, std::string("DigestStreamTest: Expected hash is not equal! -DE2"));
 		}
+
+		delete ms;
+
+		// test the pipelined stream method with an input spanning several read buffers
+		data.resize(rnd.NextUInt32(512000, 256000));
+		rnd.Generate(data);
+		gen = Helper::DigestFromName::GetInstance(Engine);
+		gen->Compute(data, hash1);
+		delete gen;
+
+		ms = new IO::MemoryStream(data);
+		hash2 = ds.Compute(ms);
+		delete ms;
+
+		if (hash1 != hash2)
+		{
+			throw TestException(std::string("Evaluate"), GENNME, std::string("DigestStreamTest: Expected hash is not equal! -DE3"));
+		}
 	}
 
 	void DigestStreamTest::OnProgress(const std::string &Data)
@@ -1,6 +1,9 @@
 #include "GMACTest.h"
+#include "../CEX/CMUL.h"
+#include "../CEX/CpuDetect.h"
 #include "../CEX/GMAC.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/MemoryTools.h"
 #include "../CEX/SecureRandom.h"
 #include "../CEX/SymmetricKey.h"
 
@@ -9,7 +12,9 @@ namespace Test
 	using Enumeration::BlockCiphers;
 	using Exception::CryptoMacException;
 	using Mac::GMAC;
+	using Numeric::CMUL;
 	using Tools::IntegerTools;
+	using Tools::MemoryTools;
 	using Prng::SecureRandom;
 	using Cipher::SymmetricKey;
 	using Cipher::SymmetricKeySize;
@@ -75,6 +80,12 @@ namespace Test
 			Stress(gen);
 			OnProgress(std::string("GMACTest: Passed GMAC stress tests.."));
 
+			Pointer(gen);
+			OnProgress(std::string("GMACTest: Passed GMAC pointer update and finalize tests.."));
+
+			Aggregate(gen);
+			OnProgress(std::string("GMACTest: Passed GMAC 8 block aggregated reduction tests.."));
+
 			delete gen;
 
 			return SUCCESS;
@@ -97,6 +108,87 @@ namespace Test
 		}
 	}
 
+	void GMACTest::Aggregate(IMac* Generator)
+	{
+		const size_t AGGLEN = CMUL::CMUL_PARALLEL_BLOCKS * CMUL::CMUL_BLOCK_SIZE;
+		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
+		std::array<ulong, CMUL::CMUL_STATE_SIZE> hkey;
+		std::array<ulong, CMUL::CMUL_POWERS_SIZE> powers;
+		std::array<byte, CMUL::CMUL_BLOCK_SIZE> exp;
+		std::array<byte, CMUL::CMUL_BLOCK_SIZE> otp;
+		std::vector<byte> code1(Generator->TagSize());
+		std::vector<byte> code2(Generator->TagSize());
+		std::vector<byte> inp(AGGLEN + CMUL::CMUL_BLOCK_SIZE);
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> msg;
+		std::vector<byte> nonce(ks.IVSize());
+		CpuDetect dtc;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+
+		// the aggregated permutation requires the carry-less multiply instructions
+		if (dtc.CMUL() && dtc.AVX())
+		{
+			for (i = 0; i < TEST_CYCLES; ++i)
+			{
+				hkey[0] = rnd.NextUInt64();
+				hkey[1] = rnd.NextUInt64();
+				// the 8 message blocks, followed by the running hash
+				rnd.Generate(inp, 0, inp.size());
+				MemoryTools::COPY128(inp, AGGLEN, exp, 0);
+				otp = exp;
+
+				// 8 sequential multiplications by H with the portable permutation
+				for (j = 0; j < CMUL::CMUL_PARALLEL_BLOCKS; ++j)
+				{
+					MemoryTools::XOR128(inp, j * CMUL::CMUL_BLOCK_SIZE, exp, 0);
+					CMUL::PermuteR128P128U(hkey, exp);
+				}
+
+				// 8 blocks multiplied by H^8 to H^1 with a single reduction
+				CMUL::PreCompute(hkey, powers);
+				CMUL::PermuteR128P1024V(powers, inp, 0, otp);
+
+				if (otp != exp)
+				{
+					throw TestException(std::string("Aggregate"), std::string("CMUL"), std::string("The aggregated permutation output is not equal! -GA1"));
+				}
+			}
+		}
+
+		// lengths below, at, and across the aggregated block size, with partial trailing blocks
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			const size_t MSGLEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(AGGLEN * 8), 1));
+			msg.resize(MSGLEN);
+			rnd.Generate(msg, 0, msg.size());
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(nonce, 0, nonce.size());
+			SymmetricKey kp(key, nonce);
+
+			// a single update takes the aggregated path
+			Generator->Initialize(kp);
+			Generator->Update(msg, 0, msg.size());
+			Generator->Finalize(code1, 0);
+
+			// one block per update is always permuted block by block
+			Generator->Initialize(kp);
+
+			for (j = 0; j < MSGLEN; j += CMUL::CMUL_BLOCK_SIZE)
+			{
+				Generator->Update(msg, j, IntegerTools::Min(CMUL::CMUL_BLOCK_SIZE, MSGLEN - j));
+			}
+
+			Generator->Finalize(code2, 0);
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Aggregate"), Generator->Name(), std::string("The aggregated mac output is not equal! -GA2"));
+			}
+		}
+	}
+
 	void GMACTest::Exception()
 	{
 		// test constructor -1
@@ -294,6 +386,73 @@ namespace Test
 		}
 	}
 
+	void GMACTest::Pointer(IMac* Generator)
+	{
+		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
+		// a partial block, and a long message
+		const std::vector<size_t> MSGLEN = { 100, MAXM_ALLOC };
+		std::vector<byte> code1(Generator->TagSize());
+		std::vector<byte> code2(Generator->TagSize());
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> msg;
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<size_t> seg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t moff;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(msg, 0, msg.size());
+			rnd.Generate(nonce, 0, nonce.size());
+			SymmetricKey kp(key, nonce);
+
+			// uneven segments exercise the input buffering
+			seg.clear();
+			moff = 0;
+
+			while (moff != msg.size())
+			{
+				seg.push_back(IntegerTools::Min(static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(Generator->BlockSize() * 3), 1)), msg.size() - moff));
+				moff += seg.back();
+			}
+
+			// the vector functions are the reference
+			Generator->Initialize(kp);
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Generator->Update(msg, moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Generator->Finalize(code1, 0);
+
+			Generator->Initialize(kp);
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Generator->Update(msg.data() + moff, seg[j]);
+				moff += seg[j];
+			}
+
+			if (Generator->Finalize(code2.data()) != code2.size())
+			{
+				throw TestException(std::string("Pointer"), Generator->Name(), std::string("The pointer finalize returned an invalid length! -GX1"));
+			}
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Pointer"), Generator->Name(), std::string("The pointer mac output is not equal! -GX2"));
+			}
+		}
+	}
+
 	void GMACTest::Stress(IMac* Generator)
 	{
 		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
@@ -56,6 +56,14 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare the 8 block aggregated CMUL permutation to 8 sequential block permutations, 
+		/// and a GMAC computed in one update to the same message absorbed one block per update
+		/// </summary>
+		/// 
+		/// <param name="Generator">The mac generator instance</param>
+		void Aggregate(IMac* Generator);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
@@ -78,6 +86,13 @@ namespace Test
 		/// <param name="Generator">The mac generator instance</param>
 		void Params(IMac* Generator);
 
+		/// <summary>
+		/// Compare the pointer Update and Finalize functions with the vector functions over the same uneven input segments
+		/// </summary>
+		/// 
+		/// <param name="Generator">The mac generator instance</param>
+		void Pointer(IMac* Generator);
+
 		/// <summary>
 		/// Test behavior parallel and sequential processing in a looping [TEST_CYCLES] stress-test using randomly sized input and data
 		/// </summary>
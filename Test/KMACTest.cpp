@@ -95,6 +95,12 @@ namespace Test
 			Stress(gen4);
 			OnProgress(std::string("HMACTest: Passed KMAC 128/256/512/1024 stress tests.."));
 
+			Pointer(gen1);
+			Pointer(gen2);
+			Pointer(gen3);
+			Pointer(gen4);
+			OnProgress(std::string("KMACTest: Passed KMAC 128/256/512/1024 pointer update and finalize tests.."));
+
 			delete gen1;
 			delete gen2;
 			delete gen3;
@@ -398,6 +404,71 @@ namespace Test
 		}
 	}
 
+	void KMACTest::Pointer(IMac* Generator)
+	{
+		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
+		// a partial block, and a long message
+		const std::vector<size_t> MSGLEN = { 100, MAXM_ALLOC };
+		std::vector<byte> code1(Generator->TagSize());
+		std::vector<byte> code2(Generator->TagSize());
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> msg;
+		std::vector<size_t> seg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t moff;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(msg, 0, msg.size());
+			SymmetricKey kp(key);
+
+			// uneven segments exercise the input buffering
+			seg.clear();
+			moff = 0;
+
+			while (moff != msg.size())
+			{
+				seg.push_back(IntegerTools::Min(static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(Generator->BlockSize() * 3), 1)), msg.size() - moff));
+				moff += seg.back();
+			}
+
+			// the vector functions are the reference
+			Generator->Initialize(kp);
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Generator->Update(msg, moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Generator->Finalize(code1, 0);
+
+			Generator->Initialize(kp);
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Generator->Update(msg.data() + moff, seg[j]);
+				moff += seg[j];
+			}
+
+			if (Generator->Finalize(code2.data()) != code2.size())
+			{
+				throw TestException(std::string("Pointer"), Generator->Name(), std::string("The pointer finalize returned an invalid length! -KX1"));
+			}
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Pointer"), Generator->Name(), std::string("The pointer mac output is not equal! -KX2"));
+			}
+		}
+	}
+
 	void KMACTest::Stress(IMac* Generator)
 	{
 		SymmetricKeySize ks = Generator->LegalKeySizes()[0];
@@ -87,6 +87,13 @@ namespace Test
 		/// <param name="Generator">The mac generator instance</param>
 		void Params(IMac* Generator);
 
+		/// <summary>
+		/// Compare the pointer Update and Finalize functions with the vector functions over the same uneven input segments
+		/// </summary>
+		/// 
+		/// <param name="Generator">The mac generator instance</param>
+		void Pointer(IMac* Generator);
+
 		/// <summary>
 		/// Test behavior parallel and sequential processing in a looping [TEST_CYCLES] stress-test using randomly sized input and data
 		/// </summary>
@@ -1,9 +1,14 @@
 #include "MemUtilsTest.h"
+#include "../CEX/LockingAllocator.h"
 #include "../CEX/MemoryTools.h"
 #include "../CEX/SecureRandom.h"
+#include "../CEX/SecureVector.h"
+#include "../CEX/ThreadPool.h"
+#include <atomic>
 
 namespace Test
 {
+	using Tools::LockingAllocator;
 	using Tools::MemoryTools;
 
 	const std::string MemUtilsTest::CLASSNAME = "MemUtilsTest";
@@ -36,6 +41,8 @@ namespace Test
 		{
 			Evaluate();
 			OnProgress(std::string("MemUtilsTest: Passed output comparison tests.."));
+			SecureAllocator();
+			OnProgress(std::string("MemUtilsTest: Passed secure allocator tests.."));
 
 			return SUCCESS;
 		}
@@ -270,6 +277,139 @@ namespace Test
 		}
 	}
 
+	void MemUtilsTest::SecureAllocator()
+	{
+		// sizes below, inside, and above the size classes
+		const std::vector<size_t> BLKLEN = { 1, 15, 16, 17, 100, 512, 1000, 4095, 4096, 4097, 8192 };
+		const size_t BLKCNT = 48;
+		const LockingAllocator::AllocatorStatistics STATS1 = LockingAllocator::Statistics();
+		std::vector<std::pair<byte*, size_t>> blks(0);
+		std::atomic_size_t errs(0);
+		size_t i;
+		size_t j;
+		size_t lrgcnt;
+
+		lrgcnt = 0;
+
+		// every block is zeroed, and no live block overlaps another
+		for (i = 0; i < BLKCNT; ++i)
+		{
+			for (j = 0; j < BLKLEN.size(); ++j)
+			{
+				byte* ptr = static_cast<byte*>(LockingAllocator::Allocate(BLKLEN[j], 1));
+
+				for (size_t k = 0; k < BLKLEN[j]; ++k)
+				{
+					if (ptr[k] != 0x00)
+					{
+						throw TestException(std::string("SecureAllocator"), std::string("Allocate"), std::string("The block was not zeroed! -LA1"));
+					}
+				}
+
+				std::memset(ptr, static_cast<byte>(blks.size() + 1), BLKLEN[j]);
+				blks.push_back(std::pair<byte*, size_t>(ptr, BLKLEN[j]));
+				lrgcnt += (BLKLEN[j] > CEX_SECMEMALLOC_MAX) ? 1 : 0;
+			}
+		}
+
+		for (i = 0; i < blks.size(); ++i)
+		{
+			for (j = 0; j < blks[i].second; ++j)
+			{
+				if (blks[i].first[j] != static_cast<byte>(i + 1))
+				{
+					throw TestException(std::string("SecureAllocator"), std::string("Allocate"), std::string("The blocks overlap! -LA2"));
+				}
+			}
+		}
+
+		const LockingAllocator::AllocatorStatistics STATS2 = LockingAllocator::Statistics();
+
+		// while the locked region exists, the small blocks are hits or fallbacks, and the large blocks are always fallbacks
+		if (STATS2.LockedBytes != 0)
+		{
+			if (STATS2.SlabBytes > STATS2.LockedBytes || STATS2.Fallbacks - STATS1.Fallbacks < lrgcnt ||
+				(STATS2.Hits - STATS1.Hits) + (STATS2.Fallbacks - STATS1.Fallbacks) < blks.size())
+			{
+				throw TestException(std::string("SecureAllocator"), std::string("Statistics"), std::string("The allocator statistics are invalid! -LA3"));
+			}
+		}
+
+		// blocks allocated on this thread are released and re-used on worker threads
+		{
+			Tools::ThreadPool pool(4);
+
+			pool.Execute(blks.size(), [&blks, &errs](size_t Index)
+			{
+				const size_t BLKSZE = blks[Index].second;
+
+				LockingAllocator::Deallocate(blks[Index].first, BLKSZE, 1);
+				blks[Index].first = nullptr;
+
+				for (size_t k = 0; k < 8; ++k)
+				{
+					SecureVector<byte> tmp(BLKSZE, 0x00);
+
+					std::memset(tmp.data(), static_cast<byte>(Index + k), tmp.size());
+
+					for (size_t m = 0; m < tmp.size(); ++m)
+					{
+						if (tmp[m] != static_cast<byte>(Index + k))
+						{
+							errs.fetch_add(1);
+							break;
+						}
+					}
+				}
+			});
+		}
+
+		if (errs != 0)
+		{
+			throw TestException(std::string("SecureAllocator"), std::string("Deallocate"), std::string("A worker block was corrupted! -LA4"));
+		}
+
+		// the worker caches were returned when the threads exited, the blocks are re-used here
+		for (i = 0; i < blks.size(); ++i)
+		{
+			blks[i].first = static_cast<byte*>(LockingAllocator::Allocate(blks[i].second, 1));
+			std::memset(blks[i].first, static_cast<byte>(i + 1), blks[i].second);
+		}
+
+		for (i = 0; i < blks.size(); ++i)
+		{
+			for (j = 0; j < blks[i].second; ++j)
+			{
+				if (blks[i].first[j] != static_cast<byte>(i + 1))
+				{
+					throw TestException(std::string("SecureAllocator"), std::string("Allocate"), std::string("The re-used blocks overlap! -LA5"));
+				}
+			}
+
+			LockingAllocator::Deallocate(blks[i].first, blks[i].second, 1);
+		}
+
+		// multi-byte elements are sized by their element count
+		SecureVector<ulong> vec1(300, 0);
+		SecureVector<ulong> vec2(0);
+
+		for (i = 0; i < vec1.size(); ++i)
+		{
+			vec1[i] = static_cast<ulong>(i) * 0x0101010101010101ULL;
+		}
+
+		vec2 = vec1;
+		vec1.resize(1000);
+
+		for (i = 0; i < vec2.size(); ++i)
+		{
+			if (vec1[i] != vec2[i] || vec2[i] != static_cast<ulong>(i) * 0x0101010101010101ULL)
+			{
+				throw TestException(std::string("SecureAllocator"), std::string("SecureVector"), std::string("The vector copy is invalid! -LA6"));
+			}
+		}
+	}
+
 	void MemUtilsTest::OnProgress(const std::string &Data)
 	{
 		m_progressEvent(Data);
@@ -62,6 +62,11 @@ namespace Test
 		/// </summary>
 		TestEventHandler &Progress() override;
 
+		/// <summary>
+		/// Evaluate the secure vector slab allocator; block isolation, zeroing, statistics, and cross-thread release
+		/// </summary>
+		void SecureAllocator();
+
 		/// <summary>
 		/// Start the tests
 		/// </summary>
@@ -10,6 +10,7 @@
 
 namespace Test
 {
+	using Cipher::ISymmetricKey;
 	using Exception::CryptoKdfException;
 	using Tools::IntegerTools;
 	using Kdf::PBKDF2;
@@ -72,6 +73,10 @@ namespace Test
 			Kat(gen2, m_key[3], m_salt[3], m_expected[7], 4096);
 			OnProgress(std::string("PBKDF2Test: Passed PBKDF2 SHA2512 KAT vector tests.."));
 
+			Batch(gen1);
+			Batch(gen2);
+			OnProgress(std::string("PBKDF2Test: Passed batch generator tests.."));
+
 			gen1->Iterations() = 1;
 			gen2->Iterations() = 1;
 
@@ -106,6 +111,54 @@ namespace Test
 		}
 	}
 
+	void PBKDF2Test::Batch(IKdf* Generator)
+	{
+		SymmetricKeySize ks = Generator->LegalKeySizes()[1];
+		std::vector<SymmetricKey*> keys(0);
+		std::vector<ISymmetricKey*> params(0);
+		std::vector<SecureVector<byte>> otp1(0);
+		std::vector<byte> otp2(0);
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> salt(ks.InfoSize());
+		SecureRandom rnd;
+		size_t i;
+
+		dynamic_cast<PBKDF2*>(Generator)->Iterations() = BATCH_ITERATIONS;
+		const size_t OTPLEN = static_cast<size_t>(rnd.NextUInt32(MINM_ALLOC, 1));
+
+		// more passwords than lanes, so the final group is processed sequentially
+		for (i = 0; i < TEST_CYCLES + 1; ++i)
+		{
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(salt, 0, salt.size());
+			keys.push_back(new SymmetricKey(key, salt));
+			params.push_back(keys[i]);
+		}
+
+		dynamic_cast<PBKDF2*>(Generator)->Generate(params, otp1, OTPLEN);
+
+		if (otp1.size() != keys.size())
+		{
+			throw TestException(std::string("Batch"), Generator->Name(), std::string("The batch output count is invalid! -PB1"));
+		}
+
+		otp2.resize(OTPLEN);
+
+		for (i = 0; i < keys.size(); ++i)
+		{
+			Generator->Initialize(*keys[i]);
+			Generator->Generate(otp2, 0, OTPLEN);
+			Generator->Reset();
+
+			if (otp1[i].size() != OTPLEN || std::equal(otp2.begin(), otp2.end(), otp1[i].begin()) == false)
+			{
+				throw TestException(std::string("Batch"), Generator->Name(), std::string("The batch output does not match the sequential output! -PB2"));
+			}
+
+			delete keys[i];
+		}
+	}
+
 	void PBKDF2Test::Exception()
 	{
 		// test constructor
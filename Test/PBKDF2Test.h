@@ -23,6 +23,7 @@ namespace Test
 		static const size_t MAXM_ALLOC = 31 * 255;
 		static const size_t MINM_ALLOC = 1024;
 		static const size_t TEST_CYCLES = 10;
+		static const uint BATCH_ITERATIONS = 100;
 
 		std::vector<std::vector<byte>> m_key;
 		std::vector<std::vector<byte>> m_expected;
@@ -56,6 +57,13 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Compare the output of the batch generator to the output of each password generated sequentially
+		/// </summary>
+		/// 
+		/// <param name="Generator">The kdf generator instance</param>
+		void Batch(IKdf* Generator);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
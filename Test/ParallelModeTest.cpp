@@ -2,18 +2,33 @@
 #include "TestUtils.h"
 #include "../CEX/CBC.h"
 #include "../CEX/CTR.h"
+#include "../CEX/CpuDetect.h"
+#include "../CEX/CryptoProcessingException.h"
 #include "../CEX/ECB.h"
 #include "../CEX/ICM.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/ParallelCalibration.h"
+#include "../CEX/ParallelTools.h"
 #include "../CEX/SecureRandom.h"
+#include "../CEX/ThreadPlacements.h"
+#include "../CEX/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
 
 namespace Test
 {
 	using namespace Cipher::Block::Mode;
+	using Exception::CryptoProcessingException;
+	using Enumeration::ErrorCodes;
 	using Tools::IntegerTools;
+	using Tools::ParallelTools;
 	using Prng::SecureRandom;
 	using Cipher::SymmetricKey;
 	using Cipher::SymmetricKeySize;
+	using Enumeration::ThreadPlacements;
 
 	const std::string ParallelModeTest::CLASSNAME = "ParallelModeTest";
 	const std::string ParallelModeTest::DESCRIPTION = "Stress test compares output from parallel and linear modes for equality.";
@@ -49,6 +64,13 @@ namespace Test
 	{
 		try
 		{
+			ThreadPooling();
+			OnProgress(std::string("ParallelModeTest: Passed thread pool scheduling and exception tests.."));
+			Calibration();
+			OnProgress(std::string("ParallelModeTest: Passed parallel calibration profile tests.."));
+			Placement();
+			OnProgress(std::string("ParallelModeTest: Passed processor topology and thread placement tests.."));
+
 			CBC* cpr1 = new CBC(Enumeration::BlockCiphers::AES);
 			Stress(cpr1, false);
 			OnProgress(std::string("ParallelModeTest: Passed CBC parallel to sequential equivalence test.."));
@@ -85,6 +107,267 @@ namespace Test
 		}
 	}
 
+	void ParallelModeTest::Calibration()
+	{
+		const std::string PRFNME = "parallelmodetest.prf";
+		CTR cpr1(Enumeration::BlockCiphers::AES);
+		const size_t DEGREE = cpr1.ParallelProfile().ParallelMaxDegree();
+		const size_t MINPRL = cpr1.ParallelProfile().ParallelMinimumSize();
+		const size_t DEFLEN = cpr1.ParallelProfile().ParallelBlockSize();
+		// a valid calibrated size that differs from the default
+		const size_t CALLEN = (MINPRL == 0) ? 64 * 1024 : (DEFLEN > MINPRL) ? DEFLEN - MINPRL : DEFLEN + MINPRL;
+		std::vector<byte> key(32, 0x11);
+		std::vector<byte> iv(16, 0x22);
+		SymmetricKey kp(key, iv);
+		size_t blklen;
+
+		ParallelCalibration::Clear();
+		ParallelCalibration::Set(cpr1.Name(), DEGREE, CALLEN);
+
+		// an entry is returned only for the degree it was calibrated with
+		if (!ParallelCalibration::TryGet(cpr1.Name(), DEGREE, blklen) || blklen != CALLEN || ParallelCalibration::TryGet(cpr1.Name(), DEGREE + 2, blklen))
+		{
+			throw TestException(std::string("Calibration"), cpr1.Name(), std::string("The profile entry was not returned! -PC1"));
+		}
+
+		// a saved profile is restored by a load
+		ParallelCalibration::Save(PRFNME);
+		ParallelCalibration::Clear();
+
+		if (ParallelCalibration::TryGet(cpr1.Name(), DEGREE, blklen))
+		{
+			throw TestException(std::string("Calibration"), cpr1.Name(), std::string("The profile was not cleared! -PC2"));
+		}
+
+		if (!ParallelCalibration::Load(PRFNME) || !ParallelCalibration::TryGet(cpr1.Name(), DEGREE, blklen) || blklen != CALLEN)
+		{
+			throw TestException(std::string("Calibration"), cpr1.Name(), std::string("The saved profile was not restored! -PC3"));
+		}
+
+		// a profile from another host is rejected
+		{
+			std::ifstream ifs(PRFNME.c_str());
+			std::string hdr;
+			std::getline(ifs, hdr);
+			ifs.close();
+			std::ofstream ofs(PRFNME.c_str(), std::ofstream::out | std::ofstream::trunc);
+			ofs << hdr << std::endl << "host 0 0 0 0" << std::endl << cpr1.Name() << " " << DEGREE << " " << CALLEN << std::endl;
+		}
+
+		ParallelCalibration::Clear();
+
+		if (ParallelCalibration::Load(PRFNME) || ParallelCalibration::TryGet(cpr1.Name(), DEGREE, blklen))
+		{
+			throw TestException(std::string("Calibration"), cpr1.Name(), std::string("A foreign profile was loaded! -PC4"));
+		}
+
+		std::remove(PRFNME.c_str());
+
+		if (cpr1.ParallelProfile().IsParallel())
+		{
+			std::vector<byte> inp(CALLEN * 3 + 13);
+			std::vector<byte> otp1(inp.size());
+			std::vector<byte> otp2(inp.size());
+			SecureRandom rnd;
+
+			rnd.Generate(inp);
+			ParallelCalibration::Set(cpr1.Name(), DEGREE, CALLEN);
+
+			// the calibrated size is applied to a default instance, and the output is unchanged
+			cpr1.Initialize(true, kp);
+
+			if (cpr1.ParallelProfile().ParallelBlockSize() != CALLEN)
+			{
+				throw TestException(std::string("Calibration"), cpr1.Name(), std::string("The calibrated size was not applied! -PC5"));
+			}
+
+			cpr1.Transform(inp, 0, otp1, 0, inp.size());
+			cpr1.Initialize(true, kp);
+			cpr1.ParallelProfile().IsParallel() = false;
+			cpr1.Transform(inp, 0, otp2, 0, inp.size());
+
+			if (otp1 != otp2)
+			{
+				throw TestException(std::string("Calibration"), cpr1.Name(), std::string("Cipher output is not equal! -PC6"));
+			}
+
+			// a user defined size is never replaced
+			CTR cpr2(Enumeration::BlockCiphers::AES);
+			cpr2.ParallelProfile().SetBlockSize(MINPRL);
+			cpr2.Initialize(true, kp);
+
+			if (cpr2.ParallelProfile().ParallelBlockSize() == CALLEN)
+			{
+				throw TestException(std::string("Calibration"), cpr2.Name(), std::string("A user defined size was replaced! -PC7"));
+			}
+
+			// a measured size is a legal parallel block size, and is stored in the profile
+			CTR cpr3(Enumeration::BlockCiphers::AES);
+			const size_t MSRLEN = ParallelCalibration::Calibrate(&cpr3, true);
+
+			if (MSRLEN != 0 && (MSRLEN % MINPRL != 0 || MSRLEN > cpr3.ParallelProfile().ParallelMaximumSize() || !ParallelCalibration::TryGet(cpr3.Name(), DEGREE, blklen) || blklen != MSRLEN))
+			{
+				throw TestException(std::string("Calibration"), cpr3.Name(), std::string("The calibrated size is invalid! -PC8"));
+			}
+		}
+		else
+		{
+			// a sequential host does not calibrate
+			if (ParallelCalibration::Calibrate(&cpr1, true) != 0)
+			{
+				throw TestException(std::string("Calibration"), cpr1.Name(), std::string("A sequential engine was calibrated! -PC9"));
+			}
+		}
+
+		ParallelCalibration::Clear();
+	}
+
+	void ParallelModeTest::Placement()
+	{
+		std::vector<std::vector<size_t>> cores = CpuDetect::CoreTopology();
+		std::vector<size_t> lgcs(0);
+		std::vector<byte> key(32, 0x11);
+		std::vector<byte> iv(16, 0x22);
+		SymmetricKey kp(key, iv);
+		std::atomic_size_t ctr(0);
+		std::atomic_size_t errs(0);
+		size_t i;
+		size_t j;
+		bool exc;
+
+		// every logical processor belongs to exactly one core, siblings are in ascending order
+		for (i = 0; i < cores.size(); ++i)
+		{
+			if (cores[i].size() == 0)
+			{
+				throw TestException(std::string("Placement"), std::string("CoreTopology"), std::string("A core has no logical processors! -PT1"));
+			}
+
+			for (j = 0; j < cores[i].size(); ++j)
+			{
+				if (j != 0 && cores[i][j] <= cores[i][j - 1])
+				{
+					throw TestException(std::string("Placement"), std::string("CoreTopology"), std::string("The core siblings are not ordered! -PT1"));
+				}
+
+				lgcs.push_back(cores[i][j]);
+			}
+		}
+
+		std::sort(lgcs.begin(), lgcs.end());
+
+		if (lgcs.size() == 0 || std::adjacent_find(lgcs.begin(), lgcs.end()) != lgcs.end())
+		{
+			throw TestException(std::string("Placement"), std::string("CoreTopology"), std::string("A logical processor is listed more than once! -PT2"));
+		}
+
+		CTR cpr1(Enumeration::BlockCiphers::AES);
+
+		exc = false;
+
+		try
+		{
+			cpr1.ParallelProfile().SetPlacement(ThreadPlacements::Explicit);
+		}
+		catch (CryptoProcessingException const &)
+		{
+			exc = true;
+		}
+
+		if (exc == false)
+		{
+			throw TestException(std::string("Placement"), std::string("SetPlacement"), std::string("Exception handling failure! -PT3"));
+		}
+
+		exc = false;
+
+		try
+		{
+			cpr1.ParallelProfile().SetPlacement(std::vector<size_t>(0));
+		}
+		catch (CryptoProcessingException const &)
+		{
+			exc = true;
+		}
+
+		if (exc == false)
+		{
+			throw TestException(std::string("Placement"), std::string("SetPlacement"), std::string("Exception handling failure! -PT4"));
+		}
+
+		// one worker per physical core, bounded by the pool; a failed placement leaves the state unchanged
+		if (cpr1.ParallelProfile().SetPlacement(ThreadPlacements::Physical))
+		{
+			if (cpr1.ParallelProfile().Placement() != ThreadPlacements::Physical || !Tools::ThreadPool::Instance().IsPinned() ||
+				cpr1.ParallelProfile().ProcessorCount() > cores.size() || cpr1.ParallelProfile().ProcessorCount() == 0)
+			{
+				throw TestException(std::string("Placement"), std::string("SetPlacement"), std::string("The physical placement was not applied! -PT5"));
+			}
+
+			std::vector<byte> inp(cpr1.ParallelProfile().ParallelBlockSize() * 2 + 31);
+			std::vector<byte> otp1(inp.size());
+			std::vector<byte> otp2(inp.size());
+			SecureRandom rnd;
+
+			rnd.Generate(inp);
+			cpr1.Initialize(true, kp);
+			cpr1.Transform(inp, 0, otp1, 0, inp.size());
+			cpr1.Initialize(true, kp);
+			cpr1.ParallelProfile().IsParallel() = false;
+			cpr1.Transform(inp, 0, otp2, 0, inp.size());
+
+			if (otp1 != otp2)
+			{
+				throw TestException(std::string("Placement"), cpr1.Name(), std::string("Cipher output is not equal! -PT6"));
+			}
+		}
+		else if (cpr1.ParallelProfile().Placement() != ThreadPlacements::None)
+		{
+			throw TestException(std::string("Placement"), std::string("SetPlacement"), std::string("A failed placement changed the state! -PT5"));
+		}
+
+		cpr1.ParallelProfile().SetPlacement(ThreadPlacements::None);
+
+		if (cpr1.ParallelProfile().Placement() != ThreadPlacements::None || Tools::ThreadPool::Instance().IsPinned())
+		{
+			throw TestException(std::string("Placement"), std::string("SetPlacement"), std::string("The placement was not removed! -PT7"));
+		}
+
+		// while pinned, a batch runs only on the pinned workers and the caller waits
+		Tools::ThreadPool pool2(2);
+		const std::thread::id THDID = std::this_thread::get_id();
+
+		if (pool2.SetAffinity(std::vector<size_t>(2, lgcs[0])))
+		{
+			if (!pool2.IsPinned() || pool2.Concurrency() != 2)
+			{
+				throw TestException(std::string("Placement"), std::string("SetAffinity"), std::string("The pool was not pinned! -PT8"));
+			}
+
+			pool2.Execute(16, [&ctr, &errs, THDID](size_t)
+			{
+				if (std::this_thread::get_id() == THDID)
+				{
+					errs.fetch_add(1);
+				}
+
+				ctr.fetch_add(1);
+			});
+
+			if (ctr != 16 || errs != 0)
+			{
+				throw TestException(std::string("Placement"), std::string("Execute"), std::string("A pinned job ran on the calling thread! -PT9"));
+			}
+
+			pool2.SetAffinity(std::vector<size_t>(0));
+
+			if (pool2.IsPinned() || pool2.Concurrency() != 2)
+			{
+				throw TestException(std::string("Placement"), std::string("SetAffinity"), std::string("The pool was not unpinned! -PT10"));
+			}
+		}
+	}
+
 	void ParallelModeTest::Stress(IAeadMode* Cipher, bool Encryption)
 	{
 		const uint MINSMP = static_cast<uint>(Cipher->ParallelProfile().ParallelBlockSize());
@@ -220,6 +503,198 @@ namespace Test
 		}
 	}
 
+	void ParallelModeTest::ThreadPooling()
+	{
+		const size_t PRCCNT = ParallelTools::ProcessorCount();
+		const size_t JOBCNT = (PRCCNT * 4) + 3;
+		const size_t RNGBEG = 5;
+		const size_t RNGEND = 1005;
+		const size_t GRNLEN = 64;
+		std::vector<std::atomic_size_t> hits(JOBCNT);
+		std::vector<std::atomic_size_t> elms(RNGEND);
+		std::atomic_size_t ctr(0);
+		std::atomic_size_t cnks(0);
+		std::atomic_size_t errs(0);
+		size_t i;
+		bool exc;
+
+		for (i = 0; i < hits.size(); ++i)
+		{
+			hits[i] = 0;
+		}
+
+		for (i = 0; i < elms.size(); ++i)
+		{
+			elms[i] = 0;
+		}
+
+		// every index in the range is visited exactly once
+		ParallelTools::ParallelFor(3, 3 + JOBCNT, [&hits](size_t Index)
+		{
+			hits[Index - 3].fetch_add(1);
+		});
+
+		for (i = 0; i < hits.size(); ++i)
+		{
+			if (hits[i] != 1)
+			{
+				throw TestException(std::string("ThreadPooling"), std::string("ParallelFor"), std::string("The index was not visited exactly once! -PP1"));
+			}
+		}
+
+		// the chunks cover the range once, and only the last chunk is short
+		ParallelTools::ParallelFor(RNGBEG, RNGEND, GRNLEN, [&elms, &cnks, &errs, GRNLEN, RNGEND](size_t Start, size_t End)
+		{
+			if (End <= Start || (End - Start != GRNLEN && End != RNGEND))
+			{
+				errs.fetch_add(1);
+			}
+
+			for (size_t j = Start; j < End; ++j)
+			{
+				elms[j].fetch_add(1);
+			}
+
+			cnks.fetch_add(1);
+		});
+
+		for (i = 0; i < elms.size(); ++i)
+		{
+			if (elms[i] != ((i < RNGBEG) ? 0 : 1) || errs != 0 || cnks != ((RNGEND - RNGBEG) + (GRNLEN - 1)) / GRNLEN)
+			{
+				throw TestException(std::string("ThreadPooling"), std::string("ParallelFor"), std::string("The chunked range was not processed exactly once! -PP2"));
+			}
+		}
+
+		// nested calls from inside a job must complete
+		ParallelTools::ParallelFor(0, PRCCNT * 2, [&ctr](size_t)
+		{
+			ParallelTools::ParallelFor(0, 8, [&ctr](size_t)
+			{
+				ctr.fetch_add(1);
+			});
+		});
+
+		if (ctr != PRCCNT * 2 * 8)
+		{
+			throw TestException(std::string("ThreadPooling"), std::string("ParallelFor"), std::string("The nested loop did not complete! -PP3"));
+		}
+
+		ctr = 0;
+		ParallelTools::ParallelTask([&ctr]()
+		{
+			ctr.fetch_add(1);
+		});
+
+		if (ctr != 1)
+		{
+			throw TestException(std::string("ThreadPooling"), std::string("ParallelTask"), std::string("The task did not execute exactly once! -PP4"));
+		}
+
+		// an exception thrown by a job is re-thrown on the caller, after every job has finished
+		exc = false;
+		ctr = 0;
+
+		try
+		{
+			Tools::ThreadPool::Instance().Execute(JOBCNT, [&ctr](size_t Index)
+			{
+				ctr.fetch_add(1);
+
+				if (Index == 1)
+				{
+					throw CryptoProcessingException(std::string("ParallelModeTest"), std::string("ThreadPooling"), std::string("Expected exception"), ErrorCodes::InvalidState);
+				}
+			});
+		}
+		catch (CryptoProcessingException const &)
+		{
+			exc = true;
+		}
+
+		if (exc == false || ctr != JOBCNT)
+		{
+			throw TestException(std::string("ThreadPooling"), std::string("Execute"), std::string("The job exception was not propagated! -PP5"));
+		}
+
+		// a single thread pool executes every job on the calling thread
+		Tools::ThreadPool pool1(1);
+		const std::thread::id THDID = std::this_thread::get_id();
+		ctr = 0;
+
+		pool1.Execute(JOBCNT, [&ctr, &errs, THDID](size_t)
+		{
+			if (std::this_thread::get_id() != THDID)
+			{
+				errs.fetch_add(1);
+			}
+
+			ctr.fetch_add(1);
+		});
+
+		if (ctr != JOBCNT || errs != 0 || pool1.Concurrency() != 1)
+		{
+			throw TestException(std::string("ThreadPooling"), std::string("Execute"), std::string("The single thread pool did not run on the caller! -PP6"));
+		}
+
+		// a private pool runs every job once and can be reused
+		Tools::ThreadPool pool4(4);
+
+		for (i = 0; i < 4; ++i)
+		{
+			ctr = 0;
+			pool4.Execute(JOBCNT, [&ctr](size_t)
+			{
+				ctr.fetch_add(1);
+			});
+
+			if (ctr != JOBCNT)
+			{
+				throw TestException(std::string("ThreadPooling"), std::string("Execute"), std::string("The pool did not run every job! -PP7"));
+			}
+		}
+
+		// nested calls and exceptions on the worker threads
+		ctr = 0;
+		pool4.Execute(8, [&ctr, &pool4](size_t)
+		{
+			pool4.Execute(8, [&ctr](size_t)
+			{
+				ctr.fetch_add(1);
+			});
+		});
+
+		if (ctr != 64)
+		{
+			throw TestException(std::string("ThreadPooling"), std::string("Execute"), std::string("The nested pool calls did not complete! -PP8"));
+		}
+
+		exc = false;
+		ctr = 0;
+
+		try
+		{
+			pool4.Execute(JOBCNT, [&ctr, JOBCNT](size_t Index)
+			{
+				ctr.fetch_add(1);
+
+				if (Index == JOBCNT - 1)
+				{
+					throw CryptoProcessingException(std::string("ParallelModeTest"), std::string("ThreadPooling"), std::string("Expected exception"), ErrorCodes::InvalidState);
+				}
+			});
+		}
+		catch (CryptoProcessingException const &)
+		{
+			exc = true;
+		}
+
+		if (exc == false || ctr != JOBCNT)
+		{
+			throw TestException(std::string("ThreadPooling"), std::string("Execute"), std::string("The worker exception was not propagated! -PP9"));
+		}
+	}
+
 	//~~~Private Functions~~~//
 
 	void ParallelModeTest::OnProgress(const std::string &Data)
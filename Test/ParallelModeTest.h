@@ -57,6 +57,16 @@ namespace Test
 		/// </summary>
 		std::string Run() override;
 
+		/// <summary>
+		/// Tests the parallel block size calibration profile; storage, persistence, and application to a cipher mode
+		/// </summary>
+		void Calibration();
+
+		/// <summary>
+		/// Tests the processor topology and the worker thread placement policies
+		/// </summary>
+		void Placement();
+
 		/// <summary>
 		/// Compares synchronous to parallel processed random-sized, pseudo-random array transformations and their inverse in a looping [TEST_CYCLES] stress-test
 		/// </summary>
@@ -73,6 +83,11 @@ namespace Test
 		/// <param name="Encryption">Test encryption or decryption output</param>
 		void Stress(ICipherMode* Cipher, bool Encryption);
 
+		/// <summary>
+		/// Tests the work-stealing thread pool used by ParallelTools; index coverage, chunked ranges, nested calls, and exception propagation
+		/// </summary>
+		void ThreadPooling();
+
 	private:
 
 		void OnProgress(const std::string &Data);
@@ -86,6 +86,13 @@ namespace Test
 		/// <param name="Generator">The mac generator instance</param>
 		void Params(IMac* Generator);
 
+		/// <summary>
+		/// Compare the pointer Update and Finalize functions with the vector functions over the same uneven input segments
+		/// </summary>
+		/// 
+		/// <param name="Generator">The mac generator instance</param>
+		void Pointer(IMac* Generator);
+
 		/// <summary>
 		/// Compare output between access functions Compute and Update/Finalize in a looping [TEST_CYCLES] stress-test
 		/// </summary>
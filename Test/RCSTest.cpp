@@ -78,6 +78,10 @@ namespace Test
 			Authentication(rcsa);
 			OnProgress(std::string("RCSTest: Passed RCS-256/512/1024 MAC authentication tests.."));
 
+			// test the shared key context and nonce-only initialization
+			Context(rcsa);
+			OnProgress(std::string("RCSTest: Passed RCS shared key context tests.."));
+
 			// test all exception handlers for correct operation
 			Exception();
 			OnProgress(std::string("RCSTest: Passed RCS-256/512/1024 exception handling tests.."));
@@ -108,6 +112,10 @@ namespace Test
 			Parallel(rcss);
 			OnProgress(std::string("RCSTest: Passed RCS-256/512/1024 parallel to sequential equivalence test.."));
 
+			// compare a transform from an unaligned seek position to the same slice of the full stream
+			Seek(rcss);
+			OnProgress(std::string("RCSTest: Passed RCS-256/512/1024 random-access seek tests.."));
+
 			// tests the cipher state serialization feature
 			Serialization();
 			OnProgress(std::string("RCSTest: Passed RCS state serialization test.."));
@@ -116,6 +124,10 @@ namespace Test
 			Stress(rcss);
 			OnProgress(std::string("RCSTest: Passed RCS-256/512/1024 stress tests.."));
 
+			Pointer(rcss);
+			Pointer(rcsa);
+			OnProgress(std::string("RCSTest: Passed RCS-256/512/1024 pointer and in-place transform tests.."));
+
 			// verify ciphertext output, decryption, and mac code generation
 			Verification(rcsa, m_message[0], m_key[0], m_nonce[0], m_expected[1], m_code[0]);
 			Verification(rcsa, m_message[1], m_key[1], m_nonce[0], m_expected[2], m_code[2]);
@@ -137,6 +149,10 @@ namespace Test
 				Authentication(acsa);
 				OnProgress(std::string("RCSTest: Passed ACS-256/512/1024 MAC authentication tests.."));
 
+				// test the shared key context and nonce-only initialization
+				Context(acsa);
+				OnProgress(std::string("RCSTest: Passed ACS shared key context tests.."));
+
 				// test 2 succesive finalization calls against mac output and expected ciphertext
 				Finalization(acsa, m_message[0], m_key[0], m_nonce[0], m_expected[1], m_code[0], m_code[1]);
 				Finalization(acsa, m_message[1], m_key[1], m_nonce[0], m_expected[2], m_code[2], m_code[3]);
@@ -163,10 +179,24 @@ namespace Test
 				Parallel(acss);
 				OnProgress(std::string("RCSTest: Passed ACS-256/512/1024 parallel to sequential equivalence test.."));
 
+				// compare a transform from an unaligned seek position to the same slice of the full stream
+				Seek(acss);
+				OnProgress(std::string("RCSTest: Passed ACS-256/512/1024 random-access seek tests.."));
+
+				// compare the staged counters and interleaved transforms to the rcs output
+				RCS* rcsr = new RCS(false);
+				Interleave(acss, rcsr);
+				delete rcsr;
+				OnProgress(std::string("RCSTest: Passed ACS-256/512/1024 multi-block counter equivalence tests.."));
+
 				// looping test of successful decryption with random keys and input
 				Stress(acss);
 				OnProgress(std::string("RCSTest: Passed ACS-256/512/1024 stress tests.."));
 
+				Pointer(acss);
+				Pointer(acsa);
+				OnProgress(std::string("RCSTest: Passed ACS-256/512/1024 pointer and in-place transform tests.."));
+
 				// verify ciphertext output, decryption, and mac code generation
 				Verification(acsa, m_message[0], m_key[0], m_nonce[0], m_expected[1], m_code[0]);
 				Verification(acsa, m_message[1], m_key[1], m_nonce[0], m_expected[2], m_code[2]);
@@ -245,6 +275,97 @@ namespace Test
 		}
 	}
 
+	template<typename T>
+	void RCSTest::Context(T* Cipher)
+	{
+		const size_t MSGLEN = 137;
+		std::vector<SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		std::vector<byte> cpt1;
+		std::vector<byte> cpt2;
+		std::vector<byte> cpt3;
+		std::vector<byte> key;
+		std::vector<byte> msg(MSGLEN);
+		std::vector<byte> nonce1;
+		std::vector<byte> nonce2;
+		std::vector<byte> plt(MSGLEN);
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < ks.size(); ++i)
+		{
+			key.resize(ks[i].KeySize());
+			nonce1.resize(ks[i].IVSize());
+			nonce2.resize(ks[i].IVSize());
+			rnd.Generate(key);
+			rnd.Generate(msg);
+			rnd.Generate(nonce1);
+			rnd.Generate(nonce2);
+
+			SymmetricKey kp1(key, nonce1);
+			SymmetricKey kp2(key, nonce2);
+			SymmetricKey kpn1(std::vector<byte>(0), nonce1);
+			SymmetricKey kpn2(std::vector<byte>(0), nonce2);
+			Cipher->Initialize(true, kp1);
+			// the tag size follows the key size
+			cpt1.resize(MSGLEN + Cipher->TagSize());
+			cpt2.resize(MSGLEN + Cipher->TagSize());
+			cpt3.resize(MSGLEN + Cipher->TagSize());
+
+			// two instances sharing the key schedule of the first, with different nonces
+			T cpr2(Cipher->Context());
+			T cpr3(Cipher->Context());
+			cpr2.Initialize(true, kpn1);
+			cpr3.Initialize(true, kpn2);
+
+			Cipher->Transform(msg, 0, cpt1, 0, msg.size());
+			cpr2.Transform(msg, 0, cpt2, 0, msg.size());
+
+			if (cpt1 != cpt2)
+			{
+				throw TestException(std::string("Context"), Cipher->Name(), std::string("Transformation output is not equal! -KC1"));
+			}
+
+			// a nonce-only initialization must match an independently keyed instance
+			T cpr4(true);
+			cpr4.Initialize(true, kp2);
+			cpr4.Transform(msg, 0, cpt1, 0, msg.size());
+			cpr3.Transform(msg, 0, cpt3, 0, msg.size());
+
+			if (cpt1 != cpt3)
+			{
+				throw TestException(std::string("Context"), Cipher->Name(), std::string("Transformation output is not equal! -KC2"));
+			}
+
+			// an instance bound to the context can not be re-keyed
+			try
+			{
+				cpr2.Initialize(true, kp2);
+
+				throw TestException(std::string("Context"), Cipher->Name(), std::string("Exception handling failure! -KC3"));
+			}
+			catch (CryptoSymmetricException const &)
+			{
+			}
+
+			// the shared context is unchanged; decrypt and authenticate with the other instances
+			cpr2.Initialize(false, kpn2);
+			cpr2.Transform(cpt3, 0, plt, 0, plt.size());
+
+			if (plt != msg)
+			{
+				throw TestException(std::string("Context"), Cipher->Name(), std::string("Decrypted output is not equal! -KC4"));
+			}
+
+			Cipher->Initialize(false, kpn2);
+			Cipher->Transform(cpt3, 0, plt, 0, plt.size());
+
+			if (plt != msg)
+			{
+				throw TestException(std::string("Context"), Cipher->Name(), std::string("Decrypted output is not equal! -KC5"));
+			}
+		}
+	}
+
 	void RCSTest::Exception()
 	{
 		// test serialized loading with invalid state
@@ -403,6 +524,58 @@ namespace Test
 		}
 	}
 
+	void RCSTest::Interleave(IStreamCipher* Cipher, IStreamCipher* Reference)
+	{
+		const size_t PRLLEN = Cipher->ParallelBlockSize();
+		std::vector<SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < ks.size(); ++i)
+		{
+			for (j = 0; j < 3 * TEST_CYCLES; ++j)
+			{
+				// a sequential length that cascades through every block tier, or a parallel length
+				const size_t MSGLEN = (j % 2 == 0) ? rnd.NextUInt32(2048, 1) : rnd.NextUInt32(static_cast<uint>(PRLLEN * 2), static_cast<uint>(PRLLEN));
+				std::vector<byte> cpt1(MSGLEN);
+				std::vector<byte> cpt2(MSGLEN);
+				std::vector<byte> inp(MSGLEN);
+				std::vector<byte> key(ks[i].KeySize());
+				std::vector<byte> nonce(ks[i].IVSize());
+
+				rnd.Generate(key, 0, key.size());
+				rnd.Generate(inp, 0, inp.size());
+				rnd.Generate(nonce, 0, nonce.size());
+
+				// the low 16 bytes of the nonce are the little-endian counter; start a few blocks before the low 64-bit word wraps,
+				// or with a sequential length, before the whole 128-bit counter wraps (the parallel offsets carry into the high nonce bytes)
+				if (j % 3 == 1 || (j % 3 == 2 && j % 2 == 0))
+				{
+					MemoryTools::SetValue(nonce, 0, (j % 3 == 1) ? 8 : 16, static_cast<byte>(0xFF));
+					nonce[0] = static_cast<byte>(0xFF - (j % 16));
+				}
+
+				SymmetricKey kp(key, nonce);
+
+				Cipher->Initialize(true, kp);
+				Cipher->ParallelProfile().IsParallel() = (j % 2 != 0);
+				Cipher->Transform(inp, 0, cpt1, 0, MSGLEN);
+
+				Reference->Initialize(true, kp);
+				Reference->ParallelProfile().IsParallel() = false;
+				Reference->Transform(inp, 0, cpt2, 0, MSGLEN);
+
+				if (cpt1 != cpt2)
+				{
+					throw TestException(std::string("Interleave"), Cipher->Name(), std::string("Cipher output is not equal to the reference output! -TI1"));
+				}
+			}
+		}
+
+		Cipher->ParallelProfile().IsParallel() = true;
+	}
+
 	void RCSTest::Kat(IStreamCipher* Cipher, std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<byte> &Expected)
 	{
 		const size_t CPTLEN = Cipher->IsAuthenticator() ? Message.size() + Key.size() : Message.size();
@@ -526,6 +699,135 @@ namespace Test
 		}
 	}
 
+	void RCSTest::Pointer(IStreamCipher* Cipher)
+	{
+		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		// the authenticated variants append the tag to the cipher-text
+		const size_t TAGLEN = Cipher->IsAuthenticator() ? Cipher->TagSize() : 0;
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Cipher->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> cpt;
+		std::vector<byte> exp;
+		std::vector<byte> inp;
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<byte> otp;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			exp.resize(MSGLEN[i] + TAGLEN);
+			inp.resize(MSGLEN[i]);
+			otp.resize(MSGLEN[i]);
+
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(inp, 0, inp.size());
+			rnd.Generate(nonce, 0, nonce.size());
+			SymmetricKey kp(key, nonce);
+
+			// the vector transform is the reference
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp, 0, exp, 0, inp.size());
+
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer encryption output is not equal! -TX1"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), otp.data(), otp.size());
+
+			if (otp != inp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer decryption output is not equal! -TX2"));
+			}
+
+			// in-place, the buffer holds the message and the tag
+			cpt = inp;
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place encryption output is not equal! -TX3"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (IntegerTools::Compare(cpt, 0, inp, 0, inp.size()) == false)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place decryption output is not equal! -TX4"));
+			}
+		}
+	}
+
+	template<typename T>
+	void RCSTest::Seek(T* Cipher)
+	{
+		const size_t MSGLEN = static_cast<size_t>(SecureRandom().NextUInt32(MAXM_ALLOC, 1024));
+		std::vector<SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		std::vector<byte> exp(MSGLEN);
+		std::vector<byte> inp(MSGLEN);
+		std::vector<byte> key;
+		std::vector<byte> nonce;
+		std::vector<byte> otp(MSGLEN);
+		T cpra(true);
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+
+		rnd.Generate(inp);
+
+		for (i = 0; i < ks.size(); ++i)
+		{
+			key.resize(ks[i].KeySize());
+			nonce.resize(ks[i].IVSize());
+			rnd.Generate(key);
+			rnd.Generate(nonce);
+			SymmetricKey kp(key, nonce);
+
+			// the reference stream, processed from the start
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp, 0, exp, 0, MSGLEN);
+
+			for (j = 0; j < TEST_CYCLES; ++j)
+			{
+				// an odd position is never block aligned, the length is random
+				const size_t POS = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(MSGLEN - 2), 0)) | 1;
+				const size_t LEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(MSGLEN - POS), 1));
+
+				Cipher->Initialize(true, kp);
+				Cipher->Seek(POS);
+				Cipher->Transform(inp, POS, otp, 0, LEN);
+
+				if (IntegerTools::Compare(otp, 0, exp, POS, LEN) == false)
+				{
+					throw TestException(std::string("Seek"), Cipher->Name(), std::string("The seek output is not equal! -KS1"));
+				}
+			}
+
+			// the mac covers the message in order, an authenticated instance can not seek
+			cpra.Initialize(true, kp);
+
+			try
+			{
+				cpra.Seek(1);
+
+				throw TestException(std::string("Seek"), cpra.Name(), std::string("Exception handling failure! -KS2"));
+			}
+			catch (CryptoSymmetricException const &)
+			{
+			}
+		}
+	}
+
 	void RCSTest::Sequential(IStreamCipher* Cipher, const std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce,
 		const std::vector<byte> &Output1, const std::vector<byte> &Output2, const std::vector<byte> &Output3)
 	{
@@ -650,6 +952,19 @@ namespace Test
 		{
 			throw TestException(std::string("Serialization"), cpr1.Name(), std::string("Transformation output is not equal! -SS2"));
 		}
+
+		// a state without the trailing seek origin and offset was serialized by an earlier version, and is rejected
+		sta1.resize(sta1.size() - (sizeof(ushort) + ks.IVSize() + sizeof(ulong)));
+
+		try
+		{
+			RCS cpr4(sta1);
+
+			throw TestException(std::string("Serialization"), cpr1.Name(), std::string("Exception handling failure! -SS3"));
+		}
+		catch (CryptoSymmetricException const &)
+		{
+		}
 	}
 
 	void RCSTest::Stress(IStreamCipher* Cipher)
@@ -85,6 +85,14 @@ namespace Test
 		/// <param name="Cipher">The authenticated cipher instance pointer</param>
 		void Authentication(IStreamCipher* Cipher);
 
+		/// <summary>
+		/// Tests two instances sharing a key context against an independently keyed instance, and rejection of a keyed re-initialization
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The authenticated cipher instance pointer</param>
+		template<typename T>
+		void Context(T* Cipher);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
@@ -103,6 +111,15 @@ namespace Test
 		/// <param name="MacCode2">The second expected Mac code array</param>
 		void Finalization(IStreamCipher* Cipher, std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<byte> &Expected, std::vector<byte> &MacCode1, std::vector<byte> &MacCode2);
 
+		/// <summary>
+		/// Compare the interleaved multi-block output to a reference implementation, using random lengths,
+		/// and counters that carry across the 64-bit and 128-bit boundaries
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher instance pointer</param>
+		/// <param name="Reference">The reference cipher instance pointer</param>
+		void Interleave(IStreamCipher* Cipher, IStreamCipher* Reference);
+
 		/// <summary>
 		/// Compare known answer test vectors to cipher output
 		/// </summary>
@@ -132,6 +149,21 @@ namespace Test
 		/// <param name="Cipher">The cipher instance pointer</param>
 		void Parallel(IStreamCipher* Cipher);
 
+		/// <summary>
+		/// Compare the pointer transform, including in-place operation, with the vector transform
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Pointer(IStreamCipher* Cipher);
+
+		/// <summary>
+		/// Compare a transform that starts at an unaligned Seek position to the same slice of a full transform, and test that an authenticated instance rejects Seek
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The unauthenticated cipher instance pointer</param>
+		template<typename T>
+		void Seek(T* Cipher);
+
 		/// <summary>
 		/// Tests the the ciphers state serialization function
 		/// </summary>
@@ -106,6 +106,10 @@ namespace Test
 			Parallel(rwss);
 			OnProgress(std::string("RWSTest: Passed RWS-256/512/1024 parallel to sequential equivalence test.."));
 
+			// compare the interleaved multi-block transforms to single block calls
+			Interleave(rwss);
+			OnProgress(std::string("RWSTest: Passed RWS-256/512/1024 multi-block equivalence tests.."));
+
 			// tests the cipher state serialization feature
 			Serialization();
 			OnProgress(std::string("RWSTest: Passed RWS state serialization test.."));
@@ -114,6 +118,10 @@ namespace Test
 			Stress(rwss);
 			OnProgress(std::string("RWSTest: Passed RWS-256/512/1024 stress tests.."));
 
+			Pointer(rwss);
+			Pointer(rwsa);
+			OnProgress(std::string("RWSTest: Passed RWS-256/512/1024 pointer and in-place transform tests.."));
+
 			// verify ciphertext output, decryption, and mac code generation
 			Verification(rwsa, m_message[0], m_key[0], m_nonce[0], m_expected[1], m_code[0]);
 			Verification(rwsa, m_message[1], m_key[1], m_nonce[0], m_expected[2], m_code[2]);
@@ -349,6 +357,67 @@ namespace Test
 		}
 	}
 
+	void RWSTest::Interleave(IStreamCipher* Cipher)
+	{
+		const size_t PRLLEN = Cipher->ParallelBlockSize();
+		std::vector<SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t k;
+
+		for (i = 0; i < ks.size(); ++i)
+		{
+			// the nonce size is the cipher block size
+			const size_t BLKLEN = ks[i].IVSize();
+
+			for (j = 0; j < 3 * TEST_CYCLES; ++j)
+			{
+				// a sequential length that cascades through every block tier, or a parallel length
+				const size_t MSGLEN = (j % 2 == 0) ? rnd.NextUInt32(4096, 1) : rnd.NextUInt32(static_cast<uint>(PRLLEN * 2), static_cast<uint>(PRLLEN));
+				std::vector<byte> cpt1(MSGLEN);
+				std::vector<byte> cpt2(MSGLEN);
+				std::vector<byte> inp(MSGLEN);
+				std::vector<byte> key(ks[i].KeySize());
+				std::vector<byte> nonce(BLKLEN);
+
+				rnd.Generate(key, 0, key.size());
+				rnd.Generate(inp, 0, inp.size());
+				rnd.Generate(nonce, 0, nonce.size());
+
+				// the low 16 bytes of the nonce are the little-endian counter; start a few blocks before the low 64-bit word wraps,
+				// or with a sequential length, before the whole 128-bit counter wraps (the parallel offsets carry into the high nonce bytes)
+				if (j % 3 == 1 || (j % 3 == 2 && j % 2 == 0))
+				{
+					MemoryTools::SetValue(nonce, 0, (j % 3 == 1) ? 8 : 16, static_cast<byte>(0xFF));
+					nonce[0] = static_cast<byte>(0xFF - (j % 16));
+				}
+
+				SymmetricKey kp(key, nonce);
+
+				Cipher->Initialize(true, kp);
+				Cipher->ParallelProfile().IsParallel() = (j % 2 != 0);
+				Cipher->Transform(inp, 0, cpt1, 0, MSGLEN);
+
+				// one block per call
+				Cipher->Initialize(true, kp);
+				Cipher->ParallelProfile().IsParallel() = false;
+
+				for (k = 0; k < MSGLEN; k += BLKLEN)
+				{
+					Cipher->Transform(inp, k, cpt2, k, IntegerTools::Min(BLKLEN, MSGLEN - k));
+				}
+
+				if (cpt1 != cpt2)
+				{
+					throw TestException(std::string("Interleave"), Cipher->Name(), std::string("Cipher output is not equal to the single block output! -TI1"));
+				}
+			}
+		}
+
+		Cipher->ParallelProfile().IsParallel() = true;
+	}
+
 	void RWSTest::Kat(IStreamCipher* Cipher, std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<byte> &Expected)
 	{
 		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
@@ -474,6 +543,75 @@ namespace Test
 		}
 	}
 
+	void RWSTest::Pointer(IStreamCipher* Cipher)
+	{
+		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		// the authenticated variants append the tag to the cipher-text
+		const size_t TAGLEN = Cipher->IsAuthenticator() ? Cipher->TagSize() : 0;
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Cipher->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> cpt;
+		std::vector<byte> exp;
+		std::vector<byte> inp;
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<byte> otp;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			exp.resize(MSGLEN[i] + TAGLEN);
+			inp.resize(MSGLEN[i]);
+			otp.resize(MSGLEN[i]);
+
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(inp, 0, inp.size());
+			rnd.Generate(nonce, 0, nonce.size());
+			SymmetricKey kp(key, nonce);
+
+			// the vector transform is the reference
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp, 0, exp, 0, inp.size());
+
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer encryption output is not equal! -TX1"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), otp.data(), otp.size());
+
+			if (otp != inp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer decryption output is not equal! -TX2"));
+			}
+
+			// in-place, the buffer holds the message and the tag
+			cpt = inp;
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place encryption output is not equal! -TX3"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (IntegerTools::Compare(cpt, 0, inp, 0, inp.size()) == false)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place decryption output is not equal! -TX4"));
+			}
+		}
+	}
+
 	void RWSTest::Sequential(IStreamCipher* Cipher, const std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce,
 		const std::vector<byte> &Output1, const std::vector<byte> &Output2, const std::vector<byte> &Output3)
 	{
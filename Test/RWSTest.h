@@ -109,6 +109,14 @@ namespace Test
 		/// <param name="MacCode2">The second expected Mac code array</param>
 		void Finalization(IStreamCipher* Cipher, std::vector<byte> &Message, std::vector<byte> &Key, std::vector<byte> &Nonce, std::vector<byte> &Expected, std::vector<byte> &MacCode1, std::vector<byte> &MacCode2);
 
+		/// <summary>
+		/// Compare the interleaved multi-block output to the same message transformed one block per call, using random lengths,
+		/// and counters that carry across the 64-bit and 128-bit boundaries
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Interleave(IStreamCipher* Cipher);
+
 		/// <summary>
 		/// Compare known answer test vectors to cipher output
 		/// </summary>
@@ -138,6 +146,13 @@ namespace Test
 		/// <param name="Cipher">The cipher instance pointer</param>
 		void Parallel(IStreamCipher* Cipher);
 
+		/// <summary>
+		/// Compare the pointer transform, including in-place operation, with the vector transform
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Pointer(IStreamCipher* Cipher);
+
 		/// <summary>
 		/// Tests the the ciphers state serialization function
 		/// </summary>
@@ -94,40 +94,39 @@ namespace Test
 				Kat(cpr5, m_keys[28], m_plainText[0], m_cipherText[30]);
 				delete cpr5;
 			}
-			else
 #endif
-			{
-				RHX* cpr1 = new RHX();
-				Kat(cpr1, m_keys[0], m_plainText[0], m_cipherText[0]);
-				Kat(cpr1, m_keys[1], m_plainText[1], m_cipherText[1]);
-				Kat(cpr1, m_keys[2], m_plainText[2], m_cipherText[2]);
-				Kat(cpr1, m_keys[3], m_plainText[3], m_cipherText[3]);
-				Kat(cpr1, m_keys[4], m_plainText[4], m_cipherText[4]);
-				Kat(cpr1, m_keys[5], m_plainText[5], m_cipherText[5]);
-				Kat(cpr1, m_keys[6], m_plainText[6], m_cipherText[6]);
-				Kat(cpr1, m_keys[7], m_plainText[7], m_cipherText[7]);
-				Kat(cpr1, m_keys[8], m_plainText[8], m_cipherText[8]);
-				Kat(cpr1, m_keys[9], m_plainText[9], m_cipherText[9]);
-				Kat(cpr1, m_keys[10], m_plainText[10], m_cipherText[10]);
-				Kat(cpr1, m_keys[11], m_plainText[11], m_cipherText[11]);
-				Kat(cpr1, m_keys[12], m_plainText[12], m_cipherText[12]);
-				Kat(cpr1, m_keys[13], m_plainText[12], m_cipherText[13]);
-				Kat(cpr1, m_keys[14], m_plainText[12], m_cipherText[14]);
-				delete cpr1;
 
-				RHX* cpr2 = new RHX(BlockCipherExtensions::HKDF256);
-				Kat(cpr2, m_keys[27], m_plainText[0], m_cipherText[27]);
-				delete cpr2;
-				RHX* cpr3 = new RHX(BlockCipherExtensions::HKDF512);
-				Kat(cpr3, m_keys[28], m_plainText[0], m_cipherText[28]);
-				delete cpr3;
-				RHX* cpr4 = new RHX(BlockCipherExtensions::SHAKE256);
-				Kat(cpr4, m_keys[27], m_plainText[0], m_cipherText[29]);
-				delete cpr4;
-				RHX* cpr5 = new RHX(BlockCipherExtensions::SHAKE512);
-				Kat(cpr5, m_keys[28], m_plainText[0], m_cipherText[30]);
-				delete cpr5;
-			}
+			// the vector permute rounds are used by RHX on SSSE3 builds, so RHX is tested with or without AES-NI
+			RHX* rhx1 = new RHX();
+			Kat(rhx1, m_keys[0], m_plainText[0], m_cipherText[0]);
+			Kat(rhx1, m_keys[1], m_plainText[1], m_cipherText[1]);
+			Kat(rhx1, m_keys[2], m_plainText[2], m_cipherText[2]);
+			Kat(rhx1, m_keys[3], m_plainText[3], m_cipherText[3]);
+			Kat(rhx1, m_keys[4], m_plainText[4], m_cipherText[4]);
+			Kat(rhx1, m_keys[5], m_plainText[5], m_cipherText[5]);
+			Kat(rhx1, m_keys[6], m_plainText[6], m_cipherText[6]);
+			Kat(rhx1, m_keys[7], m_plainText[7], m_cipherText[7]);
+			Kat(rhx1, m_keys[8], m_plainText[8], m_cipherText[8]);
+			Kat(rhx1, m_keys[9], m_plainText[9], m_cipherText[9]);
+			Kat(rhx1, m_keys[10], m_plainText[10], m_cipherText[10]);
+			Kat(rhx1, m_keys[11], m_plainText[11], m_cipherText[11]);
+			Kat(rhx1, m_keys[12], m_plainText[12], m_cipherText[12]);
+			Kat(rhx1, m_keys[13], m_plainText[12], m_cipherText[13]);
+			Kat(rhx1, m_keys[14], m_plainText[12], m_cipherText[14]);
+			delete rhx1;
+
+			RHX* rhx2 = new RHX(BlockCipherExtensions::HKDF256);
+			Kat(rhx2, m_keys[27], m_plainText[0], m_cipherText[27]);
+			delete rhx2;
+			RHX* rhx3 = new RHX(BlockCipherExtensions::HKDF512);
+			Kat(rhx3, m_keys[28], m_plainText[0], m_cipherText[28]);
+			delete rhx3;
+			RHX* rhx4 = new RHX(BlockCipherExtensions::SHAKE256);
+			Kat(rhx4, m_keys[27], m_plainText[0], m_cipherText[29]);
+			delete rhx4;
+			RHX* rhx5 = new RHX(BlockCipherExtensions::SHAKE512);
+			Kat(rhx5, m_keys[28], m_plainText[0], m_cipherText[30]);
+			delete rhx5;
 
 			OnProgress(std::string("RijndaelTest: Passed Rijndael FIPS 197 KAT tests.."));
 
@@ -162,39 +161,60 @@ namespace Test
 				MonteCarlo(cpr5, m_keys[28], m_plainText[0], m_cipherText[34]);
 				delete cpr5;
 			}
-			else
 #endif
+
+			rhx1 = new RHX();
+			MonteCarlo(rhx1, m_keys[15], m_plainText[13], m_cipherText[15]);
+			MonteCarlo(rhx1, m_keys[16], m_plainText[14], m_cipherText[16]);
+			MonteCarlo(rhx1, m_keys[17], m_plainText[15], m_cipherText[17]);
+			MonteCarlo(rhx1, m_keys[18], m_plainText[16], m_cipherText[18]);
+			MonteCarlo(rhx1, m_keys[19], m_plainText[17], m_cipherText[19]);
+			MonteCarlo(rhx1, m_keys[20], m_plainText[18], m_cipherText[20]);
+			MonteCarlo(rhx1, m_keys[21], m_plainText[19], m_cipherText[21]);
+			MonteCarlo(rhx1, m_keys[22], m_plainText[20], m_cipherText[22]);
+			MonteCarlo(rhx1, m_keys[23], m_plainText[21], m_cipherText[23]);
+			MonteCarlo(rhx1, m_keys[24], m_plainText[22], m_cipherText[24]);
+			MonteCarlo(rhx1, m_keys[25], m_plainText[23], m_cipherText[25]);
+			MonteCarlo(rhx1, m_keys[26], m_plainText[24], m_cipherText[26]);
+			delete rhx1;
+
+			rhx2 = new RHX(BlockCipherExtensions::HKDF256);
+			MonteCarlo(rhx2, m_keys[27], m_plainText[0], m_cipherText[31]);
+			delete rhx2;
+			rhx3 = new RHX(BlockCipherExtensions::HKDF512);
+			MonteCarlo(rhx3, m_keys[28], m_plainText[0], m_cipherText[32]);
+			delete rhx3;
+			rhx4 = new RHX(BlockCipherExtensions::SHAKE256);
+			MonteCarlo(rhx4, m_keys[27], m_plainText[0], m_cipherText[33]);
+			delete rhx4;
+			rhx5 = new RHX(BlockCipherExtensions::SHAKE512);
+			MonteCarlo(rhx5, m_keys[28], m_plainText[0], m_cipherText[34]);
+			delete rhx5;
+
+			OnProgress(std::string("RijndaelTest: Passed Rijndael extended Monte Carlo tests.."));
+
+#if defined(__AVX__)
+			if (m_aesniTest)
 			{
-				RHX* cpr1 = new RHX();
-				MonteCarlo(cpr1, m_keys[15], m_plainText[13], m_cipherText[15]);
-				MonteCarlo(cpr1, m_keys[16], m_plainText[14], m_cipherText[16]);
-				MonteCarlo(cpr1, m_keys[17], m_plainText[15], m_cipherText[17]);
-				MonteCarlo(cpr1, m_keys[18], m_plainText[16], m_cipherText[18]);
-				MonteCarlo(cpr1, m_keys[19], m_plainText[17], m_cipherText[19]);
-				MonteCarlo(cpr1, m_keys[20], m_plainText[18], m_cipherText[20]);
-				MonteCarlo(cpr1, m_keys[21], m_plainText[19], m_cipherText[21]);
-				MonteCarlo(cpr1, m_keys[22], m_plainText[20], m_cipherText[22]);
-				MonteCarlo(cpr1, m_keys[23], m_plainText[21], m_cipherText[23]);
-				MonteCarlo(cpr1, m_keys[24], m_plainText[22], m_cipherText[24]);
-				MonteCarlo(cpr1, m_keys[25], m_plainText[23], m_cipherText[25]);
-				MonteCarlo(cpr1, m_keys[26], m_plainText[24], m_cipherText[26]);
+				AHX* cpr1 = new AHX();
+				Interleave(cpr1);
 				delete cpr1;
-
-				RHX* cpr2 = new RHX(BlockCipherExtensions::HKDF256);
-				MonteCarlo(cpr2, m_keys[27], m_plainText[0], m_cipherText[31]);
+				AHX* cpr2 = new AHX(BlockCipherExtensions::SHAKE512);
+				Interleave(cpr2);
 				delete cpr2;
-				RHX* cpr3 = new RHX(BlockCipherExtensions::HKDF512);
-				MonteCarlo(cpr3, m_keys[28], m_plainText[0], m_cipherText[32]);
-				delete cpr3;
-				RHX* cpr4 = new RHX(BlockCipherExtensions::SHAKE256);
-				MonteCarlo(cpr4, m_keys[27], m_plainText[0], m_cipherText[33]);
-				delete cpr4;
-				RHX* cpr5 = new RHX(BlockCipherExtensions::SHAKE512);
-				MonteCarlo(cpr5, m_keys[28], m_plainText[0], m_cipherText[34]);
-				delete cpr5;
+
+				OnProgress(std::string("RijndaelTest: Passed AES-NI 4, 8 and 16 block interleave equivalence tests.."));
 			}
+#endif
 
-			OnProgress(std::string("RijndaelTest: Passed Rijndael extended Monte Carlo tests.."));
+			rhx1 = new RHX();
+			Interleave(rhx1);
+			delete rhx1;
+			rhx5 = new RHX(BlockCipherExtensions::SHAKE512);
+			Interleave(rhx5);
+			delete rhx5;
+
+			OnProgress(std::string("RijndaelTest: Passed Rijndael 4, 8 and 16 block interleave equivalence tests.."));
 
 			if (m_aesniTest)
 			{
@@ -255,6 +275,67 @@ namespace Test
 		}
 	}
 
+	void RijndaelTest::Interleave(IBlockCipher* Cipher)
+	{
+		const size_t BLKLEN = Cipher->BlockSize();
+		const size_t MSGLEN = 16 * BLKLEN;
+		std::vector<Cipher::SymmetricKeySize> ks = Cipher->LegalKeySizes();
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			// alternate encryption and decryption, and shift the blocks off the 16 byte boundary
+			const bool ENCRYPT = (i % 2 == 0);
+			const size_t OFFSET = i % BLKLEN;
+			std::vector<byte> inp(OFFSET + MSGLEN);
+			std::vector<byte> key(ks[(i / 2) % ks.size()].KeySize());
+			std::vector<byte> otp1(OFFSET + MSGLEN, 0x00);
+			std::vector<byte> otp2(OFFSET + MSGLEN, 0x00);
+			std::vector<byte> otp3(OFFSET + MSGLEN, 0x00);
+			std::vector<byte> otp4(OFFSET + MSGLEN, 0x00);
+
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(inp, 0, inp.size());
+			SymmetricKey kp(key);
+
+			Cipher->Initialize(ENCRYPT, kp);
+
+			for (j = 0; j < MSGLEN; j += BLKLEN)
+			{
+				Cipher->Transform(inp, OFFSET + j, otp1, OFFSET + j);
+			}
+
+			for (j = 0; j < MSGLEN; j += 4 * BLKLEN)
+			{
+				Cipher->Transform512(inp, OFFSET + j, otp2, OFFSET + j);
+			}
+
+			if (otp2 != otp1)
+			{
+				throw TestException(std::string("Interleave"), Cipher->Name(), std::string("The 4 block transform is not equal to the single block transform! -RI1"));
+			}
+
+			for (j = 0; j < MSGLEN; j += 8 * BLKLEN)
+			{
+				Cipher->Transform1024(inp, OFFSET + j, otp3, OFFSET + j);
+			}
+
+			if (otp3 != otp1)
+			{
+				throw TestException(std::string("Interleave"), Cipher->Name(), std::string("The 8 block transform is not equal to the single block transform! -RI2"));
+			}
+
+			Cipher->Transform2048(inp, OFFSET, otp4, OFFSET);
+
+			if (otp4 != otp1)
+			{
+				throw TestException(std::string("Interleave"), Cipher->Name(), std::string("The 16 block transform is not equal to the single block transform! -RI3"));
+			}
+		}
+	}
+
 	void RijndaelTest::Kat(IBlockCipher* Cipher, std::vector<byte> &Key, std::vector<byte> &Message, std::vector<byte> &Expected)
 	{
 		const size_t MSGLEN = Message.size();
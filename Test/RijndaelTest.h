@@ -73,6 +73,13 @@ namespace Test
 		/// </summary>
 		void Exception();
 
+		/// <summary>
+		/// Compare the 4, 8, and 16 block transforms to the single block transform, with random keys, input, and unaligned offsets
+		/// </summary>
+		/// 
+		/// <param name="Cipher">The cipher instance pointer</param>
+		void Interleave(IBlockCipher* Cipher);
+
 		/// <summary>
 		/// Compare known answer test vectors to authenticated and standard cipher output
 		/// </summary>
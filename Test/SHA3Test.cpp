@@ -99,12 +99,30 @@ namespace Test
 
 			Stress(dgt256s);
 			OnProgress(std::string("SHA3Test: Passed SHA3-256 sequential stress tests.."));
+			Pointer(dgt256s);
+			OnProgress(std::string("SHA3Test: Passed SHA3-256 sequential pointer update and finalize tests.."));
+			Midstate(dgt256s);
+			OnProgress(std::string("SHA3Test: Passed SHA3-256 sequential midstate serialization tests.."));
 
 			Stress(dgt512s);
 			OnProgress(std::string("SHA3Test: Passed SHA3-512 sequential stress tests.."));
+			Pointer(dgt512s);
+			OnProgress(std::string("SHA3Test: Passed SHA3-512 sequential pointer update and finalize tests.."));
+			Midstate(dgt512s);
+			OnProgress(std::string("SHA3Test: Passed SHA3-512 sequential midstate serialization tests.."));
 
 			Stress(dgt1024s);
 			OnProgress(std::string("SHA3Test: Passed Keccak-1024 sequential stress tests.."));
+			Pointer(dgt1024s);
+			OnProgress(std::string("SHA3Test: Passed Keccak-1024 sequential pointer update and finalize tests.."));
+			Midstate(dgt1024s);
+			OnProgress(std::string("SHA3Test: Passed Keccak-1024 sequential midstate serialization tests.."));
+
+			Batch(dgt256s);
+			OnProgress(std::string("SHA3Test: Passed SHA3-256 batch hashing tests.."));
+
+			Batch(dgt512s);
+			OnProgress(std::string("SHA3Test: Passed SHA3-512 batch hashing tests.."));
 
 			delete dgt256s;
 			delete dgt512s;
@@ -113,14 +131,26 @@ namespace Test
 			SHA3256* dgt256p = new SHA3256(true);
 			Stress(dgt256p);
 			OnProgress(std::string("SHA3Test: Passed SHA3-256 parallel stress tests.."));
+			Pointer(dgt256p);
+			OnProgress(std::string("SHA3Test: Passed SHA3-256 parallel pointer update and finalize tests.."));
+			Midstate(dgt256p);
+			OnProgress(std::string("SHA3Test: Passed SHA3-256 parallel midstate serialization tests.."));
 
 			SHA3512* dgt512p = new SHA3512(true);
 			Stress(dgt512p);
 			OnProgress(std::string("SHA3Test: Passed SHA3-512 parallel stress tests.."));
+			Pointer(dgt512p);
+			OnProgress(std::string("SHA3Test: Passed SHA3-512 parallel pointer update and finalize tests.."));
+			Midstate(dgt512p);
+			OnProgress(std::string("SHA3Test: Passed SHA3-512 parallel midstate serialization tests.."));
 
 			SHA31024* dgt1024p = new SHA31024(true);
 			Stress(dgt1024p);
 			OnProgress(std::string("SHA3Test: Passed Keccak-1024 parallel stress tests.."));
+			Pointer(dgt1024p);
+			OnProgress(std::string("SHA3Test: Passed Keccak-1024 parallel pointer update and finalize tests.."));
+			Midstate(dgt1024p);
+			OnProgress(std::string("SHA3Test: Passed Keccak-1024 parallel midstate serialization tests.."));
 
 			Parallel(dgt256p);
 			OnProgress(std::string("SHA3Test: Passed SHA3-256 parallel tests.."));
@@ -195,6 +225,45 @@ namespace Test
 		}
 	}
 
+	template<typename T>
+	void SHA3Test::Batch(T* Digest)
+	{
+		const size_t MAXSMP = 4096;
+		const size_t MSGCNT = 41;
+		std::vector<std::vector<byte>> codes;
+		std::vector<std::vector<byte>> msgs(MSGCNT);
+		std::vector<byte> code(Digest->DigestSize());
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			// lengths on either side of the padding block boundary, then random lengths
+			const size_t INPLEN = (i < 16) ? Digest->BlockSize() + i - 10 : static_cast<size_t>(rnd.NextUInt32(MAXSMP, 0));
+			msgs[i].resize(INPLEN);
+			rnd.Generate(msgs[i], 0, msgs[i].size());
+		}
+
+		try
+		{
+			Digest->Compute(msgs, codes);
+		}
+		catch (const std::exception&)
+		{
+			throw TestException(std::string("Batch"), Digest->Name(), std::string("The digest has thrown an exception! -KB1"));
+		}
+
+		for (i = 0; i < MSGCNT; ++i)
+		{
+			Digest->Compute(msgs[i], code);
+
+			if (codes[i] != code)
+			{
+				throw TestException(std::string("Batch"), Digest->Name(), std::string("Hash output is not equal! -KB2"));
+			}
+		}
+	}
+
 	void SHA3Test::Exception()
 	{
 		// test params constructor SHA3256
@@ -313,6 +382,67 @@ namespace Test
 		}
 	}
 
+	void SHA3Test::Midstate(IDigest* Digest)
+	{
+		const uint MINPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize());
+		const uint MAXPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize() * 4);
+
+		std::vector<byte> code1(Digest->DigestSize());
+		std::vector<byte> code2(Digest->DigestSize());
+		std::vector<byte> msg;
+		SecureVector<byte> state;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			const size_t INPLEN = static_cast<size_t>(rnd.NextUInt32(MAXPRL, MINPRL));
+			const size_t PRELEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(INPLEN), 1));
+
+			msg.resize(INPLEN);
+			rnd.Generate(msg, 0, msg.size());
+
+			try
+			{
+				Digest->Compute(msg, code1);
+				// save the state after the prefix, then overwrite it
+				Digest->Update(msg, 0, PRELEN);
+				state = Digest->Serialize();
+				Digest->Update(msg, 0, msg.size());
+				// restore the state and finish the message
+				Digest->DeSerialize(state);
+				Digest->Update(msg, PRELEN, msg.size() - PRELEN);
+				Digest->Finalize(code2, 0);
+			}
+			catch (const std::exception&)
+			{
+				throw TestException(std::string("Midstate"), Digest->Name(), std::string("The digest has thrown an exception! -KM1"));
+			}
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Midstate"), Digest->Name(), std::string("Hash output is not equal! -KM2"));
+			}
+		}
+
+		// a truncated state must be rejected
+		try
+		{
+			state = Digest->Serialize();
+			state.resize(state.size() - 1);
+			Digest->DeSerialize(state);
+
+			throw TestException(std::string("Midstate"), Digest->Name(), std::string("Exception handling failure! -KM3"));
+		}
+		catch (CryptoDigestException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+	}
+
 	void SHA3Test::Parallel(IDigest* Digest)
 	{
 		const size_t MINSMP = 2048;
@@ -374,6 +504,18 @@ namespace Test
 			throw TestException(std::string("PermutationR24"), std::string("PermuteR24P1600"), std::string("Permutation output is not equal!"));
 		}
 
+#if defined(__AVX2__)
+
+		MemoryTools::Clear(state2, 0, 25 * sizeof(ulong));
+		Keccak::PermuteR24P1600V(state2);
+
+		if (state1 != state2)
+		{
+			throw TestException(std::string("PermutationR24"), std::string("PermuteR24P1600V"), std::string("Permutation output is not equal!"));
+		}
+
+#endif
+
 #if defined(__AVX512__)
 
 		std::vector<ULong512> state512(25, ULong512(0));
@@ -427,6 +569,18 @@ namespace Test
 			throw TestException(std::string("PermutationR48"), std::string("PermuteR48P1600"), std::string("Permutation output is not equal!"));
 		}
 
+#if defined(__AVX2__)
+
+		MemoryTools::Clear(state2, 0, 25 * sizeof(ulong));
+		Keccak::PermuteR48P1600V(state2);
+
+		if (state1 != state2)
+		{
+			throw TestException(std::string("PermutationR48"), std::string("PermuteR48P1600V"), std::string("Permutation output is not equal!"));
+		}
+
+#endif
+
 #if defined(__AVX512__)
 
 		std::vector<ULong512> state512(25, ULong512(0));
@@ -464,6 +618,62 @@ namespace Test
 #endif
 	}
 
+	void SHA3Test::Pointer(IDigest* Digest)
+	{
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Digest->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> code1(Digest->DigestSize());
+		std::vector<byte> code2(Digest->DigestSize());
+		std::vector<byte> msg;
+		std::vector<size_t> seg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t moff;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			rnd.Generate(msg, 0, msg.size());
+
+			// uneven segments exercise the input buffering
+			seg.clear();
+			moff = 0;
+
+			while (moff != msg.size())
+			{
+				seg.push_back(IntegerTools::Min(static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(Digest->BlockSize() * 3), 1)), msg.size() - moff));
+				moff += seg.back();
+			}
+
+			// the vector functions are the reference
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Digest->Update(msg, moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Digest->Finalize(code1, 0);
+
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Digest->Update(msg.data() + moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Digest->Finalize(code2.data());
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Pointer"), Digest->Name(), std::string("The pointer hash output is not equal! -SX1"));
+			}
+		}
+	}
+
 	void SHA3Test::Stress(IDigest* Digest)
 	{
 		const uint MINPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize());
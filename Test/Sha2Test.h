@@ -65,6 +65,14 @@ namespace Test
 		/// </summary>
 		void Ancillary();
 
+		/// <summary>
+		/// Compare the batch Compute output of randomly sized, pseudo-random messages to the sequential Compute output
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		template<typename T>
+		void Batch(T* Digest);
+
 		/// <summary>
 		/// Test exception handlers for correct execution
 		/// </summary>
@@ -79,6 +87,13 @@ namespace Test
 		/// <param name="Expected">The expected output vector</param>
 		void Kat(IDigest* Digest, std::vector<byte> &Input, std::vector<byte> &Expected);
 
+		/// <summary>
+		/// Compare the output of a message hashed in two parts, with the state serialized and restored between the parts, to the output of a single pass
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		void Midstate(IDigest* Digest);
+
 		/// <summary>
 		/// Compares synchronous to parallel random-sized, pseudo-random arrays in a looping [TEST_CYCLES] stress-test
 		/// </summary>
@@ -96,6 +111,13 @@ namespace Test
 		/// </summary>
 		void PermutationR80();
 
+		/// <summary>
+		/// Compare the pointer Update and Finalize functions with the vector functions over the same uneven input segments
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		void Pointer(IDigest* Digest);
+
 		/// <summary>
 		/// Test behavior parallel and sequential processing in a looping [TEST_CYCLES] stress-test using randomly sized input and data
 		/// </summary>
@@ -100,30 +100,56 @@ namespace Test
 
 			Stress(dgt256s);
 			OnProgress(std::string("SkeinTest: Passed Skein-256 sequential stress tests.."));
+			Pointer(dgt256s);
+			OnProgress(std::string("SkeinTest: Passed Skein-256 sequential pointer update and finalize tests.."));
+			Midstate(dgt256s);
+			OnProgress(std::string("SkeinTest: Passed Skein-256 sequential midstate serialization tests.."));
 			delete dgt256s;
 
 			Stress(dgt512s);
 			OnProgress(std::string("SkeinTest: Passed Skein-512 sequential stress tests.."));
+			Pointer(dgt512s);
+			OnProgress(std::string("SkeinTest: Passed Skein-512 sequential pointer update and finalize tests.."));
+			Midstate(dgt512s);
+			OnProgress(std::string("SkeinTest: Passed Skein-512 sequential midstate serialization tests.."));
 			delete dgt512s;
 
 			Stress(dgt1024s);
 			OnProgress(std::string("SkeinTest: Passed Skein-1024 sequential stress tests.."));
+			Pointer(dgt1024s);
+			OnProgress(std::string("SkeinTest: Passed Skein-1024 sequential pointer update and finalize tests.."));
+			Midstate(dgt1024s);
+			OnProgress(std::string("SkeinTest: Passed Skein-1024 sequential midstate serialization tests.."));
 			delete dgt1024s;
 
 			Skein256* dgt256p = new Skein256(true);
 			Stress(dgt256p);
 			OnProgress(std::string("SkeinTest: Passed Skein-256 parallel stress tests.."));
+			Pointer(dgt256p);
+			OnProgress(std::string("SkeinTest: Passed Skein-256 parallel pointer update and finalize tests.."));
+			Midstate(dgt256p);
+			OnProgress(std::string("SkeinTest: Passed Skein-256 parallel midstate serialization tests.."));
 
 			Skein512* dgt512p = new Skein512(true);
 			Stress(dgt512p);
 			OnProgress(std::string("SkeinTest: Passed Skein-512 parallel stress tests.."));
+			Pointer(dgt512p);
+			OnProgress(std::string("SkeinTest: Passed Skein-512 parallel pointer update and finalize tests.."));
+			Midstate(dgt512p);
+			OnProgress(std::string("SkeinTest: Passed Skein-512 parallel midstate serialization tests.."));
 
 			Skein1024* dgt1024p = new Skein1024(true);
 			Stress(dgt1024p);
 			OnProgress(std::string("SkeinTest: Passed Skein-1024 parallel stress tests.."));
+			Pointer(dgt1024p);
+			OnProgress(std::string("SkeinTest: Passed Skein-1024 parallel pointer update and finalize tests.."));
+			Midstate(dgt1024p);
+			OnProgress(std::string("SkeinTest: Passed Skein-1024 parallel midstate serialization tests.."));
 
 			Parallel(dgt256p);
 			OnProgress(std::string("SkeinTest: Passed Skein-256 parallel integrity tests.."));
+			Pointer(dgt256p);
+			OnProgress(std::string("SkeinTest: Passed Skein-256 parallel pointer update and finalize tests.."));
 			delete dgt256p;
 
 			Parallel(dgt512p);
@@ -285,6 +311,67 @@ namespace Test
 		}
 	}
 
+	void SkeinTest::Midstate(IDigest* Digest)
+	{
+		const uint MINPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize());
+		const uint MAXPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize() * 4);
+
+		std::vector<byte> code1(Digest->DigestSize());
+		std::vector<byte> code2(Digest->DigestSize());
+		std::vector<byte> msg;
+		SecureVector<byte> state;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < TEST_CYCLES; ++i)
+		{
+			const size_t INPLEN = static_cast<size_t>(rnd.NextUInt32(MAXPRL, MINPRL));
+			const size_t PRELEN = static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(INPLEN), 1));
+
+			msg.resize(INPLEN);
+			rnd.Generate(msg, 0, msg.size());
+
+			try
+			{
+				Digest->Compute(msg, code1);
+				// save the state after the prefix, then overwrite it
+				Digest->Update(msg, 0, PRELEN);
+				state = Digest->Serialize();
+				Digest->Update(msg, 0, msg.size());
+				// restore the state and finish the message
+				Digest->DeSerialize(state);
+				Digest->Update(msg, PRELEN, msg.size() - PRELEN);
+				Digest->Finalize(code2, 0);
+			}
+			catch (const std::exception&)
+			{
+				throw TestException(std::string("Midstate"), Digest->Name(), std::string("The digest has thrown an exception! -NM1"));
+			}
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Midstate"), Digest->Name(), std::string("Hash output is not equal! -NM2"));
+			}
+		}
+
+		// a truncated state must be rejected
+		try
+		{
+			state = Digest->Serialize();
+			state.resize(state.size() - 1);
+			Digest->DeSerialize(state);
+
+			throw TestException(std::string("Midstate"), Digest->Name(), std::string("Exception handling failure! -NM3"));
+		}
+		catch (CryptoDigestException const &)
+		{
+		}
+		catch (TestException const &)
+		{
+			throw;
+		}
+	}
+
 	void SkeinTest::Parallel(IDigest* Digest)
 	{
 		const size_t MINSMP = 2048;
@@ -370,6 +457,62 @@ namespace Test
 		}
 	}
 
+	void SkeinTest::Pointer(IDigest* Digest)
+	{
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Digest->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> code1(Digest->DigestSize());
+		std::vector<byte> code2(Digest->DigestSize());
+		std::vector<byte> msg;
+		std::vector<size_t> seg;
+		SecureRandom rnd;
+		size_t i;
+		size_t j;
+		size_t moff;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			msg.resize(MSGLEN[i]);
+			rnd.Generate(msg, 0, msg.size());
+
+			// uneven segments exercise the input buffering
+			seg.clear();
+			moff = 0;
+
+			while (moff != msg.size())
+			{
+				seg.push_back(IntegerTools::Min(static_cast<size_t>(rnd.NextUInt32(static_cast<uint>(Digest->BlockSize() * 3), 1)), msg.size() - moff));
+				moff += seg.back();
+			}
+
+			// the vector functions are the reference
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Digest->Update(msg, moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Digest->Finalize(code1, 0);
+
+			moff = 0;
+
+			for (j = 0; j < seg.size(); ++j)
+			{
+				Digest->Update(msg.data() + moff, seg[j]);
+				moff += seg[j];
+			}
+
+			Digest->Finalize(code2.data());
+
+			if (code1 != code2)
+			{
+				throw TestException(std::string("Pointer"), Digest->Name(), std::string("The pointer hash output is not equal! -SX1"));
+			}
+		}
+	}
+
 	void SkeinTest::Stress(IDigest* Digest)
 	{
 		const uint MINPRL = static_cast<uint>(Digest->ParallelProfile().ParallelBlockSize());
@@ -74,6 +74,13 @@ namespace Test
 		/// <param name="Expected">The expected output vector</param>
 		void Kat(IDigest* Digest, std::vector<byte> &Input, std::vector<byte> &Expected);
 
+		/// <summary>
+		/// Compare the output of a message hashed in two parts, with the state serialized and restored between the parts, to the output of a single pass
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		void Midstate(IDigest* Digest);
+
 		/// <summary>
 		/// Compares synchronous to parallel random-sized, pseudo-random arrays in a looping [TEST_CYCLES] stress-test
 		/// </summary>
@@ -91,6 +98,13 @@ namespace Test
 		/// </summary>
 		void PermutationR80();
 
+		/// <summary>
+		/// Compare the pointer Update and Finalize functions with the vector functions over the same uneven input segments
+		/// </summary>
+		/// 
+		/// <param name="Digest">The digest instance pointer</param>
+		void Pointer(IDigest* Digest);
+
 		/// <summary>
 		/// Test behavior parallel and sequential processing in a looping [TEST_CYCLES] stress-test using randomly sized input and data
 		/// </summary>
@@ -121,6 +121,10 @@ namespace Test
 			Stress(tsx256s);
 			OnProgress(std::string("ThreefishTest: Passed Threefish-256 stress tests.."));
 
+			Pointer(tsx256s);
+			Pointer(tsx256a);
+			OnProgress(std::string("ThreefishTest: Passed Threefish-256 pointer and in-place transform tests.."));
+
 			// verify ciphertext output, decryption, and mac code generation
 			Verification(tsx256a, m_message[0], m_key[0], m_nonce[0], m_expected[0], m_code[0]);
 			OnProgress(std::string("ThreefishTest: Passed Threefish-256 known answer authentication tests.."));
@@ -157,6 +161,10 @@ namespace Test
 			Stress(tsx512s);
 			OnProgress(std::string("ThreefishTest: Passed Threefish-512 stress tests.."));
 
+			Pointer(tsx512s);
+			Pointer(tsx512a);
+			OnProgress(std::string("ThreefishTest: Passed Threefish-512 pointer and in-place transform tests.."));
+
 			Verification(tsx512a, m_message[1], m_key[1], m_nonce[1], m_expected[2], m_code[2]);
 			OnProgress(std::string("ThreefishTest: Passed Threefish-512 known answer authentication tests.."));
 
@@ -192,6 +200,10 @@ namespace Test
 			Stress(tsx1024s);
 			OnProgress(std::string("ThreefishTest: Passed Threefish-1024 stress tests.."));
 
+			Pointer(tsx1024s);
+			Pointer(tsx1024a);
+			OnProgress(std::string("ThreefishTest: Passed Threefish-1024 pointer and in-place transform tests.."));
+
 			Verification(tsx1024a, m_message[2], m_key[2], m_nonce[2], m_expected[4], m_code[4]);
 			OnProgress(std::string("ThreefishTest: Passed Threefish-1024 known answer authentication tests.."));
 
@@ -721,6 +733,75 @@ namespace Test
 		}
 	}
 
+	void ThreefishTest::Pointer(IStreamCipher* Cipher)
+	{
+		Cipher::SymmetricKeySize ks = Cipher->LegalKeySizes()[0];
+		// the authenticated variants append the tag to the cipher-text
+		const size_t TAGLEN = Cipher->IsAuthenticator() ? Cipher->TagSize() : 0;
+		// a partial block, and a message spanning the parallel block size
+		const std::vector<size_t> MSGLEN = { 100, Cipher->ParallelProfile().ParallelBlockSize() + 100 };
+		std::vector<byte> cpt;
+		std::vector<byte> exp;
+		std::vector<byte> inp;
+		std::vector<byte> key(ks.KeySize());
+		std::vector<byte> nonce(ks.IVSize());
+		std::vector<byte> otp;
+		SecureRandom rnd;
+		size_t i;
+
+		for (i = 0; i < MSGLEN.size(); ++i)
+		{
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			exp.resize(MSGLEN[i] + TAGLEN);
+			inp.resize(MSGLEN[i]);
+			otp.resize(MSGLEN[i]);
+
+			rnd.Generate(key, 0, key.size());
+			rnd.Generate(inp, 0, inp.size());
+			rnd.Generate(nonce, 0, nonce.size());
+			SymmetricKey kp(key, nonce);
+
+			// the vector transform is the reference
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp, 0, exp, 0, inp.size());
+
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(inp.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer encryption output is not equal! -TX1"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), otp.data(), otp.size());
+
+			if (otp != inp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The pointer decryption output is not equal! -TX2"));
+			}
+
+			// in-place, the buffer holds the message and the tag
+			cpt = inp;
+			cpt.resize(MSGLEN[i] + TAGLEN);
+			Cipher->Initialize(true, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (cpt != exp)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place encryption output is not equal! -TX3"));
+			}
+
+			Cipher->Initialize(false, kp);
+			Cipher->Transform(cpt.data(), cpt.data(), inp.size());
+
+			if (IntegerTools::Compare(cpt, 0, inp, 0, inp.size()) == false)
+			{
+				throw TestException(std::string("Pointer"), Cipher->Name(), std::string("The in-place decryption output is not equal! -TX4"));
+			}
+		}
+	}
+
 	void ThreefishTest::Stress(IStreamCipher* Cipher)
 	{
 		const uint MINPRL = static_cast<uint>(Cipher->ParallelProfile().ParallelBlockSize());
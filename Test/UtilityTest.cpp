@@ -1,10 +1,14 @@
  #include "UtilityTest.h"
+#include "../CEX/CpuDetect.h"
 #include "../CEX/SecureRandom.h"
 #include "../CEX/IntegerTools.h"
+#include "../CEX/ParallelTools.h"
+#include <thread>
 
 namespace Test
 {
 	using Tools::IntegerTools;
+	using Tools::ParallelTools;
 
 	const std::string UtilityTest::CLASSNAME = "UtilityTest";
 	const std::string UtilityTest::DESCRIPTION = "Utility test; tests various math helper functions.";
@@ -38,6 +42,8 @@ namespace Test
 			OnProgress(std::string("UtilityTest: Passed endian conversion tests.."));
 			CounterTest();
 			OnProgress(std::string("UtilityTest: Passed endian counter tests.."));
+			CpuLimits();
+			OnProgress(std::string("UtilityTest: Passed processor list and quota parsing tests.."));
 			//Operations();
 			//OnProgress(std::string("UtilityTest: Passed mathematical operations tests.."));
 			Rotation();
@@ -359,6 +365,64 @@ namespace Test
 		}
 	}
 
+	void UtilityTest::CpuLimits()
+	{
+		// cpuset lists; indices, ranges, white space, and malformed entries
+		const std::vector<std::pair<std::string, size_t>> LISTS =
+		{
+			{ "0-3,8,10-11", 7 },
+			{ "0", 1 },
+			{ "", 0 },
+			{ "0-63", 64 },
+			{ "2,4,6,8", 4 },
+			{ " 0-1 , 4 ", 3 },
+			{ "5-2", 0 },
+			{ "0-3,x-1,7", 5 },
+			{ "1--3,9", 1 },
+			{ "-3", 0 }
+		};
+		// cpu.max fields (v2) and cfs quota and period (v1)
+		const std::vector<std::pair<std::pair<std::string, std::string>, size_t>> QUOTAS =
+		{
+			{ { "max", "100000" }, 0 },
+			{ { "-1", "100000" }, 0 },
+			{ { "150000", "100000" }, 2 },
+			{ { "100000", "100000" }, 1 },
+			{ { "50000", "100000" }, 1 },
+			{ { "400000", "100000" }, 4 },
+			{ { "100000", "0" }, 0 },
+			{ { "0", "100000" }, 0 },
+			{ { "", "" }, 0 },
+			{ { "99999999999999999999999", "100000" }, 0 }
+		};
+		size_t i;
+
+		for (i = 0; i < LISTS.size(); ++i)
+		{
+			if (CpuDetect::ParseCpuList(LISTS[i].first) != LISTS[i].second)
+			{
+				throw TestException(std::string("CpuLimits"), std::string("ParseCpuList"), std::string("The cpu list count is invalid!"));
+			}
+		}
+
+		for (i = 0; i < QUOTAS.size(); ++i)
+		{
+			if (CpuDetect::ParseCpuQuota(QUOTAS[i].first.first, QUOTAS[i].first.second) != QUOTAS[i].second)
+			{
+				throw TestException(std::string("CpuLimits"), std::string("ParseCpuQuota"), std::string("The cpu quota count is invalid!"));
+			}
+		}
+
+		// the available count is at least one, never more than the host has, and is cached
+		const size_t HSTCNT = (std::thread::hardware_concurrency() != 0) ? static_cast<size_t>(std::thread::hardware_concurrency()) : 1;
+		const size_t AVLCNT = CpuDetect::AvailableCores(true);
+
+		if (AVLCNT == 0 || AVLCNT > HSTCNT || CpuDetect::AvailableCores() != AVLCNT || ParallelTools::ProcessorCount() != AVLCNT)
+		{
+			throw TestException(std::string("CpuLimits"), std::string("AvailableCores"), std::string("The available processor count is invalid!"));
+		}
+	}
+
 	void UtilityTest::Operations()
 	{
 		// TODO: complete this once library is stable
@@ -61,6 +61,7 @@ namespace Test
 
 		void Conversions();
 		void CounterTest();
+		void CpuLimits();
 		void Rotation();
 		void Operations();
 		void OnProgress(const std::string &Data);